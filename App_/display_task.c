@@ -2,8 +2,16 @@
 #include "ui_render.h"
 #include "project_defines.h"
 #include "lcd_driver.h"
+#include "fast_boot.h"
+#include "notify_client.h"
+#include "event_bus.h"
 #include "cmsis_os.h"
+#include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+
+/* 推送信息每行的字符数，字符宽8像素，左边留4像素 */
+#define NOTIFY_ROW_CHARS    ((LCD_WIDTH - 8) / 8)
 
 /* 私有变量 */
 static WeatherData current_weather;
@@ -11,64 +19,113 @@ static TimeData current_time;
 static bool weather_updated = false;
 static bool time_updated = false;
 static uint32_t last_refresh_time = 0;
+static bool lcd_initialized = false;
+static bool weather_stale = false;
+static bool weather_restored = false;
+
+/* 私有函数原型 */
+static void RenderStaleIndicator(void);
+static void RenderNotifications(const NotifyState *state);
+static void RenderNotificationRow(uint16_t y, const char *text, uint16_t color);
+
+/* 启动时显示缓存数据，在调度器启动前调用；首帧总是标记为过期 */
+void DisplayShowSnapshot(const WeatherData *weather, const TimeData *time,
+                         bool restored) {
+    if (!lcd_initialized) {
+        LCD_Init();
+        LCD_SetBrightness(ui_config.brightness);
+        lcd_initialized = true;
+    }
+    LCD_Clear(COLOR_BLACK);
+
+    current_weather = *weather;
+    current_time = *time;
+    weather_stale = true;
+    weather_restored = restored;
+
+    RenderDisplay(&current_time, &current_weather, &ui_config, &system_status);
+    if (weather_stale) {
+        RenderStaleIndicator();
+    }
+}
 
 /* 显示任务 */
 void DisplayTask(void *argument) {
-    EventType event;
+    uint32_t events;
+    uint32_t flags;
     TickType_t last_wake_time;
+    NotifyState notify;
 
     DEBUG_PRINT("Display Task Started");
 
-    /* 初始化LCD显示屏 */
-    LCD_Init();
-    LCD_Clear(COLOR_BLACK);
+    /* 初始化LCD显示屏(快速启动时已在首帧完成) */
+    if (!lcd_initialized) {
+        LCD_Init();
+        LCD_Clear(COLOR_BLACK);
+        lcd_initialized = true;
+    }
 
     last_wake_time = xTaskGetTickCount();
 
     while (1) {
-        /* 检查是否有新的事件 */
-        if (osMessageQueueGet(eventQueueHandle, &event, 0, 0) == osOK) {
-            switch (event) {
-                case EVENT_WEATHER_UPDATE:
-                    weather_updated = true;
-                    break;
-
-                case EVENT_TIME_UPDATE:
-                    time_updated = true;
-                    break;
-
-                case EVENT_MODE_CHANGE:
-                    RenderModeChange(ui_config.current_mode);
-                    break;
-
-                default:
-                    break;
-            }
+        /* 取走所有待处理事件，同类事件已在总线中合并 */
+        events = EventBus_Fetch(EVENT_SUBSCRIBER_DISPLAY);
+        if (events & EVENT_BIT(EVENT_WEATHER_UPDATE)) {
+            weather_updated = true;
+        }
+        if (events & EVENT_BIT(EVENT_TIME_UPDATE)) {
+            time_updated = true;
+        }
+        if (events & EVENT_BIT(EVENT_MODE_CHANGE)) {
+            RenderModeChange(ui_config.current_mode);
         }
 
-        /* 获取最新的天气数据 */
+        /* 获取最新的天气数据，合并的事件对应多条数据时只保留最新一条 */
         if (weather_updated) {
             WeatherData new_weather;
-            if (osMessageQueueGet(weatherQueueHandle, &new_weather, 0, 0) == osOK) {
+            while (osMessageQueueGet(weatherQueueHandle, &new_weather, 0, 0) == osOK) {
                 current_weather = new_weather;
                 weather_updated = false;
+                weather_stale = false;
             }
         }
 
         /* 获取最新的时间数据 */
         if (time_updated) {
             TimeData new_time;
-            if (osMessageQueueGet(timeQueueHandle, &new_time, 0, 0) == osOK) {
+            while (osMessageQueueGet(timeQueueHandle, &new_time, 0, 0) == osOK) {
                 current_time = new_time;
                 time_updated = false;
             }
+            if (!time_updated) {
+                FastBoot_SaveTime(&current_time);
+            }
         }
 
         /* 根据当前模式渲染显示 */
         RenderDisplay(&current_time, &current_weather, &ui_config, &system_status);
+        if (weather_stale) {
+            RenderStaleIndicator();
+        }
 
-        /* 等待下一次刷新 */
-        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(ui_config.refresh_interval));
+        /* 显示推送的天气状况、空气质量和告警 */
+        bool notify_pending = NotifyClient_GetState(&notify);
+        RenderNotifications(&notify);
+        if (notify_pending) {
+            NotifyClient_MarkRendered();
+        }
+
+        /* 等待下一次刷新，收到事件或推送时提前唤醒 */
+        TickType_t next_wake_time = last_wake_time + pdMS_TO_TICKS(ui_config.refresh_interval);
+        TickType_t now = xTaskGetTickCount();
+        if ((int32_t)(next_wake_time - now) > 0) {
+            flags = osThreadFlagsWait(DISPLAY_FLAG_NOTIFY | EVENT_BUS_THREAD_FLAG,
+                                      osFlagsWaitAny, next_wake_time - now);
+            if (!(flags & osFlagsError)) {
+                continue;
+            }
+        }
+        last_wake_time = next_wake_time;
     }
 }
 
@@ -77,8 +134,7 @@ void ChangeDisplayMode(DisplayMode new_mode) {
     if (new_mode < DISPLAY_MODE_COUNT) {
         ui_config.current_mode = new_mode;
 
-        EventType event = EVENT_MODE_CHANGE;
-        osMessageQueuePut(eventQueueHandle, &event, 0, 0);
+        EventBus_Publish(EVENT_MODE_CHANGE);
     }
 }
 
@@ -106,4 +162,67 @@ void ToggleTimeFormat(void) {
     } else {
         ui_config.time_format = TIME_FORMAT_24H;
     }
-}
\ No newline at end of file
+}
+
+/* 在右上角绘制缓存数据标记，直到收到ESP32的新数据；没有快照时显示占位标记 */
+static void RenderStaleIndicator(void) {
+    if (weather_restored) {
+        LCD_DrawString(LCD_WIDTH - 56, 4, "CACHED", COLOR_YELLOW, COLOR_BLACK);
+    } else {
+        LCD_DrawString(LCD_WIDTH - 64, 4, "NO DATA", COLOR_YELLOW, COLOR_BLACK);
+    }
+}
+
+/* 在底部显示天气状况、空气质量和告警 */
+static void RenderNotifications(const NotifyState *state) {
+    static const char *condition_names[NOTIFY_CONDITION_COUNT] = {
+        "UNKNOWN", "CLEAR", "CLOUDY", "RAIN", "DRIZZLE",
+        "STORM", "SNOW", "FOG", "WIND"
+    };
+    static const char *alert_names[ALERT_ID_COUNT] = {
+        "AIR POOR", "HEAT", "COLD", "WIND"
+    };
+    char text[32];
+    const char *alert = "";
+
+    if (state->condition_valid) {
+        int32_t temperature = state->temperature_x10;
+        uint8_t condition = state->condition;
+        char unit = 'C';
+
+        if (ui_config.temp_unit == TEMP_UNIT_FAHRENHEIT) {
+            temperature = temperature * 9 / 5 + 320;
+            unit = 'F';
+        }
+        if (condition >= NOTIFY_CONDITION_COUNT) {
+            condition = NOTIFY_CONDITION_UNKNOWN;
+        }
+        snprintf(text, sizeof(text), "%s %s%ld.%ld%c %d%%", condition_names[condition],
+                 temperature < 0 ? "-" : "", (long)(labs(temperature) / 10),
+                 (long)(labs(temperature) % 10), unit, state->humidity);
+        RenderNotificationRow(LCD_HEIGHT - 54, text, COLOR_WHITE);
+    }
+
+    if (state->aqi_valid) {
+        snprintf(text, sizeof(text), "AQI %d PM2.5 %d", state->aqi,
+                 state->pm2_5_x10 / 10);
+        RenderNotificationRow(LCD_HEIGHT - 36, text, COLOR_WHITE);
+    }
+
+    /* 只显示编号最小的告警，全部解除时清空这一行 */
+    for (uint8_t i = 0; i < ALERT_ID_COUNT; i++) {
+        if (state->active_alerts & (1U << i)) {
+            alert = alert_names[i];
+            break;
+        }
+    }
+    RenderNotificationRow(LCD_HEIGHT - 18, alert, COLOR_RED);
+}
+
+/* 绘制一行推送信息，补空格到整行宽度以覆盖上一次较长的内容 */
+static void RenderNotificationRow(uint16_t y, const char *text, uint16_t color) {
+    char row[NOTIFY_ROW_CHARS + 1];
+
+    snprintf(row, sizeof(row), "%-*s", NOTIFY_ROW_CHARS, text);
+    LCD_DrawString(4, y, row, color, COLOR_BLACK);
+}
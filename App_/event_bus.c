@@ -0,0 +1,124 @@
+#include "event_bus.h"
+#include "main.h"
+#include <string.h>
+
+/* 订阅者 */
+typedef struct {
+    osThreadId_t thread;
+    uint32_t filter;
+    volatile uint32_t pending;
+    volatile uint32_t published;
+    volatile uint32_t coalesced;
+    volatile uint32_t signals;
+} EventSubscriber;
+
+/* 私有变量 */
+static EventSubscriber subscribers[EVENT_SUBSCRIBER_COUNT];
+static volatile uint32_t overflow_count = 0;
+
+/* 基于LDREX/STREX的原子操作，任务和中断中都可以使用且不关中断 */
+static inline uint32_t AtomicFetchOr(volatile uint32_t *target, uint32_t value) {
+    uint32_t old;
+    do {
+        old = __LDREXW(target);
+    } while (__STREXW(old | value, target) != 0U);
+    return old;
+}
+
+static inline uint32_t AtomicExchange(volatile uint32_t *target, uint32_t value) {
+    uint32_t old;
+    do {
+        old = __LDREXW(target);
+    } while (__STREXW(value, target) != 0U);
+    return old;
+}
+
+static inline void AtomicIncrement(volatile uint32_t *target) {
+    uint32_t old;
+    do {
+        old = __LDREXW(target);
+    } while (__STREXW(old + 1U, target) != 0U);
+}
+
+/* 初始化事件总线 */
+void EventBus_Init(void) {
+    memset((void *)subscribers, 0, sizeof(subscribers));
+    overflow_count = 0;
+}
+
+/* 注册订阅者，filter为关心的事件位图 */
+bool EventBus_Subscribe(EventSubscriberId id, osThreadId_t thread, uint32_t filter) {
+    if (id >= EVENT_SUBSCRIBER_COUNT || thread == NULL) {
+        return false;
+    }
+
+    subscribers[id].filter = filter;
+    subscribers[id].thread = thread;
+    return true;
+}
+
+/*
+ * 发布事件。每个订阅者的待处理事件是一个位图，
+ * 重复事件在被取走前自动合并，因此不会因队列满而丢失。
+ * 只在位图由空变为非空时唤醒订阅线程。
+ */
+bool EventBus_Publish(EventType event) {
+    uint32_t bit;
+    bool delivered = false;
+
+    if ((uint32_t)event >= EVENT_BUS_MAX_EVENTS) {
+        AtomicIncrement(&overflow_count);
+        return false;
+    }
+
+    bit = EVENT_BIT(event);
+
+    for (uint8_t i = 0; i < EVENT_SUBSCRIBER_COUNT; i++) {
+        EventSubscriber *subscriber = &subscribers[i];
+        uint32_t old;
+
+        if (subscriber->thread == NULL || !(subscriber->filter & bit)) {
+            continue;
+        }
+
+        old = AtomicFetchOr(&subscriber->pending, bit);
+        AtomicIncrement(&subscriber->published);
+        delivered = true;
+
+        if (old & bit) {
+            AtomicIncrement(&subscriber->coalesced);
+        }
+
+        if (old == 0U) {
+            AtomicIncrement(&subscriber->signals);
+            osThreadFlagsSet(subscriber->thread, EVENT_BUS_THREAD_FLAG);
+        }
+    }
+
+    return delivered;
+}
+
+/* 取走订阅者所有待处理事件，返回事件位图 */
+uint32_t EventBus_Fetch(EventSubscriberId id) {
+    if (id >= EVENT_SUBSCRIBER_COUNT) {
+        return 0;
+    }
+
+    return AtomicExchange(&subscribers[id].pending, 0U);
+}
+
+/* 获取订阅者统计 */
+void EventBus_GetStats(EventSubscriberId id, EventBusStats *stats) {
+    if (id >= EVENT_SUBSCRIBER_COUNT || stats == NULL) {
+        return;
+    }
+
+    stats->published = subscribers[id].published;
+    stats->coalesced = subscribers[id].coalesced;
+    stats->signals = subscribers[id].signals;
+}
+
+/* 获取无法表示的事件数(EventType超出位图范围) */
+uint32_t EventBus_GetOverflowCount(void) {
+    return overflow_count;
+}
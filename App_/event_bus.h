@@ -0,0 +1,45 @@
+#ifndef __EVENT_BUS_H
+#define __EVENT_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cmsis_os.h"
+#include "project_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 订阅者编号 */
+typedef enum {
+    EVENT_SUBSCRIBER_DISPLAY = 0,
+    EVENT_SUBSCRIBER_COUNT
+} EventSubscriberId;
+
+/* 事件位图，每种EventType占一位 */
+#define EVENT_BIT(event)        (1UL << (uint32_t)(event))
+#define EVENT_BUS_MAX_EVENTS    32U
+
+/* 有新事件时设置给订阅线程的标志 */
+#define EVENT_BUS_THREAD_FLAG   0x0100U
+
+/* 订阅者统计 */
+typedef struct {
+    uint32_t published;     /* 投递到该订阅者的事件数 */
+    uint32_t coalesced;     /* 与未处理的同类事件合并的次数 */
+    uint32_t signals;       /* 唤醒订阅线程的次数 */
+} EventBusStats;
+
+/* 函数声明 */
+void EventBus_Init(void);
+bool EventBus_Subscribe(EventSubscriberId id, osThreadId_t thread, uint32_t filter);
+bool EventBus_Publish(EventType event);
+uint32_t EventBus_Fetch(EventSubscriberId id);
+void EventBus_GetStats(EventSubscriberId id, EventBusStats *stats);
+uint32_t EventBus_GetOverflowCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EVENT_BUS_H */
@@ -0,0 +1,197 @@
+#include "fast_boot.h"
+#include "main.h"
+#include "cmsis_os.h"
+#include <stddef.h>
+#include <string.h>
+
+/* 快照放在备份SRAM起始处(STM32F407共4KB，VBAT供电时复位不丢失) */
+#define FAST_BOOT_SNAPSHOT  ((volatile FastBootSnapshot *)BKPSRAM_BASE)
+
+/* 启动跟踪 */
+static BootTraceEntry boot_trace[FAST_BOOT_TRACE_MAX];
+static uint8_t boot_trace_count = 0;
+static uint32_t boot_trace_last_cycles = 0;
+static uint32_t boot_trace_cycles_per_us = 1;
+static uint32_t boot_trace_elapsed_us = 0;
+
+/* 备份SRAM是否可用 */
+static bool backup_ready = false;
+
+/* 私有函数原型 */
+static uint32_t CalculateSnapshotCRC(const FastBootSnapshot *snapshot);
+static bool SnapshotIsValid(const FastBootSnapshot *snapshot);
+static void CommitSnapshot(FastBootSnapshot *snapshot);
+
+/* 初始化启动跟踪，使用DWT周期计数器作为时间基准 */
+void FastBoot_TraceInit(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    boot_trace_count = 0;
+    boot_trace_last_cycles = 0;
+    boot_trace_elapsed_us = 0;
+    boot_trace_cycles_per_us = 1;
+
+    FastBoot_TraceMark("reset");
+}
+
+/* 记录一个启动阶段 */
+void FastBoot_TraceMark(const char *phase) {
+    uint32_t cycles = DWT->CYCCNT;
+
+    /* 系统时钟切换前后频率不同，按增量累加以保持时间连续。
+       时钟只在阶段末尾切换(如SystemClock_Config)，增量按上一个标记时的频率换算 */
+    boot_trace_elapsed_us += (cycles - boot_trace_last_cycles) / boot_trace_cycles_per_us;
+    boot_trace_last_cycles = cycles;
+
+    boot_trace_cycles_per_us = SystemCoreClock / 1000000U;
+    if (boot_trace_cycles_per_us == 0) {
+        boot_trace_cycles_per_us = 1;
+    }
+
+    if (boot_trace_count < FAST_BOOT_TRACE_MAX) {
+        boot_trace[boot_trace_count].phase = phase;
+        boot_trace[boot_trace_count].timestamp_us = boot_trace_elapsed_us;
+        boot_trace_count++;
+    }
+}
+
+/* 获取启动跟踪记录 */
+uint8_t FastBoot_GetTrace(const BootTraceEntry **entries) {
+    if (entries) {
+        *entries = boot_trace;
+    }
+    return boot_trace_count;
+}
+
+/* 打印启动跟踪 */
+void FastBoot_PrintTrace(void) {
+    uint32_t previous_us = 0;
+
+    DEBUG_PRINT("Boot trace (%d phases):", boot_trace_count);
+    for (uint8_t i = 0; i < boot_trace_count; i++) {
+        DEBUG_PRINT("  %-16s %8lu us (+%lu us)",
+                    boot_trace[i].phase,
+                    (unsigned long)boot_trace[i].timestamp_us,
+                    (unsigned long)(boot_trace[i].timestamp_us - previous_us));
+        previous_us = boot_trace[i].timestamp_us;
+    }
+}
+
+/* 使能备份SRAM访问 */
+void FastBoot_BackupInit(void) {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+    __HAL_RCC_BKPSRAM_CLK_ENABLE();
+
+    /* 打开备份调节器，VBAT供电时保持备份SRAM内容 */
+    if (HAL_PWREx_EnableBkUpReg() == HAL_OK) {
+        backup_ready = true;
+    }
+}
+
+/* 从备份SRAM恢复上一次的有效数据 */
+bool FastBoot_Restore(WeatherData *weather, TimeData *time) {
+    FastBootSnapshot snapshot;
+
+    if (!backup_ready) {
+        return false;
+    }
+
+    memcpy(&snapshot, (const void *)FAST_BOOT_SNAPSHOT, sizeof(snapshot));
+    if (!SnapshotIsValid(&snapshot)) {
+        return false;
+    }
+
+    if (weather && snapshot.weather_valid) {
+        *weather = snapshot.weather;
+    }
+
+    if (time && snapshot.time_valid) {
+        *time = snapshot.time;
+    }
+
+    return snapshot.weather_valid;
+}
+
+/* 保存最新的天气数据 */
+void FastBoot_SaveWeather(const WeatherData *weather) {
+    FastBootSnapshot snapshot;
+
+    if (!backup_ready || !weather) {
+        return;
+    }
+
+    /* 串口任务和显示任务都会写快照，读-改-写和CRC必须一次完成 */
+    taskENTER_CRITICAL();
+    memcpy(&snapshot, (const void *)FAST_BOOT_SNAPSHOT, sizeof(snapshot));
+    if (!SnapshotIsValid(&snapshot)) {
+        memset(&snapshot, 0, sizeof(snapshot));
+    }
+
+    snapshot.weather = *weather;
+    snapshot.weather_valid = true;
+    CommitSnapshot(&snapshot);
+    taskEXIT_CRITICAL();
+}
+
+/* 保存最新的时间数据 */
+void FastBoot_SaveTime(const TimeData *time) {
+    FastBootSnapshot snapshot;
+
+    if (!backup_ready || !time) {
+        return;
+    }
+
+    /* 串口任务和显示任务都会写快照，读-改-写和CRC必须一次完成 */
+    taskENTER_CRITICAL();
+    memcpy(&snapshot, (const void *)FAST_BOOT_SNAPSHOT, sizeof(snapshot));
+    if (!SnapshotIsValid(&snapshot)) {
+        memset(&snapshot, 0, sizeof(snapshot));
+    }
+
+    snapshot.time = *time;
+    snapshot.time_valid = true;
+    CommitSnapshot(&snapshot);
+    taskEXIT_CRITICAL();
+}
+
+/* 写回快照，CRC最后写入，掉电时旧快照会因CRC不匹配被丢弃，调用者需持有临界区 */
+static void CommitSnapshot(FastBootSnapshot *snapshot) {
+    snapshot->magic = FAST_BOOT_MAGIC;
+    snapshot->version = FAST_BOOT_VERSION;
+    snapshot->sequence++;
+    snapshot->crc = CalculateSnapshotCRC(snapshot);
+
+    memcpy((void *)FAST_BOOT_SNAPSHOT, snapshot, sizeof(*snapshot));
+}
+
+/* 检查快照是否有效 */
+static bool SnapshotIsValid(const FastBootSnapshot *snapshot) {
+    if (snapshot->magic != FAST_BOOT_MAGIC) {
+        return false;
+    }
+
+    if (snapshot->version != FAST_BOOT_VERSION) {
+        return false;
+    }
+
+    return CalculateSnapshotCRC(snapshot) == snapshot->crc;
+}
+
+/* 计算快照CRC32(不含crc字段本身) */
+static uint32_t CalculateSnapshotCRC(const FastBootSnapshot *snapshot) {
+    const uint8_t *data = (const uint8_t *)snapshot;
+    uint32_t length = offsetof(FastBootSnapshot, crc);
+    uint32_t crc = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,56 @@
+#ifndef __FAST_BOOT_H
+#define __FAST_BOOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "project_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 快照魔数与版本，结构体布局变化时需递增版本号 */
+#define FAST_BOOT_MAGIC             0x57534E50U  /* "WSNP" */
+#define FAST_BOOT_VERSION           1U
+
+/* 启动跟踪最多记录的阶段数 */
+#define FAST_BOOT_TRACE_MAX         16
+
+/* 启动阶段时间戳 */
+typedef struct {
+    const char *phase;
+    uint32_t timestamp_us;
+} BootTraceEntry;
+
+/* 保存在备份SRAM中的最近一次有效数据 */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sequence;
+    bool weather_valid;
+    bool time_valid;
+    WeatherData weather;
+    TimeData time;
+    uint32_t crc;
+} FastBootSnapshot;
+
+/* 函数声明 */
+void FastBoot_TraceInit(void);
+void FastBoot_TraceMark(const char *phase);
+uint8_t FastBoot_GetTrace(const BootTraceEntry **entries);
+void FastBoot_PrintTrace(void);
+
+void FastBoot_BackupInit(void);
+bool FastBoot_Restore(WeatherData *weather, TimeData *time);
+void FastBoot_SaveWeather(const WeatherData *weather);
+void FastBoot_SaveTime(const TimeData *time);
+
+/* 首帧显示，由display_task.c实现；restored表示数据来自快照而不是全零 */
+void DisplayShowSnapshot(const WeatherData *weather, const TimeData *time,
+                         bool restored);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FAST_BOOT_H */
@@ -0,0 +1,116 @@
+#include "notify_client.h"
+#include "cmsis_os.h"
+#include <string.h>
+
+extern osThreadId_t displayTaskHandle;
+
+/* 私有变量 */
+static NotifyState notify_state;
+static bool notify_pending = false;
+/* 每收到一帧加一，用来判断显示的是否是最新状态 */
+static uint32_t notify_generation = 0;
+static uint32_t rendering_generation = 0;
+
+/* 私有函数原型 */
+static int16_t GetInt16(const uint8_t *buffer);
+
+/* 解析推送帧: 主题 + 序号 + 负载，成功后唤醒显示任务 */
+bool NotifyClient_HandleFrame(const uint8_t *data, uint8_t length,
+                              uint8_t *topic, uint8_t *seq) {
+    const uint8_t *payload = &data[2];
+    uint8_t payload_length;
+
+    if (length < 2) {
+        return false;
+    }
+
+    *topic = data[0];
+    *seq = data[1];
+    payload_length = length - 2;
+
+    taskENTER_CRITICAL();
+    switch (*topic) {
+        case NOTIFY_TOPIC_AQI:
+            if (payload_length < 5) {
+                taskEXIT_CRITICAL();
+                return false;
+            }
+            notify_state.aqi_valid = true;
+            notify_state.aqi = payload[0];
+            notify_state.pm2_5_x10 = (uint16_t)GetInt16(&payload[1]);
+            notify_state.pm10_x10 = (uint16_t)GetInt16(&payload[3]);
+            break;
+
+        case NOTIFY_TOPIC_ALERT:
+            if (payload_length < 4 || payload[0] >= ALERT_ID_COUNT) {
+                taskEXIT_CRITICAL();
+                return false;
+            }
+            if (payload[1]) {
+                notify_state.active_alerts |= (uint8_t)(1U << payload[0]);
+            } else {
+                notify_state.active_alerts &= (uint8_t)~(1U << payload[0]);
+            }
+            notify_state.alert_value_x10[payload[0]] = GetInt16(&payload[2]);
+            break;
+
+        case NOTIFY_TOPIC_CONDITION:
+            if (payload_length < 4) {
+                taskEXIT_CRITICAL();
+                return false;
+            }
+            notify_state.condition_valid = true;
+            notify_state.condition = payload[0];
+            notify_state.temperature_x10 = GetInt16(&payload[1]);
+            notify_state.humidity = payload[3];
+            break;
+
+        default:
+            taskEXIT_CRITICAL();
+            return false;
+    }
+
+    notify_state.received_tick = osKernelGetTickCount();
+    notify_pending = true;
+    notify_generation++;
+    taskEXIT_CRITICAL();
+
+    /* 不等待下一个刷新周期，立即刷新显示 */
+    osThreadFlagsSet(displayTaskHandle, DISPLAY_FLAG_NOTIFY);
+    return true;
+}
+
+/* 获取推送状态，返回是否有尚未显示的更新 */
+bool NotifyClient_GetState(NotifyState *state) {
+    bool pending;
+
+    taskENTER_CRITICAL();
+    *state = notify_state;
+    pending = notify_pending;
+    rendering_generation = notify_generation;
+    taskEXIT_CRITICAL();
+
+    return pending;
+}
+
+/* 显示完成，记录从推送到达到显示的延迟。显示期间又收到推送时保留待显示标志，
+ * 由下一次刷新显示 */
+void NotifyClient_MarkRendered(void) {
+    uint32_t latency;
+
+    taskENTER_CRITICAL();
+    if (notify_pending && rendering_generation == notify_generation) {
+        latency = osKernelGetTickCount() - notify_state.received_tick;
+        notify_state.last_latency_ms = latency * 1000U / osKernelGetTickFreq();
+        if (notify_state.last_latency_ms > notify_state.max_latency_ms) {
+            notify_state.max_latency_ms = notify_state.last_latency_ms;
+        }
+        notify_pending = false;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/* 小端读取16位整数 */
+static int16_t GetInt16(const uint8_t *buffer) {
+    return (int16_t)((uint16_t)buffer[0] | ((uint16_t)buffer[1] << 8));
+}
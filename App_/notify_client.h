@@ -0,0 +1,80 @@
+#ifndef __NOTIFY_CLIENT_H
+#define __NOTIFY_CLIENT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "project_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 推送协议命令，与ESP32端esp32_config.h保持一致 */
+#define CMD_SUBSCRIBE           0x09
+#define CMD_NOTIFY              0x0A
+
+/* 推送主题 */
+#define NOTIFY_TOPIC_AQI        1
+#define NOTIFY_TOPIC_ALERT      2
+#define NOTIFY_TOPIC_CONDITION  3
+#define NOTIFY_TOPIC_BIT(t)     (1U << (t))
+#define NOTIFY_DEFAULT_TOPICS   (NOTIFY_TOPIC_BIT(NOTIFY_TOPIC_AQI) | \
+                                 NOTIFY_TOPIC_BIT(NOTIFY_TOPIC_ALERT) | \
+                                 NOTIFY_TOPIC_BIT(NOTIFY_TOPIC_CONDITION))
+
+/* ESP32状态报告中订阅主题所在的字节，ESP32重启后订阅丢失 */
+#define NOTIFY_STATUS_TOPICS_INDEX  4
+/* 向ESP32请求状态以检查订阅的间隔 */
+#define NOTIFY_STATUS_POLL_MS       30000U
+
+/* 天气状况编码 */
+#define NOTIFY_CONDITION_UNKNOWN        0
+#define NOTIFY_CONDITION_CLEAR          1
+#define NOTIFY_CONDITION_CLOUDY         2
+#define NOTIFY_CONDITION_RAIN           3
+#define NOTIFY_CONDITION_DRIZZLE        4
+#define NOTIFY_CONDITION_THUNDERSTORM   5
+#define NOTIFY_CONDITION_SNOW           6
+#define NOTIFY_CONDITION_FOG            7
+#define NOTIFY_CONDITION_WIND           8
+#define NOTIFY_CONDITION_COUNT          9
+
+/* 告警编号 */
+#define ALERT_ID_AQI            0
+#define ALERT_ID_HEAT           1
+#define ALERT_ID_COLD           2
+#define ALERT_ID_WIND           3
+#define ALERT_ID_COUNT          4
+
+/* 显示任务线程标志：收到推送后立即刷新 */
+#define DISPLAY_FLAG_NOTIFY     0x0001U
+
+/* 推送得到的最新状态 */
+typedef struct {
+    bool aqi_valid;
+    uint8_t aqi;
+    uint16_t pm2_5_x10;
+    uint16_t pm10_x10;
+    uint8_t active_alerts;              /* 按告警编号的位图 */
+    int16_t alert_value_x10[ALERT_ID_COUNT];
+    bool condition_valid;
+    uint8_t condition;
+    int16_t temperature_x10;
+    uint8_t humidity;
+    uint32_t received_tick;             /* 最近一次推送到达的时刻 */
+    uint32_t last_latency_ms;           /* 推送到达到显示完成的耗时 */
+    uint32_t max_latency_ms;
+} NotifyState;
+
+/* 函数声明 */
+bool NotifyClient_HandleFrame(const uint8_t *data, uint8_t length,
+                              uint8_t *topic, uint8_t *seq);
+bool NotifyClient_GetState(NotifyState *state);
+void NotifyClient_MarkRendered(void);
+void SubscribeNotifications(uint8_t topic_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NOTIFY_CLIENT_H */
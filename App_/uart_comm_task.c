@@ -2,6 +2,9 @@
 #include "project_defines.h"
 #include "weather_parser.h"
 #include "lcd_driver.h"
+#include "fast_boot.h"
+#include "notify_client.h"
+#include "event_bus.h"
 #include "cmsis_os.h"
 #include <string.h>
 
@@ -16,17 +19,28 @@ static UARTFrame current_frame;
 /* 私有函数原型 */
 static void ProcessReceivedFrame(UARTFrame *frame);
 static void SendUARTFrame(UARTFrame *frame);
+static void RequestSystemStatus(void);
 static uint8_t CalculateChecksum(uint8_t *data, uint16_t length);
 static bool ValidateFrame(UARTFrame *frame);
 
 /* UART接收任务 */
 void UartRxTask(void *argument) {
-    EventType event = EVENT_UART_DATA_RECEIVED;
     uint8_t rx_byte;
+    uint32_t last_status_poll;
     
     DEBUG_PRINT("UART RX Task Started");
+
+    /* 订阅ESP32的推送通知 */
+    SubscribeNotifications(NOTIFY_DEFAULT_TOPICS);
+    last_status_poll = osKernelGetTickCount();
     
     while (1) {
+        /* 定期请求ESP32状态，ESP32重启丢失订阅时据此重新订阅 */
+        if (osKernelGetTickCount() - last_status_poll >= NOTIFY_STATUS_POLL_MS) {
+            last_status_poll = osKernelGetTickCount();
+            RequestSystemStatus();
+        }
+
         /* 等待UART接收完成中断或轮询接收 */
         if (HAL_UART_Receive(&ESP32_UART, &rx_byte, 1, 10) == HAL_OK) {
             /* 帧开始检测 */
@@ -62,7 +76,7 @@ void UartRxTask(void *argument) {
                         /* 验证帧 */
                         if (ValidateFrame(&current_frame)) {
                             ProcessReceivedFrame(&current_frame);
-                            osMessageQueuePut(eventQueueHandle, &event, 0, 0);
+                            EventBus_Publish(EVENT_UART_DATA_RECEIVED);
                         }
                         
                         /* 重置解码状态 */
@@ -88,6 +102,12 @@ static void ProcessReceivedFrame(UARTFrame *frame) {
                 /* 发送到显示任务 */
                 osMessageQueuePut(weatherQueueHandle, &weather_data, 0, 0);
                 system_status.weather_data_valid = true;
+
+                /* 保存快照供下次快速启动使用 */
+                FastBoot_SaveWeather(&weather_data);
+
+                /* 通知显示任务取数据 */
+                EventBus_Publish(EVENT_WEATHER_UPDATE);
                 
                 /* 发送ACK确认 */
                 UARTFrame ack_frame = {
@@ -110,6 +130,17 @@ static void ProcessReceivedFrame(UARTFrame *frame) {
         }
             
         case CMD_SYSTEM_STATUS: {
+            /* ESP32的状态报告(启动时主动发送或回复请求) */
+            if (frame->data_length > 0) {
+                if (frame->data_length > NOTIFY_STATUS_TOPICS_INDEX &&
+                    (frame->data[NOTIFY_STATUS_TOPICS_INDEX] & NOTIFY_DEFAULT_TOPICS) !=
+                    NOTIFY_DEFAULT_TOPICS) {
+                    DEBUG_PRINT("ESP32 lost subscriptions, resubscribing");
+                    SubscribeNotifications(NOTIFY_DEFAULT_TOPICS);
+                }
+                break;
+            }
+
             /* 发送系统状态给ESP32 */
             UARTFrame status_frame;
             uint8_t status_data[8];
@@ -130,6 +161,26 @@ static void ProcessReceivedFrame(UARTFrame *frame) {
             break;
         }
             
+        case CMD_NOTIFY: {
+            uint8_t topic;
+            uint8_t seq;
+
+            if (NotifyClient_HandleFrame(frame->data, frame->data_length,
+                                         &topic, &seq)) {
+                /* 回复主题和序号，ESP32据此测量推送延迟 */
+                UARTFrame ack_frame = {
+                    .start_byte = PROTOCOL_START_BYTE,
+                    .command = CMD_ACK,
+                    .data_length = 2,
+                };
+                ack_frame.data[0] = topic;
+                ack_frame.data[1] = seq;
+                ack_frame.checksum = CalculateChecksum(ack_frame.data, 2);
+                SendUARTFrame(&ack_frame);
+            }
+            break;
+        }
+
         case CMD_ACK:
             DEBUG_PRINT("Received ACK from ESP32");
             break;
@@ -189,6 +240,31 @@ void RequestWeatherData(void) {
     SendUARTFrame(&request_frame);
 }
 
+/* 请求ESP32的系统状态 */
+static void RequestSystemStatus(void) {
+    UARTFrame request_frame;
+
+    request_frame.start_byte = PROTOCOL_START_BYTE;
+    request_frame.command = CMD_SYSTEM_STATUS;
+    request_frame.data_length = 0;
+    request_frame.checksum = CalculateChecksum(NULL, 0);
+
+    SendUARTFrame(&request_frame);
+}
+
+/* 订阅ESP32推送主题 */
+void SubscribeNotifications(uint8_t topic_mask) {
+    UARTFrame subscribe_frame;
+
+    subscribe_frame.start_byte = PROTOCOL_START_BYTE;
+    subscribe_frame.command = CMD_SUBSCRIBE;
+    subscribe_frame.data_length = 1;
+    subscribe_frame.data[0] = topic_mask;
+    subscribe_frame.checksum = CalculateChecksum(subscribe_frame.data, 1);
+
+    SendUARTFrame(&subscribe_frame);
+}
+
 /* 计算校验和 */
 static uint8_t CalculateChecksum(uint8_t *data, uint16_t length) {
     uint8_t checksum = 0;
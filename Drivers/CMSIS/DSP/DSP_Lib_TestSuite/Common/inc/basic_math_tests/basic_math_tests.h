@@ -10,6 +10,7 @@ JTEST_DECLARE_GROUP(dot_prod_tests);
 JTEST_DECLARE_GROUP(mult_tests);
 JTEST_DECLARE_GROUP(negate_tests);
 JTEST_DECLARE_GROUP(offset_tests);
+JTEST_DECLARE_GROUP(saturation_tests);
 JTEST_DECLARE_GROUP(scale_tests);
 JTEST_DECLARE_GROUP(shift_tests);
 JTEST_DECLARE_GROUP(sub_tests);
@@ -99,4 +99,58 @@
             return JTEST_TEST_PASSED;                                   \
         }
 
+/**
+ *  Test a function that takes a whole input vector, on block_size samples
+ *  of the given input.
+ */
+#define VECTOR_TEST_TEMPLATE_ELT1(suffix, type, func, input, block_size)  \
+                                                                        \
+        JTEST_DEFINE_TEST(arm_##func##_##suffix##_test, arm_##func##_##suffix) \
+        {                                                               \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_##func##_##suffix(                                  \
+                    input,                                              \
+                    (type*)fast_math_output_fut,                        \
+                    block_size));                                       \
+                                                                        \
+            ref_##func##_##suffix(                                      \
+                input,                                                  \
+                (type*)fast_math_output_ref,                            \
+                block_size);                                            \
+                                                                        \
+            FAST_MATH_SNR_COMPARE_INTERFACE(                            \
+                block_size,                                             \
+                type);                                                  \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+        }
+
+/**
+ *  Test a two input function, with y and x taken from consecutive samples
+ *  of the given input.
+ */
+#define ATAN2_TEST_TEMPLATE_ELT1(suffix, type)                          \
+                                                                        \
+        JTEST_DEFINE_TEST(arm_atan2_##suffix##_test, arm_atan2_##suffix) \
+        {                                                               \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_atan2_##suffix(                                     \
+                    fast_math_##suffix##_inputs,                        \
+                    fast_math_##suffix##_inputs + 1,                    \
+                    (type*)fast_math_output_fut,                        \
+                    FAST_MATH_MAX_LEN - 1));                            \
+                                                                        \
+            ref_atan2_##suffix(                                         \
+                fast_math_##suffix##_inputs,                            \
+                fast_math_##suffix##_inputs + 1,                        \
+                (type*)fast_math_output_ref,                            \
+                FAST_MATH_MAX_LEN - 1);                                 \
+                                                                        \
+            FAST_MATH_SNR_COMPARE_INTERFACE(                            \
+                FAST_MATH_MAX_LEN - 1,                                  \
+                type);                                                  \
+                                                                        \
+            return JTEST_TEST_PASSED;                                   \
+        }
+
 #endif /* _FAST_MATH_TEMPLATES_H_ */
@@ -8,8 +8,11 @@
 JTEST_DECLARE_GROUP(biquad_tests);
 JTEST_DECLARE_GROUP(conv_tests);
 JTEST_DECLARE_GROUP(correlate_tests);
+JTEST_DECLARE_GROUP(fdaf_tests);
 JTEST_DECLARE_GROUP(fir_tests);
 JTEST_DECLARE_GROUP(iir_tests);
+JTEST_DECLARE_GROUP(kalman_tests);
+JTEST_DECLARE_GROUP(median_tests);
 JTEST_DECLARE_GROUP(lms_tests);
 
 #endif /* _FILTERING_TESTS_H_ */
@@ -40,6 +40,9 @@ extern MATRIX_TEST_BIGGEST_INPUT_TYPE matrix_output_f32_fut[MATRIX_TEST_MAX_ELTS
 extern MATRIX_TEST_BIGGEST_INPUT_TYPE matrix_output_f32_ref[MATRIX_TEST_MAX_ELTS];
 extern MATRIX_TEST_BIGGEST_INPUT_TYPE matrix_output_scratch[MATRIX_TEST_MAX_ELTS];
 
+/* Pool of random data the matrix inputs are built from */
+extern float32_t matrix_f32_100_rand[100];
+
 /* Matrix Inputs */
 MATRIX_DECLARE_INPUTS(f64);
 MATRIX_DECLARE_INPUTS(f32);
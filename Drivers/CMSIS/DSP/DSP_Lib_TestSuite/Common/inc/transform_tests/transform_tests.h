@@ -6,6 +6,11 @@
 /*--------------------------------------------------------------------------------*/
 JTEST_DECLARE_GROUP(cfft_tests);
 JTEST_DECLARE_GROUP(cfft_family_tests);
+JTEST_DECLARE_GROUP(cfft_mixed_radix_tests);
+JTEST_DECLARE_GROUP(cfft_table_tests);
+JTEST_DECLARE_GROUP(cfft_batch_tests);
+JTEST_DECLARE_GROUP(stft_tests);
+JTEST_DECLARE_GROUP(mfcc_tests);
 JTEST_DECLARE_GROUP(dct4_tests);
 JTEST_DECLARE_GROUP(rfft_tests);
 JTEST_DECLARE_GROUP(rfft_fast_tests);
@@ -9,6 +9,7 @@ JTEST_DEFINE_GROUP(basic_math_tests)
     JTEST_GROUP_CALL(mult_tests);
     JTEST_GROUP_CALL(negate_tests);
     JTEST_GROUP_CALL(offset_tests);
+    JTEST_GROUP_CALL(saturation_tests);
     JTEST_GROUP_CALL(scale_tests); 
     JTEST_GROUP_CALL(shift_tests);
     JTEST_GROUP_CALL(sub_tests);
@@ -0,0 +1,292 @@
+#include "jtest.h"
+#include "basic_math_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "basic_math_templates.h"
+#include "type_abbrev.h"
+
+/*
+  The fixed-point kernels must match the reference functions bit for bit on
+  the saturation and wrap-around corner cases. The block sizes cover every
+  tail length of the 4, 8 and 16 lane vector loops, the longest ones every
+  input word for each element type.
+*/
+
+#define SATURATION_MAX_BLOCK 33
+
+static const uint32_t saturation_block_sizes[] = {1, 3, 4, 5, 8, 15, 16, 17, 33, 66, 132};
+
+/* Read as q15 or q7 the words also give the 0x8000 / 0x80 and 0x7FFF / 0x7F pairs */
+static const uint32_t saturation_values[] = {
+    0x80000000, 0x7FFFFFFF, 0x80000001, 0x7FFFFFFE, 0xFFFFFFFF,
+    0x00000000, 0x00000001, 0x40000000, 0xC0000000, 0x80008000,
+    0x7FFF7FFF, 0x00008000, 0xFFFF8000, 0x80808080, 0x7F7F7F7F
+};
+
+#define SATURATION_VALUE_COUNT                                          \
+    (sizeof(saturation_values) / sizeof(saturation_values[0]))
+
+static const int32_t saturation_scales[] = {
+    (int32_t) 0x80000000, 0x7FFFFFFF, 0x40000000, (int32_t) 0xC0000001
+};
+
+static const int8_t saturation_shifts[] = {-3, 0, 1, 4};
+
+static uint32_t saturation_a[SATURATION_MAX_BLOCK];
+static uint32_t saturation_b[SATURATION_MAX_BLOCK];
+static uint32_t saturation_fut[SATURATION_MAX_BLOCK];
+static uint32_t saturation_ref[SATURATION_MAX_BLOCK];
+
+/**
+ *  Fill the inputs. The first pass pairs every value with itself, the next
+ *  passes with the following values.
+ */
+static void saturation_fill_inputs(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < SATURATION_MAX_BLOCK; i++)
+    {
+        saturation_a[i] = saturation_values[i % SATURATION_VALUE_COUNT];
+        saturation_b[i] = saturation_values[(i + i / SATURATION_VALUE_COUNT) %
+                                            SATURATION_VALUE_COUNT];
+    }
+}
+
+/**
+ *  Run the body for each block size that fits the inputs, with count the
+ *  number of elements of type.
+ */
+#define SATURATION_FOR_EACH_BLOCK(type, body)                                   \
+    do                                                                          \
+    {                                                                           \
+        uint32_t block_size_idx;                                                \
+        uint32_t count;                                                         \
+                                                                                \
+        saturation_fill_inputs();                                               \
+        for (block_size_idx = 0;                                                \
+             block_size_idx < sizeof(saturation_block_sizes) / sizeof(uint32_t); \
+             block_size_idx++)                                                  \
+        {                                                                       \
+            count = saturation_block_sizes[block_size_idx];                     \
+            if (count * sizeof(type) > sizeof(saturation_a))                    \
+            {                                                                   \
+                break;                                                          \
+            }                                                                   \
+            body;                                                               \
+        }                                                                       \
+    } while (0)
+
+#define SATURATION_BUF2_TEST(fn_name, suffix)                                   \
+    JTEST_DEFINE_TEST(arm_##fn_name##_##suffix##_saturation_test,               \
+                      arm_##fn_name##_##suffix)                                 \
+    {                                                                           \
+        typedef TYPE_FROM_ABBREV(suffix) type;                                  \
+                                                                                \
+        SATURATION_FOR_EACH_BLOCK(                                              \
+            type,                                                               \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_##fn_name##_##suffix((type *) saturation_a,                 \
+                                         (type *) saturation_b,                 \
+                                         (type *) saturation_fut, count));      \
+            ref_##fn_name##_##suffix((type *) saturation_a,                     \
+                                     (type *) saturation_b,                     \
+                                     (type *) saturation_ref, count);           \
+            TEST_ASSERT_BUFFERS_EQUAL(saturation_ref, saturation_fut,           \
+                                      count * sizeof(type)));                   \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+#define SATURATION_BUF1_TEST(fn_name, suffix)                                   \
+    JTEST_DEFINE_TEST(arm_##fn_name##_##suffix##_saturation_test,               \
+                      arm_##fn_name##_##suffix)                                 \
+    {                                                                           \
+        typedef TYPE_FROM_ABBREV(suffix) type;                                  \
+                                                                                \
+        SATURATION_FOR_EACH_BLOCK(                                              \
+            type,                                                               \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_##fn_name##_##suffix((type *) saturation_a,                 \
+                                         (type *) saturation_fut, count));      \
+            ref_##fn_name##_##suffix((type *) saturation_a,                     \
+                                     (type *) saturation_ref, count);           \
+            TEST_ASSERT_BUFFERS_EQUAL(saturation_ref, saturation_fut,           \
+                                      count * sizeof(type)));                   \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+/* The q15 and q7 offsets and scales are the top bits of the q31 ones */
+#define SATURATION_ELT(type, value)                                             \
+    ((type) ((value) >> (32 - 8 * sizeof(type))))
+
+#define SATURATION_OFFSET_TEST(suffix)                                          \
+    JTEST_DEFINE_TEST(arm_offset_##suffix##_saturation_test,                    \
+                      arm_offset_##suffix)                                      \
+    {                                                                           \
+        typedef TYPE_FROM_ABBREV(suffix) type;                                  \
+        uint32_t offset_idx;                                                    \
+        type offset;                                                            \
+                                                                                \
+        for (offset_idx = 0; offset_idx < 4; offset_idx++)                      \
+        {                                                                       \
+            offset = SATURATION_ELT(type, saturation_scales[offset_idx]);       \
+            SATURATION_FOR_EACH_BLOCK(                                          \
+                type,                                                           \
+                JTEST_COUNT_CYCLES(                                             \
+                    arm_offset_##suffix((type *) saturation_a, offset,          \
+                                        (type *) saturation_fut, count));       \
+                ref_offset_##suffix((type *) saturation_a, offset,              \
+                                    (type *) saturation_ref, count);            \
+                TEST_ASSERT_BUFFERS_EQUAL(saturation_ref, saturation_fut,       \
+                                          count * sizeof(type)));               \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+#define SATURATION_SCALE_TEST(suffix)                                           \
+    JTEST_DEFINE_TEST(arm_scale_##suffix##_saturation_test,                     \
+                      arm_scale_##suffix)                                       \
+    {                                                                           \
+        typedef TYPE_FROM_ABBREV(suffix) type;                                  \
+        uint32_t scale_idx, shift_idx;                                          \
+        type scale;                                                             \
+        int8_t shift;                                                           \
+                                                                                \
+        for (scale_idx = 0; scale_idx < 4; scale_idx++)                         \
+        {                                                                       \
+            for (shift_idx = 0; shift_idx < 4; shift_idx++)                     \
+            {                                                                   \
+                scale = SATURATION_ELT(type, saturation_scales[scale_idx]);     \
+                shift = saturation_shifts[shift_idx];                           \
+                SATURATION_FOR_EACH_BLOCK(                                      \
+                    type,                                                       \
+                    JTEST_COUNT_CYCLES(                                         \
+                        arm_scale_##suffix((type *) saturation_a, scale, shift, \
+                                           (type *) saturation_fut, count));    \
+                    ref_scale_##suffix((type *) saturation_a, scale, shift,     \
+                                       (type *) saturation_ref, count);         \
+                    TEST_ASSERT_BUFFERS_EQUAL(saturation_ref, saturation_fut,   \
+                                              count * sizeof(type)));           \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+#define SATURATION_DOT_PROD_TEST(suffix, result_type)                           \
+    JTEST_DEFINE_TEST(arm_dot_prod_##suffix##_saturation_test,                  \
+                      arm_dot_prod_##suffix)                                    \
+    {                                                                           \
+        typedef TYPE_FROM_ABBREV(suffix) type;                                  \
+        result_type result_fut;                                                 \
+        result_type result_ref;                                                 \
+                                                                                \
+        SATURATION_FOR_EACH_BLOCK(                                              \
+            type,                                                               \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_dot_prod_##suffix((type *) saturation_a,                    \
+                                      (type *) saturation_b,                    \
+                                      count, &result_fut));                     \
+            ref_dot_prod_##suffix((type *) saturation_a,                        \
+                                  (type *) saturation_b,                        \
+                                  count, &result_ref);                          \
+            TEST_ASSERT_EQUAL(result_ref, result_fut));                         \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+SATURATION_BUF2_TEST(add, q31);
+SATURATION_BUF2_TEST(add, q15);
+SATURATION_BUF2_TEST(add, q7);
+SATURATION_BUF2_TEST(sub, q31);
+SATURATION_BUF2_TEST(sub, q15);
+SATURATION_BUF2_TEST(sub, q7);
+
+/*
+  The reference, like the ARM_MATH_DSP path, drops bit 31 of the q31 product
+  while the other paths keep it, so the results may differ by one LSB. A
+  product that wrapped instead of saturating is far off.
+*/
+JTEST_DEFINE_TEST(arm_mult_q31_saturation_test,
+                  arm_mult_q31)
+{
+    q31_t * fut = (q31_t *) saturation_fut;
+    q31_t * ref = (q31_t *) saturation_ref;
+    uint32_t i;
+
+    SATURATION_FOR_EACH_BLOCK(
+        q31_t,
+        JTEST_COUNT_CYCLES(
+            arm_mult_q31((q31_t *) saturation_a, (q31_t *) saturation_b,
+                         fut, count));
+        ref_mult_q31((q31_t *) saturation_a, (q31_t *) saturation_b,
+                     ref, count);
+        for (i = 0; i < count; i++)
+        {
+            if ((q63_t) ref[i] - fut[i] > 1 || (q63_t) fut[i] - ref[i] > 1)
+            {
+                return JTEST_TEST_FAILED;
+            }
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+SATURATION_BUF2_TEST(mult, q15);
+SATURATION_BUF2_TEST(mult, q7);
+
+SATURATION_BUF1_TEST(abs, q31);
+SATURATION_BUF1_TEST(abs, q15);
+SATURATION_BUF1_TEST(abs, q7);
+SATURATION_BUF1_TEST(negate, q31);
+SATURATION_BUF1_TEST(negate, q15);
+SATURATION_BUF1_TEST(negate, q7);
+
+SATURATION_OFFSET_TEST(q31);
+SATURATION_OFFSET_TEST(q15);
+SATURATION_OFFSET_TEST(q7);
+
+SATURATION_SCALE_TEST(q31);
+SATURATION_SCALE_TEST(q15);
+SATURATION_SCALE_TEST(q7);
+
+SATURATION_DOT_PROD_TEST(q31, q63_t);
+SATURATION_DOT_PROD_TEST(q15, q63_t);
+SATURATION_DOT_PROD_TEST(q7, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(saturation_tests)
+{
+    JTEST_TEST_CALL(arm_add_q31_saturation_test);
+    JTEST_TEST_CALL(arm_add_q15_saturation_test);
+    JTEST_TEST_CALL(arm_add_q7_saturation_test);
+    JTEST_TEST_CALL(arm_sub_q31_saturation_test);
+    JTEST_TEST_CALL(arm_sub_q15_saturation_test);
+    JTEST_TEST_CALL(arm_sub_q7_saturation_test);
+    JTEST_TEST_CALL(arm_mult_q31_saturation_test);
+    JTEST_TEST_CALL(arm_mult_q15_saturation_test);
+    JTEST_TEST_CALL(arm_mult_q7_saturation_test);
+    JTEST_TEST_CALL(arm_abs_q31_saturation_test);
+    JTEST_TEST_CALL(arm_abs_q15_saturation_test);
+    JTEST_TEST_CALL(arm_abs_q7_saturation_test);
+    JTEST_TEST_CALL(arm_negate_q31_saturation_test);
+    JTEST_TEST_CALL(arm_negate_q15_saturation_test);
+    JTEST_TEST_CALL(arm_negate_q7_saturation_test);
+    JTEST_TEST_CALL(arm_offset_q31_saturation_test);
+    JTEST_TEST_CALL(arm_offset_q15_saturation_test);
+    JTEST_TEST_CALL(arm_offset_q7_saturation_test);
+    JTEST_TEST_CALL(arm_scale_q31_saturation_test);
+    JTEST_TEST_CALL(arm_scale_q15_saturation_test);
+    JTEST_TEST_CALL(arm_scale_q7_saturation_test);
+    JTEST_TEST_CALL(arm_dot_prod_q31_saturation_test);
+    JTEST_TEST_CALL(arm_dot_prod_q15_saturation_test);
+    JTEST_TEST_CALL(arm_dot_prod_q7_saturation_test);
+}
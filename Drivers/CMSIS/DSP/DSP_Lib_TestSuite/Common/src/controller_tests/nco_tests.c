@@ -0,0 +1,167 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"
+#include "ref.h"
+#include "type_abbrev.h"
+#include "test_templates.h"
+#include "controller_templates.h"
+#include "controller_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Input Data */
+/*--------------------------------------------------------------------------------*/
+
+/* Number of samples generated by each call, the phase must be continuous
+ * between the calls */
+#define NCO_NUM_BLOCKS 4
+static const uint32_t nco_block_sizes[NCO_NUM_BLOCKS] = {1, 6, 101, 404};
+#define NCO_LEN (CONTROLLER_MAX_LEN / 2)
+
+/* Phase increment and initial phase, in degrees for the floating-point
+ * version and in Q31 for the others. The second one is a negative frequency */
+#define NCO_NUM_SETTINGS 2
+static const float32_t nco_settings_f32[NCO_NUM_SETTINGS][2] =
+{
+    {7.3f, 30.0f},
+    {-101.25f, -170.5f}
+};
+
+static const q31_t nco_settings_q31[NCO_NUM_SETTINGS][2] =
+{
+    {0x0123457, 0x20000000},
+    {(q31_t) 0xB7FFFFF3, (q31_t) 0x86A12345}
+};
+
+/*--------------------------------------------------------------------------------*/
+/* Test Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Generate NCO_LEN samples with separate sine and cosine outputs, in several
+ *  blocks, and compare them with the reference oscillator. The sines are
+ *  written to the first half of the output buffers and the cosines to the
+ *  second half.
+ */
+#define NCO_TEST_TEMPLATE(suffix, type, settings)                       \
+    JTEST_DEFINE_TEST(arm_nco_##suffix##_test,                          \
+                      arm_nco_##suffix)                                 \
+    {                                                                   \
+        arm_nco_instance_##suffix S_fut;                                \
+        arm_nco_instance_##suffix S_ref;                                \
+        type * pDst_fut =                                               \
+            (type *) controller_output_fut;                             \
+        type * pDst_ref =                                               \
+            (type *) controller_output_ref;                             \
+        uint32_t set, blk, offset;                                      \
+                                                                        \
+        for (set = 0; set < NCO_NUM_SETTINGS; set++)                    \
+        {                                                               \
+            arm_nco_init_##suffix(&S_fut, settings[set][0],             \
+                                  settings[set][1]);                    \
+            S_ref = S_fut;                                              \
+                                                                        \
+            offset = 0;                                                 \
+            for (blk = 0; blk < NCO_NUM_BLOCKS; blk++)                  \
+            {                                                           \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_nco_##suffix(&S_fut,                            \
+                                     pDst_fut + offset,                 \
+                                     pDst_fut + NCO_LEN + offset,       \
+                                     nco_block_sizes[blk]));            \
+                offset += nco_block_sizes[blk];                         \
+            }                                                           \
+                                                                        \
+            ref_nco_##suffix(&S_ref, pDst_ref, pDst_ref + NCO_LEN,      \
+                             NCO_LEN);                                  \
+                                                                        \
+            if (S_fut.phase != S_ref.phase)                             \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            CONTROLLER_SNR_COMPARE_INTERFACE(                           \
+                CONTROLLER_MAX_LEN,                                     \
+                type);                                                  \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/**
+ *  Generate NCO_LEN complex samples in several blocks and compare them with
+ *  the reference oscillator, interleaved.
+ */
+#define NCO_CMPLX_TEST_TEMPLATE(suffix, type, settings)                 \
+    JTEST_DEFINE_TEST(arm_nco_cmplx_##suffix##_test,                    \
+                      arm_nco_cmplx_##suffix)                           \
+    {                                                                   \
+        arm_nco_instance_##suffix S_fut;                                \
+        arm_nco_instance_##suffix S_ref;                                \
+        type * pDst_fut =                                               \
+            (type *) controller_output_fut;                             \
+        type * pDst_ref =                                               \
+            (type *) controller_output_ref;                             \
+        type sinVal, cosVal;                                            \
+        uint32_t set, blk, offset, i;                                   \
+                                                                        \
+        for (set = 0; set < NCO_NUM_SETTINGS; set++)                    \
+        {                                                               \
+            arm_nco_init_##suffix(&S_fut, settings[set][0],             \
+                                  settings[set][1]);                    \
+            S_ref = S_fut;                                              \
+                                                                        \
+            offset = 0;                                                 \
+            for (blk = 0; blk < NCO_NUM_BLOCKS; blk++)                  \
+            {                                                           \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_nco_cmplx_##suffix(&S_fut,                      \
+                                           pDst_fut + (2 * offset),     \
+                                           nco_block_sizes[blk]));      \
+                offset += nco_block_sizes[blk];                         \
+            }                                                           \
+                                                                        \
+            for (i = 0; i < NCO_LEN; i++)                               \
+            {                                                           \
+                ref_nco_##suffix(&S_ref, &sinVal, &cosVal, 1);          \
+                pDst_ref[2 * i] = cosVal;                               \
+                pDst_ref[2 * i + 1] = sinVal;                           \
+            }                                                           \
+                                                                        \
+            if (S_fut.phase != S_ref.phase)                             \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            CONTROLLER_SNR_COMPARE_INTERFACE(                           \
+                CONTROLLER_MAX_LEN,                                     \
+                type);                                                  \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+NCO_TEST_TEMPLATE(f32, float32_t, nco_settings_f32);
+NCO_TEST_TEMPLATE(q31, q31_t, nco_settings_q31);
+NCO_TEST_TEMPLATE(q15, q15_t, nco_settings_q31);
+
+NCO_CMPLX_TEST_TEMPLATE(f32, float32_t, nco_settings_f32);
+NCO_CMPLX_TEST_TEMPLATE(q31, q31_t, nco_settings_q31);
+NCO_CMPLX_TEST_TEMPLATE(q15, q15_t, nco_settings_q31);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(nco_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_nco_f32_test);
+    JTEST_TEST_CALL(arm_nco_q31_test);
+    JTEST_TEST_CALL(arm_nco_q15_test);
+
+    JTEST_TEST_CALL(arm_nco_cmplx_f32_test);
+    JTEST_TEST_CALL(arm_nco_cmplx_q31_test);
+    JTEST_TEST_CALL(arm_nco_cmplx_q15_test);
+}
@@ -4,6 +4,8 @@
 #include "ref.h"
 #include "type_abbrev.h"
 #include "test_templates.h"
+#include "controller_templates.h"
+#include "controller_test_data.h"
 
 /*--------------------------------------------------------------------------------*/
 /* Input Data */
@@ -28,7 +30,7 @@ ARR_DESC_DEFINE(float32_t,
  * to degrees in the range [-180, 179]*/
 ARR_DESC_DEFINE(q31_t,
                 arm_sin_cos_degrees_q31,
-                6,
+                8,
                 CURLY(
                     0,
                     0x80000000, /* -1 */
@@ -36,7 +38,10 @@ ARR_DESC_DEFINE(q31_t,
                     /* Randoms */
                     0xf7badafa,
                     0x285954a1,
-                    0xb9d09511
+                    0xb9d09511,
+                    /* Close to -90 degrees, where the sine is -1 */
+                    0xc0300000,
+                    0xbfd00000
                       ));
 
 /*--------------------------------------------------------------------------------*/
@@ -137,6 +142,90 @@ JTEST_DEFINE_TEST(arm_sin_cos_q31_test,
     return JTEST_TEST_PASSED;
 }
 
+/*
+  Block sine and cosine tests, the sines are written to the first half of the
+  output buffers and the cosines to the second half.
+*/
+#define SIN_COS_BLOCK_LEN (CONTROLLER_MAX_LEN / 2)
+
+JTEST_DEFINE_TEST(arm_vsin_cos_f32_test, arm_vsin_cos_f32)
+{
+    uint32_t i;
+
+    JTEST_COUNT_CYCLES(
+        arm_vsin_cos_f32(controller_f32_inputs,
+                         controller_output_fut,
+                         controller_output_fut + SIN_COS_BLOCK_LEN,
+                         SIN_COS_BLOCK_LEN));
+
+    for (i = 0; i < SIN_COS_BLOCK_LEN; i++)
+    {
+        ref_sin_cos_f32(controller_f32_inputs[i],
+                        controller_output_ref + i,
+                        controller_output_ref + SIN_COS_BLOCK_LEN + i);
+    }
+
+    CONTROLLER_SNR_COMPARE_INTERFACE(
+        CONTROLLER_MAX_LEN,
+        float32_t);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vsin_cos_q31_test, arm_vsin_cos_q31)
+{
+    q31_t * pDst_fut = (q31_t *) controller_output_fut;
+    q31_t * pDst_ref = (q31_t *) controller_output_ref;
+    uint32_t i;
+
+    JTEST_COUNT_CYCLES(
+        arm_vsin_cos_q31(controller_q31_inputs,
+                         pDst_fut,
+                         pDst_fut + SIN_COS_BLOCK_LEN,
+                         SIN_COS_BLOCK_LEN));
+
+    for (i = 0; i < SIN_COS_BLOCK_LEN; i++)
+    {
+        ref_sin_cos_q31(controller_q31_inputs[i],
+                        pDst_ref + i,
+                        pDst_ref + SIN_COS_BLOCK_LEN + i);
+    }
+
+    CONTROLLER_SNR_COMPARE_INTERFACE(
+        CONTROLLER_MAX_LEN,
+        q31_t);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vsin_cos_q15_test, arm_vsin_cos_q15)
+{
+    q15_t * pDst_fut = (q15_t *) controller_output_fut;
+    q15_t * pDst_ref = (q15_t *) controller_output_ref;
+    q31_t sinVal, cosVal;
+    uint32_t i;
+
+    JTEST_COUNT_CYCLES(
+        arm_vsin_cos_q15(controller_q15_inputs,
+                         pDst_fut,
+                         pDst_fut + SIN_COS_BLOCK_LEN,
+                         SIN_COS_BLOCK_LEN));
+
+    /* The Q15 angle is the upper half of a Q31 angle */
+    for (i = 0; i < SIN_COS_BLOCK_LEN; i++)
+    {
+        ref_sin_cos_q31((q31_t) controller_q15_inputs[i] << 16, &sinVal, &cosVal);
+        pDst_ref[i] = (q15_t) (sinVal >> 16);
+        pDst_ref[SIN_COS_BLOCK_LEN + i] = (q15_t) (cosVal >> 16);
+    }
+
+    CONTROLLER_SNR_COMPARE_INTERFACE(
+        CONTROLLER_MAX_LEN,
+        q15_t);
+
+    return JTEST_TEST_PASSED;
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -148,4 +237,7 @@ JTEST_DEFINE_GROUP(sin_cos_tests)
     */
     JTEST_TEST_CALL(arm_sin_cos_f32_test);
     JTEST_TEST_CALL(arm_sin_cos_q31_test);
+    JTEST_TEST_CALL(arm_vsin_cos_f32_test);
+    JTEST_TEST_CALL(arm_vsin_cos_q31_test);
+    JTEST_TEST_CALL(arm_vsin_cos_q15_test);
 }
@@ -16,6 +16,172 @@ SIN_COS_TEST_TEMPLATE_ELT1(f32, float32_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q31, q31_t, cos);
 SIN_COS_TEST_TEMPLATE_ELT1(q15, q15_t, cos);
 
+/* The logarithm is only tested on positive inputs */
+static float32_t fast_math_f32_positive_inputs[FAST_MATH_MAX_LEN];
+
+VECTOR_TEST_TEMPLATE_ELT1(f32, float32_t, vexp, fast_math_f32_inputs, FAST_MATH_MAX_LEN);
+
+JTEST_DEFINE_TEST(arm_vlog_f32_test, arm_vlog_f32)
+{
+    uint32_t i;
+
+    for(i=0;i<FAST_MATH_MAX_LEN;i++)
+    {
+        fast_math_f32_positive_inputs[i] = fabsf(fast_math_f32_inputs[i]) + 1.0e-3f;
+    }
+
+    JTEST_COUNT_CYCLES(
+        arm_vlog_f32(fast_math_f32_positive_inputs,
+                     fast_math_output_fut,
+                     FAST_MATH_MAX_LEN));
+
+    ref_vlog_f32(fast_math_f32_positive_inputs,
+                 fast_math_output_ref,
+                 FAST_MATH_MAX_LEN);
+
+    FAST_MATH_SNR_COMPARE_INTERFACE(
+        FAST_MATH_MAX_LEN,
+        float32_t);
+
+    return JTEST_TEST_PASSED;
+}
+
+VECTOR_TEST_TEMPLATE_ELT1(f32, float32_t, vtanh, fast_math_f32_inputs, FAST_MATH_MAX_LEN);
+VECTOR_TEST_TEMPLATE_ELT1(q31, q31_t, vtanh, fast_math_q31_inputs, FAST_MATH_MAX_LEN);
+VECTOR_TEST_TEMPLATE_ELT1(q15, q15_t, vtanh, fast_math_q15_inputs, FAST_MATH_MAX_LEN);
+
+VECTOR_TEST_TEMPLATE_ELT1(f32, float32_t, vsigmoid, fast_math_f32_inputs, FAST_MATH_MAX_LEN);
+VECTOR_TEST_TEMPLATE_ELT1(q31, q31_t, vsigmoid, fast_math_q31_inputs, FAST_MATH_MAX_LEN);
+VECTOR_TEST_TEMPLATE_ELT1(q15, q15_t, vsigmoid, fast_math_q15_inputs, FAST_MATH_MAX_LEN);
+
+/* Below -87.34 the sigmoid is a denormal number, which must not be flushed to zero */
+#define SIGMOID_TINY_LEN 9
+
+static const float32_t sigmoid_tiny_inputs[SIGMOID_TINY_LEN] =
+{
+    -79.5f, -80.5f, -87.0f, -87.5f, -90.0f, -96.0f, -100.0f, -103.5f, -110.0f
+};
+
+JTEST_DEFINE_TEST(arm_vsigmoid_f32_tiny_test, arm_vsigmoid_f32)
+{
+    uint32_t i;
+    float32_t tolerance;
+
+    arm_vsigmoid_f32(sigmoid_tiny_inputs, fast_math_output_fut, SIGMOID_TINY_LEN);
+    ref_vsigmoid_f32(sigmoid_tiny_inputs, fast_math_output_ref, SIGMOID_TINY_LEN);
+
+    for(i=0;i<SIGMOID_TINY_LEN;i++)
+    {
+        /* 3 ULP, where one ULP of a denormal number is 1.4e-45 */
+        tolerance = (3.0f * 1.1920929e-7f * fast_math_output_ref[i]) + 4.3e-45f;
+
+        if ((fabsf(fast_math_output_fut[i] - fast_math_output_ref[i]) > tolerance) ||
+            ((fast_math_output_fut[i] > 0.0f) != (fast_math_output_ref[i] > 0.0f)))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+ATAN2_TEST_TEMPLATE_ELT1(f32, float32_t);
+ATAN2_TEST_TEMPLATE_ELT1(q31, q31_t);
+ATAN2_TEST_TEMPLATE_ELT1(q15, q15_t);
+
+/* Points on and next to the negative x axis, where the angle jumps from +pi to -pi,
+   and on the positive x axis. The sign of the result must follow the sign of y */
+#define ATAN2_BRANCH_CUT_LEN 8
+
+static const float32_t atan2_branch_cut_y_f32[ATAN2_BRANCH_CUT_LEN] =
+{
+    0.0f, -0.0f, 1.0e-30f, -1.0e-30f, 0.0f, -0.0f, 1.0e-30f, -0.0f
+};
+
+static const float32_t atan2_branch_cut_x_f32[ATAN2_BRANCH_CUT_LEN] =
+{
+    -1.0f, -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0e30f, -1.0e-30f
+};
+
+static const q31_t atan2_branch_cut_y_q31[ATAN2_BRANCH_CUT_LEN] =
+{
+    0, -1, 1, 0, 0, -1, 1, -0x7FFF
+};
+
+static const q31_t atan2_branch_cut_x_q31[ATAN2_BRANCH_CUT_LEN] =
+{
+    -0x40000000, -0x40000000, -0x7FFFFFFF, 0x40000000, -1, -0x7FFFFFFF, -0x7FFFFFFF, -0x7FFFFFFF
+};
+
+static const q15_t atan2_branch_cut_y_q15[ATAN2_BRANCH_CUT_LEN] =
+{
+    0, -1, 1, 0, 0, -1, 1, -0x7FFF
+};
+
+static const q15_t atan2_branch_cut_x_q15[ATAN2_BRANCH_CUT_LEN] =
+{
+    -0x4000, -0x4000, -0x7FFF, 0x4000, -1, -0x7FFF, -0x7FFF, -0x7FFF
+};
+
+JTEST_DEFINE_TEST(arm_atan2_f32_branch_cut_test, arm_atan2_f32)
+{
+    uint32_t i;
+
+    arm_atan2_f32(atan2_branch_cut_y_f32, atan2_branch_cut_x_f32,
+                  fast_math_output_fut, ATAN2_BRANCH_CUT_LEN);
+    ref_atan2_f32(atan2_branch_cut_y_f32, atan2_branch_cut_x_f32,
+                  fast_math_output_ref, ATAN2_BRANCH_CUT_LEN);
+
+    for(i=0;i<ATAN2_BRANCH_CUT_LEN;i++)
+    {
+        if ((fast_math_output_fut[i] != fast_math_output_ref[i]) ||
+            (signbit(fast_math_output_fut[i]) != signbit(atan2_branch_cut_y_f32[i])))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+#define ATAN2_BRANCH_CUT_TEST_TEMPLATE(suffix, type, tolerance)            \
+                                                                            \
+    JTEST_DEFINE_TEST(arm_atan2_##suffix##_branch_cut_test,                \
+                      arm_atan2_##suffix)                                   \
+    {                                                                       \
+        uint32_t i;                                                         \
+        q63_t diff;                                                         \
+        type * fut = (type *) fast_math_output_fut;                         \
+        type * ref = (type *) fast_math_output_ref;                         \
+                                                                            \
+        arm_atan2_##suffix(atan2_branch_cut_y_##suffix,                     \
+                           atan2_branch_cut_x_##suffix,                     \
+                           fut, ATAN2_BRANCH_CUT_LEN);                      \
+        ref_atan2_##suffix(atan2_branch_cut_y_##suffix,                     \
+                           atan2_branch_cut_x_##suffix,                     \
+                           ref, ATAN2_BRANCH_CUT_LEN);                      \
+                                                                            \
+        for(i=0;i<ATAN2_BRANCH_CUT_LEN;i++)                                 \
+        {                                                                   \
+            if (((fut[i] < 0) != (atan2_branch_cut_y_##suffix[i] < 0)) &&   \
+                (fut[i] != 0))                                              \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            diff = (q63_t) fut[i] - (q63_t) ref[i];                         \
+            if ((diff > tolerance) || (diff < -tolerance))                  \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+ATAN2_BRANCH_CUT_TEST_TEMPLATE(q31, q31_t, 24);
+ATAN2_BRANCH_CUT_TEST_TEMPLATE(q15, q15_t, 1);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -35,4 +201,23 @@ JTEST_DEFINE_GROUP(fast_math_tests)
     JTEST_TEST_CALL(arm_cos_f32_test);
     JTEST_TEST_CALL(arm_cos_q31_test);
     JTEST_TEST_CALL(arm_cos_q15_test);
+
+    JTEST_TEST_CALL(arm_vexp_f32_test);
+    JTEST_TEST_CALL(arm_vlog_f32_test);
+
+    JTEST_TEST_CALL(arm_vtanh_f32_test);
+    JTEST_TEST_CALL(arm_vtanh_q31_test);
+    JTEST_TEST_CALL(arm_vtanh_q15_test);
+
+    JTEST_TEST_CALL(arm_vsigmoid_f32_test);
+    JTEST_TEST_CALL(arm_vsigmoid_q31_test);
+    JTEST_TEST_CALL(arm_vsigmoid_q15_test);
+    JTEST_TEST_CALL(arm_vsigmoid_f32_tiny_test);
+
+    JTEST_TEST_CALL(arm_atan2_f32_test);
+    JTEST_TEST_CALL(arm_atan2_q31_test);
+    JTEST_TEST_CALL(arm_atan2_q15_test);
+    JTEST_TEST_CALL(arm_atan2_f32_branch_cut_test);
+    JTEST_TEST_CALL(arm_atan2_q31_branch_cut_test);
+    JTEST_TEST_CALL(arm_atan2_q15_branch_cut_test);
 }
@@ -113,6 +113,125 @@
    }
 
 
+#define BIQUAD_DF2T_WITH_POSTSHIFT_DEFINE_TEST(suffix, output_type)                    \
+   JTEST_DEFINE_TEST(arm_biquad_cascade_df2T_##suffix##_test,                          \
+         arm_biquad_cascade_df2T_##suffix)                                             \
+   {                                                                                   \
+      arm_biquad_cascade_df2T_instance_##suffix biquad_inst_fut = { 0 };               \
+      arm_biquad_cascade_df2T_instance_##suffix biquad_inst_ref = { 0 };               \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes                   \
+            ,                                                                          \
+         TEMPLATE_DO_ARR_DESC(                                                         \
+               numstages_idx, uint16_t, numStages, filtering_numstages                 \
+               ,                                                                       \
+            TEMPLATE_DO_ARR_DESC(                                                      \
+                  postshifts_idx, uint8_t, postShift, filtering_postshifts             \
+                  ,                                                                    \
+                  /* Display test parameter values */                                  \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                                   \
+                                  "Number of Stages: %d\n"                             \
+                                  "Post Shift: %d\n",                                  \
+                                  (int)blockSize,                                      \
+                                  (int)numStages,                                      \
+                                  (int)postShift);                                     \
+                                                                                       \
+                  /* Initialize the BIQUAD Instances */                                \
+                  arm_biquad_cascade_df2T_init_##suffix(                               \
+                        &biquad_inst_fut, numStages,                                   \
+                        (output_type*)filtering_coeffs_b_##suffix,                     \
+                        (void *) filtering_pState, postShift);                         \
+                                                                                       \
+                  JTEST_COUNT_CYCLES(                                                  \
+                        arm_biquad_cascade_df2T_##suffix(                              \
+                              &biquad_inst_fut,                                        \
+                              (void *) filtering_##suffix##_inputs,                    \
+                              (void *) filtering_output_fut,                           \
+                              blockSize));                                             \
+                                                                                       \
+                  arm_biquad_cascade_df2T_init_##suffix(                               \
+                        &biquad_inst_ref, numStages,                                   \
+                        (output_type*)filtering_coeffs_b_##suffix,                     \
+                        (void *) filtering_pState, postShift);                         \
+                                                                                       \
+                  ref_biquad_cascade_df2T_##suffix(                                    \
+                        &biquad_inst_ref,                                              \
+                        (void *) filtering_##suffix##_inputs,                          \
+                        (void *) filtering_output_ref,                                 \
+                        blockSize);                                                    \
+                                                                                       \
+                  FILTERING_SNR_COMPARE_INTERFACE(                                     \
+                        blockSize,                                                     \
+                        output_type))));                                               \
+                                                                                       \
+            return JTEST_TEST_PASSED;                                                  \
+   }
+
+/*
+ * The coefficient lists hold FILTERING_MAX_NUMSTAGES sections, which are
+ * shared between the channels: numChannels * numStages <= FILTERING_MAX_NUMSTAGES.
+ */
+#define BIQUAD_MC_DF2T_INIT_f32(inst, numStages, numChannels)                          \
+   arm_biquad_cascade_mc_df2T_init_f32(inst, numStages, numChannels,                   \
+         (float32_t*)filtering_coeffs_b_f32, (void *) filtering_pState)
+
+#define BIQUAD_MC_DF2T_INIT_q15(inst, numStages, numChannels)                          \
+   arm_biquad_cascade_mc_df2T_init_q15(inst, numStages, numChannels,                   \
+         (q15_t*)filtering_coeffs_b_q15, (void *) filtering_pState, 1)
+
+#define BIQUAD_MC_DF2T_DEFINE_TEST(suffix, output_type)                                \
+   JTEST_DEFINE_TEST(arm_biquad_cascade_mc_df2T_##suffix##_test,                       \
+         arm_biquad_cascade_mc_df2T_##suffix)                                          \
+   {                                                                                   \
+      arm_biquad_cascade_mc_df2T_instance_##suffix biquad_inst_fut = { 0 };            \
+      arm_biquad_cascade_mc_df2T_instance_##suffix biquad_inst_ref = { 0 };            \
+      uint8_t numStages;                                                               \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes                   \
+            ,                                                                          \
+         TEMPLATE_DO_ARR_DESC(                                                         \
+               numchannels_idx, uint16_t, numChannels, filtering_numchannels           \
+               ,                                                                       \
+               numStages = FILTERING_MAX_NUMSTAGES / numChannels;                      \
+                                                                                       \
+               /* Display test parameter values */                                     \
+               JTEST_DUMP_STRF("Block Size: %d\n"                                      \
+                               "Number of Channels: %d\n"                              \
+                               "Number of Stages: %d\n",                               \
+                               (int)blockSize,                                         \
+                               (int)numChannels,                                       \
+                               (int)numStages);                                        \
+                                                                                       \
+               /* Initialize the BIQUAD Instances */                                   \
+               BIQUAD_MC_DF2T_INIT_##suffix(                                           \
+                     &biquad_inst_fut, numStages, numChannels);                        \
+                                                                                       \
+               JTEST_COUNT_CYCLES(                                                     \
+                     arm_biquad_cascade_mc_df2T_##suffix(                              \
+                           &biquad_inst_fut,                                           \
+                           (void *) filtering_##suffix##_inputs,                       \
+                           (void *) filtering_output_fut,                              \
+                           blockSize));                                                \
+                                                                                       \
+               BIQUAD_MC_DF2T_INIT_##suffix(                                           \
+                     &biquad_inst_ref, numStages, numChannels);                        \
+                                                                                       \
+               ref_biquad_cascade_mc_df2T_##suffix(                                    \
+                     &biquad_inst_ref,                                                 \
+                     (void *) filtering_##suffix##_inputs,                             \
+                     (void *) filtering_output_ref,                                    \
+                     blockSize);                                                       \
+                                                                                       \
+               FILTERING_SNR_COMPARE_INTERFACE(                                        \
+                     blockSize * numChannels,                                          \
+                     output_type)));                                                   \
+                                                                                       \
+            return JTEST_TEST_PASSED;                                                  \
+   }
+
+
 JTEST_DEFINE_TEST(arm_biquad_cas_df1_32x64_q31_test,
       arm_biquad_cas_df1_32x64_q31)
 {
@@ -222,6 +341,10 @@ BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,,q15_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,_fast,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fast,q15_t);
+BIQUAD_DF2T_WITH_POSTSHIFT_DEFINE_TEST(q31,q31_t);
+BIQUAD_DF2T_WITH_POSTSHIFT_DEFINE_TEST(q15,q15_t);
+BIQUAD_MC_DF2T_DEFINE_TEST(f32,float32_t);
+BIQUAD_MC_DF2T_DEFINE_TEST(q15,q15_t);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -236,6 +359,10 @@ JTEST_DEFINE_GROUP(biquad_tests)
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_stereo_df2T_f32_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df2T_f64_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df2T_q31_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df2T_q15_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_mc_df2T_f32_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_mc_df2T_q15_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_q15_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q31_test);
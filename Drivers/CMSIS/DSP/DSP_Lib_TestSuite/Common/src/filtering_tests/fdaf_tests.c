@@ -0,0 +1,294 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+#define FDAF_MAX_BLOCK_LEN   64
+#define FDAF_MAX_PARTITIONS  4
+#define FDAF_NUM_SAMPLES     512
+#define FDAF_ERLE_SAMPLES    4096
+
+typedef struct
+{
+    uint16_t blockLen;
+    uint16_t numPartitions;
+    uint16_t echoLen;
+} fdaf_config;
+
+/* Echo paths shorter than, as long as and longer than the adaptive filter,
+   with power of two and mixed radix block lengths */
+static const fdaf_config fdaf_configs[] =
+{
+    {16, 1, 12},
+    {16, 4, 64},
+    {32, 2, 80},
+    {64, 3, 150},
+    {30, 2, 45},
+    {60, 1, 90},
+};
+
+static const float32_t fdaf_mu = 0.5f;
+
+static uint32_t fdaf_arena_buf[ARM_FDAF_ARENA_SIZE_F32(FDAF_MAX_BLOCK_LEN, FDAF_MAX_PARTITIONS) / 4 + 1];
+
+static float32_t fdaf_echo[FDAF_MAX_BLOCK_LEN * FDAF_MAX_PARTITIONS];
+static float32_t fdaf_x[FDAF_ERLE_SAMPLES];
+static float32_t fdaf_d[FDAF_ERLE_SAMPLES];
+static float32_t fdaf_out_fut[FDAF_ERLE_SAMPLES];
+static float32_t fdaf_err_fut[FDAF_ERLE_SAMPLES];
+static float32_t fdaf_out_ref[FDAF_NUM_SAMPLES];
+static float32_t fdaf_err_ref[FDAF_NUM_SAMPLES];
+
+/**
+ *  Fill the input with numSamples white noise samples in [-0.5, 0.5) and the
+ *  reference with the input through a decaying echo path of echoLen taps.
+ */
+static void fdaf_echo_signals(uint32_t echoLen, uint32_t numSamples)
+{
+    uint32_t seed = 12345;
+    float32_t gain = 0.8f;
+    float32_t sum;
+    uint32_t n, k;
+
+    for (k = 0; k < echoLen; k++)
+    {
+        fdaf_echo[k] = gain * ((k % 3 == 1) ? -1.0f : 1.0f) *
+            (0.5f + filtering_f32_inputs[k] / 512);
+        gain *= 0.97f;
+    }
+
+    for (n = 0; n < numSamples; n++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        fdaf_x[n] = (float32_t) (seed >> 8) / 16777216.0f - 0.5f;
+    }
+
+    for (n = 0; n < numSamples; n++)
+    {
+        sum = 0.0f;
+        for (k = 0; (k < echoLen) && (k <= n); k++)
+        {
+            sum += fdaf_echo[k] * fdaf_x[n - k];
+        }
+        fdaf_d[n] = sum;
+    }
+}
+
+/**
+ *  Adapt the filter block by block on the echo signals and compare the output
+ *  and the error with the reference filter.
+ */
+JTEST_DEFINE_TEST(arm_fdaf_block_f32_test,
+                  arm_fdaf_block_f32)
+{
+    arm_fdaf_instance_f32 inst_fut;
+    arm_table_arena arena;
+    const fdaf_config *cfg;
+    uint32_t c, b, L, N;
+
+    for (c = 0; c < sizeof(fdaf_configs) / sizeof(fdaf_configs[0]); c++)
+    {
+        cfg = &fdaf_configs[c];
+        L = cfg->blockLen;
+        N = (FDAF_NUM_SAMPLES / L) * L;
+        fdaf_echo_signals(cfg->echoLen, FDAF_NUM_SAMPLES);
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Block Length: %d\n"
+                        "Number of Partitions: %d\n"
+                        "Echo Length: %d\n",
+                        (int)L,
+                        (int)cfg->numPartitions,
+                        (int)cfg->echoLen);
+
+        arm_table_arena_init(&arena, fdaf_arena_buf, sizeof(fdaf_arena_buf));
+        if ((arm_fdaf_init_f32(&inst_fut, L, cfg->numPartitions, fdaf_mu,
+                               &arena) != ARM_MATH_SUCCESS) ||
+            (arena.used > ARM_FDAF_ARENA_SIZE_F32(L, cfg->numPartitions)))
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        for (b = 0; b < N / L; b++)
+        {
+            JTEST_COUNT_CYCLES(
+                arm_fdaf_block_f32(&inst_fut, fdaf_x + b * L, fdaf_d + b * L,
+                                   fdaf_out_fut + b * L, fdaf_err_fut + b * L));
+        }
+
+        ref_fdaf_f32(L, cfg->numPartitions, fdaf_mu, inst_fut.alpha, inst_fut.delta,
+                     fdaf_x, fdaf_d, fdaf_out_ref, fdaf_err_ref, N / L);
+
+        /* The output of the first block is zero */
+        TEST_ASSERT_SNR(fdaf_out_ref + L, fdaf_out_fut + L, N - L,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+        TEST_ASSERT_SNR(fdaf_err_ref, fdaf_err_fut, N,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Feed the streaming function in chunks of irregular sizes: it must return the
+ *  output and the error of the block function, delayed by one block.
+ */
+JTEST_DEFINE_TEST(arm_fdaf_f32_test,
+                  arm_fdaf_f32)
+{
+    static const uint16_t chunks[] = {1, 7, 16, 33, 2, 64, 5};
+    arm_fdaf_instance_f32 inst_fut;
+    arm_table_arena arena;
+    const fdaf_config *cfg;
+    uint32_t c, b, n, len, i, L;
+
+    for (c = 0; c < sizeof(fdaf_configs) / sizeof(fdaf_configs[0]); c++)
+    {
+        cfg = &fdaf_configs[c];
+        L = cfg->blockLen;
+        fdaf_echo_signals(cfg->echoLen, FDAF_NUM_SAMPLES);
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Block Length: %d\n"
+                        "Number of Partitions: %d\n",
+                        (int)L,
+                        (int)cfg->numPartitions);
+
+        arm_table_arena_init(&arena, fdaf_arena_buf, sizeof(fdaf_arena_buf));
+        if (arm_fdaf_init_f32(&inst_fut, L, cfg->numPartitions, fdaf_mu,
+                              &arena) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        for (b = 0; b < FDAF_NUM_SAMPLES / L; b++)
+        {
+            arm_fdaf_block_f32(&inst_fut, fdaf_x + b * L, fdaf_d + b * L,
+                               fdaf_out_ref + b * L, fdaf_err_ref + b * L);
+        }
+
+        arm_table_arena_init(&arena, fdaf_arena_buf, sizeof(fdaf_arena_buf));
+        if (arm_fdaf_init_f32(&inst_fut, L, cfg->numPartitions, fdaf_mu,
+                              &arena) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        for (n = 0, i = 0; n < FDAF_NUM_SAMPLES; n += len, i++)
+        {
+            len = chunks[i % (sizeof(chunks) / sizeof(chunks[0]))];
+            len = (len < FDAF_NUM_SAMPLES - n) ? len : FDAF_NUM_SAMPLES - n;
+
+            JTEST_COUNT_CYCLES(
+                arm_fdaf_f32(&inst_fut, fdaf_x + n, fdaf_d + n,
+                             fdaf_out_fut + n, fdaf_err_fut + n, len));
+        }
+
+        for (n = 0; n < L; n++)
+        {
+            if ((fdaf_out_fut[n] != 0.0f) || (fdaf_err_fut[n] != 0.0f))
+            {
+                return JTEST_TEST_FAILED;
+            }
+        }
+
+        TEST_ASSERT_BUFFERS_EQUAL(fdaf_out_ref, fdaf_out_fut + L,
+                                  (FDAF_NUM_SAMPLES - L) * sizeof(float32_t));
+        TEST_ASSERT_BUFFERS_EQUAL(fdaf_err_ref, fdaf_err_fut + L,
+                                  (FDAF_NUM_SAMPLES - L) * sizeof(float32_t));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Cancel an echo path shorter than the filter: the error power of the last
+ *  blocks must be at least 30 dB below the echo power (echo return loss
+ *  enhancement).
+ */
+JTEST_DEFINE_TEST(arm_fdaf_block_f32_erle_test,
+                  arm_fdaf_block_f32)
+{
+    static const uint16_t blockLens[] = {32, 30};
+    arm_fdaf_instance_f32 inst_fut;
+    arm_table_arena arena;
+    float32_t echoPower, errPower;
+    uint32_t c, L, P = 4, b, N, tail = FDAF_ERLE_SAMPLES / 4;
+
+    fdaf_echo_signals(100, FDAF_ERLE_SAMPLES);
+
+    for (c = 0; c < sizeof(blockLens) / sizeof(blockLens[0]); c++)
+    {
+        L = blockLens[c];
+        N = (FDAF_ERLE_SAMPLES / L) * L;
+
+        arm_table_arena_init(&arena, fdaf_arena_buf, sizeof(fdaf_arena_buf));
+        if (arm_fdaf_init_f32(&inst_fut, L, P, fdaf_mu, &arena) != ARM_MATH_SUCCESS)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        for (b = 0; b < N / L; b++)
+        {
+            arm_fdaf_block_f32(&inst_fut, fdaf_x + b * L, fdaf_d + b * L,
+                               fdaf_out_fut + b * L, fdaf_err_fut + b * L);
+        }
+
+        arm_power_f32(fdaf_d + N - tail, tail, &echoPower);
+        arm_power_f32(fdaf_err_fut + N - tail, tail, &errPower);
+
+        JTEST_DUMP_STRF("Block Length: %d\n"
+                        "ERLE: %f dB\n",
+                        (int)L,
+                        10 * log10(echoPower / errPower));
+        if (!(errPower * 1000.0f < echoPower))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_fdaf_init_f32_test,
+                  arm_fdaf_init_f32)
+{
+    arm_fdaf_instance_f32 inst_fut;
+    arm_table_arena arena;
+
+    arm_table_arena_init(&arena, fdaf_arena_buf, sizeof(fdaf_arena_buf));
+    if ((arm_fdaf_init_f32(&inst_fut, 0, 2, fdaf_mu, &arena) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_fdaf_init_f32(&inst_fut, 32, 0, fdaf_mu, &arena) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_fdaf_init_f32(&inst_fut, 14, 2, fdaf_mu, &arena) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arena.used != 0))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* An arena too small is reported and left as it was */
+    arm_table_arena_init(&arena, fdaf_arena_buf, ARM_FDAF_ARENA_SIZE_F32(32, 2) / 2);
+    arm_table_arena_alloc(&arena, 4U);
+    if ((arm_fdaf_init_f32(&inst_fut, 32, 2, fdaf_mu, &arena) != ARM_MATH_LENGTH_ERROR) ||
+        (arena.used != 4U))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fdaf_tests)
+{
+    JTEST_TEST_CALL(arm_fdaf_block_f32_test);
+    JTEST_TEST_CALL(arm_fdaf_f32_test);
+    JTEST_TEST_CALL(arm_fdaf_block_f32_erle_test);
+    JTEST_TEST_CALL(arm_fdaf_init_f32_test);
+}
@@ -590,6 +590,12 @@ ARR_DESC_DEFINE(uint8_t,
                 CURLY(
                       1, 2, 4, 7, 11, FILTERING_MAX_M));
 
+ARR_DESC_DEFINE(uint16_t,
+                filtering_numchannels,
+                4,
+                CURLY(
+                      1, 3, 4, 7));
+
 
 /*--------------------------------------------------------------------------------*/
 /* Coefficient Lists */
@@ -9,8 +9,11 @@ JTEST_DEFINE_GROUP(filtering_tests)
     JTEST_GROUP_CALL(biquad_tests);
     JTEST_GROUP_CALL(conv_tests);
     JTEST_GROUP_CALL(correlate_tests);
+    JTEST_GROUP_CALL(fdaf_tests);
     JTEST_GROUP_CALL(fir_tests);
     JTEST_GROUP_CALL(iir_tests);
+    JTEST_GROUP_CALL(kalman_tests);
+    JTEST_GROUP_CALL(median_tests);
     JTEST_GROUP_CALL(lms_tests);
 
     return;
@@ -339,6 +339,299 @@
             return JTEST_TEST_PASSED;                                   \
    }
 
+/* Arena and sizes of the partitioned FIR tests */
+#define FIR_PARTITIONED_BLOCKSIZE   16
+#define FIR_PARTITIONED_CALLSIZE    64
+#define FIR_PARTITIONED_NUMSAMPLES  512
+static uint32_t fir_partitioned_arena_buf[4096];
+
+#define FIR_PARTITIONED_DEFINE_TEST(config_suffix, max_blocksize)          \
+   JTEST_DEFINE_TEST(arm_fir_partitioned_f32_##config_suffix##_test,      \
+         arm_fir_partitioned_f32)                                         \
+   {                                                                      \
+      arm_fir_partitioned_instance_f32 fir_inst_fut;                      \
+      arm_fir_instance_f32 fir_inst_ref = { 0 };                          \
+      arm_table_arena arena;                                              \
+      uint32_t i;                                                         \
+                                                                          \
+      TEMPLATE_DO_ARR_DESC(                                               \
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps             \
+            ,                                                             \
+            /* Display test parameter values */                           \
+            JTEST_DUMP_STRF("Block Size: %d\n"                            \
+                            "Number of Taps: %d\n"                        \
+                            "Max Partition: %d\n",                        \
+                            (int)FIR_PARTITIONED_CALLSIZE,                \
+                            (int)numTaps,                                 \
+                            (int)max_blocksize);                          \
+                                                                          \
+            /* Initialize the FIR Instances */                            \
+            arm_table_arena_init(&arena, fir_partitioned_arena_buf,       \
+                                 sizeof(fir_partitioned_arena_buf));      \
+                                                                          \
+            if (arm_fir_partitioned_init_f32(                             \
+                  &fir_inst_fut, numTaps,                                 \
+                  (float32_t*)filtering_coeffs_f32,                       \
+                  FIR_PARTITIONED_BLOCKSIZE, max_blocksize,               \
+                  &arena) != ARM_MATH_SUCCESS)                            \
+            {                                                             \
+                return JTEST_TEST_FAILED;                                 \
+            }                                                             \
+                                                                          \
+            for (i = 0; i < FIR_PARTITIONED_NUMSAMPLES;                   \
+                 i += FIR_PARTITIONED_CALLSIZE)                           \
+            {                                                             \
+               JTEST_COUNT_CYCLES(                                        \
+                     arm_fir_partitioned_f32(                             \
+                           &fir_inst_fut,                                 \
+                           (float32_t *) filtering_f32_inputs + i,        \
+                           (float32_t *) filtering_output_fut + i,        \
+                           FIR_PARTITIONED_CALLSIZE));                    \
+            }                                                             \
+                                                                          \
+            arm_fir_init_f32(                                             \
+                  &fir_inst_ref, numTaps,                                 \
+                  (float32_t*)filtering_coeffs_f32,                       \
+                  (void *) filtering_pState, FIR_PARTITIONED_NUMSAMPLES); \
+                                                                          \
+            ref_fir_f32(                                                  \
+                  &fir_inst_ref,                                          \
+                  (void *) filtering_f32_inputs,                          \
+                  (void *) filtering_output_ref,                          \
+                  FIR_PARTITIONED_NUMSAMPLES);                            \
+                                                                          \
+            FILTERING_SNR_COMPARE_INTERFACE(                              \
+                  FIR_PARTITIONED_NUMSAMPLES,                             \
+                  float32_t));                                            \
+                                                                          \
+      return JTEST_TEST_PASSED;                                           \
+   }
+
+/* Keep every M-th output of the reference interpolator, returns the number kept */
+#define FIR_RESAMPLE_PICK_REF(output_type, numOut, M)                      \
+   do                                                                      \
+   {                                                                       \
+      uint32_t k;                                                          \
+      for (k = 0; k < (numOut); k++)                                       \
+      {                                                                    \
+         ((output_type *) filtering_output_ref)[k] =                       \
+            ((output_type *) filtering_output_ref)[k * (M)];               \
+      }                                                                    \
+   } while (0)
+
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                      \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                     \
+         arm_fir_resample_##suffix)                                        \
+   {                                                                       \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };             \
+      arm_fir_interpolate_instance_##suffix fir_inst_ref = { 0 };          \
+      uint32_t numOut = 0;                                                 \
+                                                                           \
+      TEMPLATE_DO_ARR_DESC(                                                \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes       \
+            ,                                                              \
+         TEMPLATE_DO_ARR_DESC(                                             \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2          \
+               ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                          \
+                  L_idx, uint8_t, L, filtering_Ls                          \
+                  ,                                                        \
+               TEMPLATE_DO_ARR_DESC(                                       \
+                     M_idx, uint8_t, M, filtering_Ms                       \
+                     ,                                                     \
+                     /* Display test parameter values */                   \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                    \
+                                     "Number of Taps: %d\n"                \
+                                     "Upsample factor: %d\n"               \
+                                     "Downsample factor: %d\n",            \
+                                     (int)blockSize,                       \
+                                     (int)numTaps,                         \
+                                     (int)L,                               \
+                                     (int)M);                              \
+                                                                           \
+                     /* Initialize the FIR Instances */                    \
+                     arm_fir_resample_init_##suffix(                       \
+                           &fir_inst_fut, L, M, numTaps,                   \
+                           (output_type*)filtering_coeffs_##suffix,        \
+                           (void *) filtering_pState, blockSize);          \
+                                                                           \
+                     JTEST_COUNT_CYCLES(                                   \
+                           numOut = arm_fir_resample_##suffix(             \
+                                 &fir_inst_fut,                            \
+                                 (void *) filtering_##suffix##_inputs,     \
+                                 (void *) filtering_output_fut,            \
+                                 blockSize));                              \
+                                                                           \
+                     if (numOut != (blockSize * L + M - 1) / M)            \
+                     {                                                     \
+                           return JTEST_TEST_FAILED;                       \
+                     }                                                     \
+                                                                           \
+                     arm_fir_interpolate_init_##suffix(                    \
+                           &fir_inst_ref, L, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,        \
+                           (void *) filtering_pState, blockSize);          \
+                                                                           \
+                     ref_fir_interpolate_##suffix(                         \
+                           &fir_inst_ref,                                  \
+                           (void *) filtering_##suffix##_inputs,           \
+                           (void *) filtering_output_ref,                  \
+                           blockSize);                                     \
+                                                                           \
+                     FIR_RESAMPLE_PICK_REF(output_type, numOut, M);        \
+                                                                           \
+                     FILTERING_SNR_COMPARE_INTERFACE(                      \
+                           numOut,                                         \
+                           output_type)))));                               \
+                                                                           \
+            return JTEST_TEST_PASSED;                                      \
+   }
+
+/* With a step of exactly M/L input samples the fractional resampler computes
+   the outputs of the rational one, up to the last input sample of the block */
+#define FIR_RESAMPLE_FRAC_DEFINE_TEST(suffix, output_type)                 \
+   JTEST_DEFINE_TEST(arm_fir_resample_frac_##suffix##_test,                \
+         arm_fir_resample_frac_##suffix)                                   \
+   {                                                                       \
+      arm_fir_resample_frac_instance_##suffix fir_inst_fut = { 0 };        \
+      arm_fir_interpolate_instance_##suffix fir_inst_ref = { 0 };          \
+      uint32_t numOut = 0;                                                 \
+                                                                           \
+      TEMPLATE_DO_ARR_DESC(                                                \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes       \
+            ,                                                              \
+         TEMPLATE_DO_ARR_DESC(                                             \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2          \
+               ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                          \
+                  L_idx, uint8_t, L, filtering_Ls                          \
+                  ,                                                        \
+               TEMPLATE_DO_ARR_DESC(                                       \
+                     M_idx, uint8_t, M, filtering_Ms                       \
+                     ,                                                     \
+                     if ((((uint32_t)M << 24) % L) != 0)                   \
+                     {                                                     \
+                        continue;                                          \
+                     }                                                     \
+                                                                           \
+                     /* Display test parameter values */                   \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                    \
+                                     "Number of Taps: %d\n"                \
+                                     "Number of phases: %d\n"              \
+                                     "Step: %d/%d\n",                      \
+                                     (int)blockSize,                       \
+                                     (int)numTaps,                         \
+                                     (int)L,                               \
+                                     (int)M, (int)L);                      \
+                                                                           \
+                     /* Initialize the FIR Instances */                    \
+                     arm_fir_resample_frac_init_##suffix(                  \
+                           &fir_inst_fut, L, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,        \
+                           (void *) filtering_pState, blockSize,           \
+                           ((uint32_t)M << 24) / L);                       \
+                                                                           \
+                     JTEST_COUNT_CYCLES(                                   \
+                           numOut = arm_fir_resample_frac_##suffix(        \
+                                 &fir_inst_fut,                            \
+                                 (void *) filtering_##suffix##_inputs,     \
+                                 (void *) filtering_output_fut,            \
+                                 blockSize));                              \
+                                                                           \
+                     if (numOut != ((blockSize - 1) * L + M - 1) / M)      \
+                     {                                                     \
+                           return JTEST_TEST_FAILED;                       \
+                     }                                                     \
+                                                                           \
+                     arm_fir_interpolate_init_##suffix(                    \
+                           &fir_inst_ref, L, numTaps,                      \
+                           (output_type*)filtering_coeffs_##suffix,        \
+                           (void *) filtering_pState, blockSize);          \
+                                                                           \
+                     ref_fir_interpolate_##suffix(                         \
+                           &fir_inst_ref,                                  \
+                           (void *) filtering_##suffix##_inputs,           \
+                           (void *) filtering_output_ref,                  \
+                           blockSize);                                     \
+                                                                           \
+                     FIR_RESAMPLE_PICK_REF(output_type, numOut, M);        \
+                                                                           \
+                     if (numOut > 0)                                       \
+                     {                                                     \
+                        FILTERING_SNR_COMPARE_INTERFACE(                   \
+                              numOut,                                      \
+                              output_type);                                \
+                     }))));                                                \
+                                                                           \
+            return JTEST_TEST_PASSED;                                      \
+   }
+
+/* Tap counts of the fully unrolled kernels (ARM_FIR_FIXED_TAPS) */
+static const uint16_t fir_fixed_numtaps[] = {16, 32, 64};
+
+#define FIR_FIXED_NUMSAMPLES  231
+static uint32_t fir_fixed_state[64 + FILTERING_MAX_BLOCKSIZE];
+
+/* Run the filter call after call over a signal and compare with the reference
+   filtering it in one call, so that the state kept between calls is checked */
+#define FIR_FIXED_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_fixed_##suffix##_test,                        \
+         arm_fir_##suffix)                                                 \
+   {                                                                       \
+      arm_fir_instance_##suffix fir_inst_fut = { 0 };                      \
+      arm_fir_instance_##suffix fir_inst_ref = { 0 };                      \
+      uint32_t t, i, len;                                                  \
+                                                                           \
+      for (t = 0; t < sizeof(fir_fixed_numtaps) / sizeof(uint16_t); t++)   \
+      {                                                                    \
+         TEMPLATE_DO_ARR_DESC(                                             \
+               blocksize_idx, uint32_t, blockSize, filtering_blocksizes    \
+               ,                                                           \
+               /* Display test parameter values */                         \
+               JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                               "Number of Taps: %d\n",                     \
+                               (int)blockSize,                             \
+                               (int)fir_fixed_numtaps[t]);                 \
+                                                                           \
+               /* Initialize the FIR Instances */                          \
+               arm_fir_init_##suffix(                                      \
+                     &fir_inst_fut, fir_fixed_numtaps[t],                  \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) fir_fixed_state, blockSize);                 \
+                                                                           \
+               for (i = 0; i < FIR_FIXED_NUMSAMPLES; i += len)             \
+               {                                                           \
+                  len = FIR_FIXED_NUMSAMPLES - i;                          \
+                  len = (len < blockSize) ? len : blockSize;               \
+                                                                           \
+                  JTEST_COUNT_CYCLES(                                      \
+                        arm_fir_##suffix(                                  \
+                              &fir_inst_fut,                               \
+                              (output_type *) filtering_##suffix##_inputs  \
+                                 + i,                                      \
+                              (output_type *) filtering_output_fut + i,    \
+                              len));                                       \
+               }                                                           \
+                                                                           \
+               arm_fir_init_##suffix(                                      \
+                     &fir_inst_ref, fir_fixed_numtaps[t],                  \
+                     (output_type*)filtering_coeffs_##suffix,              \
+                     (void *) filtering_pState, FIR_FIXED_NUMSAMPLES);     \
+                                                                           \
+               ref_fir_##suffix(                                           \
+                     &fir_inst_ref,                                        \
+                     (void *) filtering_##suffix##_inputs,                 \
+                     (void *) filtering_output_ref,                        \
+                     FIR_FIXED_NUMSAMPLES);                                \
+                                                                           \
+               FILTERING_SNR_COMPARE_INTERFACE(                            \
+                     FIR_FIXED_NUMSAMPLES,                                 \
+                     output_type));                                        \
+      }                                                                    \
+                                                                           \
+      return JTEST_TEST_PASSED;                                            \
+   }
+
 FIR_DEFINE_TEST(f32,,float32_t);
 FIR_DEFINE_TEST(q31,,q31_t);
 FIR_DEFINE_TEST(q15,,q15_t);
@@ -346,6 +639,207 @@ FIR_DEFINE_TEST(q31,_fast,q31_t);
 FIR_DEFINE_TEST(q15,_fast,q15_t);
 FIR_DEFINE_TEST(q7,,q7_t);
 
+FIR_FIXED_DEFINE_TEST(f32,float32_t);
+FIR_FIXED_DEFINE_TEST(q31,q31_t);
+FIR_FIXED_DEFINE_TEST(q15,q15_t);
+
+/* Tap counts of the circular state tests, with and without unrolled kernels */
+static const uint16_t fir_circ_numtaps[] = {4, 6, 14, 16, 32, 34, 64};
+
+static float32_t fir_circ_state[2 * (64 + FILTERING_MAX_BLOCKSIZE - 1)];
+
+/* Filter the same signal call after call with the circular state functions and
+   with the functions moving their state: the outputs must be identical */
+JTEST_DEFINE_TEST(arm_fir_circ_f32_test,
+                  arm_fir_circ_f32)
+{
+    arm_fir_circ_instance_f32 fir_inst_fut;
+    arm_fir_instance_f32 fir_inst_ref;
+    uint32_t t, i, len;
+    uint16_t numTaps;
+
+    for (t = 0; t < sizeof(fir_circ_numtaps) / sizeof(uint16_t); t++)
+    {
+        numTaps = fir_circ_numtaps[t];
+
+        TEMPLATE_DO_ARR_DESC(
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+            ,
+            /* Display test parameter values */
+            JTEST_DUMP_STRF("Block Size: %d\n"
+                            "Number of Taps: %d\n",
+                            (int)blockSize,
+                            (int)numTaps);
+
+            if (arm_fir_circ_init_f32(&fir_inst_fut, numTaps,
+                                      (float32_t *) filtering_coeffs_f32,
+                                      fir_circ_state, blockSize) != ARM_MATH_SUCCESS)
+            {
+                return JTEST_TEST_FAILED;
+            }
+            arm_fir_init_f32(&fir_inst_ref, numTaps, (float32_t *) filtering_coeffs_f32,
+                             (float32_t *) fir_fixed_state, blockSize);
+
+            /* The last call is shorter than the block size */
+            for (i = 0; i < FIR_FIXED_NUMSAMPLES; i += len)
+            {
+                len = FIR_FIXED_NUMSAMPLES - i;
+                len = (len < blockSize) ? len : blockSize;
+
+                JTEST_COUNT_CYCLES(
+                    arm_fir_circ_f32(&fir_inst_fut, filtering_f32_inputs + i,
+                                     filtering_output_fut + i, len));
+                arm_fir_f32(&fir_inst_ref, (float32_t *) filtering_f32_inputs + i,
+                            filtering_output_ref + i, len);
+            }
+
+            TEST_ASSERT_BUFFERS_EQUAL(filtering_output_ref, filtering_output_fut,
+                                      FIR_FIXED_NUMSAMPLES * sizeof(float32_t)));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_fir_decimate_circ_f32_test,
+                  arm_fir_decimate_circ_f32)
+{
+    arm_fir_decimate_circ_instance_f32 fir_inst_fut;
+    arm_fir_decimate_instance_f32 fir_inst_ref;
+    uint32_t b, numBlocks;
+
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+        TEMPLATE_DO_ARR_DESC(
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps
+            ,
+            TEMPLATE_DO_ARR_DESC(
+                M_idx, uint8_t, M, filtering_Ms
+                ,
+                if (blockSize % M == 0)
+                {
+                    /* Display test parameter values */
+                    JTEST_DUMP_STRF("Block Size: %d\n"
+                                    "Number of Taps: %d\n"
+                                    "Decimation Factor: %d\n",
+                                    (int)blockSize,
+                                    (int)numTaps,
+                                    (int)M);
+
+                    if (arm_fir_decimate_circ_init_f32(
+                            &fir_inst_fut, numTaps, M,
+                            (float32_t *) filtering_coeffs_f32,
+                            fir_circ_state, blockSize) != ARM_MATH_SUCCESS)
+                    {
+                        return JTEST_TEST_FAILED;
+                    }
+                    arm_fir_decimate_init_f32(&fir_inst_ref, numTaps, M,
+                                              (float32_t *) filtering_coeffs_f32,
+                                              (float32_t *) fir_fixed_state, blockSize);
+
+                    numBlocks = FIR_FIXED_NUMSAMPLES / blockSize;
+
+                    for (b = 0; b < numBlocks; b++)
+                    {
+                        JTEST_COUNT_CYCLES(
+                            arm_fir_decimate_circ_f32(
+                                &fir_inst_fut, filtering_f32_inputs + b * blockSize,
+                                filtering_output_fut + b * (blockSize / M), blockSize));
+                        arm_fir_decimate_f32(
+                            &fir_inst_ref, (float32_t *) filtering_f32_inputs + b * blockSize,
+                            filtering_output_ref + b * (blockSize / M), blockSize);
+                    }
+
+                    TEST_ASSERT_BUFFERS_EQUAL(
+                        filtering_output_ref, filtering_output_fut,
+                        numBlocks * (blockSize / M) * sizeof(float32_t));
+                })));
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_fir_interpolate_circ_f32_test,
+                  arm_fir_interpolate_circ_f32)
+{
+    arm_fir_interpolate_circ_instance_f32 fir_inst_fut;
+    arm_fir_interpolate_instance_f32 fir_inst_ref;
+    uint32_t i, len;
+
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, filtering_blocksizes
+        ,
+        TEMPLATE_DO_ARR_DESC(
+            numtaps_idx, uint16_t, numTaps, filtering_numtaps2
+            ,
+            TEMPLATE_DO_ARR_DESC(
+                L_idx, uint8_t, L, filtering_Ls
+                ,
+                /* Display test parameter values */
+                JTEST_DUMP_STRF("Block Size: %d\n"
+                                "Number of Taps: %d\n"
+                                "Upsample factor: %d\n",
+                                (int)blockSize,
+                                (int)numTaps,
+                                (int)L);
+
+                if (arm_fir_interpolate_circ_init_f32(
+                        &fir_inst_fut, L, numTaps,
+                        (float32_t *) filtering_coeffs_f32,
+                        fir_circ_state, blockSize) != ARM_MATH_SUCCESS)
+                {
+                    return JTEST_TEST_FAILED;
+                }
+                arm_fir_interpolate_init_f32(&fir_inst_ref, L, numTaps,
+                                             (float32_t *) filtering_coeffs_f32,
+                                             (float32_t *) fir_fixed_state, blockSize);
+
+                /* The last call is shorter than the block size */
+                for (i = 0; i < FIR_FIXED_NUMSAMPLES; i += len)
+                {
+                    len = FIR_FIXED_NUMSAMPLES - i;
+                    len = (len < blockSize) ? len : blockSize;
+
+                    JTEST_COUNT_CYCLES(
+                        arm_fir_interpolate_circ_f32(
+                            &fir_inst_fut, filtering_f32_inputs + i,
+                            filtering_output_fut + i * L, len));
+                    arm_fir_interpolate_f32(
+                        &fir_inst_ref, (float32_t *) filtering_f32_inputs + i,
+                        filtering_output_ref + i * L, len);
+                }
+
+                TEST_ASSERT_BUFFERS_EQUAL(
+                    filtering_output_ref, filtering_output_fut,
+                    FIR_FIXED_NUMSAMPLES * L * sizeof(float32_t)))));
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_fir_circ_init_f32_test,
+                  arm_fir_circ_init_f32)
+{
+    arm_fir_circ_instance_f32 fir_inst;
+    arm_fir_decimate_circ_instance_f32 dec_inst;
+    arm_fir_interpolate_circ_instance_f32 int_inst;
+    float32_t *pCoeffs = (float32_t *) filtering_coeffs_f32;
+
+    if ((arm_fir_circ_init_f32(&fir_inst, 0, pCoeffs, fir_circ_state, 16)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_fir_circ_init_f32(&fir_inst, 16, pCoeffs, fir_circ_state, 0)
+         != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_fir_circ_init_f32(&fir_inst, 16, pCoeffs, fir_circ_state, 0x10000)
+         != ARM_MATH_LENGTH_ERROR) ||
+        (arm_fir_decimate_circ_init_f32(&dec_inst, 16, 3, pCoeffs, fir_circ_state, 16)
+         != ARM_MATH_LENGTH_ERROR) ||
+        (arm_fir_interpolate_circ_init_f32(&int_inst, 4, 18, pCoeffs, fir_circ_state, 16)
+         != ARM_MATH_LENGTH_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
 FIR_LATTICE_DEFINE_TEST(f32,float32_t);
 FIR_LATTICE_DEFINE_TEST(q31,q31_t);
 FIR_LATTICE_DEFINE_TEST(q15,q15_t);
@@ -365,6 +859,17 @@ FIR_SPARSE_DEFINE_TEST(q31,q31_t);
 FIR_SPARSE2_DEFINE_TEST(q15,q15_t);
 FIR_SPARSE2_DEFINE_TEST(q7,q7_t);
 
+FIR_RESAMPLE_DEFINE_TEST(f32,float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q31,q31_t);
+FIR_RESAMPLE_DEFINE_TEST(q15,q15_t);
+
+FIR_RESAMPLE_FRAC_DEFINE_TEST(f32,float32_t);
+FIR_RESAMPLE_FRAC_DEFINE_TEST(q31,q31_t);
+FIR_RESAMPLE_FRAC_DEFINE_TEST(q15,q15_t);
+
+FIR_PARTITIONED_DEFINE_TEST(uniform, 16);
+FIR_PARTITIONED_DEFINE_TEST(nonuniform, 32);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -381,6 +886,15 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_fast_q31_test);
    JTEST_TEST_CALL(arm_fir_fast_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_fixed_f32_test);
+   JTEST_TEST_CALL(arm_fir_fixed_q31_test);
+   JTEST_TEST_CALL(arm_fir_fixed_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_circ_f32_test);
+   JTEST_TEST_CALL(arm_fir_decimate_circ_f32_test);
+   JTEST_TEST_CALL(arm_fir_interpolate_circ_f32_test);
+   JTEST_TEST_CALL(arm_fir_circ_init_f32_test);
+
    JTEST_TEST_CALL(arm_fir_lattice_f32_test);
    JTEST_TEST_CALL(arm_fir_lattice_q31_test);
    JTEST_TEST_CALL(arm_fir_lattice_q15_test);
@@ -399,4 +913,15 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_sparse_q31_test);
    JTEST_TEST_CALL(arm_fir_sparse_q15_test);
    JTEST_TEST_CALL(arm_fir_sparse_q7_test);
+
+   JTEST_TEST_CALL(arm_fir_resample_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_resample_frac_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_frac_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_frac_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_partitioned_f32_uniform_test);
+   JTEST_TEST_CALL(arm_fir_partitioned_f32_nonuniform_test);
 }
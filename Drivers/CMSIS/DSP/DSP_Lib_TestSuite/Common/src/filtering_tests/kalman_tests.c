@@ -0,0 +1,239 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+#define KALMAN_MAX_AXES   4
+#define KALMAN_MAX_STATES (2 * KALMAN_MAX_AXES)
+#define KALMAN_NUM_STEPS  16
+
+/* Number of measured axes. The state holds a position and a velocity per axis */
+static const uint16_t kalman_axes[] = {1, 2, 3, 4};
+
+static const float32_t kalman_dt = 0.1f;
+static const float32_t kalman_q = 0.5f;
+static const float32_t kalman_r = 0.25f;
+
+static float32_t kalman_F[KALMAN_MAX_STATES * KALMAN_MAX_STATES];
+static float32_t kalman_Q[KALMAN_MAX_STATES * KALMAN_MAX_STATES];
+static float32_t kalman_H[KALMAN_MAX_AXES * KALMAN_MAX_STATES];
+static float32_t kalman_R[KALMAN_MAX_AXES * KALMAN_MAX_AXES];
+
+static float32_t kalman_x_fut[KALMAN_MAX_STATES];
+static float32_t kalman_x_ref[KALMAN_MAX_STATES];
+static float32_t kalman_P_fut[KALMAN_MAX_STATES * KALMAN_MAX_STATES];
+static float32_t kalman_P_ref[KALMAN_MAX_STATES * KALMAN_MAX_STATES];
+static float32_t kalman_work[2 * KALMAN_MAX_STATES * KALMAN_MAX_STATES
+                             + 2 * KALMAN_MAX_STATES * KALMAN_MAX_AXES
+                             + KALMAN_MAX_AXES * KALMAN_MAX_AXES];
+static float32_t kalman_z[KALMAN_MAX_AXES];
+static float32_t kalman_hx[KALMAN_MAX_AXES];
+
+/**
+ *  Build a constant velocity model with numAxes measured positions, a white
+ *  noise acceleration and independent sensors, and the initial estimates.
+ */
+static void kalman_model(uint32_t numAxes)
+{
+    uint32_t n = 2 * numAxes;
+    uint32_t i, j, a;
+    float32_t dt = kalman_dt;
+
+    memset(kalman_F, 0, sizeof(kalman_F));
+    memset(kalman_Q, 0, sizeof(kalman_Q));
+    memset(kalman_H, 0, sizeof(kalman_H));
+    memset(kalman_R, 0, sizeof(kalman_R));
+
+    for (a = 0; a < numAxes; a++)
+    {
+        /* Position a, velocity numAxes + a */
+        i = a;
+        j = numAxes + a;
+
+        kalman_F[i * n + i] = 1.0f;
+        kalman_F[i * n + j] = dt;
+        kalman_F[j * n + j] = 1.0f;
+
+        kalman_Q[i * n + i] = kalman_q * dt * dt * dt * dt / 4;
+        kalman_Q[i * n + j] = kalman_q * dt * dt * dt / 2;
+        kalman_Q[j * n + i] = kalman_q * dt * dt * dt / 2;
+        kalman_Q[j * n + j] = kalman_q * dt * dt;
+
+        kalman_H[a * n + i] = 1.0f;
+        kalman_R[a * numAxes + a] = kalman_r * (1.0f + a);
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        kalman_x_fut[i] = 0.0f;
+        for (j = 0; j < n; j++)
+        {
+            kalman_P_fut[i * n + j] = (i == j) ? 10.0f : 0.0f;
+        }
+    }
+
+    memcpy(kalman_x_ref, kalman_x_fut, sizeof(kalman_x_fut));
+    memcpy(kalman_P_ref, kalman_P_fut, sizeof(kalman_P_fut));
+}
+
+/**
+ *  Track a target moving at a constant speed on each axis, with the noise
+ *  taken from the filtering inputs, and compare the state and the covariance
+ *  with the reference filter after each step.
+ */
+static JTEST_TEST_RET_t kalman_track(uint32_t sequential, uint32_t extended)
+{
+    arm_kalman_instance_f32 inst_fut;
+    arm_kalman_instance_f32 inst_ref;
+    arm_status status = ARM_MATH_SUCCESS;
+    uint32_t numAxes, n, s, step, a, i;
+    float32_t sum;
+
+    for (s = 0; s < sizeof(kalman_axes) / sizeof(kalman_axes[0]); s++)
+    {
+        numAxes = kalman_axes[s];
+        n = 2 * numAxes;
+        kalman_model(numAxes);
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Number of States: %d\n"
+                        "Number of Measurements: %d\n",
+                        (int)n,
+                        (int)numAxes);
+
+        arm_kalman_init_f32(&inst_fut, n, numAxes, kalman_x_fut, kalman_P_fut,
+                            kalman_F, kalman_Q, kalman_H, kalman_R, kalman_work);
+        arm_kalman_init_f32(&inst_ref, n, numAxes, kalman_x_ref, kalman_P_ref,
+                            kalman_F, kalman_Q, kalman_H, kalman_R, NULL);
+
+        for (step = 0; step < KALMAN_NUM_STEPS; step++)
+        {
+            for (a = 0; a < numAxes; a++)
+            {
+                kalman_z[a] = (1.0f + a) * kalman_dt * (step + 1) +
+                    filtering_f32_inputs[step * KALMAN_MAX_AXES + a] / 256;
+            }
+
+            JTEST_COUNT_CYCLES(
+                arm_kalman_predict_f32(&inst_fut, NULL));
+            ref_kalman_predict_f32(&inst_ref, NULL);
+
+            /* An extended filter with a linear model must match the linear one */
+            if (extended)
+            {
+                for (a = 0; a < numAxes; a++)
+                {
+                    sum = 0.0f;
+                    for (i = 0; i < n; i++)
+                    {
+                        sum += kalman_H[a * n + i] * kalman_x_fut[i];
+                    }
+                    kalman_hx[a] = sum;
+                }
+            }
+
+            if (sequential)
+            {
+                JTEST_COUNT_CYCLES(
+                    status = arm_kalman_update_sequential_f32(
+                        &inst_fut, kalman_z, extended ? kalman_hx : NULL));
+            }
+            else
+            {
+                JTEST_COUNT_CYCLES(
+                    status = arm_kalman_update_f32(
+                        &inst_fut, kalman_z, extended ? kalman_hx : NULL));
+            }
+            ref_kalman_update_f32(&inst_ref, kalman_z, NULL);
+
+            if (status != ARM_MATH_SUCCESS)
+            {
+                JTEST_DUMP_STRF("Step: %d\n", (int)step);
+                return JTEST_TEST_FAILED;
+            }
+
+            TEST_ASSERT_SNR(kalman_x_ref, kalman_x_fut, n,
+                            FILTERING_SNR_THRESHOLD_float32_t);
+            TEST_ASSERT_SNR(kalman_P_ref, kalman_P_fut, n * n,
+                            FILTERING_SNR_THRESHOLD_float32_t);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_kalman_update_f32_test,
+                  arm_kalman_update_f32)
+{
+    return kalman_track(0, 0);
+}
+
+JTEST_DEFINE_TEST(arm_kalman_update_f32_extended_test,
+                  arm_kalman_update_f32)
+{
+    return kalman_track(0, 1);
+}
+
+JTEST_DEFINE_TEST(arm_kalman_update_sequential_f32_test,
+                  arm_kalman_update_sequential_f32)
+{
+    return kalman_track(1, 0);
+}
+
+JTEST_DEFINE_TEST(arm_kalman_update_sequential_f32_extended_test,
+                  arm_kalman_update_sequential_f32)
+{
+    return kalman_track(1, 1);
+}
+
+/* A measurement noise that makes S indefinite must be reported, with P unchanged */
+JTEST_DEFINE_TEST(arm_kalman_update_f32_failure_test,
+                  arm_kalman_update_f32)
+{
+    arm_kalman_instance_f32 inst_fut;
+    arm_status status;
+    uint32_t n = 4;
+
+    kalman_model(2);
+    kalman_R[0] = -100.0f;
+    memcpy(kalman_P_ref, kalman_P_fut, sizeof(kalman_P_fut));
+
+    arm_kalman_init_f32(&inst_fut, n, 2, kalman_x_fut, kalman_P_fut,
+                        kalman_F, kalman_Q, kalman_H, kalman_R, kalman_work);
+
+    JTEST_COUNT_CYCLES(
+        status = arm_kalman_update_f32(&inst_fut, kalman_z, NULL));
+
+    if ((status != ARM_MATH_DECOMPOSITION_FAILURE) ||
+        (memcmp(kalman_P_ref, kalman_P_fut, n * n * sizeof(float32_t)) != 0))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    JTEST_COUNT_CYCLES(
+        status = arm_kalman_update_sequential_f32(&inst_fut, kalman_z, NULL));
+
+    if (status != ARM_MATH_DECOMPOSITION_FAILURE)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(kalman_tests)
+{
+    JTEST_TEST_CALL(arm_kalman_update_f32_test);
+    JTEST_TEST_CALL(arm_kalman_update_f32_extended_test);
+    JTEST_TEST_CALL(arm_kalman_update_sequential_f32_test);
+    JTEST_TEST_CALL(arm_kalman_update_sequential_f32_extended_test);
+    JTEST_TEST_CALL(arm_kalman_update_f32_failure_test);
+}
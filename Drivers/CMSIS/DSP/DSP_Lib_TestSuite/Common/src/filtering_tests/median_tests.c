@@ -0,0 +1,90 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+#define MEDIAN_MAX_WINDOW  31
+#define MEDIAN_NUM_SAMPLES 256
+
+/* Odd and even windows, the degenerate ones included */
+static const uint16_t median_windows[] = {1, 2, 3, 4, 5, 8, 9, 31};
+
+static float32_t median_state[MEDIAN_MAX_WINDOW];
+static uint16_t median_heap[2 * MEDIAN_MAX_WINDOW];
+
+/**
+ *  Filter the first samples of the filtering inputs block by block, for each
+ *  window and block size, and compare with the reference which sorts every
+ *  window. The medians are exact, so the outputs must be equal.
+ */
+#define MEDIAN_TEST_TEMPLATE(suffix, type)                                      \
+    JTEST_DEFINE_TEST(arm_median_##suffix##_test,                               \
+                      arm_median_##suffix)                                      \
+    {                                                                           \
+        arm_median_instance_##suffix median_inst;                               \
+        const type * input = (const type *) filtering_##suffix##_inputs;        \
+        type * output_fut = (type *) filtering_output_fut;                      \
+        type * output_ref = (type *) filtering_output_ref;                      \
+        uint32_t window_idx, block_size_idx, block_size, done, num;             \
+        uint16_t window_size;                                                   \
+                                                                                \
+        for (window_idx = 0;                                                    \
+             window_idx < sizeof(median_windows) / sizeof(median_windows[0]);   \
+             window_idx++)                                                      \
+        {                                                                       \
+            window_size = median_windows[window_idx];                           \
+            ref_median_##suffix(window_size, input, output_ref,                 \
+                                MEDIAN_NUM_SAMPLES);                            \
+                                                                                \
+            for (block_size_idx = 0;                                            \
+                 block_size_idx < filtering_blocksizes.element_count;           \
+                 block_size_idx++)                                              \
+            {                                                                   \
+                block_size = ARR_DESC_ELT(uint32_t, block_size_idx,             \
+                                          &filtering_blocksizes);               \
+                                                                                \
+                /* Display test parameter values */                             \
+                JTEST_DUMP_STRF("Window Size: %d\n"                             \
+                                "Block Size: %d\n",                             \
+                                (int)window_size,                               \
+                                (int)block_size);                               \
+                                                                                \
+                arm_median_init_##suffix(&median_inst, window_size,             \
+                                         (type *) median_state, median_heap);   \
+                                                                                \
+                for (done = 0; done < MEDIAN_NUM_SAMPLES; done += num)          \
+                {                                                               \
+                    num = MEDIAN_NUM_SAMPLES - done;                            \
+                    num = (num < block_size) ? num : block_size;                \
+                                                                                \
+                    JTEST_COUNT_CYCLES(                                         \
+                        arm_median_##suffix(&median_inst, input + done,         \
+                                            output_fut + done, num));           \
+                }                                                               \
+                                                                                \
+                TEST_ASSERT_BUFFERS_EQUAL(output_ref, output_fut,               \
+                                          MEDIAN_NUM_SAMPLES * sizeof(type));   \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+MEDIAN_TEST_TEMPLATE(f32, float32_t);
+MEDIAN_TEST_TEMPLATE(q31, q31_t);
+MEDIAN_TEST_TEMPLATE(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(median_tests)
+{
+    JTEST_TEST_CALL(arm_median_f32_test);
+    JTEST_TEST_CALL(arm_median_q31_test);
+    JTEST_TEST_CALL(arm_median_q15_test);
+}
@@ -0,0 +1,278 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+#define MAT_CHOLESKY_MAX_DIM  16
+#define MAT_CHOLESKY_NUM_RHS  4
+
+/* Sizes of the symmetric positive definite test matrices */
+static const uint16_t mat_cholesky_sizes[] = {1, 2, 3, 4, 7, 12, 16};
+
+/* There is no arm_mat_init_f64() */
+#define MAT_CHOLESKY_INIT(mat, rows, cols, data)                           \
+    do                                                                     \
+    {                                                                      \
+        (mat).numRows = (rows);                                            \
+        (mat).numCols = (cols);                                            \
+        (mat).pData = (data);                                              \
+    } while (0)
+
+#define MAT_CHOLESKY_ASSERT_SNR_f32(ref_ptr, tst_ptr, block_size)          \
+    TEST_ASSERT_SNR(ref_ptr, tst_ptr, block_size, MATRIX_SNR_THRESHOLD)
+
+#define MAT_CHOLESKY_ASSERT_SNR_f64(ref_ptr, tst_ptr, block_size)          \
+    TEST_ASSERT_DBL_SNR(ref_ptr, tst_ptr, block_size, MATRIX_SNR_THRESHOLD)
+
+/**
+ *  Define the buffers of a data type: the matrix A = I + R * R' / n, with R
+ *  taken cyclically from the random pool, a right hand side B, the factors,
+ *  the solutions, and a vector x for the rank-1 update.
+ */
+#define MAT_CHOLESKY_DEFINE_BUFFERS(suffix)                                             \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_a[MAT_CHOLESKY_MAX_DIM * MAT_CHOLESKY_MAX_DIM]; \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_l[MAT_CHOLESKY_MAX_DIM * MAT_CHOLESKY_MAX_DIM]; \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_t[MAT_CHOLESKY_MAX_DIM * MAT_CHOLESKY_MAX_DIM]; \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_b[MAT_CHOLESKY_MAX_DIM * MAT_CHOLESKY_NUM_RHS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_fut[MAT_CHOLESKY_MAX_DIM * MAT_CHOLESKY_NUM_RHS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_ref[MAT_CHOLESKY_MAX_DIM * MAT_CHOLESKY_NUM_RHS]; \
+    static TYPE_FROM_ABBREV(suffix) mat_cholesky_##suffix##_x[MAT_CHOLESKY_MAX_DIM];  \
+                                                                                        \
+    static void mat_cholesky_##suffix##_inputs(uint32_t n)                              \
+    {                                                                                   \
+        TYPE_FROM_ABBREV(suffix) sum;                                                   \
+        uint32_t i, j, k;                                                               \
+                                                                                        \
+        for (i = 0; i < n; i++)                                                         \
+        {                                                                               \
+            for (j = 0; j < n; j++)                                                     \
+            {                                                                           \
+                sum = (i == j) ? 1 : 0;                                                 \
+                for (k = 0; k < n; k++)                                                 \
+                {                                                                       \
+                    sum += (matrix_f32_100_rand[(i * n + k) % 100] / 64) *              \
+                        (matrix_f32_100_rand[(j * n + k) % 100] / 64) / n;              \
+                }                                                                       \
+                mat_cholesky_##suffix##_a[i * n + j] = sum;                             \
+            }                                                                           \
+            for (j = 0; j < MAT_CHOLESKY_NUM_RHS; j++)                                  \
+            {                                                                           \
+                mat_cholesky_##suffix##_b[i * MAT_CHOLESKY_NUM_RHS + j] =               \
+                    matrix_f32_100_rand[(7 * (i * MAT_CHOLESKY_NUM_RHS + j) + 3) % 100] / 64; \
+            }                                                                           \
+            mat_cholesky_##suffix##_x[i] = matrix_f32_100_rand[(3 * i + 11) % 100] / 128; \
+        }                                                                               \
+    }                                                                                   \
+                                                                                        \
+    /* Reference solution of A * X = B: inverse of A, times B */                        \
+    static void mat_cholesky_##suffix##_ref_solve(uint32_t n)                           \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_t, mat_inv;                                    \
+        TYPE_FROM_ABBREV(suffix) * inv = mat_cholesky_##suffix##_l;           \
+        TYPE_FROM_ABBREV(suffix) sum;                                                   \
+        uint32_t i, j, k;                                                               \
+                                                                                        \
+        /* arm_mat_inverse modifies its source input */                                 \
+        memcpy(mat_cholesky_##suffix##_t, mat_cholesky_##suffix##_a,                    \
+               n * n * sizeof(TYPE_FROM_ABBREV(suffix)));                               \
+        MAT_CHOLESKY_INIT(mat_t, n, n, mat_cholesky_##suffix##_t);                      \
+        MAT_CHOLESKY_INIT(mat_inv, n, n, inv);                                          \
+        arm_mat_inverse_##suffix(&mat_t, &mat_inv);                                     \
+                                                                                        \
+        for (i = 0; i < n; i++)                                                         \
+        {                                                                               \
+            for (j = 0; j < MAT_CHOLESKY_NUM_RHS; j++)                                  \
+            {                                                                           \
+                sum = 0;                                                                \
+                for (k = 0; k < n; k++)                                                 \
+                {                                                                       \
+                    sum += inv[i * n + k] * mat_cholesky_##suffix##_b[k * MAT_CHOLESKY_NUM_RHS + j]; \
+                }                                                                       \
+                mat_cholesky_##suffix##_ref[i * MAT_CHOLESKY_NUM_RHS + j] = sum;        \
+            }                                                                           \
+        }                                                                               \
+    }
+
+MAT_CHOLESKY_DEFINE_BUFFERS(f32)
+MAT_CHOLESKY_DEFINE_BUFFERS(f64)
+
+/**
+ *  Factorize A, solve A * X = B from the factors and compare with the
+ *  solution computed through the inverse.
+ */
+#define JTEST_ARM_MAT_FACTOR_SOLVE_TEST(fn, suffix)                                     \
+    JTEST_DEFINE_TEST(arm_mat_##fn##_##suffix##_test,                                   \
+                      arm_mat_##fn##_##suffix)                                          \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_a, mat_l, mat_b, mat_fut;                      \
+        arm_status status;                                                              \
+        uint32_t n, s;                                                                  \
+                                                                                        \
+        for (s = 0; s < sizeof(mat_cholesky_sizes) / sizeof(mat_cholesky_sizes[0]); s++) \
+        {                                                                               \
+            n = mat_cholesky_sizes[s];                                                  \
+            mat_cholesky_##suffix##_inputs(n);                                          \
+            mat_cholesky_##suffix##_ref_solve(n);                                       \
+                                                                                        \
+            MAT_CHOLESKY_INIT(mat_a, n, n, mat_cholesky_##suffix##_a);                  \
+            MAT_CHOLESKY_INIT(mat_l, n, n, mat_cholesky_##suffix##_l);                  \
+            MAT_CHOLESKY_INIT(mat_b, n, MAT_CHOLESKY_NUM_RHS, mat_cholesky_##suffix##_b); \
+            MAT_CHOLESKY_INIT(mat_fut, n, MAT_CHOLESKY_NUM_RHS, mat_cholesky_##suffix##_fut); \
+                                                                                        \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);              \
+                                                                                        \
+            JTEST_COUNT_CYCLES(status = arm_mat_##fn##_##suffix(&mat_a, &mat_l));       \
+            if (status != ARM_MATH_SUCCESS)                                             \
+            {                                                                           \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+            JTEST_COUNT_CYCLES(arm_mat_solve_##fn##_##suffix(&mat_l, &mat_b, &mat_fut)); \
+                                                                                        \
+            MAT_CHOLESKY_ASSERT_SNR_##suffix(mat_cholesky_##suffix##_ref,               \
+                                             mat_cholesky_##suffix##_fut,               \
+                                             n * MAT_CHOLESKY_NUM_RHS);                 \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+JTEST_ARM_MAT_FACTOR_SOLVE_TEST(cholesky, f32);
+JTEST_ARM_MAT_FACTOR_SOLVE_TEST(cholesky, f64);
+JTEST_ARM_MAT_FACTOR_SOLVE_TEST(ldlt, f32);
+JTEST_ARM_MAT_FACTOR_SOLVE_TEST(ldlt, f64);
+
+/**
+ *  Solve A * X = B with a lower triangular solve on the Cholesky factor,
+ *  followed in place by an upper triangular solve on its transpose.
+ */
+#define JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(suffix)                                     \
+    JTEST_DEFINE_TEST(arm_mat_solve_triangular_##suffix##_test,                         \
+                      arm_mat_solve_lower_triangular_##suffix)                          \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_a, mat_l, mat_t, mat_b, mat_fut;               \
+        uint32_t n, s, i, j;                                                            \
+                                                                                        \
+        for (s = 0; s < sizeof(mat_cholesky_sizes) / sizeof(mat_cholesky_sizes[0]); s++) \
+        {                                                                               \
+            n = mat_cholesky_sizes[s];                                                  \
+            mat_cholesky_##suffix##_inputs(n);                                          \
+            mat_cholesky_##suffix##_ref_solve(n);                                       \
+                                                                                        \
+            MAT_CHOLESKY_INIT(mat_a, n, n, mat_cholesky_##suffix##_a);                  \
+            MAT_CHOLESKY_INIT(mat_l, n, n, mat_cholesky_##suffix##_l);                  \
+            MAT_CHOLESKY_INIT(mat_t, n, n, mat_cholesky_##suffix##_t);                  \
+            MAT_CHOLESKY_INIT(mat_b, n, MAT_CHOLESKY_NUM_RHS, mat_cholesky_##suffix##_b); \
+            MAT_CHOLESKY_INIT(mat_fut, n, MAT_CHOLESKY_NUM_RHS, mat_cholesky_##suffix##_fut); \
+                                                                                        \
+            arm_mat_cholesky_##suffix(&mat_a, &mat_l);                                  \
+            for (i = 0; i < n; i++)                                                     \
+            {                                                                           \
+                for (j = 0; j < n; j++)                                                 \
+                {                                                                       \
+                    mat_cholesky_##suffix##_t[i * n + j] = mat_cholesky_##suffix##_l[j * n + i]; \
+                }                                                                       \
+            }                                                                           \
+                                                                                        \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);              \
+                                                                                        \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_mat_solve_lower_triangular_##suffix(&mat_l, &mat_b, &mat_fut));     \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_mat_solve_upper_triangular_##suffix(&mat_t, &mat_fut, &mat_fut));   \
+                                                                                        \
+            MAT_CHOLESKY_ASSERT_SNR_##suffix(mat_cholesky_##suffix##_ref,               \
+                                             mat_cholesky_##suffix##_fut,               \
+                                             n * MAT_CHOLESKY_NUM_RHS);                 \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(f32);
+JTEST_ARM_MAT_SOLVE_TRIANGULAR_TEST(f64);
+
+/**
+ *  Update the factor of A with x and compare with the factor of A + x * x',
+ *  then downdate it and compare with the factor of A.
+ */
+#define JTEST_ARM_MAT_CHOLESKY_UPDATE_TEST(suffix)                                      \
+    JTEST_DEFINE_TEST(arm_mat_cholesky_update_##suffix##_test,                          \
+                      arm_mat_cholesky_update_##suffix)                                 \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_a, mat_l, mat_t;                               \
+        arm_status status;                                                              \
+        TYPE_FROM_ABBREV(suffix) x[MAT_CHOLESKY_MAX_DIM];                               \
+        uint32_t n, s, i, j;                                                            \
+                                                                                        \
+        for (s = 0; s < sizeof(mat_cholesky_sizes) / sizeof(mat_cholesky_sizes[0]); s++) \
+        {                                                                               \
+            n = mat_cholesky_sizes[s];                                                  \
+            mat_cholesky_##suffix##_inputs(n);                                          \
+                                                                                        \
+            MAT_CHOLESKY_INIT(mat_a, n, n, mat_cholesky_##suffix##_a);                  \
+            MAT_CHOLESKY_INIT(mat_l, n, n, mat_cholesky_##suffix##_l);                  \
+            MAT_CHOLESKY_INIT(mat_t, n, n, mat_cholesky_##suffix##_t);                  \
+                                                                                        \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);              \
+                                                                                        \
+            /* Reference factor of A + x * x' in the scratch matrix */                  \
+            for (i = 0; i < n; i++)                                                     \
+            {                                                                           \
+                for (j = 0; j < n; j++)                                                 \
+                {                                                                       \
+                    mat_cholesky_##suffix##_t[i * n + j] = mat_cholesky_##suffix##_a[i * n + j] + \
+                        mat_cholesky_##suffix##_x[i] * mat_cholesky_##suffix##_x[j];    \
+                }                                                                       \
+            }                                                                           \
+            arm_mat_cholesky_##suffix(&mat_t, &mat_t);                                  \
+            arm_mat_cholesky_##suffix(&mat_a, &mat_l);                                  \
+                                                                                        \
+            memcpy(x, mat_cholesky_##suffix##_x, n * sizeof(TYPE_FROM_ABBREV(suffix))); \
+            JTEST_COUNT_CYCLES(arm_mat_cholesky_update_##suffix(&mat_l, x));            \
+                                                                                        \
+            MAT_CHOLESKY_ASSERT_SNR_##suffix(mat_cholesky_##suffix##_t,                 \
+                                             mat_cholesky_##suffix##_l,                 \
+                                             n * n);                                    \
+                                                                                        \
+            /* Back to the factor of A */                                               \
+            arm_mat_cholesky_##suffix(&mat_a, &mat_t);                                  \
+            memcpy(x, mat_cholesky_##suffix##_x, n * sizeof(TYPE_FROM_ABBREV(suffix))); \
+            JTEST_COUNT_CYCLES(status = arm_mat_cholesky_downdate_##suffix(&mat_l, x)); \
+            if (status != ARM_MATH_SUCCESS)                                             \
+            {                                                                           \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            MAT_CHOLESKY_ASSERT_SNR_##suffix(mat_cholesky_##suffix##_t,                 \
+                                             mat_cholesky_##suffix##_l,                 \
+                                             n * n);                                    \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+JTEST_ARM_MAT_CHOLESKY_UPDATE_TEST(f32);
+JTEST_ARM_MAT_CHOLESKY_UPDATE_TEST(f64);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_cholesky_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f32_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_update_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_update_f64_test);
+}
@@ -44,6 +44,202 @@ JTEST_DEFINE_TEST(arm_mat_mult_q15_test, arm_mat_mult_q15)
         MATRIX_COMPARE_INTERFACE);
 }
 
+/*--------------------------------------------------------------------------------*/
+/* Products above ARM_MAT_MULT_TILE_MIN_MACS, which use the tiled kernels. */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_MULT_TILED_MAX_ELTS 1600
+
+/* Square, tall, wide and deep shapes, mostly not a multiple of the tile sizes.
+ * The last two end in four columns, and the last one is only four wide. */
+static const uint16_t mat_mult_tiled_shapes[][3] =
+{
+    {21, 23, 19},
+    {63, 11, 13},
+    {9, 13, 63},
+    {7, 97, 9},
+    {5, 33, 47},
+    {37, 29, 12},
+    {97, 11, 4}
+};
+
+static float32_t mat_mult_tiled_a[MAT_MULT_TILED_MAX_ELTS];
+static float32_t mat_mult_tiled_b[MAT_MULT_TILED_MAX_ELTS];
+static float32_t mat_mult_tiled_fut[MAT_MULT_TILED_MAX_ELTS];
+static float32_t mat_mult_tiled_ref[MAT_MULT_TILED_MAX_ELTS];
+
+/* Inputs of magnitude below 1/64, taken cyclically from the random pool and
+ * converted in place to the type under test */
+#define MAT_MULT_TILED_INPUTS(convert, num_a, num_b)                                \
+    do                                                                              \
+    {                                                                               \
+        uint32_t i;                                                                 \
+        for (i = 0; i < (num_a); i++)                                               \
+        {                                                                           \
+            mat_mult_tiled_a[i] = matrix_f32_100_rand[i % 100] / 4096.0f;           \
+        }                                                                           \
+        for (i = 0; i < (num_b); i++)                                               \
+        {                                                                           \
+            mat_mult_tiled_b[i] = matrix_f32_100_rand[(7 * i + 3) % 100] / 4096.0f; \
+        }                                                                           \
+        convert(mat_mult_tiled_a, (void *) mat_mult_tiled_a, (num_a));              \
+        convert(mat_mult_tiled_b, (void *) mat_mult_tiled_b, (num_b));              \
+    } while (0)
+
+#define MAT_MULT_TILED_NO_CONVERSION(src, dst, num) /* Blank */
+
+#define JTEST_ARM_MAT_MULT_TILED_TEST(suffix, convert, fut_args)                    \
+    JTEST_DEFINE_TEST(arm_mat_mult_tiled_##suffix##_test,                           \
+                      arm_mat_mult_##suffix)                                        \
+    {                                                                               \
+        arm_matrix_instance_##suffix mat_a, mat_b, mat_fut, mat_ref;                \
+        uint16_t M, K, N;                                                           \
+        uint32_t s;                                                                 \
+                                                                                    \
+        for (s = 0; s < sizeof(mat_mult_tiled_shapes) / sizeof(mat_mult_tiled_shapes[0]); s++) \
+        {                                                                           \
+            M = mat_mult_tiled_shapes[s][0];                                        \
+            K = mat_mult_tiled_shapes[s][1];                                        \
+            N = mat_mult_tiled_shapes[s][2];                                        \
+                                                                                    \
+            MAT_MULT_TILED_INPUTS(convert, M * K, K * N);                           \
+                                                                                    \
+            arm_mat_init_##suffix(&mat_a, M, K, (void *) mat_mult_tiled_a);         \
+            arm_mat_init_##suffix(&mat_b, K, N, (void *) mat_mult_tiled_b);         \
+            arm_mat_init_##suffix(&mat_fut, M, N, (void *) mat_mult_tiled_fut);     \
+            arm_mat_init_##suffix(&mat_ref, M, N, (void *) mat_mult_tiled_ref);     \
+                                                                                    \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d * %dx%d\n",                   \
+                            (int)M, (int)K, (int)K, (int)N);                        \
+                                                                                    \
+            JTEST_COUNT_CYCLES(arm_mat_mult_##suffix fut_args);                     \
+                                                                                    \
+            ref_mat_mult_##suffix(&mat_a, &mat_b, &mat_ref);                        \
+                                                                                    \
+            TEST_ASSERT_BUFFERS_EQUAL(mat_ref.pData,                                \
+                                      mat_fut.pData,                                \
+                                      M * N * sizeof(TYPE_FROM_ABBREV(suffix)));    \
+        }                                                                           \
+                                                                                    \
+        return JTEST_TEST_PASSED;                                                   \
+    }
+
+JTEST_ARM_MAT_MULT_TILED_TEST(f32, MAT_MULT_TILED_NO_CONVERSION,
+                              (&mat_a, &mat_b, &mat_fut));
+JTEST_ARM_MAT_MULT_TILED_TEST(q31, arm_float_to_q31,
+                              (&mat_a, &mat_b, &mat_fut));
+/* No transpose buffer: the tiled kernel reads B in place */
+JTEST_ARM_MAT_MULT_TILED_TEST(q15, arm_float_to_q15,
+                              (&mat_a, &mat_b, &mat_fut, NULL));
+
+/*--------------------------------------------------------------------------------*/
+/* Results beyond the output range saturate below and above ARM_MAT_MULT_TILE_MIN_MACS. */
+/*--------------------------------------------------------------------------------*/
+
+/* Two shapes on the plain loops, then tiled ones */
+static const uint16_t mat_mult_sat_shapes[][3] =
+{
+    {4, 8, 4},
+    {3, 5, 7},
+    {21, 23, 19},
+    {63, 11, 13},
+    {7, 97, 9}
+};
+
+static q15_t mat_mult_sat_state[MAT_MULT_TILED_MAX_ELTS];
+
+/* Magnitudes in [0.5, 1) for A and in [0.5, 1) * 1.99 / K for B, so every
+ * output is below 2 and fits the accumulator. The rows of A alternate in sign;
+ * the columns of B are positive, negative, or alternate along K, which gives
+ * results that saturate to either bound next to results in range. */
+#define MAT_MULT_SAT_INPUTS(convert, M, K, N)                                       \
+    do                                                                              \
+    {                                                                               \
+        uint32_t r, k, c;                                                           \
+        float32_t u, sign;                                                          \
+        for (r = 0; r < (M); r++)                                                   \
+        {                                                                           \
+            for (k = 0; k < (K); k++)                                               \
+            {                                                                       \
+                u = 0.5f + fabsf(matrix_f32_100_rand[(r * (K) + k) % 100]) / 100.0f; \
+                mat_mult_tiled_a[r * (K) + k] = (r & 1U) ? -u : u;                  \
+            }                                                                       \
+        }                                                                           \
+        for (k = 0; k < (K); k++)                                                   \
+        {                                                                           \
+            for (c = 0; c < (N); c++)                                               \
+            {                                                                       \
+                u = 0.5f + fabsf(matrix_f32_100_rand[(7 * (k * (N) + c) + 3) % 100]) / 100.0f; \
+                switch (c % 4U)                                                     \
+                {                                                                   \
+                case 0U:  sign = 1.0f;                          break;              \
+                case 1U:  sign = -1.0f;                         break;              \
+                default:  sign = (k & 1U) ? -1.0f : 1.0f;       break;              \
+                }                                                                   \
+                mat_mult_tiled_b[k * (N) + c] = sign * u * 1.99f / (K);             \
+            }                                                                       \
+        }                                                                           \
+        convert(mat_mult_tiled_a, (void *) mat_mult_tiled_a, (M) * (K));            \
+        convert(mat_mult_tiled_b, (void *) mat_mult_tiled_b, (K) * (N));            \
+    } while (0)
+
+#define JTEST_ARM_MAT_MULT_SAT_TEST(suffix, max, min, fut_args)                     \
+    JTEST_DEFINE_TEST(arm_mat_mult_sat_##suffix##_test,                             \
+                      arm_mat_mult_##suffix)                                        \
+    {                                                                               \
+        arm_matrix_instance_##suffix mat_a, mat_b, mat_fut, mat_ref;                \
+        TYPE_FROM_ABBREV(suffix) * pRef;                                            \
+        uint16_t M, K, N;                                                           \
+        uint32_t s, i, num_max, num_min;                                            \
+                                                                                    \
+        for (s = 0; s < sizeof(mat_mult_sat_shapes) / sizeof(mat_mult_sat_shapes[0]); s++) \
+        {                                                                           \
+            M = mat_mult_sat_shapes[s][0];                                          \
+            K = mat_mult_sat_shapes[s][1];                                          \
+            N = mat_mult_sat_shapes[s][2];                                          \
+                                                                                    \
+            MAT_MULT_SAT_INPUTS(arm_float_to_##suffix, M, K, N);                    \
+                                                                                    \
+            arm_mat_init_##suffix(&mat_a, M, K, (void *) mat_mult_tiled_a);         \
+            arm_mat_init_##suffix(&mat_b, K, N, (void *) mat_mult_tiled_b);         \
+            arm_mat_init_##suffix(&mat_fut, M, N, (void *) mat_mult_tiled_fut);     \
+            arm_mat_init_##suffix(&mat_ref, M, N, (void *) mat_mult_tiled_ref);     \
+                                                                                    \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d * %dx%d\n",                   \
+                            (int)M, (int)K, (int)K, (int)N);                        \
+                                                                                    \
+            JTEST_COUNT_CYCLES(arm_mat_mult_##suffix fut_args);                     \
+                                                                                    \
+            ref_mat_mult_##suffix(&mat_a, &mat_b, &mat_ref);                        \
+                                                                                    \
+            TEST_ASSERT_BUFFERS_EQUAL(mat_ref.pData,                                \
+                                      mat_fut.pData,                                \
+                                      M * N * sizeof(TYPE_FROM_ABBREV(suffix)));    \
+                                                                                    \
+            /* The inputs must reach both bounds */                                 \
+            pRef = mat_ref.pData;                                                   \
+            num_max = num_min = 0;                                                  \
+            for (i = 0; i < (uint32_t) M * N; i++)                                  \
+            {                                                                       \
+                num_max += (pRef[i] == (max));                                      \
+                num_min += (pRef[i] == (min));                                      \
+            }                                                                       \
+            if ((num_max == 0) || (num_min == 0))                                   \
+            {                                                                       \
+                JTEST_DUMP_STRF("Saturated outputs: %d at max, %d at min\n",        \
+                                (int)num_max, (int)num_min);                        \
+                return JTEST_TEST_FAILED;                                           \
+            }                                                                       \
+        }                                                                           \
+                                                                                    \
+        return JTEST_TEST_PASSED;                                                   \
+    }
+
+JTEST_ARM_MAT_MULT_SAT_TEST(q31, INT32_MAX, INT32_MIN,
+                            (&mat_a, &mat_b, &mat_fut));
+JTEST_ARM_MAT_MULT_SAT_TEST(q15, INT16_MAX, INT16_MIN,
+                            (&mat_a, &mat_b, &mat_fut, mat_mult_sat_state));
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -56,4 +252,9 @@ JTEST_DEFINE_GROUP(mat_mult_tests)
     JTEST_TEST_CALL(arm_mat_mult_f32_test);
     JTEST_TEST_CALL(arm_mat_mult_q31_test);
     JTEST_TEST_CALL(arm_mat_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_q31_test);
+    JTEST_TEST_CALL(arm_mat_mult_tiled_q15_test);
+    JTEST_TEST_CALL(arm_mat_mult_sat_q31_test);
+    JTEST_TEST_CALL(arm_mat_mult_sat_q15_test);
 }
@@ -0,0 +1,352 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+#define MAT_SPARSE_MAX_DIM    16
+#define MAT_SPARSE_MAX_COLS_B 9
+#define MAT_SPARSE_MAX_ELTS   (MAT_SPARSE_MAX_DIM * MAT_SPARSE_MAX_DIM)
+
+/* Rows, columns of A and columns of B of the test products */
+static const uint16_t mat_sparse_sizes[][3] =
+{
+    {1, 1, 1}, {4, 4, 4}, {8, 12, 5}, {12, 8, 9}, {16, 16, 7}
+};
+
+static const uint16_t mat_sparse_block_sizes[] = {1, 2, 4, 8};
+
+/* Elements of A with a magnitude up to 0.25 / 16 are dropped, about a third are kept */
+static const float32_t mat_sparse_threshold = 0.25f / 16;
+
+static uint32_t mat_sparse_row_start[MAT_SPARSE_MAX_DIM + 1];
+static uint16_t mat_sparse_col_idx[MAT_SPARSE_MAX_ELTS];
+
+/* Convert the test data to the type of the suffix. B is in [-0.8, 0.8] and A is
+   scaled down by 16 so that the Q31 accumulators do not overflow */
+#define MAT_SPARSE_CONVERT_f32(x) (x)
+#define MAT_SPARSE_CONVERT_q31(x) ((q31_t) ((x) * 2147483648.0f))
+#define MAT_SPARSE_CONVERT_q15(x) ((q15_t) ((x) * 32768.0f))
+
+/* Dense reference products of the pruned matrix */
+#define MAT_SPARSE_REF_ACC_f32 float32_t
+#define MAT_SPARSE_REF_ACC_q31 q63_t
+#define MAT_SPARSE_REF_ACC_q15 q63_t
+#define MAT_SPARSE_REF_OUT_f32(acc) (acc)
+#define MAT_SPARSE_REF_OUT_q31(acc) ((q31_t) ref_sat_q31((acc) >> 31))
+#define MAT_SPARSE_REF_OUT_q15(acc) ((q15_t) ref_sat_q15((acc) >> 15))
+
+/* The floating-point kernels add in another order, the fixed-point ones are exact */
+#define MAT_SPARSE_ASSERT_f32(ref_ptr, tst_ptr, block_size)                \
+    TEST_ASSERT_SNR(ref_ptr, tst_ptr, block_size, MATRIX_SNR_THRESHOLD)
+
+#define MAT_SPARSE_ASSERT_q31(ref_ptr, tst_ptr, block_size)                \
+    TEST_ASSERT_BUFFERS_EQUAL(ref_ptr, tst_ptr, (block_size) * sizeof(q31_t))
+
+#define MAT_SPARSE_ASSERT_q15(ref_ptr, tst_ptr, block_size)                \
+    TEST_ASSERT_BUFFERS_EQUAL(ref_ptr, tst_ptr, (block_size) * sizeof(q15_t))
+
+/**
+ *  Define the buffers of a data type: the dense matrix A, its pruned copy,
+ *  the dense matrix B, whose first column is also the vector operand, the
+ *  CSR and blocked-ELL storage and the outputs.
+ */
+#define MAT_SPARSE_DEFINE_BUFFERS(suffix)                                               \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_a[MAT_SPARSE_MAX_ELTS];       \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_pruned[MAT_SPARSE_MAX_ELTS];  \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_b[MAT_SPARSE_MAX_DIM * MAT_SPARSE_MAX_COLS_B]; \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_data[MAT_SPARSE_MAX_ELTS];    \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_fut[MAT_SPARSE_MAX_ELTS];     \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_fut2[MAT_SPARSE_MAX_ELTS];    \
+    static TYPE_FROM_ABBREV(suffix) mat_sparse_##suffix##_ref[MAT_SPARSE_MAX_ELTS];     \
+                                                                                        \
+    static void mat_sparse_##suffix##_inputs(uint32_t m, uint32_t k, uint32_t n)        \
+    {                                                                                   \
+        TYPE_FROM_ABBREV(suffix) threshold =                                            \
+            MAT_SPARSE_CONVERT_##suffix(mat_sparse_threshold);                          \
+        TYPE_FROM_ABBREV(suffix) a;                                                     \
+        uint32_t i;                                                                     \
+                                                                                        \
+        for (i = 0; i < m * k; i++)                                                     \
+        {                                                                               \
+            a = MAT_SPARSE_CONVERT_##suffix(matrix_f32_100_rand[(7 * i + 1) % 100] / 1024); \
+            mat_sparse_##suffix##_a[i] = a;                                             \
+            mat_sparse_##suffix##_pruned[i] =                                           \
+                ((a > threshold) || (a < -threshold)) ? a : 0;                          \
+        }                                                                               \
+        for (i = 0; i < k * n; i++)                                                     \
+        {                                                                               \
+            mat_sparse_##suffix##_b[i] =                                                \
+                MAT_SPARSE_CONVERT_##suffix(matrix_f32_100_rand[(3 * i + 5) % 100] / 64); \
+        }                                                                               \
+    }                                                                                   \
+                                                                                        \
+    /* Reference product of the pruned A and the first n columns of B */               \
+    static void mat_sparse_##suffix##_ref_mult(uint32_t m, uint32_t k,                  \
+                                               uint32_t n, uint32_t ldb)                \
+    {                                                                                   \
+        MAT_SPARSE_REF_ACC_##suffix sum;                                                \
+        uint32_t i, j, l;                                                               \
+                                                                                        \
+        for (i = 0; i < m; i++)                                                         \
+        {                                                                               \
+            for (j = 0; j < n; j++)                                                     \
+            {                                                                           \
+                sum = 0;                                                                \
+                for (l = 0; l < k; l++)                                                 \
+                {                                                                       \
+                    sum += (MAT_SPARSE_REF_ACC_##suffix) mat_sparse_##suffix##_pruned[i * k + l] * \
+                        mat_sparse_##suffix##_b[l * ldb + j];                           \
+                }                                                                       \
+                mat_sparse_##suffix##_ref[i * n + j] = MAT_SPARSE_REF_OUT_##suffix(sum); \
+            }                                                                           \
+        }                                                                               \
+    }
+
+MAT_SPARSE_DEFINE_BUFFERS(f32)
+MAT_SPARSE_DEFINE_BUFFERS(q31)
+MAT_SPARSE_DEFINE_BUFFERS(q15)
+
+/**
+ *  Convert A to CSR, check that the stored elements are those of the pruned
+ *  matrix, and compare the matrix-vector and matrix-matrix products with the
+ *  dense reference.
+ */
+#define JTEST_ARM_MAT_CSR_TEST(suffix)                                                  \
+    JTEST_DEFINE_TEST(arm_mat_csr_mult_##suffix##_test,                                 \
+                      arm_mat_csr_mult_##suffix)                                        \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_a, mat_b, mat_fut;                             \
+        arm_mat_csr_instance_##suffix mat_csr;                                          \
+        arm_status status;                                                              \
+        uint32_t m, k, n, s, i, j, nnz;                                                 \
+                                                                                        \
+        for (s = 0; s < sizeof(mat_sparse_sizes) / sizeof(mat_sparse_sizes[0]); s++)   \
+        {                                                                               \
+            m = mat_sparse_sizes[s][0];                                                 \
+            k = mat_sparse_sizes[s][1];                                                 \
+            n = mat_sparse_sizes[s][2];                                                 \
+            mat_sparse_##suffix##_inputs(m, k, n);                                      \
+                                                                                        \
+            /* Display test parameter values */                                         \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d times %dx%d\n",                   \
+                            (int)m, (int)k, (int)k, (int)n);                            \
+                                                                                        \
+            arm_mat_init_##suffix(&mat_a, m, k, mat_sparse_##suffix##_a);               \
+            arm_mat_init_##suffix(&mat_b, k, n, mat_sparse_##suffix##_b);               \
+            arm_mat_init_##suffix(&mat_fut, m, n, mat_sparse_##suffix##_fut);           \
+            arm_mat_csr_init_##suffix(&mat_csr, 0, 0, mat_sparse_row_start,             \
+                                      mat_sparse_col_idx, mat_sparse_##suffix##_data);  \
+                                                                                        \
+            status = arm_mat_csr_from_dense_##suffix(                                   \
+                &mat_a, MAT_SPARSE_CONVERT_##suffix(mat_sparse_threshold),              \
+                MAT_SPARSE_MAX_ELTS, &mat_csr);                                         \
+                                                                                        \
+            if ((status != ARM_MATH_SUCCESS) ||                                         \
+                (mat_csr.numRows != m) || (mat_csr.numCols != k))                       \
+            {                                                                           \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            /* Expand the CSR matrix back and compare it with the pruned one */         \
+            memset(mat_sparse_##suffix##_fut, 0, sizeof(mat_sparse_##suffix##_fut));    \
+            nnz = 0;                                                                    \
+            for (i = 0; i < m; i++)                                                     \
+            {                                                                           \
+                for (j = mat_sparse_row_start[i]; j < mat_sparse_row_start[i + 1]; j++) \
+                {                                                                       \
+                    mat_sparse_##suffix##_fut[i * k + mat_sparse_col_idx[j]] =          \
+                        mat_sparse_##suffix##_data[j];                                  \
+                    nnz += (mat_sparse_##suffix##_data[j] != 0);                        \
+                }                                                                       \
+            }                                                                           \
+            TEST_ASSERT_BUFFERS_EQUAL(mat_sparse_##suffix##_pruned,                     \
+                                      mat_sparse_##suffix##_fut,                        \
+                                      m * k * sizeof(TYPE_FROM_ABBREV(suffix)));        \
+            if (nnz != mat_sparse_row_start[m])                                         \
+            {                                                                           \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            /* Product with the first column of B, taken as a vector */                 \
+            for (i = 0; i < k; i++)                                                     \
+            {                                                                           \
+                mat_sparse_##suffix##_fut2[i] = mat_sparse_##suffix##_b[i * n];         \
+            }                                                                           \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_mat_csr_vec_mult_##suffix(&mat_csr, mat_sparse_##suffix##_fut2,     \
+                                              mat_sparse_##suffix##_fut));              \
+            mat_sparse_##suffix##_ref_mult(m, k, 1, n);                                 \
+            MAT_SPARSE_ASSERT_##suffix(mat_sparse_##suffix##_ref,                       \
+                                       mat_sparse_##suffix##_fut, m);                   \
+                                                                                        \
+            JTEST_COUNT_CYCLES(                                                         \
+                status = arm_mat_csr_mult_##suffix(&mat_csr, &mat_b, &mat_fut));        \
+            mat_sparse_##suffix##_ref_mult(m, k, n, n);                                 \
+                                                                                        \
+            if (status != ARM_MATH_SUCCESS)                                             \
+            {                                                                           \
+                return JTEST_TEST_FAILED;                                               \
+            }                                                                           \
+                                                                                        \
+            MAT_SPARSE_ASSERT_##suffix(mat_sparse_##suffix##_ref,                       \
+                                       mat_sparse_##suffix##_fut, m * n);               \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+/**
+ *  Convert A to blocked-ELL with each block size that divides its
+ *  dimensions, and compare the products with the dense reference.
+ */
+#define JTEST_ARM_MAT_BELL_TEST(suffix)                                                 \
+    JTEST_DEFINE_TEST(arm_mat_bell_mult_##suffix##_test,                                \
+                      arm_mat_bell_mult_##suffix)                                       \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_a, mat_b, mat_fut;                             \
+        arm_mat_bell_instance_##suffix mat_bell;                                        \
+        arm_status status;                                                              \
+        uint32_t m, k, n, s, b, i;                                                      \
+                                                                                        \
+        for (s = 0; s < sizeof(mat_sparse_sizes) / sizeof(mat_sparse_sizes[0]); s++)   \
+        {                                                                               \
+            for (b = 0; b < sizeof(mat_sparse_block_sizes) / sizeof(mat_sparse_block_sizes[0]); b++) \
+            {                                                                           \
+                m = mat_sparse_sizes[s][0];                                             \
+                k = mat_sparse_sizes[s][1];                                             \
+                n = mat_sparse_sizes[s][2];                                             \
+                                                                                        \
+                if (((m % mat_sparse_block_sizes[b]) != 0) ||                           \
+                    ((k % mat_sparse_block_sizes[b]) != 0))                             \
+                {                                                                       \
+                    continue;                                                           \
+                }                                                                       \
+                                                                                        \
+                mat_sparse_##suffix##_inputs(m, k, n);                                  \
+                                                                                        \
+                /* Display test parameter values */                                     \
+                JTEST_DUMP_STRF("Matrix Dimensions: %dx%d times %dx%d\n"                \
+                                "Block Size: %d\n",                                     \
+                                (int)m, (int)k, (int)k, (int)n,                         \
+                                (int)mat_sparse_block_sizes[b]);                        \
+                                                                                        \
+                arm_mat_init_##suffix(&mat_a, m, k, mat_sparse_##suffix##_a);           \
+                arm_mat_init_##suffix(&mat_b, k, n, mat_sparse_##suffix##_b);           \
+                arm_mat_init_##suffix(&mat_fut, m, n, mat_sparse_##suffix##_fut);       \
+                arm_mat_bell_init_##suffix(&mat_bell, 0, 0, mat_sparse_block_sizes[b], 0, \
+                                           mat_sparse_col_idx, mat_sparse_##suffix##_data); \
+                                                                                        \
+                status = arm_mat_bell_from_dense_##suffix(                              \
+                    &mat_a, MAT_SPARSE_CONVERT_##suffix(mat_sparse_threshold),          \
+                    MAT_SPARSE_MAX_ELTS / (mat_sparse_block_sizes[b] * mat_sparse_block_sizes[b]), \
+                    &mat_bell);                                                         \
+                                                                                        \
+                if ((status != ARM_MATH_SUCCESS) ||                                     \
+                    (mat_bell.numRows != m) || (mat_bell.numCols != k))                 \
+                {                                                                       \
+                    return JTEST_TEST_FAILED;                                           \
+                }                                                                       \
+                                                                                        \
+                for (i = 0; i < k; i++)                                                 \
+                {                                                                       \
+                    mat_sparse_##suffix##_fut2[i] = mat_sparse_##suffix##_b[i * n];     \
+                }                                                                       \
+                JTEST_COUNT_CYCLES(                                                     \
+                    arm_mat_bell_vec_mult_##suffix(&mat_bell, mat_sparse_##suffix##_fut2, \
+                                                   mat_sparse_##suffix##_fut));         \
+                mat_sparse_##suffix##_ref_mult(m, k, 1, n);                             \
+                MAT_SPARSE_ASSERT_##suffix(mat_sparse_##suffix##_ref,                   \
+                                           mat_sparse_##suffix##_fut, m);               \
+                                                                                        \
+                JTEST_COUNT_CYCLES(                                                     \
+                    status = arm_mat_bell_mult_##suffix(&mat_bell, &mat_b, &mat_fut));  \
+                mat_sparse_##suffix##_ref_mult(m, k, n, n);                             \
+                                                                                        \
+                if (status != ARM_MATH_SUCCESS)                                         \
+                {                                                                       \
+                    return JTEST_TEST_FAILED;                                           \
+                }                                                                       \
+                                                                                        \
+                MAT_SPARSE_ASSERT_##suffix(mat_sparse_##suffix##_ref,                   \
+                                           mat_sparse_##suffix##_fut, m * n);           \
+            }                                                                           \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+/**
+ *  Buffers that are too small and block sizes that do not divide the
+ *  dimensions must be reported.
+ */
+#define JTEST_ARM_MAT_SPARSE_ERRORS_TEST(suffix)                                        \
+    JTEST_DEFINE_TEST(arm_mat_sparse_##suffix##_errors_test,                            \
+                      arm_mat_csr_from_dense_##suffix)                                  \
+    {                                                                                   \
+        arm_matrix_instance_##suffix mat_a;                                             \
+        arm_mat_csr_instance_##suffix mat_csr;                                          \
+        arm_mat_bell_instance_##suffix mat_bell;                                        \
+        TYPE_FROM_ABBREV(suffix) threshold =                                            \
+            MAT_SPARSE_CONVERT_##suffix(mat_sparse_threshold);                          \
+                                                                                        \
+        mat_sparse_##suffix##_inputs(12, 8, 1);                                         \
+        arm_mat_init_##suffix(&mat_a, 12, 8, mat_sparse_##suffix##_a);                  \
+        arm_mat_csr_init_##suffix(&mat_csr, 0, 0, mat_sparse_row_start,                 \
+                                  mat_sparse_col_idx, mat_sparse_##suffix##_data);      \
+                                                                                        \
+        if (arm_mat_csr_from_dense_##suffix(&mat_a, threshold, 4, &mat_csr) !=          \
+            ARM_MATH_LENGTH_ERROR)                                                      \
+        {                                                                               \
+            return JTEST_TEST_FAILED;                                                   \
+        }                                                                               \
+                                                                                        \
+        arm_mat_bell_init_##suffix(&mat_bell, 0, 0, 8, 0,                               \
+                                   mat_sparse_col_idx, mat_sparse_##suffix##_data);     \
+        if (arm_mat_bell_from_dense_##suffix(&mat_a, threshold, 16, &mat_bell) !=       \
+            ARM_MATH_ARGUMENT_ERROR)                                                    \
+        {                                                                               \
+            return JTEST_TEST_FAILED;                                                   \
+        }                                                                               \
+                                                                                        \
+        mat_bell.blockSize = 4;                                                         \
+        if (arm_mat_bell_from_dense_##suffix(&mat_a, threshold, 3, &mat_bell) !=        \
+            ARM_MATH_LENGTH_ERROR)                                                      \
+        {                                                                               \
+            return JTEST_TEST_FAILED;                                                   \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+JTEST_ARM_MAT_CSR_TEST(f32);
+JTEST_ARM_MAT_CSR_TEST(q31);
+JTEST_ARM_MAT_CSR_TEST(q15);
+
+JTEST_ARM_MAT_BELL_TEST(f32);
+JTEST_ARM_MAT_BELL_TEST(q31);
+JTEST_ARM_MAT_BELL_TEST(q15);
+
+JTEST_ARM_MAT_SPARSE_ERRORS_TEST(f32);
+JTEST_ARM_MAT_SPARSE_ERRORS_TEST(q31);
+JTEST_ARM_MAT_SPARSE_ERRORS_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_sparse_tests)
+{
+    JTEST_TEST_CALL(arm_mat_csr_mult_f32_test);
+    JTEST_TEST_CALL(arm_mat_csr_mult_q31_test);
+    JTEST_TEST_CALL(arm_mat_csr_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_bell_mult_f32_test);
+    JTEST_TEST_CALL(arm_mat_bell_mult_q31_test);
+    JTEST_TEST_CALL(arm_mat_bell_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_sparse_f32_errors_test);
+    JTEST_TEST_CALL(arm_mat_sparse_q31_errors_test);
+    JTEST_TEST_CALL(arm_mat_sparse_q15_errors_test);
+}
@@ -7,6 +7,7 @@ JTEST_DEFINE_GROUP(matrix_tests)
       To skip a test, comment it out.
     */
     JTEST_GROUP_CALL(mat_add_tests);
+    JTEST_GROUP_CALL(mat_cholesky_tests);
     JTEST_GROUP_CALL(mat_cmplx_mult_tests);
     JTEST_GROUP_CALL(mat_init_tests);
     JTEST_GROUP_CALL(mat_inverse_tests);
@@ -15,5 +16,6 @@ JTEST_DEFINE_GROUP(matrix_tests)
     JTEST_GROUP_CALL(mat_sub_tests);
     JTEST_GROUP_CALL(mat_trans_tests);
     JTEST_GROUP_CALL(mat_scale_tests);
+    JTEST_GROUP_CALL(mat_sparse_tests);
     return;
 }
@@ -0,0 +1,186 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+#define STATS_NUM_BINS 64
+#define STATS_NUM_FRACTIONS 5
+
+static uint32_t stats_hist_a[STATS_NUM_BINS];
+static uint32_t stats_hist_b[STATS_NUM_BINS];
+static uint32_t stats_hist_ref[STATS_NUM_BINS];
+static float64_t stats_sorted[STATISTICS_MAX_INPUT_ELEMENTS];
+
+/* Fractions given to the percentile functions */
+static const float32_t stats_fractions_f32[STATS_NUM_FRACTIONS] =
+    {0.0f, 0.25f, 0.5f, 0.75f, 1.0f};
+static const q31_t stats_fractions_q31[STATS_NUM_FRACTIONS] =
+    {0, 0x20000000, 0x40000000, 0x60000000, 0x7FFFFFFF};
+static const q15_t stats_fractions_q15[STATS_NUM_FRACTIONS] =
+    {0, 0x2000, 0x4000, 0x6000, 0x7FFF};
+
+/**
+ *  Feed count samples to the statistics instance in blocks of block_size
+ *  samples.
+ */
+#define STATS_FEED(suffix, inst, ptr, count, block_size)            \
+    do                                                              \
+    {                                                               \
+        uint32_t done = 0;                                          \
+        uint32_t len;                                               \
+        while (done < (count))                                      \
+        {                                                           \
+            len = (count) - done;                                   \
+            len = (len < (block_size)) ? len : (block_size);        \
+            JTEST_COUNT_CYCLES(                                     \
+                arm_stats_update_##suffix(&(inst), (ptr) + done, len)); \
+            done += len;                                            \
+        }                                                           \
+    } while (0)
+
+/**
+ *  Sort the samples, in double precision, for the percentile checks.
+ */
+#define STATS_SORT(ptr, count)                                      \
+    do                                                              \
+    {                                                               \
+        uint32_t i, j;                                              \
+        float64_t tmp;                                              \
+        for (i = 0; i < (count); i++)                               \
+        {                                                           \
+            tmp = (float64_t) (ptr)[i];                             \
+            for (j = i; (j > 0) && (stats_sorted[j - 1] > tmp); j--) \
+            {                                                       \
+                stats_sorted[j] = stats_sorted[j - 1];              \
+            }                                                       \
+            stats_sorted[j] = tmp;                                  \
+        }                                                           \
+    } while (0)
+
+/**
+ *  Split each input in two halves, accumulate them in two instances in blocks
+ *  of each of the statistics block sizes, merge them, and compare the results
+ *  and the histogram with the reference functions. Each percentile must lie
+ *  within one bin of the sample of the same rank.
+ *
+ *  hist_arg is the upper edge of the histogram for the floating-point version
+ *  and the bin shift for the fixed-point versions, and bin_width is the width
+ *  of the bins in units of type.
+ */
+#define STATS_TEST_TEMPLATE(suffix, type, hist_min, hist_arg,                   \
+                            bin_width, fraction_scale)                          \
+    JTEST_DEFINE_TEST(arm_stats_##suffix##_test,                                \
+                      arm_stats_update_##suffix)                                \
+    {                                                                           \
+        arm_stats_instance_##suffix stats_a;                                    \
+        arm_stats_instance_##suffix stats_b;                                    \
+        ARR_DESC_t * input_desc;                                                \
+        type * input;                                                           \
+        type res_fut[5];                                                        \
+        type res_ref[5];                                                        \
+        type percentile;                                                        \
+        uint32_t input_idx, block_size_idx, block_size;                         \
+        uint32_t count, half, rank, idx, b, f, i;                               \
+                                                                                \
+        for (input_idx = 0;                                                     \
+             input_idx < statistics_f_all.element_count;                        \
+             input_idx++)                                                       \
+        {                                                                       \
+            input_desc = ARR_DESC_ELT(ARR_DESC_t *, input_idx,                  \
+                                      &statistics_f_all);                       \
+            input = (type *) input_desc->data_ptr;                              \
+            count = input_desc->element_count;                                  \
+            half = count / 2;                                                   \
+                                                                                \
+            for (block_size_idx = 0;                                            \
+                 block_size_idx < statistics_block_sizes.element_count;         \
+                 block_size_idx++)                                              \
+            {                                                                   \
+                block_size = ARR_DESC_ELT(uint32_t, block_size_idx,             \
+                                          &statistics_block_sizes);             \
+                                                                                \
+                /* Display test parameter values */                             \
+                JTEST_DUMP_STRF("Number of Samples: %d\n"                       \
+                                "Block Size: %d\n",                             \
+                                (int)count,                                     \
+                                (int)block_size);                               \
+                                                                                \
+                arm_stats_init_##suffix(&stats_a, stats_hist_a, STATS_NUM_BINS, \
+                                        hist_min, hist_arg);                    \
+                arm_stats_init_##suffix(&stats_b, stats_hist_b, STATS_NUM_BINS, \
+                                        hist_min, hist_arg);                    \
+                STATS_FEED(suffix, stats_a, input, half, block_size);           \
+                STATS_FEED(suffix, stats_b, input + half, count - half,         \
+                           block_size);                                         \
+                arm_stats_merge_##suffix(&stats_a, &stats_b);                   \
+                                                                                \
+                arm_stats_result_##suffix(&stats_a, &res_fut[0], &res_fut[1],   \
+                                          &res_fut[2], &res_fut[3],             \
+                                          &res_fut[4]);                         \
+                ref_mean_##suffix(input, count, &res_ref[0]);                   \
+                ref_var_##suffix(input, count, &res_ref[1]);                    \
+                ref_std_##suffix(input, count, &res_ref[2]);                    \
+                ref_min_##suffix(input, count, &res_ref[3], &idx);              \
+                ref_max_##suffix(input, count, &res_ref[4], &idx);              \
+                                                                                \
+                for (i = 0; i < 5; i++)                                         \
+                {                                                               \
+                    TEST_CONVERT_AND_ASSERT_SNR(                                \
+                        statistics_output_f32_ref,                              \
+                        &res_ref[i],                                            \
+                        statistics_output_f32_fut,                              \
+                        &res_fut[i],                                            \
+                        1,                                                      \
+                        type,                                                   \
+                        STATISTICS_SNR_THRESHOLD_##type);                       \
+                }                                                               \
+                                                                                \
+                ref_histogram_##suffix(input, count, stats_hist_ref,            \
+                                       STATS_NUM_BINS, hist_min, hist_arg);     \
+                for (b = 0; b < STATS_NUM_BINS; b++)                            \
+                {                                                               \
+                    TEST_ASSERT_EQUAL(stats_hist_a[b], stats_hist_ref[b]);      \
+                }                                                               \
+                                                                                \
+                STATS_SORT(input, count);                                       \
+                for (f = 0; f < STATS_NUM_FRACTIONS; f++)                       \
+                {                                                               \
+                    percentile = arm_stats_percentile_##suffix(                 \
+                        &stats_a, stats_fractions_##suffix[f]);                 \
+                    rank = (uint32_t) ceil(stats_fractions_##suffix[f] *        \
+                                           (float64_t) count / fraction_scale); \
+                    rank = (rank > 0) ? rank : 1;                               \
+                    if (fabs((float64_t) percentile - stats_sorted[rank - 1]) > \
+                        (bin_width))                                            \
+                    {                                                           \
+                        JTEST_DUMP_STRF("Fraction: %d\n", (int)f);              \
+                        return JTEST_TEST_FAILED;                               \
+                    }                                                           \
+                }                                                               \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+STATS_TEST_TEMPLATE(f32, float32_t, -0.5f, 0.5f, 1.0 / 64, 1.0);
+STATS_TEST_TEMPLATE(q31, q31_t, (q31_t) 0x80000000, 26, 67108864.0, 2147483648.0);
+STATS_TEST_TEMPLATE(q15, q15_t, (q15_t) 0x8000, 10, 1024.0, 32768.0);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_f32_test);
+    JTEST_TEST_CALL(arm_stats_q31_test);
+    JTEST_TEST_CALL(arm_stats_q15_test);
+}
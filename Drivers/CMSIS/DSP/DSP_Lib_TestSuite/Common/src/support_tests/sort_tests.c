@@ -0,0 +1,233 @@
+#include "jtest.h"
+#include "support_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "support_templates.h"
+#include "type_abbrev.h"
+
+#define SORT_LONG_SIZE 257
+#define SORT_MAX_SIZE  (SORT_LONG_SIZE * 4)
+
+/* Sizes of the pseudo-random inputs, to cover several merge and radix passes */
+static const uint32_t sort_long_sizes[] = {1, 9, 64, 257};
+static const uint32_t topk_ks[] = {1, 3, 8, 20};
+
+static uint32_t sort_input[SORT_LONG_SIZE];
+static uint32_t sort_fut[SORT_MAX_SIZE / 4];
+static uint32_t sort_ref[SORT_MAX_SIZE / 4];
+static uint32_t sort_scratch[SORT_MAX_SIZE / 4];
+static uint32_t sort_index_fut[SORT_MAX_SIZE];
+static uint32_t sort_index_ref[SORT_MAX_SIZE];
+static uint32_t topk_heap_index[SORT_MAX_SIZE];
+
+/**
+ *  Fill the pseudo-random input. Every fourth word repeats an earlier one so
+ *  that there are equal elements, and the floating-point values are finite.
+ */
+static void sort_fill_input(void)
+{
+    uint32_t i, seed = 12345;
+
+    for (i = 0; i < SORT_LONG_SIZE; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        sort_input[i] = ((i & 3) == 3) ? sort_input[i / 2] : (seed & 0xBFFFFFFF);
+    }
+}
+
+/**
+ *  Run the body for each support input and block size, then for each pseudo
+ *  random input, with input pointing to the data and count the number of
+ *  elements of type.
+ */
+#define SORT_FOR_EACH_INPUT(type, body)                                         \
+    do                                                                          \
+    {                                                                           \
+        uint32_t input_idx, block_size_idx;                                     \
+        ARR_DESC_t * input_desc;                                                \
+        type * input;                                                           \
+        uint32_t count;                                                         \
+                                                                                \
+        for (input_idx = 0; input_idx < support_f_all.element_count; input_idx++) \
+        {                                                                       \
+            input_desc = ARR_DESC_ELT(ARR_DESC_t *, input_idx, &support_f_all); \
+            input = (type *) input_desc->data_ptr;                              \
+            for (block_size_idx = 0;                                            \
+                 block_size_idx < support_block_sizes.element_count;            \
+                 block_size_idx++)                                              \
+            {                                                                   \
+                count = ARR_DESC_ELT(uint32_t, block_size_idx,                  \
+                                     &support_block_sizes);                     \
+                count = (count < input_desc->element_count) ?                   \
+                    count : input_desc->element_count;                          \
+                body;                                                           \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        sort_fill_input();                                                      \
+        input = (type *) sort_input;                                            \
+        for (block_size_idx = 0; block_size_idx < 4; block_size_idx++)          \
+        {                                                                       \
+            count = sort_long_sizes[block_size_idx];                            \
+            body;                                                               \
+        }                                                                       \
+    } while (0)
+
+#define SORT_TEST_TEMPLATE(suffix, type)                                        \
+    JTEST_DEFINE_TEST(arm_sort_##suffix##_test,                                 \
+                      arm_sort_##suffix)                                        \
+    {                                                                           \
+        SORT_FOR_EACH_INPUT(                                                    \
+            type,                                                               \
+            memcpy(sort_fut, input, count * sizeof(type));                      \
+            memcpy(sort_ref, input, count * sizeof(type));                      \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_sort_##suffix((type *) sort_fut,                            \
+                                  (type *) sort_scratch, count));               \
+            ref_sort_##suffix((type *) sort_ref, count);                        \
+                                                                                \
+            TEST_ASSERT_BUFFERS_EQUAL(sort_ref, sort_fut,                       \
+                                      count * sizeof(type)));                   \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+/**
+ *  The selected element must be the one of the sorted vector, with smaller or
+ *  equal elements before it and larger or equal elements after it.
+ */
+#define NTH_ELEMENT_TEST_TEMPLATE(suffix, type)                                 \
+    JTEST_DEFINE_TEST(arm_nth_element_##suffix##_test,                          \
+                      arm_nth_element_##suffix)                                 \
+    {                                                                           \
+        type * fut = (type *) sort_fut;                                         \
+        type * ref = (type *) sort_ref;                                         \
+        type value;                                                             \
+        uint32_t n, i;                                                          \
+                                                                                \
+        SORT_FOR_EACH_INPUT(                                                    \
+            type,                                                               \
+            memcpy(ref, input, count * sizeof(type));                           \
+            ref_sort_##suffix(ref, count);                                      \
+                                                                                \
+            for (n = 0; n < count; n += 1 + count / 16)                         \
+            {                                                                   \
+                memcpy(fut, input, count * sizeof(type));                       \
+                JTEST_COUNT_CYCLES(                                             \
+                    value = arm_nth_element_##suffix(fut, count, n));           \
+                                                                                \
+                TEST_ASSERT_EQUAL(value, ref[n]);                               \
+                TEST_ASSERT_EQUAL(fut[n], ref[n]);                              \
+                for (i = 0; i < count; i++)                                     \
+                {                                                               \
+                    TEST_ASSERT_EQUAL((i < n) ? (fut[i] <= value) :             \
+                                      (fut[i] >= value), 1);                    \
+                }                                                               \
+            });                                                                 \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+/**
+ *  Give the elements in two blocks, and compare the k largest values and
+ *  their indices with the reference.
+ */
+#define TOPK_TEST_TEMPLATE(suffix, type)                                        \
+    JTEST_DEFINE_TEST(arm_topk_##suffix##_test,                                 \
+                      arm_topk_update_##suffix)                                 \
+    {                                                                           \
+        arm_topk_instance_##suffix topk_inst;                                   \
+        uint32_t k_idx, k, num, half;                                           \
+                                                                                \
+        SORT_FOR_EACH_INPUT(                                                    \
+            type,                                                               \
+            for (k_idx = 0; k_idx < 4; k_idx++)                                 \
+            {                                                                   \
+                k = topk_ks[k_idx];                                             \
+                half = count / 3;                                               \
+                                                                                \
+                arm_topk_init_##suffix(&topk_inst, k, (type *) sort_scratch,    \
+                                       topk_heap_index);                        \
+                JTEST_COUNT_CYCLES(                                             \
+                    arm_topk_update_##suffix(&topk_inst, input, half));         \
+                JTEST_COUNT_CYCLES(                                             \
+                    arm_topk_update_##suffix(&topk_inst, input + half,          \
+                                             count - half));                    \
+                num = arm_topk_get_##suffix(&topk_inst, (type *) sort_fut,      \
+                                            sort_index_fut);                    \
+                ref_topk_##suffix(input, count, k, (type *) sort_ref,           \
+                                  sort_index_ref);                              \
+                                                                                \
+                TEST_ASSERT_EQUAL(num, (k < count) ? k : count);                \
+                TEST_ASSERT_BUFFERS_EQUAL(sort_ref, sort_fut,                   \
+                                          num * sizeof(type));                  \
+                TEST_ASSERT_BUFFERS_EQUAL(sort_index_ref, sort_index_fut,       \
+                                          num * sizeof(uint32_t));              \
+            });                                                                 \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+SORT_TEST_TEMPLATE(f32, float32_t);
+SORT_TEST_TEMPLATE(q31, q31_t);
+SORT_TEST_TEMPLATE(q15, q15_t);
+
+JTEST_DEFINE_TEST(arm_sort_q7_test, arm_sort_q7)
+{
+    SORT_FOR_EACH_INPUT(
+        q7_t,
+        memcpy(sort_fut, input, count);
+        memcpy(sort_ref, input, count);
+
+        JTEST_COUNT_CYCLES(
+            arm_sort_q7((q7_t *) sort_fut, count));
+        ref_sort_q7((q7_t *) sort_ref, count);
+
+        TEST_ASSERT_BUFFERS_EQUAL(sort_ref, sort_fut, count));
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_argsort_f32_test, arm_argsort_f32)
+{
+    SORT_FOR_EACH_INPUT(
+        float32_t,
+        JTEST_COUNT_CYCLES(
+            arm_argsort_f32(input, sort_index_fut, sort_scratch, count));
+        ref_argsort_f32(input, sort_index_ref, count);
+
+        TEST_ASSERT_BUFFERS_EQUAL(sort_index_ref, sort_index_fut,
+                                  count * sizeof(uint32_t)));
+
+    return JTEST_TEST_PASSED;
+}
+
+NTH_ELEMENT_TEST_TEMPLATE(f32, float32_t);
+NTH_ELEMENT_TEST_TEMPLATE(q31, q31_t);
+NTH_ELEMENT_TEST_TEMPLATE(q15, q15_t);
+
+TOPK_TEST_TEMPLATE(f32, float32_t);
+TOPK_TEST_TEMPLATE(q31, q31_t);
+TOPK_TEST_TEMPLATE(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(sort_tests)
+{
+    JTEST_TEST_CALL(arm_sort_f32_test);
+    JTEST_TEST_CALL(arm_sort_q31_test);
+    JTEST_TEST_CALL(arm_sort_q15_test);
+    JTEST_TEST_CALL(arm_sort_q7_test);
+    JTEST_TEST_CALL(arm_argsort_f32_test);
+    JTEST_TEST_CALL(arm_nth_element_f32_test);
+    JTEST_TEST_CALL(arm_nth_element_q31_test);
+    JTEST_TEST_CALL(arm_nth_element_q15_test);
+    JTEST_TEST_CALL(arm_topk_f32_test);
+    JTEST_TEST_CALL(arm_topk_q31_test);
+    JTEST_TEST_CALL(arm_topk_q15_test);
+}
@@ -68,6 +68,21 @@ ARR_DESC_DEFINE_SUBSET(support_f_2,
                        support_f_32,
                        2);
 
+/* Full scale, out of range and rounding tie values of the fixed-point formats. */
+ARR_DESC_DEFINE(float32_t,
+                support_f_limits,
+                32,
+                CURLY(
+                      1.0f       , -1.0f       , 0.99999994f , -0.99999994f,
+                      1.5f       , -1.5f       , 200.0f      , -200.0f     ,
+                      0.5f       , -0.5f       , 0.25f       , -0.25f      ,
+                      1.5258789e-05f, -1.5258789e-05f, 4.5776367e-05f, -4.5776367e-05f,
+                      0.00390625f, -0.00390625f, 0.01171875f , -0.01171875f,
+                      2.3283064e-10f, -2.3283064e-10f, 0.0078125f, -0.0078125f,
+                      0.99609375f, -0.99609375f, 0.999f      , -0.999f     ,
+                      1.0039063f , -1.0039063f , 127.0f      , -128.0f
+                      ));
+
 ARR_DESC_DEFINE(float32_t,
                 support_zeros,
                 32,
@@ -76,10 +91,11 @@ ARR_DESC_DEFINE(float32_t,
 /* Aggregate all float datasets. */
 ARR_DESC_DEFINE(ARR_DESC_t *,
                 support_f_all,
-                4,
+                5,
                 CURLY(
                       &support_zeros,
                       &support_f_2,
                       &support_f_15,
-                      &support_f_32
+                      &support_f_32,
+                      &support_f_limits
                       ));
@@ -0,0 +1,241 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/* Number of channels transformed by each batched call */
+#define FFT_BATCH_CHANNELS 4
+
+/*
+  Scratch buffer for the interleaved layout and for the RFFT reference, which
+  needs 2 * fftlen values per channel. The SNR comparison only writes it after
+  the transforms are done.
+*/
+#define FFT_BATCH_SCRATCH transform_fft_output_f32_fut
+
+/* Planar channels of len elements of width values to the interleaved layout */
+static void fft_batch_interleave(const float32_t * pSrc, float32_t * pDst,
+                                 uint32_t len, uint32_t width)
+{
+    uint32_t c, k, r;
+
+    for (c = 0; c < FFT_BATCH_CHANNELS; c++)
+        for (k = 0; k < len; k++)
+            for (r = 0; r < width; r++)
+                pDst[(k * FFT_BATCH_CHANNELS + c) * width + r] =
+                    pSrc[(c * len + k) * width + r];
+}
+
+/* Interleaved layout back to planar channels */
+static void fft_batch_deinterleave(const float32_t * pSrc, float32_t * pDst,
+                                   uint32_t len, uint32_t width)
+{
+    uint32_t c, k, r;
+
+    for (c = 0; c < FFT_BATCH_CHANNELS; c++)
+        for (k = 0; k < len; k++)
+            for (r = 0; r < width; r++)
+                pDst[(c * len + k) * width + r] =
+                    pSrc[(k * FFT_BATCH_CHANNELS + c) * width + r];
+}
+
+/*
+  Batched CFFT function test template. Arguments are: function configuration
+  suffix, channel layout and inverse-transform flag
+*/
+#define CFFT_BATCH_DEFINE_TEST(config_suffix, layout, ifft_flag)            \
+    JTEST_DEFINE_TEST(arm_cfft_batch_f32_##config_suffix##_test,            \
+                      arm_cfft_batch_f32)                                   \
+    {                                                                       \
+        arm_status status;                                                  \
+        uint32_t c;                                                         \
+        float32_t * p_fut;                                                  \
+                                                                            \
+        /* Go through all arm_cfft_instances */                             \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            cfft_inst_idx, const arm_cfft_instance_f32 *, cfft_inst_ptr,    \
+            transform_cfft_f32_structs                                      \
+            ,                                                               \
+                                                                            \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                               \
+                transform_fft_f32_inputs,                                   \
+                cfft_inst_ptr->fftLen *                                     \
+                FFT_BATCH_CHANNELS *                                        \
+                sizeof(float32_t) *                                         \
+                2 /*complex_inputs*/);                                      \
+                                                                            \
+            p_fut = transform_fft_inplace_input_fut;                        \
+            if (layout == ARM_FFT_BATCH_INTERLEAVED)                        \
+            {                                                               \
+                fft_batch_interleave(transform_fft_inplace_input_fut,       \
+                                     FFT_BATCH_SCRATCH,                     \
+                                     cfft_inst_ptr->fftLen, 2);             \
+                p_fut = FFT_BATCH_SCRATCH;                                  \
+            }                                                               \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Channels: %d\n"                                \
+                            "Inverse-transform flag: %d\n",                 \
+                            (int)cfft_inst_ptr->fftLen,                     \
+                            (int)FFT_BATCH_CHANNELS,                        \
+                            (int)ifft_flag);                                \
+                                                                            \
+            /* Display cycle count and run test */                          \
+            JTEST_COUNT_CYCLES(                                             \
+                status = arm_cfft_batch_f32(cfft_inst_ptr,                  \
+                                            p_fut,                          \
+                                            FFT_BATCH_CHANNELS,             \
+                                            layout,                         \
+                                            ifft_flag,                      \
+                                            1));                            \
+            if (status != ARM_MATH_SUCCESS)                                 \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            if (layout == ARM_FFT_BATCH_INTERLEAVED)                        \
+            {                                                               \
+                fft_batch_deinterleave(FFT_BATCH_SCRATCH,                   \
+                                       transform_fft_inplace_input_fut,     \
+                                       cfft_inst_ptr->fftLen, 2);           \
+            }                                                               \
+                                                                            \
+            for (c = 0; c < FFT_BATCH_CHANNELS; c++)                        \
+            {                                                               \
+                ref_cfft_f32(cfft_inst_ptr,                                 \
+                             transform_fft_inplace_input_ref +              \
+                             c * 2 * cfft_inst_ptr->fftLen,                 \
+                             ifft_flag,                                     \
+                             1);                                            \
+            }                                                               \
+                                                                            \
+            /* Test correctness */                                          \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                          \
+                cfft_inst_ptr->fftLen * FFT_BATCH_CHANNELS,                 \
+                float32_t));                                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/*
+  Batched RFFT fast function test template. Arguments are: function
+  configuration suffix, channel layout and inverse-transform flag
+*/
+#define RFFT_FAST_BATCH_DEFINE_TEST(config_suffix, layout, ifft_flag)       \
+    JTEST_DEFINE_TEST(arm_rfft_fast_batch_f32_##config_suffix##_test,       \
+                      arm_rfft_fast_batch_f32)                              \
+    {                                                                       \
+        arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};             \
+        arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};             \
+        arm_status status;                                                  \
+        uint32_t c;                                                         \
+        float32_t * p_fut;                                                  \
+                                                                            \
+        /* Go through all FFT lengths */                                    \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens       \
+            ,                                                               \
+                                                                            \
+            /* Initialize the RFFT and CRFFT Instances */                   \
+            arm_rfft_fast_init_f32(&rfft_inst_fut, fftlen);                 \
+            arm_rfft_fast_init_f32(&rfft_inst_ref, fftlen);                 \
+                                                                            \
+            TRANSFORM_COPY_INPUTS(                                          \
+                transform_fft_f32_inputs,                                   \
+                fftlen *                                                    \
+                FFT_BATCH_CHANNELS *                                        \
+                sizeof(float32_t));                                         \
+                                                                            \
+            /* Real samples in, packed complex spectrum out, or reverse */  \
+            p_fut = transform_fft_input_fut;                                \
+            if (layout == ARM_FFT_BATCH_INTERLEAVED)                        \
+            {                                                               \
+                fft_batch_interleave(transform_fft_input_fut,               \
+                                     FFT_BATCH_SCRATCH,                     \
+                                     ifft_flag ? fftlen / 2 : fftlen,       \
+                                     ifft_flag ? 2 : 1);                    \
+                p_fut = FFT_BATCH_SCRATCH;                                  \
+            }                                                               \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Channels: %d\n"                                \
+                            "Inverse-transform flag: %d\n",                 \
+                            (int)fftlen,                                    \
+                            (int)FFT_BATCH_CHANNELS,                        \
+                            (int)ifft_flag);                                \
+                                                                            \
+            /* Display cycle count and run test */                          \
+            JTEST_COUNT_CYCLES(                                             \
+                status = arm_rfft_fast_batch_f32(                           \
+                    &rfft_inst_fut,                                         \
+                    p_fut,                                                  \
+                    transform_fft_output_fut,                               \
+                    FFT_BATCH_CHANNELS,                                     \
+                    layout,                                                 \
+                    ifft_flag));                                            \
+            if (status != ARM_MATH_SUCCESS)                                 \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            if (layout == ARM_FFT_BATCH_INTERLEAVED)                        \
+            {                                                               \
+                fft_batch_deinterleave(transform_fft_output_fut,            \
+                                       transform_fft_input_fut,             \
+                                       ifft_flag ? fftlen : fftlen / 2,     \
+                                       ifft_flag ? 1 : 2);                  \
+                memcpy(transform_fft_output_fut,                            \
+                       transform_fft_input_fut,                             \
+                       fftlen * FFT_BATCH_CHANNELS * sizeof(float32_t));    \
+            }                                                               \
+                                                                            \
+            /* The reference uses its output as 2 * fftlen scratch, so the */\
+            /* last channel would run past transform_fft_output_ref */      \
+            for (c = 0; c < FFT_BATCH_CHANNELS; c++)                        \
+            {                                                               \
+                ref_rfft_fast_f32(                                          \
+                    &rfft_inst_ref,                                         \
+                    transform_fft_input_ref + c * fftlen,                   \
+                    FFT_BATCH_SCRATCH,                                      \
+                    ifft_flag);                                             \
+                memcpy(transform_fft_output_ref + c * fftlen,               \
+                       FFT_BATCH_SCRATCH,                                   \
+                       fftlen * sizeof(float32_t));                         \
+            }                                                               \
+                                                                            \
+            /* Test correctness */                                          \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                                \
+                fftlen * FFT_BATCH_CHANNELS,                                \
+                float32_t));                                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CFFT_BATCH_DEFINE_TEST(planar_forward, ARM_FFT_BATCH_PLANAR, 0U);
+CFFT_BATCH_DEFINE_TEST(planar_inverse, ARM_FFT_BATCH_PLANAR, 1U);
+CFFT_BATCH_DEFINE_TEST(interleaved_forward, ARM_FFT_BATCH_INTERLEAVED, 0U);
+CFFT_BATCH_DEFINE_TEST(interleaved_inverse, ARM_FFT_BATCH_INTERLEAVED, 1U);
+RFFT_FAST_BATCH_DEFINE_TEST(planar_forward, ARM_FFT_BATCH_PLANAR, 0U);
+RFFT_FAST_BATCH_DEFINE_TEST(planar_inverse, ARM_FFT_BATCH_PLANAR, 1U);
+RFFT_FAST_BATCH_DEFINE_TEST(interleaved_forward, ARM_FFT_BATCH_INTERLEAVED, 0U);
+RFFT_FAST_BATCH_DEFINE_TEST(interleaved_inverse, ARM_FFT_BATCH_INTERLEAVED, 1U);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_batch_tests)
+{
+    JTEST_TEST_CALL(arm_cfft_batch_f32_planar_forward_test);
+    JTEST_TEST_CALL(arm_cfft_batch_f32_planar_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_batch_f32_interleaved_forward_test);
+    JTEST_TEST_CALL(arm_cfft_batch_f32_interleaved_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_batch_f32_planar_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_batch_f32_planar_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_batch_f32_interleaved_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_batch_f32_interleaved_inverse_test);
+}
@@ -0,0 +1,156 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/* Buffers receiving the tables generated by the mixed radix init functions */
+static float32_t cfft_mixed_radix_twiddle[TRANSFORM_MAX_FFT_LEN * 2];
+static float32_t cfft_mixed_radix_twiddle_rfft[TRANSFORM_MAX_FFT_LEN];
+static uint16_t cfft_mixed_radix_bitrev[TRANSFORM_MAX_FFT_LEN * 2];
+
+/*
+  Mixed radix CFFT function test template. Arguments are: function configuration
+  suffix and inverse-transform flag
+*/
+#define CFFT_MIXED_RADIX_DEFINE_TEST(config_suffix, ifft_flag)              \
+    JTEST_DEFINE_TEST(arm_cfft_mixed_radix_f32_##config_suffix##_test,      \
+                      arm_cfft_f32)                                         \
+    {                                                                       \
+        arm_cfft_instance_f32 cfft_inst_fut = {0, NULL, NULL, 0};           \
+                                                                            \
+        /* Go through all FFT lengths */                                    \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            fftlen_idx, uint16_t, fftlen, transform_cfft_mixed_radix_fftlens \
+            ,                                                               \
+                                                                            \
+            if (arm_cfft_mixed_radix_init_f32(                              \
+                    &cfft_inst_fut, fftlen,                                 \
+                    cfft_mixed_radix_twiddle,                               \
+                    cfft_mixed_radix_bitrev) != ARM_MATH_SUCCESS)           \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            /* arm_bitreversal_32 swaps in groups of two */                 \
+            if ((cfft_inst_fut.bitRevLength == 0U) ||                       \
+                ((cfft_inst_fut.bitRevLength % 4U) != 0U))                  \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                               \
+                transform_fft_f32_inputs,                                   \
+                fftlen *                                                    \
+                sizeof(float32_t) *                                         \
+                2 /*complex_inputs*/);                                      \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Inverse-transform flag: %d\n",                 \
+                            (int)fftlen,                                    \
+                            (int)ifft_flag);                                \
+                                                                            \
+            /* Display cycle count and run test */                          \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_cfft_f32(&cfft_inst_fut,                                \
+                             (void *) transform_fft_inplace_input_fut,      \
+                             ifft_flag,                                     \
+                             1));                                           \
+                                                                            \
+            /* The reference only uses the FFT length of the instance */    \
+            ref_cfft_f32(&cfft_inst_fut,                                    \
+                         (void *) transform_fft_inplace_input_ref,          \
+                         ifft_flag,                                         \
+                         1);                                                \
+                                                                            \
+            /* Test correctness */                                          \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                          \
+                fftlen,                                                     \
+                float32_t));                                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/*
+  Mixed radix RFFT fast function test template. Arguments are: function
+  configuration suffix and inverse-transform flag
+*/
+#define RFFT_FAST_MIXED_RADIX_DEFINE_TEST(config_suffix, ifft_flag)         \
+    JTEST_DEFINE_TEST(arm_rfft_fast_mixed_radix_f32_##config_suffix##_test, \
+                      arm_rfft_fast_f32)                                    \
+    {                                                                       \
+        arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};             \
+                                                                            \
+        /* Go through all FFT lengths */                                    \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            fftlen_idx, uint16_t, fftlen,                                   \
+            transform_rfft_fast_mixed_radix_fftlens                         \
+            ,                                                               \
+                                                                            \
+            if (arm_rfft_fast_mixed_radix_init_f32(                         \
+                    &rfft_inst_fut, fftlen,                                 \
+                    cfft_mixed_radix_twiddle,                               \
+                    cfft_mixed_radix_twiddle_rfft,                          \
+                    cfft_mixed_radix_bitrev) != ARM_MATH_SUCCESS)           \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            /* arm_bitreversal_32 swaps in groups of two */                 \
+            if ((rfft_inst_fut.Sint.bitRevLength == 0U) ||                  \
+                ((rfft_inst_fut.Sint.bitRevLength % 4U) != 0U))             \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            TRANSFORM_COPY_INPUTS(                                          \
+                transform_fft_f32_inputs,                                   \
+                fftlen *                                                    \
+                sizeof(float32_t));                                         \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Inverse-transform flag: %d\n",                 \
+                            (int)fftlen,                                    \
+                            (int)ifft_flag);                                \
+                                                                            \
+            /* Display cycle count and run test */                          \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_rfft_fast_f32(                                          \
+                    &rfft_inst_fut,                                         \
+                    (void *) transform_fft_input_fut,                       \
+                    (void *) transform_fft_output_fut,                      \
+                    ifft_flag));                                            \
+                                                                            \
+            ref_rfft_fast_f32(                                              \
+                &rfft_inst_fut,                                             \
+                (void *) transform_fft_input_ref,                           \
+                (void *) transform_fft_output_ref,                          \
+                ifft_flag);                                                 \
+                                                                            \
+            /* Test correctness */                                          \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                                \
+                fftlen,                                                     \
+                float32_t));                                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CFFT_MIXED_RADIX_DEFINE_TEST(forward, 0U);
+CFFT_MIXED_RADIX_DEFINE_TEST(inverse, 1U);
+RFFT_FAST_MIXED_RADIX_DEFINE_TEST(forward, 0U);
+RFFT_FAST_MIXED_RADIX_DEFINE_TEST(inverse, 1U);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_mixed_radix_tests)
+{
+    JTEST_TEST_CALL(arm_cfft_mixed_radix_f32_forward_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_radix_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_mixed_radix_f32_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_mixed_radix_f32_inverse_test);
+}
@@ -0,0 +1,156 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/* Arena receiving the tables generated at run time. The tests hand out an
+   unaligned arena of exactly the documented size. */
+static uint32_t cfft_table_arena_buf[ARM_CFFT_TABLE_ARENA_SIZE_F32(TRANSFORM_MAX_FFT_LEN) / 4 + 1];
+
+/*
+  CFFT with run time generated tables test template. Arguments are: function
+  configuration suffix, inverse-transform flag and FFT lengths
+*/
+#define CFFT_TABLE_DEFINE_TEST(config_suffix, ifft_flag, fftlens)           \
+    JTEST_DEFINE_TEST(arm_cfft_table_f32_##config_suffix##_test,            \
+                      arm_cfft_f32)                                         \
+    {                                                                       \
+        arm_cfft_instance_f32 cfft_inst_fut = {0, NULL, NULL, 0};           \
+        arm_table_arena arena;                                              \
+                                                                            \
+        /* Go through all FFT lengths */                                    \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            fftlen_idx, uint16_t, fftlen, fftlens                           \
+            ,                                                               \
+                                                                            \
+            arm_table_arena_init(&arena,                                    \
+                                 (uint8_t *) cfft_table_arena_buf + 1,      \
+                                 ARM_CFFT_TABLE_ARENA_SIZE_F32(fftlen));    \
+                                                                            \
+            if (arm_cfft_table_init_f32(                                    \
+                    &cfft_inst_fut, fftlen, &arena) != ARM_MATH_SUCCESS)    \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                               \
+                transform_fft_f32_inputs,                                   \
+                fftlen *                                                    \
+                sizeof(float32_t) *                                         \
+                2 /*complex_inputs*/);                                      \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Inverse-transform flag: %d\n"                  \
+                            "Arena used: %d\n",                             \
+                            (int)fftlen,                                    \
+                            (int)ifft_flag,                                 \
+                            (int)arena.used);                               \
+                                                                            \
+            /* Display cycle count and run test */                          \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_cfft_f32(&cfft_inst_fut,                                \
+                             (void *) transform_fft_inplace_input_fut,      \
+                             ifft_flag,                                     \
+                             1));                                           \
+                                                                            \
+            ref_cfft_f32(&cfft_inst_fut,                                    \
+                         (void *) transform_fft_inplace_input_ref,          \
+                         ifft_flag,                                         \
+                         1);                                                \
+                                                                            \
+            /* Test correctness */                                          \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                          \
+                fftlen,                                                     \
+                float32_t));                                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+/*
+  RFFT fast with run time generated tables test template. Arguments are:
+  function configuration suffix, inverse-transform flag and FFT lengths
+*/
+#define RFFT_FAST_TABLE_DEFINE_TEST(config_suffix, ifft_flag, fftlens)      \
+    JTEST_DEFINE_TEST(arm_rfft_fast_table_f32_##config_suffix##_test,       \
+                      arm_rfft_fast_f32)                                    \
+    {                                                                       \
+        arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};             \
+        arm_table_arena arena;                                              \
+                                                                            \
+        /* Go through all FFT lengths */                                    \
+        TEMPLATE_DO_ARR_DESC(                                               \
+            fftlen_idx, uint16_t, fftlen, fftlens                           \
+            ,                                                               \
+                                                                            \
+            arm_table_arena_init(&arena,                                    \
+                                 (uint8_t *) cfft_table_arena_buf + 1,      \
+                                 ARM_RFFT_FAST_TABLE_ARENA_SIZE_F32(fftlen)); \
+                                                                            \
+            if (arm_rfft_fast_table_init_f32(                               \
+                    &rfft_inst_fut, fftlen, &arena) != ARM_MATH_SUCCESS)    \
+            {                                                               \
+                return JTEST_TEST_FAILED;                                   \
+            }                                                               \
+                                                                            \
+            TRANSFORM_COPY_INPUTS(                                          \
+                transform_fft_f32_inputs,                                   \
+                fftlen *                                                    \
+                sizeof(float32_t));                                         \
+                                                                            \
+            /* Display parameter values */                                  \
+            JTEST_DUMP_STRF("Block Size: %d\n"                              \
+                            "Inverse-transform flag: %d\n"                  \
+                            "Arena used: %d\n",                             \
+                            (int)fftlen,                                    \
+                            (int)ifft_flag,                                 \
+                            (int)arena.used);                               \
+                                                                            \
+            /* Display cycle count and run test */                          \
+            JTEST_COUNT_CYCLES(                                             \
+                arm_rfft_fast_f32(                                          \
+                    &rfft_inst_fut,                                         \
+                    (void *) transform_fft_input_fut,                       \
+                    (void *) transform_fft_output_fut,                      \
+                    ifft_flag));                                            \
+                                                                            \
+            ref_rfft_fast_f32(                                              \
+                &rfft_inst_fut,                                             \
+                (void *) transform_fft_input_ref,                           \
+                (void *) transform_fft_output_ref,                          \
+                ifft_flag);                                                 \
+                                                                            \
+            /* Test correctness */                                          \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                                \
+                fftlen,                                                     \
+                float32_t));                                                \
+                                                                            \
+        return JTEST_TEST_PASSED;                                           \
+    }
+
+CFFT_TABLE_DEFINE_TEST(forward, 0U, transform_radix2_fftlens);
+CFFT_TABLE_DEFINE_TEST(inverse, 1U, transform_radix2_fftlens);
+CFFT_TABLE_DEFINE_TEST(mixed_forward, 0U, transform_cfft_mixed_radix_fftlens);
+CFFT_TABLE_DEFINE_TEST(mixed_inverse, 1U, transform_cfft_mixed_radix_fftlens);
+RFFT_FAST_TABLE_DEFINE_TEST(forward, 0U, transform_rfft_fast_fftlens);
+RFFT_FAST_TABLE_DEFINE_TEST(inverse, 1U, transform_rfft_fast_fftlens);
+RFFT_FAST_TABLE_DEFINE_TEST(mixed_forward, 0U, transform_rfft_fast_mixed_radix_fftlens);
+RFFT_FAST_TABLE_DEFINE_TEST(mixed_inverse, 1U, transform_rfft_fast_mixed_radix_fftlens);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_table_tests)
+{
+    JTEST_TEST_CALL(arm_cfft_table_f32_forward_test);
+    JTEST_TEST_CALL(arm_cfft_table_f32_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_table_f32_mixed_forward_test);
+    JTEST_TEST_CALL(arm_cfft_table_f32_mixed_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_table_f32_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_table_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_table_f32_mixed_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_table_f32_mixed_inverse_test);
+}
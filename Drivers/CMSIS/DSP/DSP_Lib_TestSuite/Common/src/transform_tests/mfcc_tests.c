@@ -0,0 +1,384 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+#define MFCC_NUM_SAMPLES  4096
+#define MFCC_MAX_FFT_LEN  512
+#define MFCC_MAX_MEL      40
+#define MFCC_MAX_FEATURES (MFCC_MAX_MEL * (MFCC_NUM_SAMPLES / 64))
+#define MFCC_SAMPLE_RATE  16000.0f
+
+/* Q15 features are compared with 8 fractional bits */
+#define MFCC_SNR_THRESHOLD_q15_t 60
+
+typedef struct
+{
+    uint16_t fftLen;
+    uint16_t hopSize;
+    uint16_t numMel;
+    uint16_t numCoeffs;
+    float32_t fMin;
+    float32_t fMax;
+} mfcc_config;
+
+static const mfcc_config mfcc_configs[] =
+{
+    {256, 128, 20, 13,  20.0f, 8000.0f},
+    {512, 160, 40, 10,  20.0f, 8000.0f},
+    {512, 320, 40,  0,   0.0f, 8000.0f},
+    {128,  64, 16, 16, 300.0f, 4000.0f}
+};
+
+static const uint16_t mfcc_block_sizes[] = {1, 160, 1000};
+
+/* Arena receiving the buffers and the tables of the largest configuration */
+static uint32_t mfcc_arena_buf[ARM_MFCC_ARENA_SIZE_F32(MFCC_MAX_FFT_LEN, MFCC_MAX_MEL, MFCC_MAX_MEL) / 4 + 1];
+static uint32_t mfcc_arena_q15_buf[ARM_MFCC_ARENA_SIZE_Q15(MFCC_MAX_FFT_LEN, MFCC_MAX_MEL, MFCC_MAX_MEL) / 4 + 1];
+
+static float32_t mfcc_input_f32[MFCC_NUM_SAMPLES];
+static q15_t mfcc_input_q15[MFCC_NUM_SAMPLES];
+static float32_t mfcc_ref[MFCC_MAX_FEATURES];
+static float32_t mfcc_fut[MFCC_MAX_FEATURES];
+static q15_t mfcc_fut_q15[MFCC_MAX_FEATURES];
+static q7_t mfcc_fut_q7[MFCC_MAX_FEATURES];
+
+/**
+ *  Two tones with a rising and falling envelope, a tone that starts half way
+ *  and some noise, stored in Q15 and in floating-point with the same values.
+ */
+static void mfcc_make_input(void)
+{
+    uint32_t n, seed = 12345;
+    float32_t t, env, x;
+
+    for (n = 0; n < MFCC_NUM_SAMPLES; n++)
+    {
+        t = n / MFCC_SAMPLE_RATE;
+        env = sinf(3.14159265f * n / MFCC_NUM_SAMPLES);
+        seed = seed * 1664525 + 1013904223;
+
+        x = env * (0.4f * sinf(2 * 3.14159265f * 440 * t) +
+                   0.15f * sinf(2 * 3.14159265f * 1530 * t)) +
+            ((n >= MFCC_NUM_SAMPLES / 2) ? 0.1f * sinf(2 * 3.14159265f * 3100 * t) : 0.0f) +
+            0.01f * ((int32_t)(seed >> 16) - 32768) / 32768.0f;
+
+        mfcc_input_q15[n] = (q15_t)lrintf(x * 32768.0f);
+        mfcc_input_f32[n] = mfcc_input_q15[n] / 32768.0f;
+    }
+}
+
+/**
+ *  Reference features of a configuration, returns the number of frames.
+ */
+static uint32_t mfcc_reference(const mfcc_config * cfg)
+{
+    return ref_mfcc_f32(mfcc_input_f32, MFCC_NUM_SAMPLES, cfg->fftLen, cfg->hopSize,
+                        ARM_WINDOW_HANN, cfg->numMel, cfg->numCoeffs,
+                        MFCC_SAMPLE_RATE, cfg->fMin, cfg->fMax, mfcc_ref);
+}
+
+/**
+ *  Feed the input in blocks and compare the features of all the frames with
+ *  the reference, for MFCC and log-mel outputs.
+ */
+JTEST_DEFINE_TEST(arm_mfcc_f32_test, arm_mfcc_f32)
+{
+    arm_mfcc_instance_f32 mfcc_inst;
+    arm_table_arena arena;
+    const mfcc_config *cfg;
+    uint32_t cfg_idx, block_idx, blockSize, done, num, numFrames, numRef, numFeatures;
+
+    mfcc_make_input();
+
+    for (cfg_idx = 0; cfg_idx < sizeof(mfcc_configs) / sizeof(mfcc_configs[0]); cfg_idx++)
+    {
+        cfg = &mfcc_configs[cfg_idx];
+        numFeatures = (cfg->numCoeffs == 0) ? cfg->numMel : cfg->numCoeffs;
+        numRef = mfcc_reference(cfg);
+
+        for (block_idx = 0; block_idx < sizeof(mfcc_block_sizes) / sizeof(mfcc_block_sizes[0]); block_idx++)
+        {
+            blockSize = mfcc_block_sizes[block_idx];
+
+            /* Display test parameter values */
+            JTEST_DUMP_STRF("FFT Length: %d\n"
+                            "Hop Size: %d\n"
+                            "Mel Filters: %d\n"
+                            "Coefficients: %d\n"
+                            "Block Size: %d\n",
+                            (int)cfg->fftLen,
+                            (int)cfg->hopSize,
+                            (int)cfg->numMel,
+                            (int)cfg->numCoeffs,
+                            (int)blockSize);
+
+            arm_table_arena_init(&arena, mfcc_arena_buf, sizeof(mfcc_arena_buf));
+            if ((arm_mfcc_init_f32(&mfcc_inst, cfg->fftLen, cfg->hopSize, ARM_WINDOW_HANN,
+                                   cfg->numMel, cfg->numCoeffs, MFCC_SAMPLE_RATE,
+                                   cfg->fMin, cfg->fMax, &arena) != ARM_MATH_SUCCESS) ||
+                (arena.used > ARM_MFCC_ARENA_SIZE_F32(cfg->fftLen, cfg->numMel, cfg->numCoeffs)))
+            {
+                return JTEST_TEST_FAILED;
+            }
+
+            numFrames = 0;
+            for (done = 0; done < MFCC_NUM_SAMPLES; done += num)
+            {
+                num = MFCC_NUM_SAMPLES - done;
+                num = (num < blockSize) ? num : blockSize;
+
+                JTEST_COUNT_CYCLES(
+                    numFrames += arm_mfcc_f32(&mfcc_inst, mfcc_input_f32 + done,
+                                              mfcc_fut + numFrames * numFeatures, num));
+            }
+
+            if (numFrames != numRef)
+            {
+                return JTEST_TEST_FAILED;
+            }
+
+            TEST_ASSERT_SNR(mfcc_ref, mfcc_fut, numFrames * numFeatures,
+                            TRANSFORM_SNR_THRESHOLD_float32_t);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Compare the fixed-point features with the floating-point reference, and
+ *  check that a silent input gives the floor of the log-mel energies.
+ */
+JTEST_DEFINE_TEST(arm_mfcc_q15_test, arm_mfcc_q15)
+{
+    arm_mfcc_instance_q15 mfcc_inst;
+    arm_table_arena arena;
+    const mfcc_config *cfg;
+    uint32_t cfg_idx, block_idx, blockSize, done, num, numFrames, numRef, numFeatures, i;
+    q15_t silence[64];
+
+    mfcc_make_input();
+
+    for (cfg_idx = 0; cfg_idx < sizeof(mfcc_configs) / sizeof(mfcc_configs[0]); cfg_idx++)
+    {
+        cfg = &mfcc_configs[cfg_idx];
+        numFeatures = (cfg->numCoeffs == 0) ? cfg->numMel : cfg->numCoeffs;
+        numRef = mfcc_reference(cfg);
+
+        for (block_idx = 0; block_idx < sizeof(mfcc_block_sizes) / sizeof(mfcc_block_sizes[0]); block_idx++)
+        {
+            blockSize = mfcc_block_sizes[block_idx];
+
+            /* Display test parameter values */
+            JTEST_DUMP_STRF("FFT Length: %d\n"
+                            "Hop Size: %d\n"
+                            "Mel Filters: %d\n"
+                            "Coefficients: %d\n"
+                            "Block Size: %d\n",
+                            (int)cfg->fftLen,
+                            (int)cfg->hopSize,
+                            (int)cfg->numMel,
+                            (int)cfg->numCoeffs,
+                            (int)blockSize);
+
+            arm_table_arena_init(&arena, mfcc_arena_q15_buf, sizeof(mfcc_arena_q15_buf));
+            if ((arm_mfcc_init_q15(&mfcc_inst, cfg->fftLen, cfg->hopSize, ARM_WINDOW_HANN,
+                                   cfg->numMel, cfg->numCoeffs, MFCC_SAMPLE_RATE,
+                                   cfg->fMin, cfg->fMax, 8, &arena) != ARM_MATH_SUCCESS) ||
+                (arena.used > ARM_MFCC_ARENA_SIZE_Q15(cfg->fftLen, cfg->numMel, cfg->numCoeffs)))
+            {
+                return JTEST_TEST_FAILED;
+            }
+
+            numFrames = 0;
+            for (done = 0; done < MFCC_NUM_SAMPLES; done += num)
+            {
+                num = MFCC_NUM_SAMPLES - done;
+                num = (num < blockSize) ? num : blockSize;
+
+                JTEST_COUNT_CYCLES(
+                    numFrames += arm_mfcc_q15(&mfcc_inst, mfcc_input_q15 + done,
+                                              mfcc_fut_q15 + numFrames * numFeatures, num));
+            }
+
+            if (numFrames != numRef)
+            {
+                return JTEST_TEST_FAILED;
+            }
+
+            for (i = 0; i < numFrames * numFeatures; i++)
+            {
+                mfcc_fut[i] = mfcc_fut_q15[i] / 256.0f;
+            }
+
+            TEST_ASSERT_SNR(mfcc_ref, mfcc_fut, numFrames * numFeatures,
+                            MFCC_SNR_THRESHOLD_q15_t);
+        }
+    }
+
+    /* Silence gives ln(1e-10) in every band */
+    cfg = &mfcc_configs[2];
+    memset(silence, 0, sizeof(silence));
+    arm_table_arena_init(&arena, mfcc_arena_q15_buf, sizeof(mfcc_arena_q15_buf));
+    arm_mfcc_init_q15(&mfcc_inst, cfg->fftLen, cfg->hopSize, ARM_WINDOW_HANN,
+                      cfg->numMel, cfg->numCoeffs, MFCC_SAMPLE_RATE,
+                      cfg->fMin, cfg->fMax, 8, &arena);
+
+    numFrames = 0;
+    for (done = 0; done < cfg->fftLen; done += sizeof(silence) / sizeof(silence[0]))
+    {
+        numFrames += arm_mfcc_q15(&mfcc_inst, silence, mfcc_fut_q15, sizeof(silence) / sizeof(silence[0]));
+    }
+
+    if (numFrames != 1)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    for (i = 0; i < cfg->numMel; i++)
+    {
+        if (mfcc_fut_q15[i] != -5895)
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  The Q7 output is the saturated Q15 output, with the same fractional bits.
+ */
+JTEST_DEFINE_TEST(arm_mfcc_q7_test, arm_mfcc_q7)
+{
+    arm_mfcc_instance_q15 mfcc_inst;
+    arm_table_arena arena;
+    const mfcc_config *cfg;
+    uint32_t cfg_idx, numFrames, numFramesQ7, numFeatures, i;
+
+    mfcc_make_input();
+
+    for (cfg_idx = 0; cfg_idx < sizeof(mfcc_configs) / sizeof(mfcc_configs[0]); cfg_idx++)
+    {
+        cfg = &mfcc_configs[cfg_idx];
+        numFeatures = (cfg->numCoeffs == 0) ? cfg->numMel : cfg->numCoeffs;
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("FFT Length: %d\n"
+                        "Mel Filters: %d\n"
+                        "Coefficients: %d\n",
+                        (int)cfg->fftLen,
+                        (int)cfg->numMel,
+                        (int)cfg->numCoeffs);
+
+        arm_table_arena_init(&arena, mfcc_arena_q15_buf, sizeof(mfcc_arena_q15_buf));
+        arm_mfcc_init_q15(&mfcc_inst, cfg->fftLen, cfg->hopSize, ARM_WINDOW_HAMMING,
+                          cfg->numMel, cfg->numCoeffs, MFCC_SAMPLE_RATE,
+                          cfg->fMin, cfg->fMax, 2, &arena);
+        numFrames = arm_mfcc_q15(&mfcc_inst, mfcc_input_q15, mfcc_fut_q15, MFCC_NUM_SAMPLES);
+
+        arm_table_arena_init(&arena, mfcc_arena_q15_buf, sizeof(mfcc_arena_q15_buf));
+        arm_mfcc_init_q15(&mfcc_inst, cfg->fftLen, cfg->hopSize, ARM_WINDOW_HAMMING,
+                          cfg->numMel, cfg->numCoeffs, MFCC_SAMPLE_RATE,
+                          cfg->fMin, cfg->fMax, 2, &arena);
+        JTEST_COUNT_CYCLES(
+            numFramesQ7 = arm_mfcc_q7(&mfcc_inst, mfcc_input_q15, mfcc_fut_q7,
+                                      MFCC_NUM_SAMPLES));
+
+        if (numFramesQ7 != numFrames)
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        for (i = 0; i < numFrames * numFeatures; i++)
+        {
+            if (mfcc_fut_q7[i] != ((mfcc_fut_q15[i] > 127) ? 127 :
+                                   (mfcc_fut_q15[i] < -128) ? -128 : mfcc_fut_q15[i]))
+            {
+                return JTEST_TEST_FAILED;
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/* Unsupported parameters and a short arena are reported, the arena is unchanged */
+JTEST_DEFINE_TEST(arm_mfcc_init_test, arm_mfcc_init_f32)
+{
+    arm_mfcc_instance_f32 inst_f32;
+    arm_mfcc_instance_q15 inst_q15;
+    arm_table_arena arena;
+
+    arm_table_arena_init(&arena, mfcc_arena_buf, sizeof(mfcc_arena_buf));
+
+    if (arm_mfcc_init_f32(&inst_f32, 256, 128, ARM_WINDOW_HANN, 20, 21,
+                          MFCC_SAMPLE_RATE, 0.0f, 8000.0f, &arena)
+        != ARM_MATH_ARGUMENT_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    if (arm_mfcc_init_f32(&inst_f32, 256, 128, ARM_WINDOW_HANN, 20, 13,
+                          MFCC_SAMPLE_RATE, 0.0f, 9000.0f, &arena)
+        != ARM_MATH_ARGUMENT_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    if (arm_mfcc_init_q15(&inst_q15, 256, 128, ARM_WINDOW_HANN, 20, 13,
+                          MFCC_SAMPLE_RATE, 0.0f, 8000.0f, 16, &arena)
+        != ARM_MATH_ARGUMENT_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    if (arm_mfcc_init_q15(&inst_q15, 200, 100, ARM_WINDOW_HANN, 20, 13,
+                          MFCC_SAMPLE_RATE, 0.0f, 8000.0f, 8, &arena)
+        != ARM_MATH_ARGUMENT_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    if (arena.used != 0)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    arm_table_arena_init(&arena, mfcc_arena_buf, ARM_MFCC_ARENA_SIZE_F32(256, 20, 13) / 2);
+    if (arm_mfcc_init_f32(&inst_f32, 256, 128, ARM_WINDOW_HANN, 20, 13,
+                          MFCC_SAMPLE_RATE, 0.0f, 8000.0f, &arena)
+        != ARM_MATH_LENGTH_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    if (arena.used != 0)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    arm_table_arena_init(&arena, mfcc_arena_q15_buf, ARM_MFCC_ARENA_SIZE_Q15(256, 20, 13) / 2);
+    if (arm_mfcc_init_q15(&inst_q15, 256, 128, ARM_WINDOW_HANN, 20, 13,
+                          MFCC_SAMPLE_RATE, 0.0f, 8000.0f, 8, &arena)
+        != ARM_MATH_LENGTH_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    if (arena.used != 0)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mfcc_tests)
+{
+    JTEST_TEST_CALL(arm_mfcc_f32_test);
+    JTEST_TEST_CALL(arm_mfcc_q15_test);
+    JTEST_TEST_CALL(arm_mfcc_q7_test);
+    JTEST_TEST_CALL(arm_mfcc_init_test);
+}
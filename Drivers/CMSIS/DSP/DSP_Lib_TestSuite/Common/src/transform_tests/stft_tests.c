@@ -0,0 +1,310 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+#define STFT_MAX_FFT_LEN 300
+#define STFT_NUM_SAMPLES 2048
+
+/* Arena receiving the buffers, the window and the FFT tables */
+static uint32_t stft_arena_buf[ARM_WELCH_ARENA_SIZE_F32(STFT_MAX_FFT_LEN) / 4 + 1];
+
+static const uint16_t stft_fftlens[] = {32, 60, 64, 96, 256, 300};
+static const uint16_t window_lens[] = {2, 16, 31, 64, 100, 512};
+static const uint16_t stft_block_sizes[] = {1, 13, 100};
+
+static float32_t stft_window[STFT_MAX_FFT_LEN];
+
+JTEST_DEFINE_TEST(arm_window_f32_test, arm_window_f32)
+{
+    uint32_t type, len_idx, len;
+
+    for (type = ARM_WINDOW_RECTANGULAR; type <= ARM_WINDOW_FLAT_TOP; type++)
+    {
+        for (len_idx = 0; len_idx < sizeof(window_lens) / sizeof(window_lens[0]); len_idx++)
+        {
+            len = window_lens[len_idx];
+
+            /* Display test parameter values */
+            JTEST_DUMP_STRF("Window: %d\n"
+                            "Length: %d\n",
+                            (int)type,
+                            (int)len);
+
+            if (arm_window_f32((arm_window_type) type, transform_fft_output_fut, len)
+                != ARM_MATH_SUCCESS)
+            {
+                return JTEST_TEST_FAILED;
+            }
+            ref_window_f32((arm_window_type) type, transform_fft_output_ref, len);
+
+            TRANSFORM_SNR_COMPARE_INTERFACE(len, float32_t);
+        }
+    }
+
+    if (arm_window_f32((arm_window_type) 5, transform_fft_output_fut, 4)
+        != ARM_MATH_ARGUMENT_ERROR)
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Feed the inputs in blocks and compare each spectrum with the DFT of the
+ *  windowed frame, for overlapping, adjacent and odd hop sizes.
+ */
+JTEST_DEFINE_TEST(arm_stft_f32_test, arm_stft_f32)
+{
+    arm_stft_instance_f32 stft_inst;
+    arm_table_arena arena;
+    uint32_t len_idx, hop_idx, block_idx;
+    uint32_t fftLen, hopSize, blockSize, done, num, numFrames, frame, f;
+    uint16_t hops[4];
+
+    for (len_idx = 0; len_idx < sizeof(stft_fftlens) / sizeof(stft_fftlens[0]); len_idx++)
+    {
+        fftLen = stft_fftlens[len_idx];
+        hops[0] = fftLen;
+        hops[1] = fftLen / 2;
+        hops[2] = fftLen / 4;
+        hops[3] = 5;
+
+        for (hop_idx = 0; hop_idx < 4; hop_idx++)
+        {
+            hopSize = hops[hop_idx];
+
+            for (block_idx = 0; block_idx < sizeof(stft_block_sizes) / sizeof(stft_block_sizes[0]); block_idx++)
+            {
+                blockSize = stft_block_sizes[block_idx];
+
+                /* Display test parameter values */
+                JTEST_DUMP_STRF("FFT Length: %d\n"
+                                "Hop Size: %d\n"
+                                "Block Size: %d\n",
+                                (int)fftLen,
+                                (int)hopSize,
+                                (int)blockSize);
+
+                arm_table_arena_init(&arena, stft_arena_buf, sizeof(stft_arena_buf));
+                if ((arm_stft_init_f32(&stft_inst, fftLen, hopSize,
+                                       ARM_WINDOW_HANN, &arena) != ARM_MATH_SUCCESS) ||
+                    (arena.used > ARM_STFT_ARENA_SIZE_F32(fftLen)))
+                {
+                    return JTEST_TEST_FAILED;
+                }
+                ref_window_f32(ARM_WINDOW_HANN, stft_window, fftLen);
+
+                frame = 0;
+                for (done = 0; done < 3 * fftLen; done += num)
+                {
+                    num = 3 * fftLen - done;
+                    num = (num < blockSize) ? num : blockSize;
+
+                    JTEST_COUNT_CYCLES(
+                        numFrames = arm_stft_f32(&stft_inst,
+                                                 transform_fft_f32_inputs + done,
+                                                 transform_fft_output_fut,
+                                                 num));
+
+                    /* The frames ending in this block, one after the other */
+                    for (f = 0; f < numFrames; f++, frame++)
+                    {
+                        if (frame * hopSize + fftLen > done + num)
+                        {
+                            return JTEST_TEST_FAILED;
+                        }
+
+                        ref_stft_frame_f32(transform_fft_f32_inputs + frame * hopSize,
+                                           stft_window, fftLen, transform_fft_output_ref);
+
+                        TEST_ASSERT_SNR(transform_fft_output_ref,
+                                        transform_fft_output_fut + f * fftLen,
+                                        fftLen,
+                                        TRANSFORM_SNR_THRESHOLD_float32_t);
+                    }
+                }
+
+                if (frame != (2 * fftLen) / hopSize + 1)
+                {
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Compare the linear and the exponential averages with the reference, for
+ *  several windows, with the input given in uneven blocks.
+ */
+JTEST_DEFINE_TEST(arm_welch_f32_test, arm_welch_f32)
+{
+    arm_welch_instance_f32 welch_inst;
+    arm_table_arena arena;
+    uint32_t len_idx, type, alpha_idx;
+    uint32_t fftLen, done, num, numFrames, numFramesRef;
+    const float32_t alphas[2] = {0.0f, 0.25f};
+
+    for (len_idx = 0; len_idx < sizeof(stft_fftlens) / sizeof(stft_fftlens[0]); len_idx++)
+    {
+        fftLen = stft_fftlens[len_idx];
+
+        for (type = ARM_WINDOW_RECTANGULAR; type <= ARM_WINDOW_FLAT_TOP; type++)
+        {
+            for (alpha_idx = 0; alpha_idx < 2; alpha_idx++)
+            {
+                /* Display test parameter values */
+                JTEST_DUMP_STRF("FFT Length: %d\n"
+                                "Window: %d\n"
+                                "Alpha: %f\n",
+                                (int)fftLen,
+                                (int)type,
+                                (double)alphas[alpha_idx]);
+
+                arm_table_arena_init(&arena, stft_arena_buf, sizeof(stft_arena_buf));
+                if ((arm_welch_init_f32(&welch_inst, fftLen, fftLen / 2,
+                                        (arm_window_type) type, alphas[alpha_idx],
+                                        &arena) != ARM_MATH_SUCCESS) ||
+                    (arena.used > ARM_WELCH_ARENA_SIZE_F32(fftLen)) ||
+                    (arm_welch_get_f32(&welch_inst, transform_fft_output_fut) != 0))
+                {
+                    return JTEST_TEST_FAILED;
+                }
+
+                numFrames = 0;
+                for (done = 0; done < STFT_NUM_SAMPLES; done += num)
+                {
+                    num = STFT_NUM_SAMPLES - done;
+                    num = (num < 100 + done % 37) ? num : 100 + done % 37;
+
+                    JTEST_COUNT_CYCLES(
+                        numFrames += arm_welch_f32(&welch_inst,
+                                                   transform_fft_f32_inputs + done,
+                                                   num));
+                }
+
+                numFramesRef = ref_welch_f32(transform_fft_f32_inputs, STFT_NUM_SAMPLES,
+                                             fftLen, fftLen / 2, (arm_window_type) type,
+                                             alphas[alpha_idx], transform_fft_output_ref);
+
+                if ((numFrames != numFramesRef) ||
+                    (arm_welch_get_f32(&welch_inst, transform_fft_output_fut)
+                     != numFramesRef))
+                {
+                    return JTEST_TEST_FAILED;
+                }
+
+                TEST_ASSERT_SNR(transform_fft_output_ref,
+                                transform_fft_output_fut,
+                                fftLen / 2 + 1,
+                                TRANSFORM_SNR_THRESHOLD_float32_t);
+
+                arm_welch_reset_f32(&welch_inst);
+                if (arm_welch_get_f32(&welch_inst, transform_fft_output_fut) != 0)
+                {
+                    return JTEST_TEST_FAILED;
+                }
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Two tones between the bins, the weaker one switched off after a while.
+ *  Each spectrum is the last frame, an exponential average with a weight of 1.
+ */
+JTEST_DEFINE_TEST(arm_peak_tracker_f32_test, arm_peak_tracker_f32)
+{
+    arm_welch_instance_f32 welch_inst;
+    arm_peak_tracker_instance_f32 tracker_inst;
+    arm_peak_track_f32 peaks[4];
+    arm_table_arena arena;
+    const uint32_t fftLen = 128;
+    const float32_t freq1 = 20.3f;
+    const float32_t freq2 = 45.7f;
+    float32_t x[64], err1, err2;
+    uint32_t frame, n, t, numPeaks;
+
+    arm_table_arena_init(&arena, stft_arena_buf, sizeof(stft_arena_buf));
+    if (arm_welch_init_f32(&welch_inst, fftLen, fftLen / 2, ARM_WINDOW_HANN,
+                           1.0f, &arena) != ARM_MATH_SUCCESS)
+    {
+        return JTEST_TEST_FAILED;
+    }
+    arm_peak_tracker_init_f32(&tracker_inst, 4, peaks, 0.1f, 2.0f, 2, 1.0f);
+
+    for (frame = 0; frame < 16; frame++)
+    {
+        for (n = 0; n < 64; n++)
+        {
+            t = frame * 64 + n;
+            x[n] = arm_cos_f32(2.0f * PI * freq1 * (float32_t) t / fftLen);
+            if (frame < 10)
+            {
+                x[n] += 0.3f * arm_cos_f32(2.0f * PI * freq2 * (float32_t) t / fftLen);
+            }
+        }
+
+        if (arm_welch_f32(&welch_inst, x, 64) == 0)
+        {
+            continue;
+        }
+
+        arm_welch_get_f32(&welch_inst, transform_fft_output_fut);
+
+        JTEST_COUNT_CYCLES(
+            numPeaks = arm_peak_tracker_f32(&tracker_inst,
+                                            transform_fft_output_fut,
+                                            fftLen / 2 + 1));
+
+        err1 = peaks[0].freq - freq1;
+        err1 = (err1 < 0.0f) ? -err1 : err1;
+        err2 = peaks[1].freq - freq2;
+        err2 = (err2 < 0.0f) ? -err2 : err2;
+
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Frame: %d\n"
+                        "Peaks: %d\n"
+                        "Error: %f %f\n",
+                        (int)frame,
+                        (int)numPeaks,
+                        (double)err1,
+                        (double)err2);
+
+        /* The last frame with the weak tone ends in block 10, and the track is kept maxMissed spectra more */
+        if ((numPeaks != ((frame <= 10 + 2) ? 2 : 1)) ||
+            (peaks[0].id != 0) || !(err1 < 0.05f))
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        if ((frame < 10) &&
+            ((peaks[1].id != 1) || !(err2 < 0.05f) ||
+             (peaks[0].missed != 0) || (peaks[1].missed != 0)))
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stft_tests)
+{
+    JTEST_TEST_CALL(arm_window_f32_test);
+    JTEST_TEST_CALL(arm_stft_f32_test);
+    JTEST_TEST_CALL(arm_welch_f32_test);
+    JTEST_TEST_CALL(arm_peak_tracker_f32_test);
+}
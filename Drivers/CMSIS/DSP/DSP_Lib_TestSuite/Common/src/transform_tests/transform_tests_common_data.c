@@ -3250,6 +3250,20 @@ ARR_DESC_DEFINE(uint16_t,
                       32, 64, 128, 256,
                       512, 1024, 2048));
 
+ARR_DESC_DEFINE(uint16_t,
+                transform_cfft_mixed_radix_fftlens,
+                11,
+                CURLY(
+                      6, 12, 30, 45, 48, 60, 120, 150,
+                      240, 480, 960/*, 1920, 3840 */));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_rfft_fast_mixed_radix_fftlens,
+                7,
+                CURLY(
+                      60, 96, 240, 300, 480,
+                      960, 1920));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
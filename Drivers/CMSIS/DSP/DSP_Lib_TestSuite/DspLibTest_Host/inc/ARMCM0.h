@@ -0,0 +1,28 @@
+/*
+ * Host stand-in for the ARMCM0 device header.
+ *
+ * JTest only needs the SysTick registers to count cycles. On the host they
+ * are a plain structure that never counts, so the reported cycle counts are
+ * meaningless; use host_bench for timings.
+ */
+
+#ifndef ARMCM0_H
+#define ARMCM0_H
+
+#include <stdint.h>
+
+typedef struct
+{
+  volatile uint32_t CTRL;
+  volatile uint32_t LOAD;
+  volatile uint32_t VAL;
+  volatile uint32_t CALIB;
+} SysTick_Type;
+
+extern SysTick_Type host_systick;
+
+#define SysTick                     (&host_systick)
+#define SysTick_CTRL_ENABLE_Msk     (1UL << 0)
+#define SysTick_CTRL_CLKSOURCE_Msk  (1UL << 2)
+
+#endif /* ARMCM0_H */
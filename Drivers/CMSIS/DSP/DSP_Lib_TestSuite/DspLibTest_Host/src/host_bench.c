@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "arm_math.h"
+
+/*
+  Per-kernel timings of the basic math and support functions on the host.
+  Built once with the portable C code and once with ARM_MATH_X86_SIMD, see
+  HowTo.txt. Each kernel processes BENCH_BLOCK_SIZE samples per call; the
+  reported time is the best of BENCH_TRIALS runs of at least BENCH_MIN_NS,
+  divided by the number of samples.
+*/
+
+#define BENCH_BLOCK_SIZE 1024
+#define BENCH_TRIALS     5
+#define BENCH_MIN_NS     20000000ULL
+
+typedef struct
+{
+    const char * name;
+    void (* run)(void);
+} bench_kernel_t;
+
+static float32_t bench_f32_a[BENCH_BLOCK_SIZE];
+static float32_t bench_f32_b[BENCH_BLOCK_SIZE];
+static float32_t bench_f32_dst[BENCH_BLOCK_SIZE];
+static q31_t bench_q31_a[BENCH_BLOCK_SIZE];
+static q31_t bench_q31_b[BENCH_BLOCK_SIZE];
+static q31_t bench_q31_dst[BENCH_BLOCK_SIZE];
+static q15_t bench_q15_a[BENCH_BLOCK_SIZE];
+static q15_t bench_q15_b[BENCH_BLOCK_SIZE];
+static q15_t bench_q15_dst[BENCH_BLOCK_SIZE];
+static q7_t bench_q7_a[BENCH_BLOCK_SIZE];
+static q7_t bench_q7_b[BENCH_BLOCK_SIZE];
+static q7_t bench_q7_dst[BENCH_BLOCK_SIZE];
+
+static volatile float32_t bench_f32_result;
+static volatile q63_t bench_q63_result;
+static volatile q31_t bench_q31_result;
+
+/* Kernels taking (a, b, dst, size) */
+#define BENCH_BUF2(fn, suffix)                                                  \
+    static void bench_##fn##_##suffix(void)                                     \
+    {                                                                           \
+        arm_##fn##_##suffix(bench_##suffix##_a, bench_##suffix##_b,             \
+                            bench_##suffix##_dst, BENCH_BLOCK_SIZE);            \
+    }
+
+/* Kernels taking (a, dst, size) */
+#define BENCH_BUF1(fn, suffix)                                                  \
+    static void bench_##fn##_##suffix(void)                                     \
+    {                                                                           \
+        arm_##fn##_##suffix(bench_##suffix##_a, bench_##suffix##_dst,           \
+                            BENCH_BLOCK_SIZE);                                  \
+    }
+
+#define BENCH_ALL_TYPES(macro, fn)              \
+    macro(fn, f32)                              \
+    macro(fn, q31)                              \
+    macro(fn, q15)                              \
+    macro(fn, q7)
+
+BENCH_ALL_TYPES(BENCH_BUF2, add)
+BENCH_ALL_TYPES(BENCH_BUF2, sub)
+BENCH_ALL_TYPES(BENCH_BUF2, mult)
+BENCH_ALL_TYPES(BENCH_BUF1, abs)
+BENCH_ALL_TYPES(BENCH_BUF1, negate)
+BENCH_ALL_TYPES(BENCH_BUF1, copy)
+
+static void bench_offset_f32(void)
+{
+    arm_offset_f32(bench_f32_a, 0.25f, bench_f32_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_offset_q31(void)
+{
+    arm_offset_q31(bench_q31_a, 0x20000000, bench_q31_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_offset_q15(void)
+{
+    arm_offset_q15(bench_q15_a, 0x2000, bench_q15_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_offset_q7(void)
+{
+    arm_offset_q7(bench_q7_a, 0x20, bench_q7_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_scale_f32(void)
+{
+    arm_scale_f32(bench_f32_a, 0.75f, bench_f32_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_scale_q31(void)
+{
+    arm_scale_q31(bench_q31_a, 0x60000000, 1, bench_q31_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_scale_q15(void)
+{
+    arm_scale_q15(bench_q15_a, 0x6000, 1, bench_q15_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_scale_q7(void)
+{
+    arm_scale_q7(bench_q7_a, 0x60, 1, bench_q7_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_dot_prod_f32(void)
+{
+    float32_t result;
+
+    arm_dot_prod_f32(bench_f32_a, bench_f32_b, BENCH_BLOCK_SIZE, &result);
+    bench_f32_result = result;
+}
+
+static void bench_dot_prod_q31(void)
+{
+    q63_t result;
+
+    arm_dot_prod_q31(bench_q31_a, bench_q31_b, BENCH_BLOCK_SIZE, &result);
+    bench_q63_result = result;
+}
+
+static void bench_dot_prod_q15(void)
+{
+    q63_t result;
+
+    arm_dot_prod_q15(bench_q15_a, bench_q15_b, BENCH_BLOCK_SIZE, &result);
+    bench_q63_result = result;
+}
+
+static void bench_dot_prod_q7(void)
+{
+    q31_t result;
+
+    arm_dot_prod_q7(bench_q7_a, bench_q7_b, BENCH_BLOCK_SIZE, &result);
+    bench_q31_result = result;
+}
+
+static void bench_fill_f32(void)
+{
+    arm_fill_f32(0.5f, bench_f32_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_fill_q31(void)
+{
+    arm_fill_q31(0x40000000, bench_q31_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_fill_q15(void)
+{
+    arm_fill_q15(0x4000, bench_q15_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_fill_q7(void)
+{
+    arm_fill_q7(0x40, bench_q7_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_float_to_q31(void)
+{
+    arm_float_to_q31(bench_f32_a, bench_q31_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_float_to_q15(void)
+{
+    arm_float_to_q15(bench_f32_a, bench_q15_dst, BENCH_BLOCK_SIZE);
+}
+
+static void bench_float_to_q7(void)
+{
+    arm_float_to_q7(bench_f32_a, bench_q7_dst, BENCH_BLOCK_SIZE);
+}
+
+#define BENCH_ENTRY(fn) { #fn, bench_##fn }
+#define BENCH_ENTRIES(fn)                       \
+    BENCH_ENTRY(fn##_f32),                      \
+    BENCH_ENTRY(fn##_q31),                      \
+    BENCH_ENTRY(fn##_q15),                      \
+    BENCH_ENTRY(fn##_q7)
+
+static const bench_kernel_t bench_kernels[] =
+{
+    BENCH_ENTRIES(add),
+    BENCH_ENTRIES(sub),
+    BENCH_ENTRIES(mult),
+    BENCH_ENTRIES(abs),
+    BENCH_ENTRIES(negate),
+    BENCH_ENTRIES(offset),
+    BENCH_ENTRIES(scale),
+    BENCH_ENTRIES(dot_prod),
+    BENCH_ENTRIES(copy),
+    BENCH_ENTRIES(fill),
+    BENCH_ENTRY(float_to_q31),
+    BENCH_ENTRY(float_to_q15),
+    BENCH_ENTRY(float_to_q7)
+};
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/* Inputs in [-1, 1), the products and sums saturate now and then */
+static void bench_fill_inputs(void)
+{
+    uint32_t i, seed = 12345;
+
+    for (i = 0; i < BENCH_BLOCK_SIZE; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        bench_q31_a[i] = (q31_t) seed;
+        seed = seed * 1664525 + 1013904223;
+        bench_q31_b[i] = (q31_t) seed;
+        bench_q15_a[i] = (q15_t) (bench_q31_a[i] >> 16);
+        bench_q15_b[i] = (q15_t) (bench_q31_b[i] >> 16);
+        bench_q7_a[i] = (q7_t) (bench_q31_a[i] >> 24);
+        bench_q7_b[i] = (q7_t) (bench_q31_b[i] >> 24);
+        bench_f32_a[i] = (float32_t) bench_q31_a[i] / 2147483648.0f;
+        bench_f32_b[i] = (float32_t) bench_q31_b[i] / 2147483648.0f;
+    }
+}
+
+int main(void)
+{
+    uint32_t kernel_idx, trial;
+    uint64_t calls, start, elapsed;
+    double ns, best_ns;
+
+    bench_fill_inputs();
+
+#if defined (ARM_MATH_X86_SIMD)
+    printf("backend: ARM_MATH_X86_SIMD\n");
+#else
+    printf("backend: C\n");
+#endif
+    printf("%-16s %12s\n", "kernel", "ns/sample");
+
+    for (kernel_idx = 0;
+         kernel_idx < sizeof(bench_kernels) / sizeof(bench_kernels[0]);
+         kernel_idx++)
+    {
+        best_ns = 0.0;
+        for (trial = 0; trial < BENCH_TRIALS; trial++)
+        {
+            calls = 0;
+            start = bench_now_ns();
+            do
+            {
+                bench_kernels[kernel_idx].run();
+                calls++;
+                elapsed = bench_now_ns() - start;
+            } while (elapsed < BENCH_MIN_NS);
+
+            ns = (double) elapsed / (double) (calls * BENCH_BLOCK_SIZE);
+            if (trial == 0 || ns < best_ns)
+            {
+                best_ns = ns;
+            }
+        }
+        printf("%-16s %12.3f\n", bench_kernels[kernel_idx].name, best_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "arm_math.h"
+
+/*
+  Timings of arm_mat_mult_f32/q31/q15 on the host for square and tall/skinny
+  shapes. Built with the portable C code, with ARM_MATH_X86_SIMD and with
+  ARM_MATH_X86_SIMD but ARM_MAT_MULT_TILE_MIN_MACS raised so that every size
+  takes the untiled loops, see HowTo.txt. The reported time is the best of
+  BENCH_TRIALS runs of at least BENCH_MIN_NS, divided by M * K * N.
+*/
+
+#define BENCH_TRIALS     5
+#define BENCH_MIN_NS     20000000ULL
+#define BENCH_MAX_ELTS   (512U * 512U)
+
+typedef struct
+{
+    const char * name;
+    uint16_t M;
+    uint16_t K;
+    uint16_t N;
+} bench_shape_t;
+
+static const bench_shape_t bench_shapes[] =
+{
+    { "square",       8,    8,    8 },
+    { "square",      16,   16,   16 },
+    { "square",      32,   32,   32 },
+    { "square",      64,   64,   64 },
+    { "square",     128,  128,  128 },
+    { "square",     256,  256,  256 },
+    { "tall",      4096,    4,    4 },
+    { "tall",      1024,    8,    8 },
+    { "tall",      1024,   64,    4 },
+    { "wide",         4,   64, 1024 },
+    { "deep",         8, 1024,    8 },
+    { "outer",      512,   16,  512 }
+};
+
+static float32_t bench_a[BENCH_MAX_ELTS];
+static float32_t bench_b[BENCH_MAX_ELTS];
+static float32_t bench_dst[BENCH_MAX_ELTS];
+static q15_t bench_state[BENCH_MAX_ELTS];
+
+static arm_matrix_instance_f32 bench_f32_a, bench_f32_b, bench_f32_dst;
+static arm_matrix_instance_q31 bench_q31_a, bench_q31_b, bench_q31_dst;
+static arm_matrix_instance_q15 bench_q15_a, bench_q15_b, bench_q15_dst;
+
+static void bench_mat_mult_f32(void)
+{
+    arm_mat_mult_f32(&bench_f32_a, &bench_f32_b, &bench_f32_dst);
+}
+
+static void bench_mat_mult_q31(void)
+{
+    arm_mat_mult_q31(&bench_q31_a, &bench_q31_b, &bench_q31_dst);
+}
+
+static void bench_mat_mult_q15(void)
+{
+    arm_mat_mult_q15(&bench_q15_a, &bench_q15_b, &bench_q15_dst, bench_state);
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+/* Inputs of magnitude below 1 / K, so the q31 and q15 results do not saturate */
+static void bench_fill_inputs(
+  uint32_t num_a,
+  uint32_t num_b,
+  uint32_t K)
+{
+    uint32_t i, seed = 12345;
+
+    for (i = 0; i < num_a; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        bench_a[i] = (float32_t) (int32_t) seed / 2147483648.0f / (float32_t) K;
+    }
+    for (i = 0; i < num_b; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        bench_b[i] = (float32_t) (int32_t) seed / 2147483648.0f;
+    }
+}
+
+static double bench_run(
+  void (* run)(void),
+  uint64_t macs)
+{
+    uint32_t trial;
+    uint64_t calls, start, elapsed;
+    double ns, best_ns = 0.0;
+
+    for (trial = 0; trial < BENCH_TRIALS; trial++)
+    {
+        calls = 0;
+        start = bench_now_ns();
+        do
+        {
+            run();
+            calls++;
+            elapsed = bench_now_ns() - start;
+        } while (elapsed < BENCH_MIN_NS);
+
+        ns = (double) elapsed / (double) (calls * macs);
+        if (trial == 0 || ns < best_ns)
+        {
+            best_ns = ns;
+        }
+    }
+
+    return best_ns;
+}
+
+int main(void)
+{
+    uint32_t s, M, K, N;
+    uint64_t macs;
+    double f32_ns, q31_ns, q15_ns;
+
+#if defined (ARM_MATH_X86_SIMD)
+    printf("backend: ARM_MATH_X86_SIMD, tiled above %lu MACs\n",
+           (unsigned long) ARM_MAT_MULT_TILE_MIN_MACS);
+#else
+    printf("backend: C\n");
+#endif
+    printf("%-7s %16s %10s %10s %10s\n", "shape", "M x K x N", "f32", "q31", "q15");
+
+    for (s = 0; s < sizeof(bench_shapes) / sizeof(bench_shapes[0]); s++)
+    {
+        M = bench_shapes[s].M;
+        K = bench_shapes[s].K;
+        N = bench_shapes[s].N;
+        macs = (uint64_t) M * K * N;
+
+        bench_fill_inputs(M * K, K * N, K);
+        arm_mat_init_f32(&bench_f32_a, M, K, bench_a);
+        arm_mat_init_f32(&bench_f32_b, K, N, bench_b);
+        arm_mat_init_f32(&bench_f32_dst, M, N, bench_dst);
+        f32_ns = bench_run(bench_mat_mult_f32, macs);
+
+        /* Converted in place */
+        arm_float_to_q31(bench_a, (q31_t *) bench_a, M * K);
+        arm_float_to_q31(bench_b, (q31_t *) bench_b, K * N);
+        arm_mat_init_q31(&bench_q31_a, M, K, (q31_t *) bench_a);
+        arm_mat_init_q31(&bench_q31_b, K, N, (q31_t *) bench_b);
+        arm_mat_init_q31(&bench_q31_dst, M, N, (q31_t *) bench_dst);
+        q31_ns = bench_run(bench_mat_mult_q31, macs);
+
+        bench_fill_inputs(M * K, K * N, K);
+        arm_float_to_q15(bench_a, (q15_t *) bench_a, M * K);
+        arm_float_to_q15(bench_b, (q15_t *) bench_b, K * N);
+        arm_mat_init_q15(&bench_q15_a, M, K, (q15_t *) bench_a);
+        arm_mat_init_q15(&bench_q15_b, K, N, (q15_t *) bench_b);
+        arm_mat_init_q15(&bench_q15_dst, M, N, (q15_t *) bench_dst);
+        q15_ns = bench_run(bench_mat_mult_q15, macs);
+
+        printf("%-7s %4u x %4u x %4u %10.3f %10.3f %10.3f\n", bench_shapes[s].name,
+               (unsigned int) M, (unsigned int) K, (unsigned int) N,
+               f32_ns, q31_ns, q15_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "jtest.h"
+#include "basic_math_test_group.h"
+#include "support_test_group.h"
+#include "matrix_test_group.h"
+
+/*
+  Host replacement for main.c and jtest_trigger_action.c. On the target the
+  debugger scripts read the JTest buffers at each trigger action, here they
+  are printed to stdout and the exit status is the test result.
+*/
+
+SysTick_Type host_systick;
+
+void test_start    (void) {
+  JTEST_FW.test_start++;
+}
+
+void test_end      (void) {
+  JTEST_FW.test_end++;
+}
+
+void group_start   (void) {
+  JTEST_FW.group_start++;
+}
+
+void group_end     (void) {
+  JTEST_FW.group_end++;
+}
+
+void dump_str      (void) {
+  JTEST_FW.dump_str++;
+  printf("%.*s", JTEST_STR_MAX_OUTPUT_SIZE, JTEST_FW.str_buffer);
+}
+
+void dump_data     (void) {
+  JTEST_FW.dump_data++;
+}
+
+void exit_fw       (void) {
+  JTEST_FW.exit_fw++;
+  printf("\nPassed: %u Failed: %u\n",
+         (unsigned int) JTEST_FW.passed, (unsigned int) JTEST_FW.failed);
+  exit(JTEST_FW.failed != 0);
+}
+
+int main(void)
+{
+    JTEST_INIT();               /* Initialize test framework. */
+
+    JTEST_GROUP_CALL(basic_math_tests);
+    JTEST_GROUP_CALL(support_tests);
+    JTEST_GROUP_CALL(matrix_tests);
+
+    JTEST_ACT_EXIT_FW();        /* Exit test framework.  */
+    return 0;
+}
@@ -449,6 +449,24 @@ void ref_sin_cos_q31(
   q31_t * pSinVal,
   q31_t * pCosVal);
 
+void ref_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize);
+
+void ref_nco_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize);
+
+void ref_nco_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize);
+
 float32_t ref_pid_f32(
 	arm_pid_instance_f32 * S,
 	float32_t in);
@@ -480,6 +498,28 @@ arm_status ref_sqrt_q31(q31_t in, q31_t * pOut);
 
 arm_status ref_sqrt_q15(q15_t in, q15_t * pOut);
 
+void ref_vexp_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vlog_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vtanh_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vtanh_q31(const q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vtanh_q15(const q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_vsigmoid_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+
+void ref_vsigmoid_q31(const q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+
+void ref_vsigmoid_q15(const q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+void ref_atan2_f32(const float32_t * pSrcY, const float32_t * pSrcX, float32_t * pDst, uint32_t blockSize);
+
+void ref_atan2_q31(const q31_t * pSrcY, const q31_t * pSrcX, q31_t * pDst, uint32_t blockSize);
+
+void ref_atan2_q15(const q15_t * pSrcY, const q15_t * pSrcX, q15_t * pDst, uint32_t blockSize);
+
 	/*
 	 * Filtering Functions
 	 */
@@ -501,6 +541,30 @@ void ref_biquad_cascade_df2T_f64(
 	float64_t * pDst,
 	uint32_t blockSize);
 
+void ref_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_biquad_cascade_mc_df2T_q15(
+  const arm_biquad_cascade_mc_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 void ref_biquad_cascade_df1_f32(
   const arm_biquad_casd_df1_inst_f32 * S,
   float32_t * pSrc,
@@ -911,6 +975,18 @@ void ref_lms_norm_q15(
   q15_t * pErr,
   uint32_t blockSize);
 
+void ref_fdaf_f32(
+  uint32_t blockLen,
+  uint32_t numPartitions,
+  float32_t mu,
+  float32_t alpha,
+  float32_t delta,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t numBlocks);
+
 void ref_fir_interpolate_f32(
   const arm_fir_interpolate_instance_f32 * S,
   float32_t * pSrc,
@@ -927,6 +1003,33 @@ void ref_fir_interpolate_q15(
   const arm_fir_interpolate_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pXPred);
+
+arm_status ref_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ,
+  float32_t * pHx);
+
+void ref_median_f32(
+  uint16_t windowSize,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_median_q31(
+  uint16_t windowSize,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_median_q15(
+  uint16_t windowSize,
+  const q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 	/*
@@ -1175,6 +1278,30 @@ void ref_var_q15(
   uint32_t blockSize,
   q15_t * pResult);
 
+void ref_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pHist,
+  uint16_t numBins,
+  float32_t histMin,
+  float32_t histMax);
+
+void ref_histogram_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q31_t histMin,
+  uint8_t binShift);
+
+void ref_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q15_t histMin,
+  uint8_t binShift);
+
 	/*
 	 * Support Functions
 	 */
@@ -1208,6 +1335,48 @@ void ref_fill_q31(
   q31_t * pDst,
   uint32_t blockSize);
 
+void ref_sort_f32(
+  float32_t * pSrcDst,
+  uint32_t blockSize);
+
+void ref_sort_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize);
+
+void ref_sort_q15(
+  q15_t * pSrcDst,
+  uint32_t blockSize);
+
+void ref_sort_q7(
+  q7_t * pSrcDst,
+  uint32_t blockSize);
+
+void ref_argsort_f32(
+  const float32_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t blockSize);
+
+void ref_topk_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex);
+
+void ref_topk_q31(
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pDst,
+  uint32_t * pIndex);
+
+void ref_topk_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint32_t * pIndex);
+
 void ref_fill_q15(
   q15_t value,
   q15_t * pDst,
@@ -1363,6 +1532,39 @@ void ref_dct4_q15(
   q15_t * pState,
   q15_t * pInlineBuffer);
 
+void ref_window_f32(
+  arm_window_type type,
+  float32_t * pDst,
+  uint32_t len);
+
+void ref_stft_frame_f32(
+  const float32_t * pSrc,
+  const float32_t * pWindow,
+  uint32_t fftLen,
+  float32_t * pDst);
+
+uint32_t ref_welch_f32(
+  const float32_t * pSrc,
+  uint32_t numSamples,
+  uint32_t fftLen,
+  uint32_t hopSize,
+  arm_window_type window,
+  float32_t alpha,
+  float32_t * pDst);
+
+uint32_t ref_mfcc_f32(
+  const float32_t * pSrc,
+  uint32_t numSamples,
+  uint32_t fftLen,
+  uint32_t hopSize,
+  arm_window_type window,
+  uint32_t numMel,
+  uint32_t numCoeffs,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  float32_t * pDst);
+
 	/*
 	 * Intrinsics
 	 */
@@ -22,7 +22,7 @@ void ref_abs_q31(
 	
 	for(i=0;i<blockSize;i++)
 	{
-		pDst[i] = pSrc[i] < 0 ? -pSrc[i] : pSrc[i];
+		pDst[i] = ref_sat_q31(pSrc[i] < 0 ? -(q63_t)pSrc[i] : pSrc[i]);
 	}
 }
 
@@ -35,7 +35,7 @@ void ref_abs_q15(
 	
 	for(i=0;i<blockSize;i++)
 	{
-		pDst[i] = pSrc[i] < 0 ? -pSrc[i] : pSrc[i];
+		pDst[i] = ref_sat_q15(pSrc[i] < 0 ? -(q31_t)pSrc[i] : pSrc[i]);
 	}
 }
 
@@ -48,6 +48,6 @@ void ref_abs_q7(
 	
 	for(i=0;i<blockSize;i++)
 	{
-		pDst[i] = pSrc[i] < 0 ? -pSrc[i] : pSrc[i];
+		pDst[i] = ref_sat_q7(pSrc[i] < 0 ? -(q15_t)pSrc[i] : pSrc[i]);
 	}
 }
@@ -22,7 +22,7 @@ void ref_negate_q31(
 	
 	for(i=0;i<blockSize;i++)
 	{
-		pDst[i] = -pSrc[i];
+		pDst[i] = ref_sat_q31(-(q63_t)pSrc[i]);
 	}
 }
 
@@ -35,7 +35,7 @@ void ref_negate_q15(
 	
 	for(i=0;i<blockSize;i++)
 	{
-		pDst[i] = -pSrc[i];
+		pDst[i] = ref_sat_q15(-(q31_t)pSrc[i]);
 	}
 }
 
@@ -48,6 +48,6 @@ void ref_negate_q7(
 	
 	for(i=0;i<blockSize;i++)
 	{
-		pDst[i] = -pSrc[i];
+		pDst[i] = ref_sat_q7(-(q15_t)pSrc[i]);
 	}
 }
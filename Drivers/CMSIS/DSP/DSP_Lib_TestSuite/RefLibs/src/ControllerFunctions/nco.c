@@ -0,0 +1,52 @@
+#include "ref.h"
+
+/* The phase is converted to radians, a full turn is 2^32 */
+#define REF_NCO_RADIANS(phase) ((phase) * 6.28318530717958647692 / 4294967296.0)
+
+void ref_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pSinVal[i] = (float32_t)sin(REF_NCO_RADIANS(S->phase));
+		pCosVal[i] = (float32_t)cos(REF_NCO_RADIANS(S->phase));
+		S->phase += S->phaseInc;
+	}
+}
+
+void ref_nco_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pSinVal[i] = clip_q63_to_q31((q63_t)floor(sin(REF_NCO_RADIANS(S->phase)) * 2147483648.0 + 0.5));
+		pCosVal[i] = clip_q63_to_q31((q63_t)floor(cos(REF_NCO_RADIANS(S->phase)) * 2147483648.0 + 0.5));
+		S->phase += S->phaseInc;
+	}
+}
+
+void ref_nco_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pSinVal[i] = clip_q31_to_q15((q31_t)floor(sin(REF_NCO_RADIANS(S->phase)) * 32768.0 + 0.5));
+		pCosVal[i] = clip_q31_to_q15((q31_t)floor(cos(REF_NCO_RADIANS(S->phase)) * 32768.0 + 0.5));
+		S->phase += S->phaseInc;
+	}
+}
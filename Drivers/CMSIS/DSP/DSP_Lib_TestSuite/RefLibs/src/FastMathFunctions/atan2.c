@@ -0,0 +1,48 @@
+#include "ref.h"
+
+void ref_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = atan2f(pSrcY[i], pSrcX[i]);
+	}
+}
+
+/* The angle is divided by pi, +pi saturates to the largest positive value */
+void ref_atan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	double angle;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		angle = floor(atan2(pSrcY[i], pSrcX[i]) / 3.14159265358979323846 * 2147483648.0 + 0.5);
+		pDst[i] = (angle >= 2147483648.0) ? 0x7FFFFFFF : (q31_t)angle;
+	}
+}
+
+void ref_atan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+	double angle;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		angle = floor(atan2(pSrcY[i], pSrcX[i]) / 3.14159265358979323846 * 32768.0 + 0.5);
+		pDst[i] = (angle >= 32768.0) ? 0x7FFF : (q15_t)angle;
+	}
+}
@@ -0,0 +1,14 @@
+#include "ref.h"
+
+void ref_vlog_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = logf(pSrc[i]);
+	}
+}
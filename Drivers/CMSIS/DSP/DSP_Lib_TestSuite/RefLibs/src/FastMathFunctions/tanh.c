@@ -0,0 +1,40 @@
+#include "ref.h"
+
+void ref_vtanh_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = tanhf(pSrc[i]);
+	}
+}
+
+void ref_vtanh_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = clip_q63_to_q31((q63_t)floor(tanh(pSrc[i] / 67108864.0) * 2147483648.0 + 0.5));
+	}
+}
+
+void ref_vtanh_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i;
+
+	for (i = 0; i < blockSize; i++)
+	{
+		pDst[i] = clip_q31_to_q15((q31_t)floor(tanh(pSrc[i] / 2048.0) * 32768.0 + 0.5));
+	}
+}
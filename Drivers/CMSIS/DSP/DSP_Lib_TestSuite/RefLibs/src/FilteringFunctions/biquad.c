@@ -711,3 +711,205 @@ void ref_biquad_cascade_df1_q15(
 
   } while (--stage);
 }
+
+void ref_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  source pointer            */
+  q31_t *pOut = pDst;                            /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q63_t acc;                                     /*  accumulator               */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q31_t Xn, Yn;                                  /*  temporary input/output    */
+  q31_t d1, d2;                                  /*  state variables           */
+  uint32_t shift = 31U - (uint32_t) S->postShift; /*  output shift              */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1, truncated from 2.62 */
+      acc = (q63_t) b0 * Xn + ((q63_t) d1 << 31);
+      Yn = ref_sat_q31(acc >> shift);
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2, rounded from 2.62 */
+      acc = (q63_t) b1 * Xn + (q63_t) a1 * Yn + ((q63_t) d2 << 31);
+      d1 = ref_sat_q31((acc + 0x40000000) >> 31);
+
+      /* d2 = b2 * x[n] + a2 * y[n], rounded from 2.62 */
+      acc = (q63_t) b2 * Xn + (q63_t) a2 * Yn;
+      d2 = ref_sat_q31((acc + 0x40000000) >> 31);
+
+      sample--;
+    }
+
+    *pState++ = d1;
+    *pState++ = d2;
+
+    pIn = pDst;
+    pOut = pDst;
+
+    stage--;
+
+  } while (stage > 0U);
+}
+
+void ref_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  source pointer            */
+  q15_t *pOut = pDst;                            /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q31_t acc;                                     /*  accumulator               */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q15_t Xn, Yn;                                  /*  temporary input/output    */
+  q31_t d1, d2;                                  /*  state variables           */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  output shift              */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    b0 = *pCoeffs++;
+    pCoeffs++;  // skip the 0 coefficient
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      Xn = *pIn++;
+
+      /* Every addition saturates to 2.30 as the state variables */
+      acc = ref_sat_q31((q63_t) ((q31_t) b0 * Xn) + d1);
+      Yn = ref_sat_q15(acc >> shift);
+      *pOut++ = Yn;
+
+      d1 = ref_sat_q31((q63_t) ((q31_t) b1 * Xn) + ((q31_t) a1 * Yn));
+      d1 = ref_sat_q31((q63_t) d1 + d2);
+
+      d2 = ref_sat_q31((q63_t) ((q31_t) b2 * Xn) + ((q31_t) a2 * Yn));
+
+      sample--;
+    }
+
+    *pState++ = d1;
+    *pState++ = d2;
+
+    pIn = pDst;
+    pOut = pDst;
+
+    stage--;
+
+  } while (stage > 0U);
+}
+
+void ref_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numCh = S->numChannels;
+  uint32_t stage, ch, n;
+  float32_t *pCoeffs, *pState;
+  float32_t acc, Xn, d1, d2;
+  float32_t *pIn = pSrc;
+
+  /* Every channel of every stage is an independent single channel biquad */
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    for (ch = 0U; ch < numCh; ch++)
+    {
+      pCoeffs = S->pCoeffs + 5U * (stage * numCh + ch);
+      pState = S->pState + 2U * (stage * numCh + ch);
+      d1 = pState[0];
+      d2 = pState[1];
+
+      for (n = 0U; n < blockSize; n++)
+      {
+        Xn = pIn[n * numCh + ch];
+        acc = (pCoeffs[0] * Xn) + d1;
+        pDst[n * numCh + ch] = acc;
+        d1 = (pCoeffs[1] * Xn + pCoeffs[3] * acc) + d2;
+        d2 = (pCoeffs[2] * Xn) + (pCoeffs[4] * acc);
+      }
+
+      pState[0] = d1;
+      pState[1] = d2;
+    }
+
+    pIn = pDst;
+  }
+}
+
+void ref_biquad_cascade_mc_df2T_q15(
+  const arm_biquad_cascade_mc_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numCh = S->numChannels;
+  uint32_t stage, ch, n;
+  q15_t *pCoeffs;
+  q31_t *pState;
+  q31_t acc, d1, d2;
+  q15_t Xn, Yn;
+  int32_t shift = (15 - (int32_t) S->postShift);
+  q15_t *pIn = pSrc;
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    for (ch = 0U; ch < numCh; ch++)
+    {
+      pCoeffs = S->pCoeffs + 6U * (stage * numCh + ch);
+      pState = S->pState + 2U * (stage * numCh + ch);
+      d1 = pState[0];
+      d2 = pState[1];
+
+      for (n = 0U; n < blockSize; n++)
+      {
+        Xn = pIn[n * numCh + ch];
+        acc = ref_sat_q31((q63_t) ((q31_t) pCoeffs[0] * Xn) + d1);
+        Yn = ref_sat_q15(acc >> shift);
+        pDst[n * numCh + ch] = Yn;
+        d1 = ref_sat_q31((q63_t) ((q31_t) pCoeffs[2] * Xn) + ((q31_t) pCoeffs[4] * Yn));
+        d1 = ref_sat_q31((q63_t) d1 + d2);
+        d2 = ref_sat_q31((q63_t) ((q31_t) pCoeffs[3] * Xn) + ((q31_t) pCoeffs[5] * Yn));
+      }
+
+      pState[0] = d1;
+      pState[1] = d2;
+    }
+
+    pIn = pDst;
+  }
+}
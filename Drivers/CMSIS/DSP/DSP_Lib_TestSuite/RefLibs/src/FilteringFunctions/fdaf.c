@@ -0,0 +1,140 @@
+#include "ref.h"
+
+#define REF_PI 3.14159265358979323846
+
+#define REF_FDAF_MAX_BLOCK 64
+#define REF_FDAF_MAX_PARTS 8
+
+/* Bins 0 to N/2 of the DFT of N real samples */
+static void ref_fdaf_dft(const double * x, double * re, double * im, uint32_t N)
+{
+	uint32_t k, n;
+
+	for (k = 0; k <= N / 2; k++)
+	{
+		re[k] = 0;
+		im[k] = 0;
+		for (n = 0; n < N; n++)
+		{
+			re[k] += x[n] * cos(2 * REF_PI * ((k * n) % N) / N);
+			im[k] -= x[n] * sin(2 * REF_PI * ((k * n) % N) / N);
+		}
+	}
+}
+
+/* Inverse DFT, scaled by 1/N, of a spectrum with Hermitian symmetry */
+static void ref_fdaf_idft(const double * re, const double * im, double * x, uint32_t N)
+{
+	uint32_t k, n;
+	double sum;
+
+	for (n = 0; n < N; n++)
+	{
+		sum = re[0] + re[N / 2] * ((n % 2) ? -1 : 1);
+		for (k = 1; k < N / 2; k++)
+		{
+			sum += 2 * (re[k] * cos(2 * REF_PI * ((k * n) % N) / N) -
+			            im[k] * sin(2 * REF_PI * ((k * n) % N) / N));
+		}
+		x[n] = sum / N;
+	}
+}
+
+/*
+ * Partitioned block frequency-domain adaptive filter on numBlocks blocks of
+ * blockLen samples, starting from zero weights, with the per bin step
+ * normalization and the round robin gradient constraint of arm_fdaf_block_f32()
+ */
+void ref_fdaf_f32(
+  uint32_t blockLen,
+  uint32_t numPartitions,
+  float32_t mu,
+  float32_t alpha,
+  float32_t delta,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t numBlocks)
+{
+	static double xRe[REF_FDAF_MAX_PARTS][REF_FDAF_MAX_BLOCK + 1];
+	static double xIm[REF_FDAF_MAX_PARTS][REF_FDAF_MAX_BLOCK + 1];
+	static double wRe[REF_FDAF_MAX_PARTS][REF_FDAF_MAX_BLOCK + 1];
+	static double wIm[REF_FDAF_MAX_PARTS][REF_FDAF_MAX_BLOCK + 1];
+	double in[2 * REF_FDAF_MAX_BLOCK], t[2 * REF_FDAF_MAX_BLOCK];
+	double yRe[REF_FDAF_MAX_BLOCK + 1], yIm[REF_FDAF_MAX_BLOCK + 1];
+	double power[REF_FDAF_MAX_BLOCK + 1], step;
+	uint32_t L = blockLen, N = 2 * blockLen, P = numPartitions;
+	uint32_t head = 0, constrain = 0, b, p, slot, k, n;
+
+	memset(xRe, 0, sizeof(xRe));
+	memset(xIm, 0, sizeof(xIm));
+	memset(wRe, 0, sizeof(wRe));
+	memset(wIm, 0, sizeof(wIm));
+	memset(in, 0, sizeof(in));
+
+	for (b = 0; b < numBlocks; b++)
+	{
+		/* Newest input spectrum */
+		for (n = 0; n < L; n++)
+		{
+			in[n] = in[L + n];
+			in[L + n] = pSrc[b * L + n];
+		}
+		head = (head == 0) ? P - 1 : head - 1;
+		ref_fdaf_dft(in, xRe[head], xIm[head], N);
+
+		/* Output: partition p filters the input spectrum p blocks old */
+		for (k = 0; k <= L; k++)
+		{
+			yRe[k] = 0;
+			yIm[k] = 0;
+			for (p = 0; p < P; p++)
+			{
+				slot = (head + p) % P;
+				yRe[k] += wRe[p][k] * xRe[slot][k] - wIm[p][k] * xIm[slot][k];
+				yIm[k] += wRe[p][k] * xIm[slot][k] + wIm[p][k] * xRe[slot][k];
+			}
+		}
+		ref_fdaf_idft(yRe, yIm, t, N);
+
+		for (n = 0; n < L; n++)
+		{
+			pOut[b * L + n] = t[L + n];
+			pErr[b * L + n] = pRef[b * L + n] - t[L + n];
+			t[n] = 0;
+			t[L + n] = pErr[b * L + n];
+		}
+		ref_fdaf_dft(t, yRe, yIm, N);
+
+		/* Normalized step of each bin, the first block sets the power */
+		for (k = 0; k <= L; k++)
+		{
+			step = xRe[head][k] * xRe[head][k] + xIm[head][k] * xIm[head][k];
+			power[k] = (b == 0) ? step : power[k] + (1 - alpha) * (step - power[k]);
+			step = mu / P / (power[k] + N * (double) delta);
+			yRe[k] *= step;
+			yIm[k] *= step;
+		}
+
+		/* Gradient: conj(X) * E */
+		for (p = 0; p < P; p++)
+		{
+			slot = (head + p) % P;
+			for (k = 0; k <= L; k++)
+			{
+				wRe[p][k] += xRe[slot][k] * yRe[k] + xIm[slot][k] * yIm[k];
+				wIm[p][k] += xRe[slot][k] * yIm[k] - xIm[slot][k] * yRe[k];
+			}
+		}
+
+		/* Constraint of one partition */
+		ref_fdaf_idft(wRe[constrain], wIm[constrain], t, N);
+		for (n = L; n < N; n++)
+		{
+			t[n] = 0;
+		}
+		ref_fdaf_dft(t, wRe[constrain], wIm[constrain], N);
+		constrain = (constrain + 1) % P;
+	}
+}
@@ -0,0 +1,165 @@
+#include "ref.h"
+
+#define REF_KALMAN_MAX_DIM 16
+
+void ref_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pXPred)
+{
+	static float32_t x[REF_KALMAN_MAX_DIM];
+	static float32_t T[REF_KALMAN_MAX_DIM * REF_KALMAN_MAX_DIM];
+	uint32_t n = S->numStates;
+	uint32_t i, j, k;
+	float32_t sum;
+
+	/* x = F * x */
+	for (i = 0; i < n; i++)
+	{
+		sum = 0.0f;
+		for (k = 0; k < n; k++)
+		{
+			sum += S->pF[i * n + k] * S->pX[k];
+		}
+		x[i] = (pXPred != NULL) ? pXPred[i] : sum;
+	}
+	for (i = 0; i < n; i++)
+	{
+		S->pX[i] = x[i];
+	}
+
+	/* T = F * P */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = 0.0f;
+			for (k = 0; k < n; k++)
+			{
+				sum += S->pF[i * n + k] * S->pP[k * n + j];
+			}
+			T[i * n + j] = sum;
+		}
+	}
+
+	/* P = T * F' + Q */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = 0.0f;
+			for (k = 0; k < n; k++)
+			{
+				sum += T[i * n + k] * S->pF[j * n + k];
+			}
+			S->pP[i * n + j] = sum + S->pQ[i * n + j];
+		}
+	}
+}
+
+arm_status ref_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ,
+  float32_t * pHx)
+{
+	static float32_t PHt[REF_KALMAN_MAX_DIM * REF_KALMAN_MAX_DIM];
+	static float32_t Sm[REF_KALMAN_MAX_DIM * REF_KALMAN_MAX_DIM];
+	static float32_t Si[REF_KALMAN_MAX_DIM * REF_KALMAN_MAX_DIM];
+	static float32_t K[REF_KALMAN_MAX_DIM * REF_KALMAN_MAX_DIM];
+	static float32_t KHP[REF_KALMAN_MAX_DIM * REF_KALMAN_MAX_DIM];
+	static float32_t y[REF_KALMAN_MAX_DIM];
+	arm_matrix_instance_f32 matS, matSi;
+	uint32_t n = S->numStates;
+	uint32_t m = S->numMeas;
+	uint32_t i, j, k;
+	float32_t sum;
+
+	/* y = z - H * x */
+	for (i = 0; i < m; i++)
+	{
+		sum = 0.0f;
+		for (k = 0; k < n; k++)
+		{
+			sum += S->pH[i * n + k] * S->pX[k];
+		}
+		y[i] = pZ[i] - ((pHx != NULL) ? pHx[i] : sum);
+	}
+
+	/* P * H' */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			sum = 0.0f;
+			for (k = 0; k < n; k++)
+			{
+				sum += S->pP[i * n + k] * S->pH[j * n + k];
+			}
+			PHt[i * m + j] = sum;
+		}
+	}
+
+	/* S = H * P * H' + R, inverted */
+	for (i = 0; i < m; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			sum = 0.0f;
+			for (k = 0; k < n; k++)
+			{
+				sum += S->pH[i * n + k] * PHt[k * m + j];
+			}
+			Sm[i * m + j] = sum + S->pR[i * m + j];
+		}
+	}
+
+	matS.numRows = matS.numCols = m;
+	matS.pData = Sm;
+	matSi.numRows = matSi.numCols = m;
+	matSi.pData = Si;
+	ref_mat_inverse_f32(&matS, &matSi);
+
+	/* K = P * H' * inv(S) */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < m; j++)
+		{
+			sum = 0.0f;
+			for (k = 0; k < m; k++)
+			{
+				sum += PHt[i * m + k] * Si[k * m + j];
+			}
+			K[i * m + j] = sum;
+		}
+	}
+
+	/* x = x + K * y */
+	for (i = 0; i < n; i++)
+	{
+		sum = 0.0f;
+		for (k = 0; k < m; k++)
+		{
+			sum += K[i * m + k] * y[k];
+		}
+		S->pX[i] += sum;
+	}
+
+	/* P = P - K * H * P, with H * P = (P * H')' */
+	for (i = 0; i < n; i++)
+	{
+		for (j = 0; j < n; j++)
+		{
+			sum = 0.0f;
+			for (k = 0; k < m; k++)
+			{
+				sum += K[i * m + k] * PHt[j * m + k];
+			}
+			KHP[i * n + j] = sum;
+		}
+	}
+	for (i = 0; i < n * n; i++)
+	{
+		S->pP[i] -= KHP[i];
+	}
+
+	return ARM_MATH_SUCCESS;
+}
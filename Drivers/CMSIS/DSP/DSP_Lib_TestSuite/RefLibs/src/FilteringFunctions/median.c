@@ -0,0 +1,71 @@
+#include "ref.h"
+
+/* Median of the last windowSize samples, the samples before pSrc are zeros */
+void ref_median_f32(
+  uint16_t windowSize,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t n, i;
+	float32_t window[1024];
+	
+	for(n=0;n<blockSize;n++)
+	{
+		for(i=0;i<windowSize;i++)
+		{
+			window[i] = (n + i + 1 >= windowSize) ? pSrc[n + i + 1 - windowSize] : 0.0f;
+		}
+		ref_sort_f32(window, windowSize);
+		if (windowSize & 1)
+			pDst[n] = window[windowSize / 2];
+		else
+			pDst[n] = 0.5f * (window[windowSize / 2 - 1] + window[windowSize / 2]);
+	}
+}
+
+void ref_median_q31(
+  uint16_t windowSize,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t n, i;
+	q31_t window[1024];
+	
+	for(n=0;n<blockSize;n++)
+	{
+		for(i=0;i<windowSize;i++)
+		{
+			window[i] = (n + i + 1 >= windowSize) ? pSrc[n + i + 1 - windowSize] : 0;
+		}
+		ref_sort_q31(window, windowSize);
+		if (windowSize & 1)
+			pDst[n] = window[windowSize / 2];
+		else
+			pDst[n] = (q31_t)(((q63_t)window[windowSize / 2 - 1] + window[windowSize / 2]) >> 1);
+	}
+}
+
+void ref_median_q15(
+  uint16_t windowSize,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t n, i;
+	q15_t window[1024];
+	
+	for(n=0;n<blockSize;n++)
+	{
+		for(i=0;i<windowSize;i++)
+		{
+			window[i] = (n + i + 1 >= windowSize) ? pSrc[n + i + 1 - windowSize] : 0;
+		}
+		ref_sort_q15(window, windowSize);
+		if (windowSize & 1)
+			pDst[n] = window[windowSize / 2];
+		else
+			pDst[n] = (q15_t)(((q31_t)window[windowSize / 2 - 1] + window[windowSize / 2]) >> 1);
+	}
+}
@@ -0,0 +1,67 @@
+#include "ref.h"
+
+void ref_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pHist,
+  uint16_t numBins,
+  float32_t histMin,
+  float32_t histMax)
+{
+	uint32_t i;
+	double pos;
+	
+	memset(pHist, 0, numBins * sizeof(uint32_t));
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pos = floor(((double)pSrc[i] - histMin) * numBins / ((double)histMax - histMin));
+		pos = (pos < 0) ? 0 : pos;
+		pos = (pos > numBins - 1) ? numBins - 1 : pos;
+		pHist[(uint32_t)pos]++;
+	}
+}
+
+void ref_histogram_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q31_t histMin,
+  uint8_t binShift)
+{
+	uint32_t i;
+	double pos;
+	
+	memset(pHist, 0, numBins * sizeof(uint32_t));
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pos = floor(((double)pSrc[i] - histMin) / ldexp(1.0, binShift));
+		pos = (pos < 0) ? 0 : pos;
+		pos = (pos > numBins - 1) ? numBins - 1 : pos;
+		pHist[(uint32_t)pos]++;
+	}
+}
+
+void ref_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q15_t histMin,
+  uint8_t binShift)
+{
+	uint32_t i;
+	double pos;
+	
+	memset(pHist, 0, numBins * sizeof(uint32_t));
+	
+	for(i=0;i<blockSize;i++)
+	{
+		pos = floor(((double)pSrc[i] - histMin) / ldexp(1.0, binShift));
+		pos = (pos < 0) ? 0 : pos;
+		pos = (pos > numBins - 1) ? numBins - 1 : pos;
+		pHist[(uint32_t)pos]++;
+	}
+}
@@ -0,0 +1,71 @@
+#include "ref.h"
+#include <stdlib.h>
+
+static int ref_cmp_f32(const void * a, const void * b)
+{
+	float32_t x = *(const float32_t *)a, y = *(const float32_t *)b;
+	return (x > y) - (x < y);
+}
+
+static int ref_cmp_q31(const void * a, const void * b)
+{
+	q31_t x = *(const q31_t *)a, y = *(const q31_t *)b;
+	return (x > y) - (x < y);
+}
+
+static int ref_cmp_q15(const void * a, const void * b)
+{
+	return *(const q15_t *)a - *(const q15_t *)b;
+}
+
+static int ref_cmp_q7(const void * a, const void * b)
+{
+	return *(const q7_t *)a - *(const q7_t *)b;
+}
+
+void ref_sort_f32(
+  float32_t * pSrcDst,
+  uint32_t blockSize)
+{
+	qsort(pSrcDst, blockSize, sizeof(float32_t), ref_cmp_f32);
+}
+
+void ref_sort_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize)
+{
+	qsort(pSrcDst, blockSize, sizeof(q31_t), ref_cmp_q31);
+}
+
+void ref_sort_q15(
+  q15_t * pSrcDst,
+  uint32_t blockSize)
+{
+	qsort(pSrcDst, blockSize, sizeof(q15_t), ref_cmp_q15);
+}
+
+void ref_sort_q7(
+  q7_t * pSrcDst,
+  uint32_t blockSize)
+{
+	qsort(pSrcDst, blockSize, sizeof(q7_t), ref_cmp_q7);
+}
+
+/* Stable: equal values keep the order of their indices */
+void ref_argsort_f32(
+  const float32_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t blockSize)
+{
+	uint32_t i, j, in;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		in = i;
+		for(j=i;(j>0) && (pSrc[pIndex[j-1]] > pSrc[in]);j--)
+		{
+			pIndex[j] = pIndex[j-1];
+		}
+		pIndex[j] = in;
+	}
+}
@@ -0,0 +1,80 @@
+#include "ref.h"
+
+/* The k largest values in descending order, the first ones on ties */
+void ref_topk_f32(
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex)
+{
+	uint32_t i, j, best;
+	uint8_t taken[1024] = {0};
+	
+	for(j=0;(j<k) && (j<blockSize);j++)
+	{
+		best = blockSize;
+		for(i=0;i<blockSize;i++)
+		{
+			if (!taken[i] && ((best == blockSize) || (pSrc[i] > pSrc[best])))
+			{
+				best = i;
+			}
+		}
+		taken[best] = 1;
+		pDst[j] = pSrc[best];
+		pIndex[j] = best;
+	}
+}
+
+void ref_topk_q31(
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pDst,
+  uint32_t * pIndex)
+{
+	uint32_t i, j, best;
+	uint8_t taken[1024] = {0};
+	
+	for(j=0;(j<k) && (j<blockSize);j++)
+	{
+		best = blockSize;
+		for(i=0;i<blockSize;i++)
+		{
+			if (!taken[i] && ((best == blockSize) || (pSrc[i] > pSrc[best])))
+			{
+				best = i;
+			}
+		}
+		taken[best] = 1;
+		pDst[j] = pSrc[best];
+		pIndex[j] = best;
+	}
+}
+
+void ref_topk_q15(
+  const q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint32_t * pIndex)
+{
+	uint32_t i, j, best;
+	uint8_t taken[1024] = {0};
+	
+	for(j=0;(j<k) && (j<blockSize);j++)
+	{
+		best = blockSize;
+		for(i=0;i<blockSize;i++)
+		{
+			if (!taken[i] && ((best == blockSize) || (pSrc[i] > pSrc[best])))
+			{
+				best = i;
+			}
+		}
+		taken[best] = 1;
+		pDst[j] = pSrc[best];
+		pIndex[j] = best;
+	}
+}
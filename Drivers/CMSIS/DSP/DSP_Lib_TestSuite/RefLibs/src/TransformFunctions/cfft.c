@@ -1,5 +1,51 @@
 #include "ref.h"
 #include "arm_const_structs.h"
+
+#define REF_DFT_MAX_LEN 2048
+
+static float32_t ref_dft_scratch[REF_DFT_MAX_LEN * 2];
+
+/*
+ * Direct DFT used for the mixed radix lengths that are not a power
+ * of two, accumulated in double precision.
+ */
+static void ref_dft_f32(
+   float32_t * p1,
+   uint32_t N,
+   uint8_t ifftFlag)
+{
+	uint32_t k, n;
+	float64_t sumr, sumi, phase;
+	float64_t dir = (ifftFlag) ? 1.0 : -1.0;
+
+	for (n = 0; n < 2*N; n++)
+	{
+		ref_dft_scratch[n] = p1[n];
+	}
+
+	for (k = 0; k < N; k++)
+	{
+		sumr = 0.0;
+		sumi = 0.0;
+		for (n = 0; n < N; n++)
+		{
+			phase = dir * 6.283185307179586 * (float64_t)((k * n) % N) / N;
+			sumr += ref_dft_scratch[2*n] * cos(phase) - ref_dft_scratch[2*n+1] * sin(phase);
+			sumi += ref_dft_scratch[2*n] * sin(phase) + ref_dft_scratch[2*n+1] * cos(phase);
+		}
+		p1[2*k]   = (float32_t)sumr;
+		p1[2*k+1] = (float32_t)sumi;
+	}
+
+	// Inverse transform is scaled by 1/N
+	if (ifftFlag)
+	{
+		for (n = 0; n < 2*N; n++)
+		{
+			p1[n] /= N;
+		}
+	}
+}
 	 
 void ref_cfft_f32(
    const arm_cfft_instance_f32 * S, 
@@ -14,6 +60,13 @@ void ref_cfft_f32(
 	uint32_t N = S->fftLen;
 	int32_t dir = (ifftFlag) ? -1 : 1;
 
+	if ((N & (N - 1)) != 0)
+	{
+		// mixed radix lengths
+		ref_dft_f32(p1, N, ifftFlag);
+		return;
+	}
+
 	// decrement pointer since the original version used fortran style indexing.
 	data--;
 
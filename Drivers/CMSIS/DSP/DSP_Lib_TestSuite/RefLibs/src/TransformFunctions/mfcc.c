@@ -0,0 +1,88 @@
+#include "ref.h"
+
+#define REF_PI 3.14159265358979323846
+
+static double ref_hz_to_mel(double f)
+{
+	return 2595 * log10(1 + f / 700);
+}
+
+static double ref_mel_to_hz(double mel)
+{
+	return 700 * (pow(10, mel / 2595) - 1);
+}
+
+/*
+ * MFCC or log-mel energies (numCoeffs = 0) of the frames starting at 0,
+ * hopSize, 2*hopSize... that fit in the input, with a dense HTK filterbank
+ * and an orthonormal DCT-II
+ */
+uint32_t ref_mfcc_f32(
+  const float32_t * pSrc,
+  uint32_t numSamples,
+  uint32_t fftLen,
+  uint32_t hopSize,
+  arm_window_type window,
+  uint32_t numMel,
+  uint32_t numCoeffs,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  float32_t * pDst)
+{
+	float32_t w[4096], spec[4096];
+	double power[2049], edges[130], logMel[128];
+	double lo, hi, f, weight, energy, sum;
+	uint32_t numFrames = 0, start, k, m;
+	
+	ref_window_f32(window, w, fftLen);
+	
+	lo = ref_hz_to_mel(fMin);
+	hi = ref_hz_to_mel(fMax);
+	for(m=0;m<numMel+2;m++)
+		edges[m] = ref_mel_to_hz(lo + (hi - lo) * m / (numMel + 1));
+	
+	for(start=0;start+fftLen<=numSamples;start+=hopSize)
+	{
+		ref_stft_frame_f32(pSrc + start, w, fftLen, spec);
+		power[0] = (double)spec[0] * spec[0];
+		power[fftLen/2] = (double)spec[1] * spec[1];
+		for(k=1;k<fftLen/2;k++)
+			power[k] = (double)spec[2*k] * spec[2*k] + (double)spec[2*k+1] * spec[2*k+1];
+		
+		for(m=0;m<numMel;m++)
+		{
+			energy = 0;
+			for(k=0;k<=fftLen/2;k++)
+			{
+				f = (double)k * sampleRate / fftLen;
+				if (f <= edges[m+1])
+					weight = (f - edges[m]) / (edges[m+1] - edges[m]);
+				else
+					weight = (edges[m+2] - f) / (edges[m+2] - edges[m+1]);
+				if (weight > 0)
+					energy += weight * power[k];
+			}
+			logMel[m] = log(energy > 1e-10 ? energy : 1e-10);
+		}
+		
+		if (numCoeffs == 0)
+		{
+			for(m=0;m<numMel;m++)
+				*pDst++ = (float32_t)logMel[m];
+		}
+		else
+		{
+			for(k=0;k<numCoeffs;k++)
+			{
+				sum = 0;
+				for(m=0;m<numMel;m++)
+					sum += logMel[m] * cos(REF_PI * k * (2 * m + 1) / (2.0 * numMel));
+				*pDst++ = (float32_t)(sum * sqrt((k == 0 ? 1.0 : 2.0) / numMel));
+			}
+		}
+		numFrames++;
+	}
+	
+	return numFrames;
+}
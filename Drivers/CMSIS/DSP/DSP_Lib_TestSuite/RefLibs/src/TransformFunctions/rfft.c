@@ -59,6 +59,7 @@ void ref_rfft_fast_f32(
 	uint8_t ifftFlag)
 {
 	uint32_t i,j;
+	arm_cfft_instance_f32 cfftInst = {0, NULL, NULL, 0};
 	
 	if (ifftFlag)
 	{
@@ -120,6 +121,12 @@ void ref_rfft_fast_f32(
    case 4096: 
 		 ref_cfft_f32(&arm_cfft_sR_f32_len4096, pOut, ifftFlag, 1);
 		 break;
+
+   default:
+		 // mixed radix lengths only need the length of the instance
+		 cfftInst.fftLen = S->fftLenRFFT;
+		 ref_cfft_f32(&cfftInst, pOut, ifftFlag, 1);
+		 break;
 	}
 	
 	if (ifftFlag)
@@ -0,0 +1,118 @@
+#include "ref.h"
+
+#define REF_PI 3.14159265358979323846
+
+void ref_window_f32(
+  arm_window_type type,
+  float32_t * pDst,
+  uint32_t len)
+{
+	static const double coeffs[5][5] = {
+		{1.0, 0.0, 0.0, 0.0, 0.0},
+		{0.5, 0.5, 0.0, 0.0, 0.0},
+		{0.54, 0.46, 0.0, 0.0, 0.0},
+		{0.35875, 0.48829, 0.14128, 0.01168, 0.0},
+		{0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368}};
+	uint32_t n, m;
+	double sum;
+	
+	for(n=0;n<len;n++)
+	{
+		sum = 0;
+		for(m=0;m<5;m++)
+		{
+			sum += ((m & 1) ? -1 : 1) * coeffs[type][m] * cos(2 * REF_PI * m * n / len);
+		}
+		pDst[n] = (float32_t)sum;
+	}
+}
+
+/*
+ * Direct DFT of the windowed frame, in the packed format of arm_rfft_fast_f32
+ */
+void ref_stft_frame_f32(
+  const float32_t * pSrc,
+  const float32_t * pWindow,
+  uint32_t fftLen,
+  float32_t * pDst)
+{
+	uint32_t n, k;
+	double re, im, x;
+	
+	for(k=0;k<=fftLen/2;k++)
+	{
+		re = 0;
+		im = 0;
+		for(n=0;n<fftLen;n++)
+		{
+			x = (double)pSrc[n] * pWindow[n];
+			re += x * cos(2 * REF_PI * (double)((uint64_t)k * n % fftLen) / fftLen);
+			im -= x * sin(2 * REF_PI * (double)((uint64_t)k * n % fftLen) / fftLen);
+		}
+		if (k == 0)
+			pDst[0] = (float32_t)re;
+		else if (k == fftLen/2)
+			pDst[1] = (float32_t)re;
+		else
+		{
+			pDst[2*k+0] = (float32_t)re;
+			pDst[2*k+1] = (float32_t)im;
+		}
+	}
+}
+
+/*
+ * Welch estimate of the frames starting at 0, hopSize, 2*hopSize... that fit
+ * in the input, scaled as arm_welch_get_f32
+ */
+uint32_t ref_welch_f32(
+  const float32_t * pSrc,
+  uint32_t numSamples,
+  uint32_t fftLen,
+  uint32_t hopSize,
+  arm_window_type window,
+  float32_t alpha,
+  float32_t * pDst)
+{
+	float32_t w[4096], spec[4096];
+	double acc[2049], p, wp = 0;
+	uint32_t numFrames = 0, start, k;
+	
+	ref_window_f32(window, w, fftLen);
+	for(k=0;k<fftLen;k++)
+		wp += (double)w[k] * w[k];
+	for(k=0;k<=fftLen/2;k++)
+		acc[k] = 0;
+	
+	for(start=0;start+fftLen<=numSamples;start+=hopSize)
+	{
+		ref_stft_frame_f32(pSrc + start, w, fftLen, spec);
+		for(k=0;k<=fftLen/2;k++)
+		{
+			if (k == 0)
+				p = (double)spec[0] * spec[0];
+			else if (k == fftLen/2)
+				p = (double)spec[1] * spec[1];
+			else
+				p = (double)spec[2*k] * spec[2*k] + (double)spec[2*k+1] * spec[2*k+1];
+			
+			if (alpha == 0 || numFrames == 0)
+				acc[k] += p;
+			else
+				acc[k] += alpha * (p - acc[k]);
+		}
+		numFrames++;
+	}
+	
+	for(k=0;k<=fftLen/2;k++)
+	{
+		p = acc[k] / wp;
+		if (alpha == 0 && numFrames > 0)
+			p /= numFrames;
+		if (k != 0 && k != fftLen/2)
+			p *= 2;
+		pDst[k] = (float32_t)p;
+	}
+	
+	return numFrames;
+}
@@ -113,9 +113,26 @@ extern const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1
 extern const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
 
+/* Run time generation of the floating-point FFT tables */
+extern void arm_twiddle_gen_f32(
+  float32_t * pDst,
+  uint32_t fftLen,
+  uint32_t numPairs,
+  uint32_t sinFirst);
+extern uint16_t arm_bitrev_table_gen(
+  uint16_t * pTable,
+  uint32_t fftLen,
+  const uint8_t * pRadix,
+  uint32_t numStages,
+  uint8_t * pVisited);
+
 /* Tables for Fast Math Sine and Cosine */
 extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Tables for the fixed-point sigmoid, hyperbolic tangent and arctangent */
+extern const q31_t sigmoidTable_q31[SIGMOID_TABLE_SIZE + 1];
+extern const q31_t atanTable_q31[ATAN_TABLE_SIZE];
+
 #endif /*  ARM_COMMON_TABLES_H */
@@ -139,6 +139,13 @@
    *
    * Initialize macro __DSP_PRESENT = 1 when Armv8-M Mainline core supports DSP instructions.
    *
+   * - ARM_MATH_X86_SIMD:
+   *
+   * Define macro ARM_MATH_X86_SIMD, together with ARM_MATH_CM0, to build the library for x86-64 hosts (simulation
+   * and offline processing tools). The basic math functions and the copy, fill and float to fixed-point conversion
+   * functions then use SSE4.1 and give the same results as the scalar code. The compiler must target SSE4.1 or
+   * later (for example -msse4.1 or -mavx2).
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -170,10 +177,13 @@
 /**
  * @defgroup groupFastMath Fast Math Functions
  * This set of functions provides a fast approximation to sine, cosine, and square root.
- * As compared to most of the other functions in the CMSIS math library, the fast math functions
+ * As compared to most of the other functions in the CMSIS math library, these fast math functions
  * operate on individual values and not arrays.
  * There are separate functions for Q15, Q31, and floating-point data.
  *
+ * The exponential, logarithm, hyperbolic tangent, sigmoid and two-argument arctangent functions
+ * operate on arrays, replacing a call to the C library for each element.
+ *
  */
 
 /**
@@ -344,6 +354,13 @@
 #undef  __CMSIS_GENERIC         /* enable NVIC and Systick functions */
 #include "string.h"
 #include "math.h"
+
+#if defined (ARM_MATH_X86_SIMD)
+  #if !defined (__SSE4_1__)
+    #error "ARM_MATH_X86_SIMD requires a compiler target with SSE4.1 support"
+  #endif
+  #include <immintrin.h>
+#endif
 #ifdef   __cplusplus
 extern "C"
 {
@@ -372,6 +389,14 @@ extern "C"
 #define TABLE_SPACING_Q31     0x400000
 #define TABLE_SPACING_Q15     0x80
 
+  /**
+   * @brief Macros required for the fixed-point sigmoid, hyperbolic tangent and arctangent
+   */
+
+#define SIGMOID_TABLE_SIZE    768
+#define SIGMOID_TABLE_SHIFT   5
+#define ATAN_TABLE_SIZE       31
+
   /**
    * @brief Macros required for SINE and COSINE Controller functions
    */
@@ -404,7 +429,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by the Cholesky and LDLT decompositions if the input matrix cannot be factorized. */
   } arm_status;
 
   /**
@@ -1003,6 +1029,134 @@ extern "C"
 
 #endif /* !defined (ARM_MATH_DSP) */
 
+#if defined (ARM_MATH_X86_SIMD)
+
+  /*
+   * @brief Saturating addition of four Q31 lanes, same result as __QADD
+   */
+  CMSIS_INLINE __STATIC_INLINE __m128i arm_x86_qadd_q31(
+  __m128i x,
+  __m128i y)
+  {
+    __m128i sum = _mm_add_epi32(x, y);
+    /* overflow when both inputs have the same sign and the sum has not */
+    __m128i ovf = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(x, y), _mm_xor_si128(x, sum)), 31);
+    __m128i sat = _mm_xor_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(0x7FFFFFFF));
+
+    return (_mm_blendv_epi8(sum, sat, ovf));
+  }
+
+  /*
+   * @brief Saturating subtraction of four Q31 lanes, same result as __QSUB
+   */
+  CMSIS_INLINE __STATIC_INLINE __m128i arm_x86_qsub_q31(
+  __m128i x,
+  __m128i y)
+  {
+    __m128i diff = _mm_sub_epi32(x, y);
+    /* overflow when the inputs have different signs and the result takes the sign of y */
+    __m128i ovf = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(x, y), _mm_xor_si128(x, diff)), 31);
+    __m128i sat = _mm_xor_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(0x7FFFFFFF));
+
+    return (_mm_blendv_epi8(diff, sat, ovf));
+  }
+
+  /*
+   * @brief Exponential of four lanes, same result as arm_exp_f32()
+   */
+  CMSIS_INLINE __STATIC_INLINE __m128 arm_x86_exp_ps(
+  __m128 x)
+  {
+    __m128 t, r, r2, p, half;
+    __m128i n, n1, n2;
+    __m128 over = _mm_cmpgt_ps(x, _mm_set1_ps(88.7228394f));
+    __m128 under = _mm_cmplt_ps(x, _mm_set1_ps(-87.3365479f));
+    __m128 nan = _mm_cmpunord_ps(x, x);
+
+    /* x = n * ln(2) + r, |r| <= ln(2) / 2 */
+    t = _mm_mul_ps(x, _mm_set1_ps(1.44269504f));
+    half = _mm_or_ps(_mm_and_ps(t, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+    n = _mm_cvttps_epi32(_mm_add_ps(t, half));
+    t = _mm_cvtepi32_ps(n);
+    r = _mm_sub_ps(x, _mm_mul_ps(t, _mm_set1_ps(0.693359375f)));
+    r = _mm_add_ps(r, _mm_mul_ps(t, _mm_set1_ps(2.12194440e-4f)));
+
+    /* exp(r) = 1 + r + r^2 * P(r) */
+    r2 = _mm_mul_ps(r, r);
+    p = _mm_set1_ps(1.9875691500e-4f);
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.3981999507e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));
+    p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, r2), r), _mm_set1_ps(1.0f));
+
+    /* 2^n as the product of two normal numbers */
+    n1 = _mm_srai_epi32(n, 1);
+    n2 = _mm_sub_epi32(n, n1);
+    n1 = _mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23);
+    n2 = _mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23);
+    p = _mm_mul_ps(_mm_mul_ps(p, _mm_castsi128_ps(n1)), _mm_castsi128_ps(n2));
+
+    /* out of range and NaN inputs */
+    p = _mm_blendv_ps(p, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000)), over);
+    p = _mm_andnot_ps(under, p);
+
+    return (_mm_blendv_ps(p, x, nan));
+  }
+
+  /*
+   * @brief Sine and cosine of four lanes, same result as arm_sin_cos_hermite_f32()
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_x86_sin_cos_hermite_ps(
+  const float *pTable,
+  __m128i indexS,
+  __m128 fract,
+  __m128 *pSinVal,
+  __m128 *pCosVal)
+  {
+    __m128 sinLo, sinHi, cosLo, cosHi, f1, f2, d1, d2, Df, temp;
+    __m128 Dn = _mm_set1_ps(0.0122718463030f);
+    __m128 two = _mm_set1_ps(2.0f);
+    __m128 three = _mm_set1_ps(3.0f);
+    int32_t iS[4], iC[4];
+
+    _mm_storeu_si128((__m128i *) iS, indexS);
+    _mm_storeu_si128((__m128i *) iC, _mm_and_si128(_mm_add_epi32(indexS, _mm_set1_epi32(128)),
+                                                   _mm_set1_epi32(0x1FF)));
+
+    sinLo = _mm_set_ps(pTable[iS[3]], pTable[iS[2]], pTable[iS[1]], pTable[iS[0]]);
+    sinHi = _mm_set_ps(pTable[iS[3] + 1], pTable[iS[2] + 1], pTable[iS[1] + 1], pTable[iS[0] + 1]);
+    cosLo = _mm_set_ps(pTable[iC[3]], pTable[iC[2]], pTable[iC[1]], pTable[iC[0]]);
+    cosHi = _mm_set_ps(pTable[iC[3] + 1], pTable[iC[2] + 1], pTable[iC[1] + 1], pTable[iC[0] + 1]);
+
+    /* cosine, the derivative is -sine */
+    f1 = cosLo;
+    f2 = cosHi;
+    d1 = _mm_xor_ps(sinLo, _mm_set1_ps(-0.0f));
+    d2 = _mm_xor_ps(sinHi, _mm_set1_ps(-0.0f));
+    Df = _mm_sub_ps(f2, f1);
+    temp = _mm_sub_ps(_mm_mul_ps(Dn, _mm_add_ps(d1, d2)), _mm_mul_ps(two, Df));
+    temp = _mm_add_ps(_mm_mul_ps(fract, temp),
+                      _mm_sub_ps(_mm_mul_ps(three, Df), _mm_mul_ps(_mm_add_ps(d2, _mm_mul_ps(two, d1)), Dn)));
+    temp = _mm_add_ps(_mm_mul_ps(fract, temp), _mm_mul_ps(d1, Dn));
+    *pCosVal = _mm_add_ps(_mm_mul_ps(fract, temp), f1);
+
+    /* sine, the derivative is cosine */
+    f1 = sinLo;
+    f2 = sinHi;
+    d1 = cosLo;
+    d2 = cosHi;
+    Df = _mm_sub_ps(f2, f1);
+    temp = _mm_sub_ps(_mm_mul_ps(Dn, _mm_add_ps(d1, d2)), _mm_mul_ps(two, Df));
+    temp = _mm_add_ps(_mm_mul_ps(fract, temp),
+                      _mm_sub_ps(_mm_mul_ps(three, Df), _mm_mul_ps(_mm_add_ps(d2, _mm_mul_ps(two, d1)), Dn)));
+    temp = _mm_add_ps(_mm_mul_ps(fract, temp), _mm_mul_ps(d1, Dn));
+    *pSinVal = _mm_add_ps(_mm_mul_ps(fract, temp), f1);
+  }
+
+#endif /* defined (ARM_MATH_X86_SIMD) */
+
 
   /**
    * @brief Instance structure for the Q7 FIR filter.
@@ -1195,6 +1349,83 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Tap counts for which arm_fir_f32(), arm_fir_q31() and arm_fir_q15() use a fully
+   * unrolled kernel, as a list of X(numTaps) entries. Each count must be a multiple of 4
+   * from 4 to 64. Define it empty to keep only the generic kernels.
+   */
+#ifndef ARM_FIR_FIXED_TAPS
+#define ARM_FIR_FIXED_TAPS(X)  X(16) X(32) X(64)
+#endif
+
+  /*
+   * @brief Expands M(k) for the groups of four taps k = 0, 4, ..., numTaps-4 of
+   * the fully unrolled FIR kernels.
+   */
+#define ARM_FIR_UNROLL_4(M)   M(0U)
+#define ARM_FIR_UNROLL_8(M)   ARM_FIR_UNROLL_4(M)  M(4U)
+#define ARM_FIR_UNROLL_12(M)  ARM_FIR_UNROLL_8(M)  M(8U)
+#define ARM_FIR_UNROLL_16(M)  ARM_FIR_UNROLL_12(M) M(12U)
+#define ARM_FIR_UNROLL_20(M)  ARM_FIR_UNROLL_16(M) M(16U)
+#define ARM_FIR_UNROLL_24(M)  ARM_FIR_UNROLL_20(M) M(20U)
+#define ARM_FIR_UNROLL_28(M)  ARM_FIR_UNROLL_24(M) M(24U)
+#define ARM_FIR_UNROLL_32(M)  ARM_FIR_UNROLL_28(M) M(28U)
+#define ARM_FIR_UNROLL_36(M)  ARM_FIR_UNROLL_32(M) M(32U)
+#define ARM_FIR_UNROLL_40(M)  ARM_FIR_UNROLL_36(M) M(36U)
+#define ARM_FIR_UNROLL_44(M)  ARM_FIR_UNROLL_40(M) M(40U)
+#define ARM_FIR_UNROLL_48(M)  ARM_FIR_UNROLL_44(M) M(44U)
+#define ARM_FIR_UNROLL_52(M)  ARM_FIR_UNROLL_48(M) M(48U)
+#define ARM_FIR_UNROLL_56(M)  ARM_FIR_UNROLL_52(M) M(52U)
+#define ARM_FIR_UNROLL_60(M)  ARM_FIR_UNROLL_56(M) M(56U)
+#define ARM_FIR_UNROLL_64(M)  ARM_FIR_UNROLL_60(M) M(60U)
+
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;  /**< state buffer index. Points to the oldest sample in the state buffer. */
+    uint16_t stateLen;    /**< length of the circular buffer, numTaps+blockSize-1. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length 2*stateLen. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] S          points to an instance of the floating-point FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, at most the block size given at initialization.
+   */
+  void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] S          points to an instance of the floating-point FIR filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer, 2*(numTaps+blockSize-1) values.
+   * @param[in]     blockSize  maximum number of samples that are processed at a time.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful,
+   * ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> or <code>blockSize</code> is zero or
+   * ARM_MATH_LENGTH_ERROR if <code>numTaps+blockSize-1</code> is above 65535.
+   */
+  arm_status arm_fir_circ_init_f32(
+  arm_fir_circ_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1507,6 +1738,27 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Minimum number of multiply-accumulates above which the matrix multiplication
+   * functions use the cache-tiled kernels (ARM_MATH_DSP and ARM_MATH_X86_SIMD builds).
+   */
+#ifndef ARM_MAT_MULT_TILE_MIN_MACS
+#define ARM_MAT_MULT_TILE_MIN_MACS 4096U
+#endif
+
+  /**
+   * @brief Number of rows of B packed at a time by the tiled floating-point matrix multiplication.
+   * The panel is on the stack of the caller: ARM_MAT_MULT_TILE_K * 16 bytes on Cortex-M
+   * (512 bytes by default) and ARM_MAT_MULT_TILE_K * 32 bytes in ARM_MATH_X86_SIMD builds (2 KB).
+   */
+#ifndef ARM_MAT_MULT_TILE_K
+#if defined (ARM_MATH_X86_SIMD)
+#define ARM_MAT_MULT_TILE_K 64U
+#else
+#define ARM_MAT_MULT_TILE_K 32U
+#endif
+#endif
+
   /**
    * @brief Floating-point matrix multiplication
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -1526,7 +1778,7 @@ extern "C"
    * @param[in]  pSrcA   points to the first input matrix structure
    * @param[in]  pSrcB   points to the second input matrix structure
    * @param[out] pDst    points to output matrix structure
-   * @param[in]  pState  points to the array for storing intermediate results
+   * @param[in]  pState  points to the array for storing intermediate results, may be NULL
    * @return     The function returns either
    * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
    */
@@ -1710,6 +1962,419 @@ extern "C"
   uint16_t nColumns,
   float32_t * pData);
 
+  /**
+   * @brief Block column index of the padding blocks of a blocked-ELL matrix.
+   */
+#define ARM_MAT_BELL_PAD              0xFFFFU
+
+  /**
+   * @brief Instance structure for the floating-point CSR (compressed sparse row) matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix. */
+    uint16_t numCols;     /**< number of columns of the matrix. */
+    uint32_t *pRowStart;  /**< points to the index of the first element of each row, numRows+1 values. */
+    uint16_t *pColIdx;    /**< points to the column of each stored element. */
+    float32_t *pData;     /**< points to the stored elements, row after row. */
+  } arm_mat_csr_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point blocked-ELL matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix, a multiple of blockSize. */
+    uint16_t numCols;     /**< number of columns of the matrix, a multiple of blockSize. */
+    uint16_t blockSize;   /**< size of the square blocks. */
+    uint16_t blockCols;   /**< number of blocks stored per block row. */
+    uint16_t *pColIdx;    /**< points to the block column of each block, ARM_MAT_BELL_PAD for padding. */
+    float32_t *pData;     /**< points to the blocks, each one stored by rows. */
+  } arm_mat_bell_instance_f32;
+
+  /**
+   * @brief  Floating-point CSR matrix initialization.
+   * @param[in,out] S          points to an instance of the floating-point CSR matrix structure.
+   * @param[in]     nRows      number of rows in the matrix.
+   * @param[in]     nColumns   number of columns in the matrix.
+   * @param[in]     pRowStart  points to the row start indexes, nRows+1 values.
+   * @param[in]     pColIdx    points to the column indexes of the elements.
+   * @param[in]     pData      points to the elements.
+   */
+  void arm_mat_csr_init_f32(
+  arm_mat_csr_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t * pRowStart,
+  uint16_t * pColIdx,
+  float32_t * pData);
+
+  /**
+   * @brief  Floating-point blocked-ELL matrix initialization.
+   * @param[in,out] S          points to an instance of the floating-point blocked-ELL matrix structure.
+   * @param[in]     nRows      number of rows in the matrix, a multiple of blockSize.
+   * @param[in]     nColumns   number of columns in the matrix, a multiple of blockSize.
+   * @param[in]     blockSize  size of the square blocks.
+   * @param[in]     blockCols  number of blocks stored per block row.
+   * @param[in]     pColIdx    points to the block column indexes, nRows/blockSize*blockCols values.
+   * @param[in]     pData      points to the blocks, nRows*blockSize*blockCols values.
+   */
+  void arm_mat_bell_init_f32(
+  arm_mat_bell_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t blockSize,
+  uint16_t blockCols,
+  uint16_t * pColIdx,
+  float32_t * pData);
+
+  /**
+   * @brief  Conversion of a floating-point dense matrix to CSR, dropping the small elements.
+   * @param[in]     pSrc         points to the dense matrix.
+   * @param[in]     threshold    elements with a magnitude at most threshold are dropped.
+   * @param[in]     maxNonZeros  number of elements that fit in the buffers of pDst.
+   * @param[in,out] pDst         points to the CSR matrix, initialized with its buffers.
+   * @return        ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t threshold,
+  uint32_t maxNonZeros,
+  arm_mat_csr_instance_f32 * pDst);
+
+  /**
+   * @brief  Conversion of a floating-point dense matrix to blocked-ELL, dropping the small blocks.
+   * @param[in]     pSrc         points to the dense matrix.
+   * @param[in]     threshold    elements with a magnitude at most threshold are dropped.
+   * @param[in]     maxBlocks    number of blocks that fit in the buffers of pDst.
+   * @param[in,out] pDst         points to the blocked-ELL matrix, initialized with its block size and buffers.
+   * @return        ARM_MATH_ARGUMENT_ERROR if the block size does not divide the dimensions,
+   *                ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_bell_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t threshold,
+  uint32_t maxBlocks,
+  arm_mat_bell_instance_f32 * pDst);
+
+  /**
+   * @brief  Floating-point CSR matrix times dense vector.
+   * @param[in]  pSrc   points to the CSR matrix.
+   * @param[in]  pVec   points to the input vector, numCols values.
+   * @param[out] pDst   points to the output vector, numRows values.
+   */
+  void arm_mat_csr_vec_mult_f32(
+  const arm_mat_csr_instance_f32 * pSrc,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+  /**
+   * @brief  Floating-point blocked-ELL matrix times dense vector.
+   * @param[in]  pSrc   points to the blocked-ELL matrix.
+   * @param[in]  pVec   points to the input vector, numCols values.
+   * @param[out] pDst   points to the output vector, numRows values.
+   */
+  void arm_mat_bell_vec_mult_f32(
+  const arm_mat_bell_instance_f32 * pSrc,
+  const float32_t * pVec,
+  float32_t * pDst);
+
+  /**
+   * @brief  Floating-point CSR matrix times dense matrix.
+   * @param[in]  pSrcA  points to the CSR matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix.
+   * @return     ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+  arm_status arm_mat_csr_mult_f32(
+  const arm_mat_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief  Floating-point blocked-ELL matrix times dense matrix.
+   * @param[in]  pSrcA  points to the blocked-ELL matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix.
+   * @return     ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+  arm_status arm_mat_bell_mult_f32(
+  const arm_mat_bell_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Instance structure for the Q31 CSR (compressed sparse row) matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix. */
+    uint16_t numCols;     /**< number of columns of the matrix. */
+    uint32_t *pRowStart;  /**< points to the index of the first element of each row, numRows+1 values. */
+    uint16_t *pColIdx;    /**< points to the column of each stored element. */
+    q31_t *pData;         /**< points to the stored elements, row after row. */
+  } arm_mat_csr_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q31 blocked-ELL matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix, a multiple of blockSize. */
+    uint16_t numCols;     /**< number of columns of the matrix, a multiple of blockSize. */
+    uint16_t blockSize;   /**< size of the square blocks. */
+    uint16_t blockCols;   /**< number of blocks stored per block row. */
+    uint16_t *pColIdx;    /**< points to the block column of each block, ARM_MAT_BELL_PAD for padding. */
+    q31_t *pData;         /**< points to the blocks, each one stored by rows. */
+  } arm_mat_bell_instance_q31;
+
+  /**
+   * @brief  Q31 CSR matrix initialization.
+   * @param[in,out] S          points to an instance of the Q31 CSR matrix structure.
+   * @param[in]     nRows      number of rows in the matrix.
+   * @param[in]     nColumns   number of columns in the matrix.
+   * @param[in]     pRowStart  points to the row start indexes, nRows+1 values.
+   * @param[in]     pColIdx    points to the column indexes of the elements.
+   * @param[in]     pData      points to the elements.
+   */
+  void arm_mat_csr_init_q31(
+  arm_mat_csr_instance_q31 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t * pRowStart,
+  uint16_t * pColIdx,
+  q31_t * pData);
+
+  /**
+   * @brief  Q31 blocked-ELL matrix initialization.
+   * @param[in,out] S          points to an instance of the Q31 blocked-ELL matrix structure.
+   * @param[in]     nRows      number of rows in the matrix, a multiple of blockSize.
+   * @param[in]     nColumns   number of columns in the matrix, a multiple of blockSize.
+   * @param[in]     blockSize  size of the square blocks.
+   * @param[in]     blockCols  number of blocks stored per block row.
+   * @param[in]     pColIdx    points to the block column indexes, nRows/blockSize*blockCols values.
+   * @param[in]     pData      points to the blocks, nRows*blockSize*blockCols values.
+   */
+  void arm_mat_bell_init_q31(
+  arm_mat_bell_instance_q31 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t blockSize,
+  uint16_t blockCols,
+  uint16_t * pColIdx,
+  q31_t * pData);
+
+  /**
+   * @brief  Conversion of a Q31 dense matrix to CSR, dropping the small elements.
+   * @param[in]     pSrc         points to the dense matrix.
+   * @param[in]     threshold    elements with a magnitude at most threshold are dropped.
+   * @param[in]     maxNonZeros  number of elements that fit in the buffers of pDst.
+   * @param[in,out] pDst         points to the CSR matrix, initialized with its buffers.
+   * @return        ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_csr_from_dense_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  q31_t threshold,
+  uint32_t maxNonZeros,
+  arm_mat_csr_instance_q31 * pDst);
+
+  /**
+   * @brief  Conversion of a Q31 dense matrix to blocked-ELL, dropping the small blocks.
+   * @param[in]     pSrc         points to the dense matrix.
+   * @param[in]     threshold    elements with a magnitude at most threshold are dropped.
+   * @param[in]     maxBlocks    number of blocks that fit in the buffers of pDst.
+   * @param[in,out] pDst         points to the blocked-ELL matrix, initialized with its block size and buffers.
+   * @return        ARM_MATH_ARGUMENT_ERROR if the block size does not divide the dimensions,
+   *                ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_bell_from_dense_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  q31_t threshold,
+  uint32_t maxBlocks,
+  arm_mat_bell_instance_q31 * pDst);
+
+  /**
+   * @brief  Q31 CSR matrix times dense vector.
+   * @param[in]  pSrc   points to the CSR matrix.
+   * @param[in]  pVec   points to the input vector, numCols values.
+   * @param[out] pDst   points to the output vector, numRows values.
+   */
+  void arm_mat_csr_vec_mult_q31(
+  const arm_mat_csr_instance_q31 * pSrc,
+  const q31_t * pVec,
+  q31_t * pDst);
+
+  /**
+   * @brief  Q31 blocked-ELL matrix times dense vector.
+   * @param[in]  pSrc   points to the blocked-ELL matrix.
+   * @param[in]  pVec   points to the input vector, numCols values.
+   * @param[out] pDst   points to the output vector, numRows values.
+   */
+  void arm_mat_bell_vec_mult_q31(
+  const arm_mat_bell_instance_q31 * pSrc,
+  const q31_t * pVec,
+  q31_t * pDst);
+
+  /**
+   * @brief  Q31 CSR matrix times dense matrix.
+   * @param[in]  pSrcA  points to the CSR matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix.
+   * @return     ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+  arm_status arm_mat_csr_mult_q31(
+  const arm_mat_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief  Q31 blocked-ELL matrix times dense matrix.
+   * @param[in]  pSrcA  points to the blocked-ELL matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix.
+   * @return     ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+  arm_status arm_mat_bell_mult_q31(
+  const arm_mat_bell_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Instance structure for the Q15 CSR (compressed sparse row) matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix. */
+    uint16_t numCols;     /**< number of columns of the matrix. */
+    uint32_t *pRowStart;  /**< points to the index of the first element of each row, numRows+1 values. */
+    uint16_t *pColIdx;    /**< points to the column of each stored element. */
+    q15_t *pData;         /**< points to the stored elements, row after row. */
+  } arm_mat_csr_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q15 blocked-ELL matrix.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix, a multiple of blockSize. */
+    uint16_t numCols;     /**< number of columns of the matrix, a multiple of blockSize. */
+    uint16_t blockSize;   /**< size of the square blocks. */
+    uint16_t blockCols;   /**< number of blocks stored per block row. */
+    uint16_t *pColIdx;    /**< points to the block column of each block, ARM_MAT_BELL_PAD for padding. */
+    q15_t *pData;         /**< points to the blocks, each one stored by rows. */
+  } arm_mat_bell_instance_q15;
+
+  /**
+   * @brief  Q15 CSR matrix initialization.
+   * @param[in,out] S          points to an instance of the Q15 CSR matrix structure.
+   * @param[in]     nRows      number of rows in the matrix.
+   * @param[in]     nColumns   number of columns in the matrix.
+   * @param[in]     pRowStart  points to the row start indexes, nRows+1 values.
+   * @param[in]     pColIdx    points to the column indexes of the elements.
+   * @param[in]     pData      points to the elements.
+   */
+  void arm_mat_csr_init_q15(
+  arm_mat_csr_instance_q15 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t * pRowStart,
+  uint16_t * pColIdx,
+  q15_t * pData);
+
+  /**
+   * @brief  Q15 blocked-ELL matrix initialization.
+   * @param[in,out] S          points to an instance of the Q15 blocked-ELL matrix structure.
+   * @param[in]     nRows      number of rows in the matrix, a multiple of blockSize.
+   * @param[in]     nColumns   number of columns in the matrix, a multiple of blockSize.
+   * @param[in]     blockSize  size of the square blocks.
+   * @param[in]     blockCols  number of blocks stored per block row.
+   * @param[in]     pColIdx    points to the block column indexes, nRows/blockSize*blockCols values.
+   * @param[in]     pData      points to the blocks, nRows*blockSize*blockCols values.
+   */
+  void arm_mat_bell_init_q15(
+  arm_mat_bell_instance_q15 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t blockSize,
+  uint16_t blockCols,
+  uint16_t * pColIdx,
+  q15_t * pData);
+
+  /**
+   * @brief  Conversion of a Q15 dense matrix to CSR, dropping the small elements.
+   * @param[in]     pSrc         points to the dense matrix.
+   * @param[in]     threshold    elements with a magnitude at most threshold are dropped.
+   * @param[in]     maxNonZeros  number of elements that fit in the buffers of pDst.
+   * @param[in,out] pDst         points to the CSR matrix, initialized with its buffers.
+   * @return        ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_csr_from_dense_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  q15_t threshold,
+  uint32_t maxNonZeros,
+  arm_mat_csr_instance_q15 * pDst);
+
+  /**
+   * @brief  Conversion of a Q15 dense matrix to blocked-ELL, dropping the small blocks.
+   * @param[in]     pSrc         points to the dense matrix.
+   * @param[in]     threshold    elements with a magnitude at most threshold are dropped.
+   * @param[in]     maxBlocks    number of blocks that fit in the buffers of pDst.
+   * @param[in,out] pDst         points to the blocked-ELL matrix, initialized with its block size and buffers.
+   * @return        ARM_MATH_ARGUMENT_ERROR if the block size does not divide the dimensions,
+   *                ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_bell_from_dense_q15(
+  const arm_matrix_instance_q15 * pSrc,
+  q15_t threshold,
+  uint32_t maxBlocks,
+  arm_mat_bell_instance_q15 * pDst);
+
+  /**
+   * @brief  Q15 CSR matrix times dense vector.
+   * @param[in]  pSrc   points to the CSR matrix.
+   * @param[in]  pVec   points to the input vector, numCols values.
+   * @param[out] pDst   points to the output vector, numRows values.
+   */
+  void arm_mat_csr_vec_mult_q15(
+  const arm_mat_csr_instance_q15 * pSrc,
+  const q15_t * pVec,
+  q15_t * pDst);
+
+  /**
+   * @brief  Q15 blocked-ELL matrix times dense vector.
+   * @param[in]  pSrc   points to the blocked-ELL matrix.
+   * @param[in]  pVec   points to the input vector, numCols values.
+   * @param[out] pDst   points to the output vector, numRows values.
+   */
+  void arm_mat_bell_vec_mult_q15(
+  const arm_mat_bell_instance_q15 * pSrc,
+  const q15_t * pVec,
+  q15_t * pDst);
+
+  /**
+   * @brief  Q15 CSR matrix times dense matrix.
+   * @param[in]  pSrcA  points to the CSR matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix.
+   * @return     ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+  arm_status arm_mat_csr_mult_q15(
+  const arm_mat_csr_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief  Q15 blocked-ELL matrix times dense matrix.
+   * @param[in]  pSrcA  points to the blocked-ELL matrix.
+   * @param[in]  pSrcB  points to the dense matrix.
+   * @param[out] pDst   points to the dense output matrix.
+   * @return     ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS based on the outcome of size checking.
+   */
+  arm_status arm_mat_bell_mult_q15(
+  const arm_mat_bell_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst);
+
 
 
   /**
@@ -2133,6 +2798,70 @@ void arm_cfft_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  /**
+   * @brief Maximum number of radix stages of the floating-point mixed radix CFFT.
+   */
+#define ARM_CFFT_MIXED_RADIX_MAX_STAGES 16
+
+  arm_status arm_cfft_mixed_radix_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable);
+
+  /**
+   * @brief Memory arena receiving the FFT tables generated at run time.
+   */
+  typedef struct
+  {
+    uint8_t *pBase;                    /**< points to the arena buffer. */
+    uint32_t size;                     /**< size of the arena buffer in bytes. */
+    uint32_t used;                     /**< number of bytes already handed out. */
+  } arm_table_arena;
+
+  /**
+   * @brief Arena size in bytes needed by arm_cfft_table_init_f32() for a length <code>fftLen</code> CFFT,
+   * including 3 bytes for aligning an unaligned arena buffer.
+   */
+#define ARM_CFFT_TABLE_ARENA_SIZE_F32(fftLen)       (12U * (uint32_t) (fftLen) + 3U)
+
+  /**
+   * @brief Arena size in bytes needed by arm_rfft_fast_table_init_f32() for a length <code>fftLen</code> RFFT,
+   * including 3 bytes for aligning an unaligned arena buffer.
+   */
+#define ARM_RFFT_FAST_TABLE_ARENA_SIZE_F32(fftLen)  (10U * (uint32_t) (fftLen) + 3U)
+
+  void arm_table_arena_init(
+  arm_table_arena * A,
+  void * pBuffer,
+  uint32_t size);
+
+  void * arm_table_arena_alloc(
+  arm_table_arena * A,
+  uint32_t size);
+
+  arm_status arm_cfft_table_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  arm_table_arena * A);
+
+  /**
+   * @brief Memory layout of the channels processed by the batched FFT functions.
+   */
+  typedef enum
+  {
+    ARM_FFT_BATCH_PLANAR = 0,          /**< each channel is stored contiguously, one after the other. */
+    ARM_FFT_BATCH_INTERLEAVED = 1      /**< the samples of all the channels at one index are stored together. */
+  } arm_fft_batch_layout;
+
+  arm_status arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint16_t numChannels,
+  arm_fft_batch_layout layout,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2229,12 +2958,437 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+arm_status arm_rfft_fast_mixed_radix_init_f32(
+   arm_rfft_fast_instance_f32 * S,
+   uint16_t fftLen,
+   float32_t * pTwiddle,
+   float32_t * pTwiddleRFFT,
+   uint16_t * pBitRevTable);
+
+arm_status arm_rfft_fast_table_init_f32(
+   arm_rfft_fast_instance_f32 * S,
+   uint16_t fftLen,
+   arm_table_arena * A);
+
+arm_status arm_rfft_fast_batch_f32(
+  arm_rfft_fast_instance_f32 * S,
+  float32_t * p, float32_t * pOut,
+  uint16_t numChannels,
+  arm_fft_batch_layout layout,
+  uint8_t ifftFlag);
+
   /**
-   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
+   * @brief Windows generated by arm_window_f32().
+   */
+  typedef enum
+  {
+    ARM_WINDOW_RECTANGULAR = 0,        /**< no window. */
+    ARM_WINDOW_HANN = 1,               /**< Hann window. */
+    ARM_WINDOW_HAMMING = 2,            /**< Hamming window. */
+    ARM_WINDOW_BLACKMAN_HARRIS = 3,    /**< 4-term Blackman-Harris window, 92 dB sidelobes. */
+    ARM_WINDOW_FLAT_TOP = 4            /**< flat top window, for amplitude measurements. */
+  } arm_window_type;
+
+  /**
+   * @brief Periodic window for spectral analysis.
+   * @param[in]     type  window to generate.
+   * @param[out]    pDst  points to the window, len values.
+   * @param[in]     len   window length.
+   * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if type is not supported.
+   */
+  arm_status arm_window_f32(
+  arm_window_type type,
+  float32_t * pDst,
+  uint32_t len);
+
+  /**
+   * @brief Instance structure for the floating-point short-time Fourier transform.
    */
   typedef struct
   {
-    uint16_t N;                          /**< length of the DCT4. */
+    uint16_t fftLen;                   /**< frame length, also the real FFT length. */
+    uint16_t hopSize;                  /**< number of samples between the starts of two frames. */
+    uint16_t writeIndex;               /**< write position in the ring buffer, where the oldest sample is. */
+    uint16_t pending;                  /**< number of samples still needed before the next frame. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length fftLen. */
+    float32_t *pRing;                  /**< points to the ring buffer of the last fftLen input samples. */
+    float32_t *pWindow;                /**< points to the window, fftLen values. */
+    float32_t *pFrame;                 /**< points to the windowed frame, overwritten by the real FFT. */
+    float32_t windowSum;               /**< sum of the window values. */
+    float32_t windowPower;             /**< sum of the squared window values. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief Arena size in bytes needed by arm_stft_init_f32() for a frame length <code>fftLen</code>.
+   */
+#define ARM_STFT_ARENA_SIZE_F32(fftLen)   (ARM_RFFT_FAST_TABLE_ARENA_SIZE_F32(fftLen) + 12U * (uint32_t) (fftLen))
+
+  /**
+   * @brief Initialization function for the floating-point short-time Fourier transform.
+   * @param[out]    S        points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen   frame length, a length supported by arm_rfft_fast_table_init_f32().
+   * @param[in]     hopSize  number of samples between the starts of two frames, from 1 to fftLen.
+   * @param[in]     window   window applied to each frame.
+   * @param[in,out] A        points to the arena receiving the buffers, the window and the FFT tables.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_LENGTH_ERROR.
+   */
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  arm_table_arena * A);
+
+  /**
+   * @brief Stores input samples of the floating-point STFT until a frame is complete.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of samples used.
+   */
+  uint32_t arm_stft_push_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Computes the spectrum of the last frame of the floating-point STFT.
+   * @param[in,out] S     points to an instance of the floating-point STFT structure.
+   * @param[out]    pDst  points to the spectrum, fftLen values in the packed format of arm_rfft_fast_f32().
+   */
+  void arm_stft_frame_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pDst);
+
+  /**
+   * @brief Floating-point short-time Fourier transform of a block of samples.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[out]    pDst       points to the spectra of the frames completed by the block, fftLen values each.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of spectra written.
+   */
+  uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point Welch power spectral density estimator.
+   */
+  typedef struct
+  {
+    arm_stft_instance_f32 stft;        /**< frames and transforms of the input. */
+    float32_t alpha;                   /**< weight of a new frame in an exponential average, 0 for a linear average. */
+    uint32_t numFrames;                /**< number of frames averaged since the last reset. */
+    float32_t *pSpectrum;              /**< points to the real FFT output, fftLen values. */
+    float32_t *pAcc;                   /**< points to the averaged power of the fftLen/2+1 bins. */
+  } arm_welch_instance_f32;
+
+  /**
+   * @brief Arena size in bytes needed by arm_welch_init_f32() for a frame length <code>fftLen</code>.
+   */
+#define ARM_WELCH_ARENA_SIZE_F32(fftLen)  (ARM_STFT_ARENA_SIZE_F32(fftLen) + 6U * (uint32_t) (fftLen) + 4U)
+
+  /**
+   * @brief Initialization function for the floating-point Welch estimator.
+   * @param[out]    S        points to an instance of the floating-point Welch structure.
+   * @param[in]     fftLen   frame length, a length supported by arm_rfft_fast_table_init_f32().
+   * @param[in]     hopSize  number of samples between the starts of two frames.
+   * @param[in]     window   window applied to each frame.
+   * @param[in]     alpha    weight of a new frame in an exponential average, in (0, 1], or 0 for a linear average.
+   * @param[in,out] A        points to the arena receiving the buffers and the FFT tables.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_LENGTH_ERROR.
+   */
+  arm_status arm_welch_init_f32(
+  arm_welch_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  float32_t alpha,
+  arm_table_arena * A);
+
+  /**
+   * @brief Restarts the average of the floating-point Welch estimator.
+   * @param[in,out]     S  points to an instance of the floating-point Welch structure.
+   */
+  void arm_welch_reset_f32(
+  arm_welch_instance_f32 * S);
+
+  /**
+   * @brief Floating-point Welch estimator, processing of a block of samples.
+   * @param[in,out] S          points to an instance of the floating-point Welch structure.
+   * @param[in]     pSrc       points to the input samples.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of frames added to the average.
+   */
+  uint32_t arm_welch_f32(
+  arm_welch_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Power spectral density estimated by the floating-point Welch estimator.
+   * @param[in]     S     points to an instance of the floating-point Welch structure.
+   * @param[out]    pDst  points to the one-sided density, fftLen/2+1 values.
+   * @return        number of frames averaged, 0 if no frame has been completed since the last reset.
+   */
+  uint32_t arm_welch_get_f32(
+  const arm_welch_instance_f32 * S,
+  float32_t * pDst);
+
+  /**
+   * @brief Largest number of peaks followed by the peak tracker.
+   */
+#define ARM_PEAK_TRACKER_MAX_PEAKS 16
+
+  /**
+   * @brief Spectral peak followed by the peak tracker.
+   */
+  typedef struct
+  {
+    float32_t freq;                    /**< position of the peak in bins, interpolated between the bins. */
+    float32_t power;                   /**< interpolated power of the peak. */
+    uint16_t id;                       /**< number of the track, kept while the peak is followed. */
+    uint16_t age;                      /**< number of spectra in which the peak was found, saturated at 65535. */
+    uint16_t missed;                   /**< number of consecutive spectra in which the peak was not found. */
+  } arm_peak_track_f32;
+
+  /**
+   * @brief Instance structure for the floating-point spectral peak tracker.
+   */
+  typedef struct
+  {
+    uint16_t maxPeaks;                 /**< largest number of peaks followed. */
+    uint16_t numPeaks;                 /**< number of peaks followed. */
+    uint16_t maxMissed;                /**< number of spectra without the peak before it is dropped. */
+    uint16_t nextId;                   /**< number given to the next new track. */
+    float32_t threshold;               /**< smallest power of a peak. */
+    float32_t maxJump;                 /**< largest move of a peak between two spectra, in bins. */
+    float32_t alpha;                   /**< weight of the new position and power, 1 for no smoothing. */
+    arm_peak_track_f32 *pPeaks;        /**< points to the peaks, strongest first. */
+  } arm_peak_tracker_instance_f32;
+
+  /**
+   * @brief Initialization function for the floating-point spectral peak tracker.
+   * @param[out]    S          points to an instance of the floating-point peak tracker structure.
+   * @param[in]     maxPeaks   largest number of peaks followed, at most ARM_PEAK_TRACKER_MAX_PEAKS.
+   * @param[in]     pPeaks     points to the array of maxPeaks tracks.
+   * @param[in]     threshold  smallest power of a peak.
+   * @param[in]     maxJump    largest move of a peak between two spectra, in bins.
+   * @param[in]     maxMissed  number of consecutive spectra without the peak before it is dropped.
+   * @param[in]     alpha      weight of the new position and power of a peak, in (0, 1], 1 for no smoothing.
+   */
+  void arm_peak_tracker_init_f32(
+  arm_peak_tracker_instance_f32 * S,
+  uint16_t maxPeaks,
+  arm_peak_track_f32 * pPeaks,
+  float32_t threshold,
+  float32_t maxJump,
+  uint16_t maxMissed,
+  float32_t alpha);
+
+  /**
+   * @brief Updates the floating-point spectral peak tracker with a new spectrum.
+   * @param[in,out] S          points to an instance of the floating-point peak tracker structure.
+   * @param[in]     pSpectrum  points to the power spectrum.
+   * @param[in]     numBins    number of bins of the spectrum.
+   * @return        number of peaks followed.
+   */
+  uint32_t arm_peak_tracker_f32(
+  arm_peak_tracker_instance_f32 * S,
+  const float32_t * pSpectrum,
+  uint32_t numBins);
+
+  /**
+   * @brief Largest number of nonzero mel filter weights for a real FFT of length <code>fftLen</code>.
+   */
+#define ARM_MEL_MAX_WEIGHTS(fftLen)       ((uint32_t) (fftLen) + 2U)
+
+  uint32_t arm_mel_filterbank_f32(
+  uint16_t fftLen,
+  uint16_t numMel,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  uint16_t * pStart,
+  uint16_t * pLen,
+  float32_t * pWeights);
+
+  void arm_dct2_matrix_f32(
+  uint16_t numCoeffs,
+  uint16_t len,
+  float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point MFCC and log-mel feature extractor.
+   */
+  typedef struct
+  {
+    arm_stft_instance_f32 stft;        /**< frames and transforms of the input. */
+    uint16_t numMel;                   /**< number of mel filters. */
+    uint16_t numCoeffs;                /**< number of cepstral coefficients, 0 for log-mel energies. */
+    uint16_t *pMelStart;               /**< points to the first bin of each mel filter. */
+    uint16_t *pMelLen;                 /**< points to the number of bins of each mel filter. */
+    float32_t *pMelWeights;            /**< points to the nonzero weights of the filters, one after the other. */
+    float32_t *pDct;                   /**< points to the DCT-II matrix, numCoeffs rows of numMel values. */
+    float32_t *pSpectrum;              /**< points to the real FFT output, then the power of the bins. */
+    float32_t *pMel;                   /**< points to the log-mel energies of the current frame. */
+  } arm_mfcc_instance_f32;
+
+  /**
+   * @brief Arena size in bytes needed by arm_mfcc_init_f32().
+   */
+#define ARM_MFCC_ARENA_SIZE_F32(fftLen, numMel, numCoeffs)                              \
+  (ARM_STFT_ARENA_SIZE_F32(fftLen) + 8U * (uint32_t) (fftLen) + 8U * (uint32_t) (numMel) \
+   + 4U * (uint32_t) (numCoeffs) * (uint32_t) (numMel) + 26U)
+
+  arm_status arm_mfcc_init_f32(
+  arm_mfcc_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  uint16_t numMel,
+  uint16_t numCoeffs,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  arm_table_arena * A);
+
+  uint32_t arm_mfcc_f32(
+  arm_mfcc_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 MFCC and log-mel feature extractor.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< frame length, also the real FFT length. */
+    uint16_t hopSize;                  /**< number of samples between the starts of two frames. */
+    uint16_t writeIndex;               /**< write position in the ring buffer, where the oldest sample is. */
+    uint16_t pending;                  /**< number of samples still needed before the next frame. */
+    uint16_t numMel;                   /**< number of mel filters. */
+    uint16_t numCoeffs;                /**< number of cepstral coefficients, 0 for log-mel energies. */
+    uint8_t fracBits;                  /**< number of fractional bits of the features. */
+    arm_rfft_instance_q31 rfft;        /**< real FFT of length fftLen. */
+    q15_t *pRing;                      /**< points to the ring buffer of the last fftLen input samples. */
+    q15_t *pWindow;                    /**< points to the window, fftLen values. */
+    q31_t *pFrame;                     /**< points to the windowed frame, overwritten by the real FFT. */
+    q31_t *pSpectrum;                  /**< points to the real FFT output, 2*fftLen values, then the power of the bins. */
+    uint16_t *pMelStart;               /**< points to the first bin of each mel filter. */
+    uint16_t *pMelLen;                 /**< points to the number of bins of each mel filter. */
+    q15_t *pMelWeights;                /**< points to the nonzero weights of the filters, one after the other. */
+    q31_t *pDct;                       /**< points to the DCT-II matrix in 1.31 format, numCoeffs rows of numMel values. */
+    q31_t *pMel;                       /**< points to the log-mel energies of the current frame, 16 fractional bits. */
+    q31_t *pFeatures;                  /**< points to the features of the last frame, fracBits fractional bits, not saturated. */
+  } arm_mfcc_instance_q15;
+
+  /**
+   * @brief Arena size in bytes needed by arm_mfcc_init_q15(), including the memory only used during the initialization.
+   */
+#define ARM_MFCC_ARENA_SIZE_Q15(fftLen, numMel, numCoeffs)                              \
+  (18U * (uint32_t) (fftLen) + 12U * (uint32_t) (numMel)                                 \
+   + 4U * (uint32_t) (numCoeffs) * (uint32_t) (numMel)                                   \
+   + 4U * ((((uint32_t) (fftLen) + 2U) > ((uint32_t) (numCoeffs) * (uint32_t) (numMel))) \
+           ? ((uint32_t) (fftLen) + 2U) : ((uint32_t) (numCoeffs) * (uint32_t) (numMel))) + 37U)
+
+  arm_status arm_mfcc_init_q15(
+  arm_mfcc_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  uint16_t numMel,
+  uint16_t numCoeffs,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  uint8_t fracBits,
+  arm_table_arena * A);
+
+  uint32_t arm_mfcc_push_q15(
+  arm_mfcc_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
+
+  void arm_mfcc_frame_q15(
+  arm_mfcc_instance_q15 * S);
+
+  uint32_t arm_mfcc_q15(
+  arm_mfcc_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  uint32_t arm_mfcc_q7(
+  arm_mfcc_instance_q15 * S,
+  const q15_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Maximum number of partition sizes of the partitioned FIR filter.
+   */
+#define ARM_FIR_PARTITIONED_MAX_SEGMENTS 8
+
+  /**
+   * @brief Segment of the partitioned FIR filter: consecutive partitions of one size.
+   */
+  typedef struct
+  {
+    uint16_t blockSize;                /**< partition length of the segment. */
+    uint16_t numPartitions;            /**< number of partitions of the segment. */
+    uint16_t fdlIndex;                 /**< slot of the newest spectrum in the frequency-domain delay line. */
+    uint16_t outIndex;                 /**< read position in pOut. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*blockSize. */
+    float32_t *pCoeffSpec;             /**< points to the partition spectra, 2*blockSize values each. */
+    float32_t *pFdl;                   /**< points to the input spectra, 2*blockSize values each. */
+    float32_t *pOut;                   /**< points to the next blockSize output values of the segment. */
+  } arm_fir_partitioned_segment_f32;
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;                  /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;                /**< smallest partition length, the processing granularity. */
+    uint16_t numSegments;              /**< number of segments. */
+    uint16_t histMask;                 /**< length of the input history minus one. */
+    uint32_t histIndex;                /**< write position in the input history. */
+    float32_t *pHist;                  /**< points to the input history of twice the largest partition length. */
+    float32_t *pWork;                  /**< points to two work buffers of twice the largest partition length. */
+    arm_fir_partitioned_segment_f32 seg[ARM_FIR_PARTITIONED_MAX_SEGMENTS]; /**< segments, smallest partitions first. */
+  } arm_fir_partitioned_instance_f32;
+
+  uint32_t arm_fir_partitioned_arena_size_f32(
+  uint16_t numTaps,
+  uint16_t blockSize,
+  uint16_t maxBlockSize);
+
+  arm_status arm_fir_partitioned_init_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  uint16_t blockSize,
+  uint16_t maxBlockSize,
+  arm_table_arena * A);
+
+  void arm_fir_partitioned_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
+   */
+  typedef struct
+  {
+    uint16_t N;                          /**< length of the DCT4. */
     uint16_t Nby2;                       /**< half of the length of the DCT4. */
     float32_t normalize;                 /**< normalizing factor. */
     float32_t *pTwiddle;                 /**< points to the twiddle factor table. */
@@ -2887,6 +4041,396 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief  Sorts a floating-point vector in ascending order.
+   * @param[in,out] *pSrcDst    points to the vector to sort.
+   * @param[in]     *pScratch   points to a scratch buffer of blockSize elements.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @return none.
+   */
+  void arm_sort_f32(
+  float32_t * pSrcDst,
+  float32_t * pScratch,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Sorts a Q31 vector in ascending order.
+   * @param[in,out] *pSrcDst    points to the vector to sort.
+   * @param[in]     *pScratch   points to a scratch buffer of blockSize elements.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @return none.
+   */
+  void arm_sort_q31(
+  q31_t * pSrcDst,
+  q31_t * pScratch,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Sorts a Q15 vector in ascending order.
+   * @param[in,out] *pSrcDst    points to the vector to sort.
+   * @param[in]     *pScratch   points to a scratch buffer of blockSize elements.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @return none.
+   */
+  void arm_sort_q15(
+  q15_t * pSrcDst,
+  q15_t * pScratch,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts a Q7 vector in ascending order.
+   * @param[in,out] *pSrcDst    points to the vector to sort.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @return none.
+   */
+  void arm_sort_q7(
+  q7_t * pSrcDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Indices that sort a floating-point vector in ascending order.
+   * @param[in]  *pSrc       points to the vector.
+   * @param[out] *pIndex     points to the blockSize output indices.
+   * @param[in]  *pScratch   points to a scratch buffer of blockSize indices.
+   * @param[in]  blockSize   number of elements in the vector.
+   * @return none.
+   */
+  void arm_argsort_f32(
+  const float32_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Selects the n-th smallest element of a floating-point vector.
+   * @param[in,out] *pSrcDst    points to the vector, which is rearranged.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @param[in]     n           rank of the element, from 0 for the smallest.
+   * @return the n-th smallest element.
+   */
+  float32_t arm_nth_element_f32(
+  float32_t * pSrcDst,
+  uint32_t blockSize,
+  uint32_t n);
+
+
+  /**
+   * @brief  Selects the n-th smallest element of a Q31 vector.
+   * @param[in,out] *pSrcDst    points to the vector, which is rearranged.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @param[in]     n           rank of the element, from 0 for the smallest.
+   * @return the n-th smallest element.
+   */
+  q31_t arm_nth_element_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize,
+  uint32_t n);
+
+
+  /**
+   * @brief  Selects the n-th smallest element of a Q15 vector.
+   * @param[in,out] *pSrcDst    points to the vector, which is rearranged.
+   * @param[in]     blockSize   number of elements in the vector.
+   * @param[in]     n           rank of the element, from 0 for the smallest.
+   * @return the n-th smallest element.
+   */
+  q15_t arm_nth_element_q15(
+  q15_t * pSrcDst,
+  uint32_t blockSize,
+  uint32_t n);
+
+
+  /**
+   * @brief Instance structure for the floating-point top-k selection.
+   */
+  typedef struct
+  {
+    uint16_t k;              /**< number of largest elements to keep. */
+    uint16_t numValues;      /**< number of elements kept so far. */
+    uint32_t offset;         /**< index of the next element. */
+    float32_t *pValues;      /**< points to the heap of values. */
+    uint32_t *pIndex;        /**< points to the heap of indices. */
+  } arm_topk_instance_f32;
+
+
+  /**
+   * @brief Instance structure for the Q31 top-k selection.
+   */
+  typedef struct
+  {
+    uint16_t k;              /**< number of largest elements to keep. */
+    uint16_t numValues;      /**< number of elements kept so far. */
+    uint32_t offset;         /**< index of the next element. */
+    q31_t *pValues;          /**< points to the heap of values. */
+    uint32_t *pIndex;        /**< points to the heap of indices. */
+  } arm_topk_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the Q15 top-k selection.
+   */
+  typedef struct
+  {
+    uint16_t k;              /**< number of largest elements to keep. */
+    uint16_t numValues;      /**< number of elements kept so far. */
+    uint32_t offset;         /**< index of the next element. */
+    q15_t *pValues;          /**< points to the heap of values. */
+    uint32_t *pIndex;        /**< points to the heap of indices. */
+  } arm_topk_instance_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point top-k selection.
+   * @param[in,out] *S         points to an instance of the floating-point top-k structure.
+   * @param[in]     k          number of largest elements to keep.
+   * @param[in]     *pValues   points to a buffer of k values.
+   * @param[in]     *pIndex    points to a buffer of k indices.
+   * @return none.
+   */
+  void arm_topk_init_f32(
+  arm_topk_instance_f32 * S,
+  uint16_t k,
+  float32_t * pValues,
+  uint32_t * pIndex);
+
+
+  /**
+   * @brief  Adds a block of elements to the floating-point top-k selection.
+   * @param[in,out] *S          points to an instance of the floating-point top-k structure.
+   * @param[in]     *pSrc       points to the block of elements.
+   * @param[in]     blockSize   number of elements in the block.
+   * @return none.
+   */
+  void arm_topk_update_f32(
+  arm_topk_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Largest elements of the floating-point top-k selection, in descending order.
+   * @param[in]  *S           points to an instance of the floating-point top-k structure.
+   * @param[out] *pDst        points to the output values, k elements.
+   * @param[out] *pDstIndex   points to the output indices, k elements.
+   * @return number of elements written.
+   */
+  uint32_t arm_topk_get_f32(
+  const arm_topk_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t * pDstIndex);
+
+
+  /**
+   * @brief  Initialization function for the Q31 top-k selection.
+   * @param[in,out] *S         points to an instance of the Q31 top-k structure.
+   * @param[in]     k          number of largest elements to keep.
+   * @param[in]     *pValues   points to a buffer of k values.
+   * @param[in]     *pIndex    points to a buffer of k indices.
+   * @return none.
+   */
+  void arm_topk_init_q31(
+  arm_topk_instance_q31 * S,
+  uint16_t k,
+  q31_t * pValues,
+  uint32_t * pIndex);
+
+
+  /**
+   * @brief  Adds a block of elements to the Q31 top-k selection.
+   * @param[in,out] *S          points to an instance of the Q31 top-k structure.
+   * @param[in]     *pSrc       points to the block of elements.
+   * @param[in]     blockSize   number of elements in the block.
+   * @return none.
+   */
+  void arm_topk_update_q31(
+  arm_topk_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Largest elements of the Q31 top-k selection, in descending order.
+   * @param[in]  *S           points to an instance of the Q31 top-k structure.
+   * @param[out] *pDst        points to the output values, k elements.
+   * @param[out] *pDstIndex   points to the output indices, k elements.
+   * @return number of elements written.
+   */
+  uint32_t arm_topk_get_q31(
+  const arm_topk_instance_q31 * S,
+  q31_t * pDst,
+  uint32_t * pDstIndex);
+
+
+  /**
+   * @brief  Initialization function for the Q15 top-k selection.
+   * @param[in,out] *S         points to an instance of the Q15 top-k structure.
+   * @param[in]     k          number of largest elements to keep.
+   * @param[in]     *pValues   points to a buffer of k values.
+   * @param[in]     *pIndex    points to a buffer of k indices.
+   * @return none.
+   */
+  void arm_topk_init_q15(
+  arm_topk_instance_q15 * S,
+  uint16_t k,
+  q15_t * pValues,
+  uint32_t * pIndex);
+
+
+  /**
+   * @brief  Adds a block of elements to the Q15 top-k selection.
+   * @param[in,out] *S          points to an instance of the Q15 top-k structure.
+   * @param[in]     *pSrc       points to the block of elements.
+   * @param[in]     blockSize   number of elements in the block.
+   * @return none.
+   */
+  void arm_topk_update_q15(
+  arm_topk_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Largest elements of the Q15 top-k selection, in descending order.
+   * @param[in]  *S           points to an instance of the Q15 top-k structure.
+   * @param[out] *pDst        points to the output values, k elements.
+   * @param[out] *pDstIndex   points to the output indices, k elements.
+   * @return number of elements written.
+   */
+  uint32_t arm_topk_get_q15(
+  const arm_topk_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t * pDstIndex);
+
+
+  /**
+   * @brief Instance structure for the floating-point running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;     /**< number of samples in the window. */
+    uint16_t oldest;         /**< state index of the oldest sample. */
+    float32_t *pState;       /**< points to the state buffer of windowSize samples. */
+    uint16_t *pHeap;         /**< points to the heap buffer of 2*windowSize indices. */
+  } arm_median_instance_f32;
+
+
+  /**
+   * @brief Instance structure for the Q31 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;     /**< number of samples in the window. */
+    uint16_t oldest;         /**< state index of the oldest sample. */
+    q31_t *pState;           /**< points to the state buffer of windowSize samples. */
+    uint16_t *pHeap;         /**< points to the heap buffer of 2*windowSize indices. */
+  } arm_median_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the Q15 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;     /**< number of samples in the window. */
+    uint16_t oldest;         /**< state index of the oldest sample. */
+    q15_t *pState;           /**< points to the state buffer of windowSize samples. */
+    uint16_t *pHeap;         /**< points to the heap buffer of 2*windowSize indices. */
+  } arm_median_instance_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point running median filter.
+   * @param[in,out] *S            points to an instance of the floating-point running median structure.
+   * @param[in]     windowSize    number of samples in the window.
+   * @param[in]     *pState       points to the state buffer of windowSize samples.
+   * @param[in]     *pHeap        points to the heap buffer of 2*windowSize indices.
+   * @return none.
+   */
+  void arm_median_init_f32(
+  arm_median_instance_f32 * S,
+  uint16_t windowSize,
+  float32_t * pState,
+  uint16_t * pHeap);
+
+
+  /**
+   * @brief  Processing function for the floating-point running median filter.
+   * @param[in,out] *S          points to an instance of the floating-point running median structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+  void arm_median_f32(
+  arm_median_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 running median filter.
+   * @param[in,out] *S            points to an instance of the Q31 running median structure.
+   * @param[in]     windowSize    number of samples in the window.
+   * @param[in]     *pState       points to the state buffer of windowSize samples.
+   * @param[in]     *pHeap        points to the heap buffer of 2*windowSize indices.
+   * @return none.
+   */
+  void arm_median_init_q31(
+  arm_median_instance_q31 * S,
+  uint16_t windowSize,
+  q31_t * pState,
+  uint16_t * pHeap);
+
+
+  /**
+   * @brief  Processing function for the Q31 running median filter.
+   * @param[in,out] *S          points to an instance of the Q31 running median structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+  void arm_median_q31(
+  arm_median_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 running median filter.
+   * @param[in,out] *S            points to an instance of the Q15 running median structure.
+   * @param[in]     windowSize    number of samples in the window.
+   * @param[in]     *pState       points to the state buffer of windowSize samples.
+   * @param[in]     *pHeap        points to the heap buffer of 2*windowSize indices.
+   * @return none.
+   */
+  void arm_median_init_q15(
+  arm_median_instance_q15 * S,
+  uint16_t windowSize,
+  q15_t * pState,
+  uint16_t * pHeap);
+
+
+  /**
+   * @brief  Processing function for the Q15 running median filter.
+   * @param[in,out] *S          points to an instance of the Q15 running median structure.
+   * @param[in]     *pSrc       points to the block of input data.
+   * @param[out]    *pDst       points to the block of output data.
+   * @param[in]     blockSize   number of samples to process.
+   * @return none.
+   */
+  void arm_median_q15(
+  arm_median_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
 /**
  * @brief Convolution of floating-point sequences.
  * @param[in]  pSrcA    points to the first input sequence.
@@ -3313,16 +4857,65 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief Processing function for the Q15 FIR decimator.
-   * @param[in]  S          points to an instance of the Q15 FIR decimator structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of input samples to process per call.
+   * @brief Instance structure for the floating-point FIR decimator with a circular state buffer.
    */
-  void arm_fir_decimate_q15(
-  const arm_fir_decimate_instance_q15 * S,
-  q15_t * pSrc,
-  q15_t * pDst,
+  typedef struct
+  {
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    uint16_t stateIndex;        /**< state buffer index. Points to the oldest sample in the state buffer. */
+    uint16_t stateLen;          /**< length of the circular buffer, numTaps+blockSize-1. */
+    float32_t *pCoeffs;         /**< points to the coefficient array. The array is of length numTaps.*/
+    float32_t *pState;          /**< points to the state variable array. The array is of length 2*stateLen. */
+  } arm_fir_decimate_circ_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point FIR decimator with a circular state buffer.
+   * @param[in,out] S          points to an instance of the floating-point FIR decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data
+   * @param[in]     blockSize  number of input samples to process per call, a multiple of M and at most
+   * the block size given at initialization.
+   */
+  void arm_fir_decimate_circ_f32(
+  arm_fir_decimate_circ_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR decimator with a circular state buffer.
+   * @param[in,out] S          points to an instance of the floating-point FIR decimator structure.
+   * @param[in]     numTaps    number of coefficients in the filter.
+   * @param[in]     M          decimation factor.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer, 2*(numTaps+blockSize-1) values.
+   * @param[in]     blockSize  maximum number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code> or <code>numTaps+blockSize-1</code> is above 65535.
+   */
+  arm_status arm_fir_decimate_circ_init_f32(
+  arm_fir_decimate_circ_instance_f32 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 FIR decimator.
+   * @param[in]  S          points to an instance of the Q15 FIR decimator structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of input samples to process per call.
+   */
+  void arm_fir_decimate_q15(
+  const arm_fir_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
@@ -3543,6 +5136,450 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point FIR interpolator with a circular state buffer.
+   */
+  typedef struct
+  {
+    uint8_t L;                     /**< upsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t stateIndex;           /**< state buffer index. Points to the oldest sample in the state buffer. */
+    uint16_t stateLen;             /**< length of the circular buffer, phaseLength+blockSize-1. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length 2*stateLen. */
+  } arm_fir_interpolate_circ_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point FIR interpolator with a circular state buffer.
+   * @param[in,out] S          points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call, at most the block size
+   * given at initialization.
+   */
+  void arm_fir_interpolate_circ_f32(
+  arm_fir_interpolate_circ_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR interpolator with a circular state buffer.
+   * @param[in,out] S          points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer, 2*(numTaps/L+blockSize-1) values.
+   * @param[in]     blockSize  maximum number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code> or
+   * <code>numTaps/L+blockSize-1</code> is above 65535.
+   */
+  arm_status arm_fir_interpolate_circ_init_f32(
+  arm_fir_interpolate_circ_instance_f32 * S,
+  uint8_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 rational FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase component of the next output sample. */
+    uint32_t index;                 /**< input sample of the next output sample, counted from the next block. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 rational FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase component of the next output sample. */
+    uint32_t index;                 /**< input sample of the next output sample, counted from the next block. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point rational FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< upsample factor. */
+    uint16_t M;                     /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< polyphase component of the next output sample. */
+    uint32_t index;                 /**< input sample of the next output sample, counted from the next block. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 fractional FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t numPhases;             /**< number of polyphase filter components. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t step;                  /**< input samples per output sample in unsigned 8.24 format. */
+    uint32_t frac;                  /**< fractional position of the next output sample in unsigned 0.24 format. */
+    int32_t index;                  /**< input sample of the next output sample, counted from the next block. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length numPhases*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength. */
+  } arm_fir_resample_frac_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 fractional FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t numPhases;             /**< number of polyphase filter components. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t step;                  /**< input samples per output sample in unsigned 8.24 format. */
+    uint32_t frac;                  /**< fractional position of the next output sample in unsigned 0.24 format. */
+    int32_t index;                  /**< input sample of the next output sample, counted from the next block. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length numPhases*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength. */
+  } arm_fir_resample_frac_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point fractional FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t numPhases;             /**< number of polyphase filter components. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t step;                  /**< input samples per output sample in unsigned 8.24 format. */
+    uint32_t frac;                  /**< fractional position of the next output sample in unsigned 0.24 format. */
+    int32_t index;                  /**< input sample of the next output sample, counted from the next block. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length numPhases*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength. */
+  } arm_fir_resample_frac_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 rational FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 rational FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 rational FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 rational FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not
+   * a multiple of the upsample factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 fractional FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 fractional FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_frac_q15(
+  arm_fir_resample_frac_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 fractional FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 fractional FIR resampler structure.
+   * @param[in]     numPhases  number of polyphase filter components.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @param[in]     step       input samples per output sample in unsigned 8.24 format.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>numPhases</code> or <code>step</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length
+   * <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+   */
+  arm_status arm_fir_resample_frac_init_q15(
+  arm_fir_resample_frac_instance_q15 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize,
+  uint32_t step);
+
+
+  /**
+   * @brief Processing function for the Q31 rational FIR resampler.
+   * @param[in,out] S          points to an instance of the Q31 rational FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 rational FIR resampler.
+   * @param[in,out] S          points to an instance of the Q31 rational FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not
+   * a multiple of the upsample factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 fractional FIR resampler.
+   * @param[in,out] S          points to an instance of the Q31 fractional FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_frac_q31(
+  arm_fir_resample_frac_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 fractional FIR resampler.
+   * @param[in,out] S          points to an instance of the Q31 fractional FIR resampler structure.
+   * @param[in]     numPhases  number of polyphase filter components.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @param[in]     step       input samples per output sample in unsigned 8.24 format.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>numPhases</code> or <code>step</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length
+   * <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+   */
+  arm_status arm_fir_resample_frac_init_q31(
+  arm_fir_resample_frac_instance_q31 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize,
+  uint32_t step);
+
+
+  /**
+   * @brief Processing function for the floating-point rational FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point rational FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point rational FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point rational FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>L</code> or <code>M</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length <code>numTaps</code> is not
+   * a multiple of the upsample factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point fractional FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point fractional FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_fir_resample_frac_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point fractional FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point fractional FIR resampler structure.
+   * @param[in]     numPhases  number of polyphase filter components.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @param[in]     step       input samples per output sample in unsigned 8.24 format.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+   * <code>numPhases</code> or <code>step</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length
+   * <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+   */
+  arm_status arm_fir_resample_frac_init_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize,
+  uint32_t step);
+
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;             /**< number of state variables n. */
+    uint16_t numMeas;               /**< number of measurements m. */
+    float32_t *pX;                  /**< points to the state vector of length n. */
+    float32_t *pP;                  /**< points to the n x n state covariance matrix. */
+    float32_t *pF;                  /**< points to the n x n state transition matrix, or its Jacobian for an extended filter. */
+    float32_t *pQ;                  /**< points to the n x n process noise covariance matrix. */
+    float32_t *pH;                  /**< points to the m x n measurement matrix, or its Jacobian for an extended filter. */
+    float32_t *pR;                  /**< points to the m x m measurement noise covariance matrix. */
+    float32_t *pWork;               /**< points to the workspace. The array is of length 2*n*n+2*n*m+m*m. */
+  } arm_kalman_instance_f32;
+
+
+  /**
+   * @brief Prediction step of the floating-point Kalman filter.
+   * @param[in,out] S       points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pXPred  points to the predicted state f(x) of an extended filter, or NULL to compute F * x.
+   */
+  void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pXPred);
+
+
+  /**
+   * @brief Measurement update of the floating-point Kalman filter.
+   * @param[in,out] S    points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pZ   points to the measurement vector of length m.
+   * @param[in]     pHx  points to the predicted measurement h(x) of an extended filter, or NULL to compute H * x.
+   * @return The function returns ARM_MATH_DECOMPOSITION_FAILURE if the innovation covariance is not positive definite.
+   */
+  arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ,
+  float32_t * pHx);
+
+
+  /**
+   * @brief Sequential scalar measurement update of the floating-point Kalman filter.
+   * @param[in,out] S    points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     pZ   points to the measurement vector of length m.
+   * @param[in]     pHx  points to the predicted measurement h(x) of an extended filter, or NULL to compute H * x.
+   * @return The function returns ARM_MATH_DECOMPOSITION_FAILURE if an innovation variance is not positive.
+   */
+  arm_status arm_kalman_update_sequential_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ,
+  float32_t * pHx);
+
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] S          points to an instance of the floating-point Kalman filter structure.
+   * @param[in]     numStates  number of state variables n.
+   * @param[in]     numMeas    number of measurements m.
+   * @param[in]     pX         points to the initial state vector.
+   * @param[in]     pP         points to the initial state covariance matrix.
+   * @param[in]     pF         points to the state transition matrix.
+   * @param[in]     pQ         points to the process noise covariance matrix.
+   * @param[in]     pH         points to the measurement matrix.
+   * @param[in]     pR         points to the measurement noise covariance matrix.
+   * @param[in]     pWork      points to a workspace of 2*n*n+2*n*m+m*m values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numStates</code> or <code>numMeas</code> is zero.
+   */
+  arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pWork);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3613,6 +5650,51 @@ void arm_rfft_fast_f32(
     float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
   } arm_biquad_cascade_df2T_instance_f64;
 
+  /**
+   * @brief Instance structure for the Q31 transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;             /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;             /**< points to the array of state coefficients in 2.30 format.  The array is of length 2*numStages. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;          /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_df2T_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages*numChannels. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    q31_t *pState;             /**< points to the array of state coefficients in 2.30 format.  The array is of length 2*numStages*numChannels. */
+    q15_t *pCoeffs;            /**< points to the array of coefficients.  The array is of length 6*numStages*numChannels. */
+    int8_t postShift;          /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cascade_mc_df2T_instance_q15;
+
 
   /**
    * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
@@ -3685,17 +5767,139 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_df2T_init_f64(
+  arm_biquad_cascade_df2T_instance_f64 * S,
+  uint8_t numStages,
+  float64_t * pCoeffs,
+  float64_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  Shift to be applied after the accumulator.  Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_df2T_init_q31(
+  arm_biquad_cascade_df2T_instance_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_df2T_init_q15(
+  arm_biquad_cascade_df2T_instance_q15 * S,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data
+   * @param[in]  blockSize  number of samples to process in each channel.
+   */
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df2T_init_f32(
+  arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q15 multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data
+   * @param[in]  blockSize  number of samples to process in each channel.
    */
-  void arm_biquad_cascade_df2T_init_f64(
-  arm_biquad_cascade_df2T_instance_f64 * S,
+  void arm_biquad_cascade_mc_df2T_q15(
+  const arm_biquad_cascade_mc_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_mc_df2T_init_q15(
+  arm_biquad_cascade_mc_df2T_instance_q15 * S,
   uint8_t numStages,
-  float64_t * pCoeffs,
-  float64_t * pState);
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
 
 
   /**
@@ -4250,6 +6454,84 @@ void arm_rfft_fast_f32(
   uint32_t blockSize,
   uint8_t postShift);
 
+  /**
+   * @brief Instance structure for the floating-point frequency-domain adaptive filter.
+   */
+  typedef struct
+  {
+    uint16_t blockLen;                 /**< block length, half of the FFT length. */
+    uint16_t numPartitions;            /**< number of partitions, the filter has blockLen*numPartitions taps. */
+    uint16_t head;                     /**< slot of the newest input spectrum in pX. */
+    uint16_t constrainIndex;           /**< partition whose weights are constrained after the next block. */
+    uint16_t fill;                     /**< number of samples gathered for the next block by arm_fdaf_f32(). */
+    float32_t mu;                      /**< step size, from 0 to 1. */
+    float32_t alpha;                   /**< forgetting factor of the input power of each bin. */
+    float32_t delta;                   /**< floor of the input power per sample, avoids large steps on silence. */
+    arm_rfft_fast_instance_f32 rfft;   /**< real FFT of length 2*blockLen. */
+    float32_t *pX;                     /**< points to the spectra of the last numPartitions input blocks, 2*blockLen values each. */
+    float32_t *pW;                     /**< points to the weight spectra of the partitions, 2*blockLen values each. */
+    float32_t *pPower;                 /**< points to the input power of the blockLen+1 bins. */
+    float32_t *pIn;                    /**< points to the last two input blocks, 2*blockLen values. */
+    float32_t *pE;                     /**< points to the error spectrum, 2*blockLen values. */
+    float32_t *pWork;                  /**< points to a working buffer of 2*blockLen values. */
+    float32_t *pBlock;                 /**< points to the input, reference, output and error blocks of arm_fdaf_f32(), blockLen values each. */
+  } arm_fdaf_instance_f32;
+
+  /**
+   * @brief Arena size in bytes needed by arm_fdaf_init_f32().
+   */
+#define ARM_FDAF_ARENA_SIZE_F32(blockLen, numPartitions) \
+  (ARM_RFFT_FAST_TABLE_ARENA_SIZE_F32(2U * (uint32_t) (blockLen)) + \
+   (16U * (uint32_t) (numPartitions) + 44U) * (uint32_t) (blockLen) + 4U)
+
+  /**
+   * @brief Initialization function for the floating-point frequency-domain adaptive filter.
+   * @param[out]    S              points to an instance of the floating-point frequency-domain adaptive filter structure.
+   * @param[in]     blockLen       block length, half of a length supported by arm_rfft_fast_table_init_f32().
+   * @param[in]     numPartitions  number of partitions of blockLen taps.
+   * @param[in]     mu             step size, from 0 to 1.
+   * @param[in,out] A              points to the arena receiving the buffers and the FFT tables.
+   * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_LENGTH_ERROR.
+   */
+  arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t blockLen,
+  uint16_t numPartitions,
+  float32_t mu,
+  arm_table_arena * A);
+
+  /**
+   * @brief Processing function for one block of the floating-point frequency-domain adaptive filter.
+   * @param[in,out] S      points to an instance of the floating-point frequency-domain adaptive filter structure.
+   * @param[in]     pSrc   points to the blockLen input samples.
+   * @param[in]     pRef   points to the blockLen reference samples.
+   * @param[out]    pOut   points to the blockLen output samples.
+   * @param[out]    pErr   points to the blockLen error samples.
+   */
+  void arm_fdaf_block_f32(
+  arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr);
+
+  /**
+   * @brief Processing function for the floating-point frequency-domain adaptive filter.
+   * @param[in,out] S          points to an instance of the floating-point frequency-domain adaptive filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     pRef       points to the block of reference data.
+   * @param[out]    pOut       points to the block of output data, delayed by blockLen samples.
+   * @param[out]    pErr       points to the block of error data, delayed by blockLen samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize);
+
 
   /**
    * @brief Correlation of floating-point sequences.
@@ -4606,6 +6888,34 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point numerically controlled oscillator.
+   */
+  typedef struct
+  {
+    uint32_t phase;          /**< phase accumulator, a full turn is 2^32. */
+    uint32_t phaseInc;       /**< phase increment per sample (frequency word), a full turn is 2^32. */
+  } arm_nco_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 numerically controlled oscillator.
+   */
+  typedef struct
+  {
+    uint32_t phase;          /**< phase accumulator, a full turn is 2^32. */
+    uint32_t phaseInc;       /**< phase increment per sample (frequency word), a full turn is 2^32. */
+  } arm_nco_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 numerically controlled oscillator.
+   */
+  typedef struct
+  {
+    uint32_t phase;          /**< phase accumulator, a full turn is 2^32. */
+    uint32_t phaseInc;       /**< phase increment per sample (frequency word), a full turn is 2^32. */
+  } arm_nco_instance_q15;
+
+
   /**
    * @brief  Floating-point sin_cos function.
    * @param[in]  theta   input value in degrees
@@ -4630,6 +6940,320 @@ void arm_rfft_fast_f32(
   q31_t * pCosVal);
 
 
+  /**
+   * @brief  Floating-point sine and cosine from the sine table, used by arm_sin_cos_f32() and the NCO.
+   * @param[in]  pTable   points to the table <code>sinTable_f32</code>.
+   * @param[in]  indexS   index of the table value below the angle, less than <code>FAST_MATH_TABLE_SIZE</code>.
+   * @param[in]  fract    position of the angle between the two table values, in [0 1).
+   * @param[out] pSinVal  points to the sine output.
+   * @param[out] pCosVal  points to the cosine output.
+   *
+   * \par
+   * The table values are interpolated with a cubic Hermite polynomial, whose slopes are read from the
+   * same table a quarter of a turn away.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_sin_cos_hermite_f32(
+  const float32_t * pTable,
+  uint32_t indexS,
+  float32_t fract,
+  float32_t * pSinVal,
+  float32_t * pCosVal)
+  {
+    uint32_t indexC = (indexS + (FAST_MATH_TABLE_SIZE / 4)) & 0x1ff;
+    float32_t f1, f2, d1, d2;                      /* Two nearest output values and slopes */
+    float32_t Dn, Df, temp;
+
+    /* Read two nearest values of input value from the cos & sin tables */
+    f1 = pTable[indexC+0];
+    f2 = pTable[indexC+1];
+    d1 = -pTable[indexS+0];
+    d2 = -pTable[indexS+1];
+
+    Dn = 0.0122718463030f; // delta between the two points (fixed), in this case 2*pi/FAST_MATH_TABLE_SIZE
+    Df = f2 - f1;          // delta between the values of the functions
+
+    temp = Dn *(d1 + d2) - 2 * Df;
+    temp = fract * temp + (3 * Df - (d2 + 2 * d1) * Dn);
+    temp = fract * temp + d1 * Dn;
+
+    /* Calculation of cosine value */
+    *pCosVal = fract * temp + f1;
+
+    /* Read two nearest values of input value from the cos & sin tables */
+    f1 = pTable[indexS+0];
+    f2 = pTable[indexS+1];
+    d1 = pTable[indexC+0];
+    d2 = pTable[indexC+1];
+
+    Df = f2 - f1; // delta between the values of the functions
+    temp = Dn*(d1 + d2) - 2*Df;
+    temp = fract*temp + (3*Df - (d2 + 2*d1)*Dn);
+    temp = fract*temp + d1*Dn;
+
+    /* Calculation of sine value */
+    *pSinVal = fract*temp + f1;
+  }
+
+
+  /**
+   * @brief  Q31 sine and cosine from the sine table, used by arm_sin_cos_q31() and the NCO.
+   * @param[in]  pTable   points to the table <code>sinTable_q31</code>.
+   * @param[in]  indexS   index of the table value below the angle, less than <code>FAST_MATH_TABLE_SIZE</code>.
+   * @param[in]  fract    position of the angle between the two table values, in 1.31 format.
+   * @param[out] pSinVal  points to the sine output.
+   * @param[out] pCosVal  points to the cosine output.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_sin_cos_hermite_q31(
+  const q31_t * pTable,
+  uint32_t indexS,
+  q31_t fract,
+  q31_t * pSinVal,
+  q31_t * pCosVal)
+  {
+    uint32_t indexC = (indexS + 128) & 0x1ff;
+    q31_t f1, f2;                                  /* Two nearest output values */
+    q63_t d1, d2;                                  /* Slopes, -sinTable_q31[384] does not fit in Q31 */
+    q31_t Dn, Df;
+    q63_t temp;
+
+    /* Read two nearest values of input value from the cos & sin tables */
+    f1 = pTable[indexC+0];
+    f2 = pTable[indexC+1];
+    d1 = -(q63_t)pTable[indexS+0];
+    d2 = -(q63_t)pTable[indexS+1];
+
+    Dn = 0x1921FB5; // delta between the two points (fixed), in this case 2*pi/FAST_MATH_TABLE_SIZE
+    Df = f2 - f1; // delta between the values of the functions
+    temp = Dn*((q63_t)d1 + d2);
+    temp = temp - ((q63_t)Df << 32);
+    temp = (q63_t)fract*(temp >> 31);
+    temp = temp + ((3*(q63_t)Df << 31) - (d2 + ((q63_t)d1 << 1))*Dn);
+    temp = (q63_t)fract*(temp >> 31);
+    temp = temp + (q63_t)d1*Dn;
+    temp = (q63_t)fract*(temp >> 31);
+
+    /* Calculation of cosine value */
+    *pCosVal = clip_q63_to_q31((temp >> 31) + (q63_t)f1);
+
+    /* Read two nearest values of input value from the cos & sin tables */
+    f1 = pTable[indexS+0];
+    f2 = pTable[indexS+1];
+    d1 = pTable[indexC+0];
+    d2 = pTable[indexC+1];
+
+    Df = f2 - f1; // delta between the values of the functions
+    temp = Dn*((q63_t)d1 + d2);
+    temp = temp - ((q63_t)Df << 32);
+    temp = (q63_t)fract*(temp >> 31);
+    temp = temp + ((3*(q63_t)Df << 31) - (d2 + ((q63_t)d1 << 1))*Dn);
+    temp = (q63_t)fract*(temp >> 31);
+    temp = temp + (q63_t)d1*Dn;
+    temp = (q63_t)fract*(temp >> 31);
+
+    /* Calculation of sine value */
+    *pSinVal = clip_q63_to_q31((temp >> 31) + (q63_t)f1);
+  }
+
+
+  /**
+   * @brief  Q15 sine and cosine of a phase from the sine table, used by arm_vsin_cos_q15() and the NCO.
+   * @param[in]  pTable   points to the table <code>sinTable_q15</code>.
+   * @param[in]  phase    angle, a full turn is 2^32.
+   * @param[out] pSinVal  points to the sine output.
+   * @param[out] pCosVal  points to the cosine output.
+   *
+   * \par
+   * The table values are interpolated linearly with a 16-bit fraction and the result is rounded.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_sin_cos_linear_q15(
+  const q15_t * pTable,
+  uint32_t phase,
+  q15_t * pSinVal,
+  q15_t * pCosVal)
+  {
+    uint32_t indexS = phase >> 23;                 /* Index of the sine */
+    uint32_t indexC = (indexS + 128) & 0x1ff;      /* Index of the cosine */
+    q31_t fract = (q31_t) ((phase >> 7) & 0xFFFF); /* Fraction in 0.16 format */
+    q31_t y0, y1;                                  /* Two nearest output values */
+
+    y0 = pTable[indexS];
+    y1 = pTable[indexS + 1];
+    *pSinVal = (q15_t) (((y0 << 16) + ((y1 - y0) * fract) + 0x8000) >> 16);
+
+    y0 = pTable[indexC];
+    y1 = pTable[indexC + 1];
+    *pCosVal = (q15_t) (((y0 << 16) + ((y1 - y0) * fract) + 0x8000) >> 16);
+  }
+
+
+  /**
+   * @brief  Floating-point block sine and cosine.
+   * @param[in]  *pTheta    points to the input angles in degrees.
+   * @param[out] *pSinVal   points to the sine output vector.
+   * @param[out] *pCosVal   points to the cosine output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_cos_f32(
+  const float32_t * pTheta,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 block sine and cosine.
+   * @param[in]  *pTheta    points to the input angles, [-1 0.999999] maps to [-180 180) degrees.
+   * @param[out] *pSinVal   points to the sine output vector.
+   * @param[out] *pCosVal   points to the cosine output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_cos_q31(
+  const q31_t * pTheta,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 block sine and cosine.
+   * @param[in]  *pTheta    points to the input angles, [-1 0.9999] maps to [-180 180) degrees.
+   * @param[out] *pSinVal   points to the sine output vector.
+   * @param[out] *pCosVal   points to the cosine output vector.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_vsin_cos_q15(
+  const q15_t * pTheta,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point NCO.
+   * @param[in,out] *S         points to an instance of the floating-point NCO structure.
+   * @param[in]     phaseInc   phase increment per sample in degrees, the frequency is phaseInc / 360 cycles per sample.
+   * @param[in]     phase      initial phase in degrees.
+   * @return none.
+   */
+  void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t phaseInc,
+  float32_t phase);
+
+
+  /**
+   * @brief  Initialization function for the Q31 NCO.
+   * @param[in,out] *S         points to an instance of the Q31 NCO structure.
+   * @param[in]     phaseInc   phase increment per sample, [-1 0.999999] maps to [-180 180) degrees.
+   * @param[in]     phase      initial phase, [-1 0.999999] maps to [-180 180) degrees.
+   * @return none.
+   */
+  void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  q31_t phaseInc,
+  q31_t phase);
+
+
+  /**
+   * @brief  Initialization function for the Q15 NCO.
+   * @param[in,out] *S         points to an instance of the Q15 NCO structure.
+   * @param[in]     phaseInc   phase increment per sample in Q31 format, [-1 0.999999] maps to [-180 180) degrees.
+   * @param[in]     phase      initial phase in Q31 format, [-1 0.999999] maps to [-180 180) degrees.
+   * @return none.
+   */
+  void arm_nco_init_q15(
+  arm_nco_instance_q15 * S,
+  q31_t phaseInc,
+  q31_t phase);
+
+
+  /**
+   * @brief  Floating-point NCO with separate sine and cosine outputs.
+   * @param[in,out] *S          points to an instance of the floating-point NCO structure.
+   * @param[out]    *pSinVal    points to the sine output vector.
+   * @param[out]    *pCosVal    points to the cosine output vector.
+   * @param[in]     blockSize   number of samples to generate.
+   * @return none.
+   */
+  void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 NCO with separate sine and cosine outputs.
+   * @param[in,out] *S          points to an instance of the Q31 NCO structure.
+   * @param[out]    *pSinVal    points to the sine output vector.
+   * @param[out]    *pCosVal    points to the cosine output vector.
+   * @param[in]     blockSize   number of samples to generate.
+   * @return none.
+   */
+  void arm_nco_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 NCO with separate sine and cosine outputs.
+   * @param[in,out] *S          points to an instance of the Q15 NCO structure.
+   * @param[out]    *pSinVal    points to the sine output vector.
+   * @param[out]    *pCosVal    points to the cosine output vector.
+   * @param[in]     blockSize   number of samples to generate.
+   * @return none.
+   */
+  void arm_nco_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point NCO with complex output.
+   * @param[in,out] *S          points to an instance of the floating-point NCO structure.
+   * @param[out]    *pDst       points to the complex output vector, cosine and sine interleaved.
+   * @param[in]     blockSize   number of complex samples to generate.
+   * @return none.
+   */
+  void arm_nco_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 NCO with complex output.
+   * @param[in,out] *S          points to an instance of the Q31 NCO structure.
+   * @param[out]    *pDst       points to the complex output vector, cosine and sine interleaved.
+   * @param[in]     blockSize   number of complex samples to generate.
+   * @return none.
+   */
+  void arm_nco_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 NCO with complex output.
+   * @param[in,out] *S          points to an instance of the Q15 NCO structure.
+   * @param[out]    *pDst       points to the complex output vector, cosine and sine interleaved.
+   * @param[in]     blockSize   number of complex samples to generate.
+   * @return none.
+   */
+  void arm_nco_cmplx_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @brief  Floating-point complex conjugate.
    * @param[in]  pSrc        points to the input vector
@@ -4854,75 +7478,277 @@ void arm_rfft_fast_f32(
    * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
    * Lastly, the accumulator is saturated to yield a result in 1.15 format.
    */
-  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_q15(
-  arm_pid_instance_q15 * S,
-  q15_t in)
-  {
-    q63_t acc;
-    q15_t out;
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_q15(
+  arm_pid_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+#if defined (ARM_MATH_DSP)
+    __SIMD32_TYPE *vstate;
+
+    /* Implementation of PID controller */
+
+    /* acc = A0 * x[n]  */
+    acc = (q31_t) __SMUAD((uint32_t)S->A0, (uint32_t)in);
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    vstate = __SIMD32_CONST(S->state);
+    acc = (q63_t)__SMLALD((uint32_t)S->A1, (uint32_t)*vstate, (uint64_t)acc);
+#else
+    /* acc = A0 * x[n]  */
+    acc = ((q31_t) S->A0) * in;
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc += (q31_t) S->A1 * S->state[0];
+    acc += (q31_t) S->A2 * S->state[1];
+#endif
+
+    /* acc += y[n-1] */
+    acc += (q31_t) S->state[2] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+  /**
+   * @} end of PID group
+   */
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_inverse_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_inverse_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  src   points to the instance of the input symmetric positive definite matrix.
+   * @param[out] dst   points to the instance of the output lower triangular matrix, may be the same as src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point LDLT decomposition.
+   * @param[in]  src   points to the instance of the input symmetric matrix.
+   * @param[out] dst   points to the instance of the output matrix holding L below the diagonal and D on the diagonal, may be the same as src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a pivot is zero, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point rank-1 update of a Cholesky factor.
+   * @param[in,out] pL   points to the instance of the lower triangular factor of A, replaced by the factor of A + x * x'.
+   * @param[in,out] pX   points to the vector x, which is overwritten.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the factor is not square.
+   */
+  arm_status arm_mat_cholesky_update_f32(
+  arm_matrix_instance_f32 * pL,
+  float32_t * pX);
+
+
+  /**
+   * @brief Floating-point rank-1 downdate of a Cholesky factor.
+   * @param[in,out] pL   points to the instance of the lower triangular factor of A, replaced by the factor of A - x * x'.
+   * @param[in,out] pX   points to the vector x, which is overwritten.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the factor is not square.
+   * If A - x * x' is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_downdate_f32(
+  arm_matrix_instance_f32 * pL,
+  float32_t * pX);
+
+
+  /**
+   * @brief Floating-point lower triangular solve of LT * X = A.
+   * @param[in]  pLT   points to the instance of the lower triangular matrix.
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pLT,
+  const arm_matrix_instance_f32 * pA,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point upper triangular solve of UT * X = A.
+   * @param[in]  pUT   points to the instance of the upper triangular matrix.
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pUT,
+  const arm_matrix_instance_f32 * pA,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point solve of L * L' * X = A from a Cholesky factor.
+   * @param[in]  pL    points to the instance of the factor computed by arm_mat_cholesky_f32().
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_solve_cholesky_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pA,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point solve of L * D * L' * X = A from an LDLT factorization.
+   * @param[in]  pLD   points to the instance of the factors computed by arm_mat_ldlt_f32().
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_solve_ldlt_f32(
+  const arm_matrix_instance_f32 * pLD,
+  const arm_matrix_instance_f32 * pA,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  src   points to the instance of the input symmetric positive definite matrix.
+   * @param[out] dst   points to the instance of the output lower triangular matrix, may be the same as src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
 
-#if defined (ARM_MATH_DSP)
-    __SIMD32_TYPE *vstate;
 
-    /* Implementation of PID controller */
+  /**
+   * @brief Floating-point LDLT decomposition.
+   * @param[in]  src   points to the instance of the input symmetric matrix.
+   * @param[out] dst   points to the instance of the output matrix holding L below the diagonal and D on the diagonal, may be the same as src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a pivot is zero, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
 
-    /* acc = A0 * x[n]  */
-    acc = (q31_t) __SMUAD((uint32_t)S->A0, (uint32_t)in);
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    vstate = __SIMD32_CONST(S->state);
-    acc = (q63_t)__SMLALD((uint32_t)S->A1, (uint32_t)*vstate, (uint64_t)acc);
-#else
-    /* acc = A0 * x[n]  */
-    acc = ((q31_t) S->A0) * in;
+  /**
+   * @brief Floating-point rank-1 update of a Cholesky factor.
+   * @param[in,out] pL   points to the instance of the lower triangular factor of A, replaced by the factor of A + x * x'.
+   * @param[in,out] pX   points to the vector x, which is overwritten.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the factor is not square.
+   */
+  arm_status arm_mat_cholesky_update_f64(
+  arm_matrix_instance_f64 * pL,
+  float64_t * pX);
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc += (q31_t) S->A1 * S->state[0];
-    acc += (q31_t) S->A2 * S->state[1];
-#endif
 
-    /* acc += y[n-1] */
-    acc += (q31_t) S->state[2] << 15;
+  /**
+   * @brief Floating-point rank-1 downdate of a Cholesky factor.
+   * @param[in,out] pL   points to the instance of the lower triangular factor of A, replaced by the factor of A - x * x'.
+   * @param[in,out] pX   points to the vector x, which is overwritten.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the factor is not square.
+   * If A - x * x' is not positive definite, then the algorithm terminates and returns error status ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_downdate_f64(
+  arm_matrix_instance_f64 * pL,
+  float64_t * pX);
 
-    /* saturate the output */
-    out = (q15_t) (__SSAT((acc >> 15), 16));
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  /**
+   * @brief Floating-point lower triangular solve of LT * X = A.
+   * @param[in]  pLT   points to the instance of the lower triangular matrix.
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pLT,
+  const arm_matrix_instance_f64 * pA,
+  arm_matrix_instance_f64 * pDst);
 
-    /* return to application */
-    return (out);
-  }
 
   /**
-   * @} end of PID group
+   * @brief Floating-point upper triangular solve of UT * X = A.
+   * @param[in]  pUT   points to the instance of the upper triangular matrix.
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element is zero, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
    */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pUT,
+  const arm_matrix_instance_f64 * pA,
+  arm_matrix_instance_f64 * pDst);
 
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  src   points to the instance of the input floating-point matrix structure.
-   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @brief Floating-point solve of L * L' * X = A from a Cholesky factor.
+   * @param[in]  pL    points to the instance of the factor computed by arm_mat_cholesky_f64().
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
    * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
    */
-  arm_status arm_mat_inverse_f32(
-  const arm_matrix_instance_f32 * src,
-  arm_matrix_instance_f32 * dst);
+  arm_status arm_mat_solve_cholesky_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pA,
+  arm_matrix_instance_f64 * pDst);
 
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  src   points to the instance of the input floating-point matrix structure.
-   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @brief Floating-point solve of L * D * L' * X = A from an LDLT factorization.
+   * @param[in]  pLD   points to the instance of the factors computed by arm_mat_ldlt_f64().
+   * @param[in]  pA    points to the instance of the right hand side matrix.
+   * @param[out] pDst  points to the instance of the solution matrix, may be the same as pA.
    * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
    */
-  arm_status arm_mat_inverse_f64(
-  const arm_matrix_instance_f64 * src,
-  arm_matrix_instance_f64 * dst);
+  arm_status arm_mat_solve_ldlt_f64(
+  const arm_matrix_instance_f64 * pLD,
+  const arm_matrix_instance_f64 * pA,
+  arm_matrix_instance_f64 * pDst);
 
 
 
@@ -5685,6 +8511,257 @@ void arm_rfft_fast_f32(
   q15_t x);
 
 
+  /**
+   * @brief  Floating-point exponential of one value, used by arm_vexp_f32().
+   * @param[in] x  input value.
+   * @return  exp(x), +Inf above 88.72, and 0 below -87.34 where the result would be denormal.
+   *
+   * \par
+   * The input is reduced to <code>x = n * ln(2) + r</code> with <code>|r| <= ln(2)/2</code>, and
+   * <code>exp(r)</code> is evaluated with a polynomial of degree 7 and scaled by
+   * <code>2<sup>n</sup></code> through the exponent field.
+   */
+  CMSIS_INLINE __STATIC_INLINE float32_t arm_exp_f32(
+  float32_t x)
+  {
+    union
+    {
+      float32_t f;
+      int32_t i;
+    } s1, s2;                                      /* Powers of two */
+    float32_t t, r, r2, p;                         /* Temporary variables */
+    int32_t n;                                     /* Exponent of the result */
+
+    if (x > 88.7228394f)
+    {
+      s1.i = 0x7F800000;
+      return (s1.f);
+    }
+
+    if (x < -87.3365479f)
+    {
+      return (0.0f);
+    }
+
+    if (x != x)
+    {
+      return (x);
+    }
+
+    /* x = n * ln(2) + r, |r| <= ln(2) / 2. ln(2) is split so that n * 0.693359375 is exact */
+    t = x * 1.44269504f;
+    n = (int32_t) (t + ((t < 0.0f) ? -0.5f : 0.5f));
+    t = (float32_t) n;
+    r = x - (t * 0.693359375f);
+    r = r + (t * 2.12194440e-4f);
+
+    /* exp(r) = 1 + r + r^2 * P(r) */
+    r2 = r * r;
+    p = 1.9875691500e-4f;
+    p = (p * r) + 1.3981999507e-3f;
+    p = (p * r) + 8.3334519073e-3f;
+    p = (p * r) + 4.1665795894e-2f;
+    p = (p * r) + 1.6666665459e-1f;
+    p = (p * r) + 5.0000001201e-1f;
+    p = ((p * r2) + r) + 1.0f;
+
+    /* 2^n as the product of two normal numbers, n ranges from -126 to 128 */
+    s1.i = ((n >> 1) + 127) << 23;
+    s2.i = ((n - (n >> 1)) + 127) << 23;
+
+    return ((p * s1.f) * s2.f);
+  }
+
+
+  /**
+   * @brief  Sigmoid of a non-negative value from the sigmoid table, used by arm_vsigmoid_q31() and arm_vtanh_q31().
+   * @param[in] pTable  points to the table <code>sigmoidTable_q31</code>.
+   * @param[in] index   index of the table value below the input, less than <code>SIGMOID_TABLE_SIZE</code>.
+   * @param[in] fract   position of the input between the two table values, in 1.31 format.
+   * @return  sigmoid in 1.31 format, saturated to 0x7FFFFFFF.
+   *
+   * \par
+   * The table values are interpolated with a cubic Hermite polynomial. The slopes at the two table
+   * points are <code>y * (1 - y)</code>, the derivative of the sigmoid, so no slope table is needed.
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_sigmoid_hermite_q31(
+  const q31_t * pTable,
+  uint32_t index,
+  q31_t fract)
+  {
+    q31_t y0, y1, dy, d0, d1;                      /* Table values, difference and slopes */
+    q31_t c2, c3;                                  /* Polynomial coefficients */
+    q63_t acc;                                     /* Accumulator */
+
+    y0 = pTable[index];
+    y1 = pTable[index + 1U];
+    dy = y1 - y0;
+
+    /* Slopes y * (1 - y) scaled by the table spacing */
+    d0 = (q31_t) (((q63_t) y0 * (0x80000000LL - y0)) >> (31 + SIGMOID_TABLE_SHIFT));
+    d1 = (q31_t) (((q63_t) y1 * (0x80000000LL - y1)) >> (31 + SIGMOID_TABLE_SHIFT));
+
+    /* y = y0 + d0 * t + c2 * t^2 + c3 * t^3 */
+    c2 = (3 * dy) - (2 * d0) - d1;
+    c3 = d0 + d1 - (2 * dy);
+
+    acc = (((q63_t) c3 * fract) + 0x40000000) >> 31;
+    acc = ((((acc + c2) * fract) + 0x40000000) >> 31);
+    acc = ((((acc + d0) * fract) + 0x40000000) >> 31);
+
+    return (clip_q63_to_q31(acc + y0));
+  }
+
+
+  /**
+   * @brief  Floating-point vector exponential.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vexp_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector natural logarithm.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vlog_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector hyperbolic tangent.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vtanh_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector hyperbolic tangent.
+   * @param[in]  *pSrc      points to the input vector in 6.26 format.
+   * @param[out] *pDst      points to the output vector in 1.31 format.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vtanh_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector hyperbolic tangent.
+   * @param[in]  *pSrc      points to the input vector in 5.11 format.
+   * @param[out] *pDst      points to the output vector in 1.15 format.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vtanh_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector sigmoid.
+   * @param[in]  *pSrc      points to the input vector.
+   * @param[out] *pDst      points to the output vector.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vsigmoid_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector sigmoid.
+   * @param[in]  *pSrc      points to the input vector in 6.26 format.
+   * @param[out] *pDst      points to the output vector in 1.31 format.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vsigmoid_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector sigmoid.
+   * @param[in]  *pSrc      points to the input vector in 5.11 format.
+   * @param[out] *pDst      points to the output vector in 1.15 format.
+   * @param[in]  blockSize  number of samples in the vector.
+   * @return none.
+   */
+  void arm_vsigmoid_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point two-argument arctangent.
+   * @param[in]  *pSrcY     points to the vector of y coordinates.
+   * @param[in]  *pSrcX     points to the vector of x coordinates.
+   * @param[out] *pDst      points to the output vector of angles in radians.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 two-argument arctangent.
+   * @param[in]  *pSrcY     points to the vector of y coordinates.
+   * @param[in]  *pSrcX     points to the vector of x coordinates.
+   * @param[out] *pDst      points to the output vector of angles divided by pi.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_atan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 two-argument arctangent.
+   * @param[in]  *pSrcY     points to the vector of y coordinates.
+   * @param[in]  *pSrcX     points to the vector of x coordinates.
+   * @param[out] *pDst      points to the output vector of angles divided by pi.
+   * @param[in]  blockSize  number of samples in each vector.
+   * @return none.
+   */
+  void arm_atan2_q15(
+  const q15_t * pSrcY,
+  const q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
   /**
    * @ingroup groupFastMath
    */
@@ -5840,12 +8917,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0U;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5858,7 +8936,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (int32_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5880,6 +8958,60 @@ void arm_rfft_fast_f32(
   }
 
 
+  /**
+   * @brief floating-point Circular write function for a doubled buffer.
+   * @details The buffer holds 2*L values and each sample is written both at its offset
+   * and L values after it. The last L samples written are then contiguous, from
+   * <code>circBuffer + *writeOffset</code>, and can be read without wrapping around.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_circularWriteDouble_f32(
+  float32_t * circBuffer,
+  int32_t L,
+  uint16_t * writeOffset,
+  const float32_t * src,
+  uint32_t blockSize)
+  {
+    float32_t *pLow, *pHigh;
+    uint32_t i, wOffset;
+
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    while (blockSize > 0U)
+    {
+      /* Number of samples before the end of the buffer */
+      i = (uint32_t) L - wOffset;
+      i = (i < blockSize) ? i : blockSize;
+
+      blockSize -= i;
+      wOffset += i;
+
+      pLow = circBuffer + (wOffset - i);
+      pHigh = pLow + L;
+
+      /* copy the input samples to both halves of the buffer */
+      while (i > 0U)
+      {
+        *pLow++ = *src;
+        *pHigh++ = *src++;
+
+        /* Decrement the loop counter */
+        i--;
+      }
+
+      /* Wrap around at the end of the buffer */
+      if (wOffset == (uint32_t) L)
+      {
+        wOffset = 0U;
+      }
+    }
+
+    /* Update the index pointer */
+    *writeOffset = (uint16_t) wOffset;
+  }
+
+
   /**
    * @brief Q15 Circular write function.
    */
@@ -5939,13 +9071,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5958,7 +9091,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q15_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6039,13 +9172,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6058,7 +9192,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q7_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6284,6 +9418,269 @@ void arm_rfft_fast_f32(
   q15_t * pResult);
 
 
+  /**
+   * @brief Instance structure for the floating-point streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;          /**< number of samples accumulated. */
+    float32_t mean;          /**< mean of the samples. */
+    float32_t m2;            /**< sum of the squared differences to the mean. */
+    float32_t min;           /**< smallest sample. */
+    float32_t max;           /**< largest sample. */
+    uint32_t *pHist;         /**< points to the histogram bins, or NULL. */
+    uint16_t numBins;        /**< number of histogram bins. */
+    float32_t histMin;       /**< lower edge of the first bin. */
+    float32_t binScale;      /**< inverse of the bin width. */
+  } arm_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;          /**< number of samples accumulated. */
+    q63_t sum;               /**< sum of the samples in 33.31 format. */
+    q63_t sumOfSquares;      /**< sum of the upper 32 bits of the squared samples, in 34.30 format. */
+    uint64_t sumOfSquaresLow; /**< sum of the lower 32 bits of the squared samples. */
+    q31_t min;               /**< smallest sample. */
+    q31_t max;               /**< largest sample. */
+    uint32_t *pHist;         /**< points to the histogram bins, or NULL. */
+    uint16_t numBins;        /**< number of histogram bins. */
+    q31_t histMin;           /**< lower edge of the first bin. */
+    uint8_t binShift;        /**< the bin width is 2^binShift. */
+  } arm_stats_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 streaming statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;          /**< number of samples accumulated. */
+    q63_t sum;               /**< sum of the samples in 49.15 format. */
+    q63_t sumOfSquares;      /**< sum of the squared samples in 34.30 format. */
+    q15_t min;               /**< smallest sample. */
+    q15_t max;               /**< largest sample. */
+    uint32_t *pHist;         /**< points to the histogram bins, or NULL. */
+    uint16_t numBins;        /**< number of histogram bins. */
+    q15_t histMin;           /**< lower edge of the first bin. */
+    uint8_t binShift;        /**< the bin width is 2^binShift. */
+  } arm_stats_instance_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point streaming statistics.
+   * @param[in,out] *S        points to an instance of the floating-point streaming statistics structure.
+   * @param[in]     *pHist    points to an array of numBins histogram bins, or NULL for no histogram.
+   * @param[in]     numBins   number of histogram bins.
+   * @param[in]     histMin   lower edge of the first bin.
+   * @param[in]     histMax   upper edge of the last bin.
+   * @return none.
+   */
+  void arm_stats_init_f32(
+  arm_stats_instance_f32 * S,
+  uint32_t * pHist,
+  uint16_t numBins,
+  float32_t histMin,
+  float32_t histMax);
+
+
+  /**
+   * @brief  Initialization function for the Q31 streaming statistics.
+   * @param[in,out] *S        points to an instance of the Q31 streaming statistics structure.
+   * @param[in]     *pHist    points to an array of numBins histogram bins, or NULL for no histogram.
+   * @param[in]     numBins   number of histogram bins.
+   * @param[in]     histMin   lower edge of the first bin.
+   * @param[in]     binShift  the width of the bins is 2^binShift.
+   * @return none.
+   */
+  void arm_stats_init_q31(
+  arm_stats_instance_q31 * S,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q31_t histMin,
+  uint8_t binShift);
+
+
+  /**
+   * @brief  Initialization function for the Q15 streaming statistics.
+   * @param[in,out] *S        points to an instance of the Q15 streaming statistics structure.
+   * @param[in]     *pHist    points to an array of numBins histogram bins, or NULL for no histogram.
+   * @param[in]     numBins   number of histogram bins.
+   * @param[in]     histMin   lower edge of the first bin.
+   * @param[in]     binShift  the width of the bins is 2^binShift.
+   * @return none.
+   */
+  void arm_stats_init_q15(
+  arm_stats_instance_q15 * S,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q15_t histMin,
+  uint8_t binShift);
+
+
+  /**
+   * @brief  Adds a block of samples to the floating-point streaming statistics.
+   * @param[in,out] *S          points to an instance of the floating-point streaming statistics structure.
+   * @param[in]     *pSrc       points to the block of samples.
+   * @param[in]     blockSize   number of samples in the block.
+   * @return none.
+   */
+  void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Adds a block of samples to the Q31 streaming statistics.
+   * @param[in,out] *S          points to an instance of the Q31 streaming statistics structure.
+   * @param[in]     *pSrc       points to the block of samples.
+   * @param[in]     blockSize   number of samples in the block.
+   * @return none.
+   */
+  void arm_stats_update_q31(
+  arm_stats_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Adds a block of samples to the Q15 streaming statistics.
+   * @param[in,out] *S          points to an instance of the Q15 streaming statistics structure.
+   * @param[in]     *pSrc       points to the block of samples.
+   * @param[in]     blockSize   number of samples in the block.
+   * @return none.
+   */
+  void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Merges two floating-point streaming statistics.
+   * @param[in,out] *S      points to the instance that receives the samples of the other one.
+   * @param[in]     *S2     points to the other instance, with the same histogram bins.
+   * @return none.
+   */
+  void arm_stats_merge_f32(
+  arm_stats_instance_f32 * S,
+  const arm_stats_instance_f32 * S2);
+
+
+  /**
+   * @brief  Merges two Q31 streaming statistics.
+   * @param[in,out] *S      points to the instance that receives the samples of the other one.
+   * @param[in]     *S2     points to the other instance, with the same histogram bins.
+   * @return none.
+   */
+  void arm_stats_merge_q31(
+  arm_stats_instance_q31 * S,
+  const arm_stats_instance_q31 * S2);
+
+
+  /**
+   * @brief  Merges two Q15 streaming statistics.
+   * @param[in,out] *S      points to the instance that receives the samples of the other one.
+   * @param[in]     *S2     points to the other instance, with the same histogram bins.
+   * @return none.
+   */
+  void arm_stats_merge_q15(
+  arm_stats_instance_q15 * S,
+  const arm_stats_instance_q15 * S2);
+
+
+  /**
+   * @brief  Mean, variance, standard deviation, minimum and maximum of the floating-point streaming statistics.
+   * @param[in]  *S       points to an instance of the floating-point streaming statistics structure.
+   * @param[out] *pMean   mean value returned here.
+   * @param[out] *pVar    variance value returned here.
+   * @param[out] *pStd    standard deviation value returned here.
+   * @param[out] *pMin    minimum value returned here.
+   * @param[out] *pMax    maximum value returned here.
+   * @return none.
+   */
+  void arm_stats_result_f32(
+  const arm_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar,
+  float32_t * pStd,
+  float32_t * pMin,
+  float32_t * pMax);
+
+
+  /**
+   * @brief  Mean, variance, standard deviation, minimum and maximum of the Q31 streaming statistics.
+   * @param[in]  *S       points to an instance of the Q31 streaming statistics structure.
+   * @param[out] *pMean   mean value returned here.
+   * @param[out] *pVar    variance value returned here.
+   * @param[out] *pStd    standard deviation value returned here.
+   * @param[out] *pMin    minimum value returned here.
+   * @param[out] *pMax    maximum value returned here.
+   * @return none.
+   */
+  void arm_stats_result_q31(
+  const arm_stats_instance_q31 * S,
+  q31_t * pMean,
+  q31_t * pVar,
+  q31_t * pStd,
+  q31_t * pMin,
+  q31_t * pMax);
+
+
+  /**
+   * @brief  Mean, variance, standard deviation, minimum and maximum of the Q15 streaming statistics.
+   * @param[in]  *S       points to an instance of the Q15 streaming statistics structure.
+   * @param[out] *pMean   mean value returned here.
+   * @param[out] *pVar    variance value returned here.
+   * @param[out] *pStd    standard deviation value returned here.
+   * @param[out] *pMin    minimum value returned here.
+   * @param[out] *pMax    maximum value returned here.
+   * @return none.
+   */
+  void arm_stats_result_q15(
+  const arm_stats_instance_q15 * S,
+  q15_t * pMean,
+  q15_t * pVar,
+  q15_t * pStd,
+  q15_t * pMin,
+  q15_t * pMax);
+
+
+  /**
+   * @brief  Percentile of the floating-point streaming statistics, from the histogram.
+   * @param[in]  *S         points to an instance of the floating-point streaming statistics structure.
+   * @param[in]  fraction   fraction of the samples below the result, in [0 1].
+   * @return percentile value.
+   */
+  float32_t arm_stats_percentile_f32(
+  const arm_stats_instance_f32 * S,
+  float32_t fraction);
+
+
+  /**
+   * @brief  Percentile of the Q31 streaming statistics, from the histogram.
+   * @param[in]  *S         points to an instance of the Q31 streaming statistics structure.
+   * @param[in]  fraction   fraction of the samples below the result, in [0 1).
+   * @return percentile value.
+   */
+  q31_t arm_stats_percentile_q31(
+  const arm_stats_instance_q31 * S,
+  q31_t fraction);
+
+
+  /**
+   * @brief  Percentile of the Q15 streaming statistics, from the histogram.
+   * @param[in]  *S         points to an instance of the Q15 streaming statistics structure.
+   * @param[in]  fraction   fraction of the samples below the result, in [0 1).
+   * @return percentile value.
+   */
+  q15_t arm_stats_percentile_q15(
+  const arm_stats_instance_q15 * S,
+  q15_t fraction);
+
+
   /**
    * @brief  Floating-point complex magnitude
    * @param[in]  pSrc        points to the complex input vector
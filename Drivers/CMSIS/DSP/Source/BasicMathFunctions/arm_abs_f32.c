@@ -67,7 +67,30 @@ void arm_abs_f32(
 {
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  const __m128 signMask = _mm_set1_ps(-0.0f);    /* sign bit of each lane */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = |A| */
+    _mm_storeu_ps(pDst, _mm_andnot_ps(signMask, _mm_loadu_ps(pSrc)));
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
   float32_t in1, in2, in3, in4;                  /* temporary variables */
@@ -57,7 +57,42 @@ void arm_abs_q15(
 {
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  const __m128i minAbs = _mm_set1_epi16(-32767); /* 0x8000 saturates to 0x7FFF */
+  q15_t in;                                      /* Input value */
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = |A| */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_abs_epi16(_mm_max_epi16(_mm_loadu_si128((__m128i *) pSrc), minAbs)));
+
+    pSrc += 8;
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = |A| */
+    in = *pSrc++;
+    *pDst++ = (in > 0) ? in : ((in == (q15_t) 0x8000) ? 0x7fff : -in);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
   __SIMD32_TYPE *simd;
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
@@ -62,7 +62,31 @@ void arm_abs_q7(
   uint32_t blkCnt;                               /* loop counter */
   q7_t in;                                       /* Input value1 */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  const __m128i minAbs = _mm_set1_epi8(-127);    /* 0x80 saturates to 0x7F */
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = |A| */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_abs_epi8(_mm_max_epi8(_mm_loadu_si128((__m128i *) pSrc), minAbs)));
+
+    pSrc += 16;
+    pDst += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t in1, in2, in3, in4;                      /* temporary input variables */
@@ -59,7 +59,41 @@ void arm_add_q15(
 {
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A + B */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_adds_epi16(_mm_loadu_si128((__m128i *) pSrcA),
+                                    _mm_loadu_si128((__m128i *) pSrcB)));
+
+    pSrcA += 8;
+    pSrcB += 8;
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A + B */
+    *pDst++ = (q15_t) __SSAT(((q31_t) * pSrcA++ + *pSrcB++), 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t inA1, inA2, inB1, inB2;
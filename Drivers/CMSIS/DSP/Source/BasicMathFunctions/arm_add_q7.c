@@ -59,7 +59,41 @@ void arm_add_q7(
 {
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A + B */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_adds_epi8(_mm_loadu_si128((__m128i *) pSrcA),
+                                   _mm_loadu_si128((__m128i *) pSrcB)));
+
+    pSrcA += 16;
+    pSrcB += 16;
+    pDst += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A + B */
+    *pDst++ = (q7_t) __SSAT((q15_t) * pSrcA++ + *pSrcB++, 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -70,7 +70,35 @@ void arm_dot_prod_f32(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 acc = _mm_setzero_ps();                 /* four partial sums */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(pSrcA), _mm_loadu_ps(pSrcB)));
+
+    pSrcA += 4;
+    pSrcB += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Add the four partial sums */
+  acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+  acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+  sum = _mm_cvtss_f32(acc);
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   /*loop Unrolling */
@@ -63,7 +63,53 @@ void arm_dot_prod_q15(
   q63_t sum = 0;                                 /* Temporary result storage */
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i pairs;                                 /* sums of adjacent products */
+  __m128i acc = _mm_setzero_si128();             /* two 64-bit partial sums */
+  __m128i wraps = _mm_setzero_si128();           /* number of wrapped pair sums per lane */
+  const __m128i minQ31 = _mm_set1_epi32(INT32_MIN);
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    pairs = _mm_madd_epi16(_mm_loadu_si128((__m128i *) pSrcA), _mm_loadu_si128((__m128i *) pSrcB));
+
+    /* The only pair sum which does not fit 32 bits is 2 * 0x8000 * 0x8000,
+     * it wraps to 0x80000000 and is counted here to add 2^32 back later */
+    wraps = _mm_sub_epi32(wraps, _mm_cmpeq_epi32(pairs, minQ31));
+
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(pairs));
+    acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(pairs, 8)));
+
+    pSrcA += 8;
+    pSrcB += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = _mm_cvtsi128_si64(acc) + _mm_extract_epi64(acc, 1);
+  sum += ((q63_t) ((uint32_t) _mm_extract_epi32(wraps, 0) + (uint32_t) _mm_extract_epi32(wraps, 1) +
+                   (uint32_t) _mm_extract_epi32(wraps, 2) + (uint32_t) _mm_extract_epi32(wraps, 3))) << 32;
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += (q63_t) ((q31_t) * pSrcA++ * *pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -65,7 +65,47 @@ void arm_dot_prod_q31(
   uint32_t blkCnt;                               /* loop counter */
 
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i inA, inB;                              /* temporary input variables */
+  __m128i acc = _mm_setzero_si128();             /* two 64-bit partial sums */
+  const __m128i signQ63 = _mm_set1_epi64x(INT64_MIN);
+  uint64_t bias;                                 /* sum of the 2^49 offsets */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  /* SSE has no 64-bit arithmetic shift. Flipping the sign bit offsets each
+   * product by 2^63, so a logical shift gives (product >> 14) + 2^49 and the
+   * offsets are removed from the sum at the end. */
+  bias = (uint64_t) blkCnt * 4U << 49;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    inA = _mm_loadu_si128((__m128i *) pSrcA);
+    inB = _mm_loadu_si128((__m128i *) pSrcB);
+
+    /* 64-bit products of the even and odd lanes, each scaled down to 16.48 like the scalar code */
+    acc = _mm_add_epi64(acc, _mm_srli_epi64(_mm_xor_si128(_mm_mul_epi32(inA, inB), signQ63), 14));
+    acc = _mm_add_epi64(acc, _mm_srli_epi64(_mm_xor_si128(_mm_mul_epi32(_mm_srli_epi64(inA, 32),
+                                                                        _mm_srli_epi64(inB, 32)),
+                                                          signQ63), 14));
+
+    pSrcA += 4;
+    pSrcB += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum = (q63_t) ((uint64_t) _mm_cvtsi128_si64(acc) + (uint64_t) _mm_extract_epi64(acc, 1) - bias);
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t inA1, inA2, inA3, inA4;
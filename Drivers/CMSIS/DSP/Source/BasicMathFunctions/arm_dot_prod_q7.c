@@ -64,7 +64,51 @@ void arm_dot_prod_q7(
 
   q31_t sum = 0;                                 /* Temporary variables to store output */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i inA, inB;                              /* temporary input variables */
+  __m128i acc = _mm_setzero_si128();             /* four 32-bit partial sums */
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    inA = _mm_loadu_si128((__m128i *) pSrcA);
+    inB = _mm_loadu_si128((__m128i *) pSrcB);
+
+    /* Sign extend to 16 bits and multiply accumulate adjacent pairs */
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_cvtepi8_epi16(inA), _mm_cvtepi8_epi16(inB)));
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(inA, 8)),
+                                            _mm_cvtepi8_epi16(_mm_srli_si128(inB, 8))));
+
+    pSrcA += 16;
+    pSrcB += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Add the four partial sums */
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  sum = _mm_cvtsi128_si32(acc);
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += (q31_t) ((q15_t) * pSrcA++ * *pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
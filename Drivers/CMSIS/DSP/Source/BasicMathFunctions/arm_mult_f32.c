@@ -65,7 +65,33 @@ void arm_mult_f32(
   uint32_t blockSize)
 {
   uint32_t blkCnt;                               /* loop counters */
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 inA, inB;                               /* temporary variables */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    inA = _mm_loadu_ps(pSrcA);
+    inB = _mm_loadu_ps(pSrcB);
+    _mm_storeu_ps(pDst, _mm_mul_ps(inA, inB));
+
+    pSrcA += 4;
+    pSrcB += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
   float32_t inA1, inA2, inA3, inA4;              /* temporary input variables */
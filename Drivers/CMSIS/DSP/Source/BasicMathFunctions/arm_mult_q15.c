@@ -60,7 +60,40 @@ void arm_mult_q15(
 {
   uint32_t blkCnt;                               /* loop counters */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i inA, inB;                              /* temporary input variables */
+  __m128i prodLo, prodHi;                        /* low and high halves of the products */
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    inA = _mm_loadu_si128((__m128i *) pSrcA);
+    inB = _mm_loadu_si128((__m128i *) pSrcB);
+
+    /* Form the 32-bit products, shift to 1.15 and saturate when packing */
+    prodLo = _mm_mullo_epi16(inA, inB);
+    prodHi = _mm_mulhi_epi16(inA, inB);
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_packs_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(prodLo, prodHi), 15),
+                                     _mm_srai_epi32(_mm_unpackhi_epi16(prodLo, prodHi), 15)));
+
+    pSrcA += 8;
+    pSrcB += 8;
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t inA1, inA2, inB1, inB2;                  /* temporary input variables */
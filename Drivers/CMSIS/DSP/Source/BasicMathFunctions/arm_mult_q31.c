@@ -59,7 +59,53 @@ void arm_mult_q31(
 {
   uint32_t blkCnt;                               /* loop counters */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i inA, inB;                              /* temporary input variables */
+  __m128i prodEven, prodOdd, out;                /* temporary output variables */
+  const __m128i minQ31 = _mm_set1_epi32(INT32_MIN);
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    inA = _mm_loadu_si128((__m128i *) pSrcA);
+    inB = _mm_loadu_si128((__m128i *) pSrcB);
+
+    /* 64-bit products of the even and odd lanes, bits [62:31] are the 1.31 result */
+    prodEven = _mm_srli_epi64(_mm_mul_epi32(inA, inB), 31);
+    prodOdd = _mm_slli_epi64(_mm_mul_epi32(_mm_srli_epi64(inA, 32), _mm_srli_epi64(inB, 32)), 1);
+    out = _mm_blend_epi16(prodEven, prodOdd, 0xCC);
+
+    /* Only 0x80000000 * 0x80000000 overflows, it gives 0x80000000 and is saturated */
+    out = _mm_xor_si128(out, _mm_cmpeq_epi32(out, minQ31));
+    _mm_storeu_si128((__m128i *) pDst, out);
+
+    pSrcA += 4;
+    pSrcB += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    *pDst++ =
+      (q31_t) clip_q63_to_q31(((q63_t) (*pSrcA++) * (*pSrcB++)) >> 31);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t inA1, inA2, inA3, inA4;                  /* temporary input variables */
@@ -59,7 +59,39 @@ void arm_mult_q7(
 {
   uint32_t blkCnt;                               /* loop counters */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i inA, inB;                              /* temporary input variables */
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * B */
+    inA = _mm_loadu_si128((__m128i *) pSrcA);
+    inB = _mm_loadu_si128((__m128i *) pSrcB);
+
+    /* The 16-bit products cannot overflow, shift to 1.7 and saturate when packing */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_packs_epi16(
+                       _mm_srai_epi16(_mm_mullo_epi16(_mm_cvtepi8_epi16(inA), _mm_cvtepi8_epi16(inB)), 7),
+                       _mm_srai_epi16(_mm_mullo_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(inA, 8)),
+                                                      _mm_cvtepi8_epi16(_mm_srli_si128(inB, 8))), 7)));
+
+    pSrcA += 16;
+    pSrcB += 16;
+    pDst += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q7_t out1, out2, out3, out4;                   /* Temporary variables to store the product */
@@ -62,7 +62,30 @@ void arm_negate_q15(
   uint32_t blkCnt;                               /* loop counter */
   q15_t in;
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  const __m128i zero = _mm_setzero_si128();
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = -A */
+    _mm_storeu_si128((__m128i *) pDst, _mm_subs_epi16(zero, _mm_loadu_si128((__m128i *) pSrc)));
+
+    pSrc += 8;
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
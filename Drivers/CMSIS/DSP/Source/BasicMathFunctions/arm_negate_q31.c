@@ -58,7 +58,32 @@ void arm_negate_q31(
   q31_t in;                                      /* Temporary variable */
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i minNeg = _mm_set1_epi32(-INT32_MAX); /* 0x80000000 saturates to 0x7FFFFFFF */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = -A */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_sub_epi32(zero, _mm_max_epi32(_mm_loadu_si128((__m128i *) pSrc), minNeg)));
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t in1, in2, in3, in4;
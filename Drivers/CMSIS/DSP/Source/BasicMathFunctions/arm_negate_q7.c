@@ -58,7 +58,30 @@ void arm_negate_q7(
   uint32_t blkCnt;                               /* loop counter */
   q7_t in;
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  const __m128i zero = _mm_setzero_si128();
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = -A */
+    _mm_storeu_si128((__m128i *) pDst, _mm_subs_epi8(zero, _mm_loadu_si128((__m128i *) pSrc)));
+
+    pSrc += 16;
+    pDst += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q31_t input;                                   /* Input values1-4 */
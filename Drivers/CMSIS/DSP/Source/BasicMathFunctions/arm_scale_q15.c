@@ -63,7 +63,48 @@ void arm_scale_q15(
   int8_t kShift = 15 - shift;                    /* shift to apply after scaling */
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i in, prodLo, prodHi;                    /* temporary variables */
+  const __m128i scaleV = _mm_set1_epi16(scaleFract);
+  const __m128i shiftV = _mm_cvtsi32_si128(kShift);
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale */
+    in = _mm_loadu_si128((__m128i *) pSrc);
+
+    /* Form the 32-bit products, shift and saturate when packing */
+    prodLo = _mm_mullo_epi16(in, scaleV);
+    prodHi = _mm_mulhi_epi16(in, scaleV);
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_packs_epi32(_mm_sra_epi32(_mm_unpacklo_epi16(prodLo, prodHi), shiftV),
+                                     _mm_sra_epi32(_mm_unpackhi_epi16(prodLo, prodHi), shiftV)));
+
+    pSrc += 8;
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale */
+    *pDst++ = (q15_t) (__SSAT(((q31_t) * pSrc++ * scaleFract) >> kShift, 16));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q15_t in1, in2, in3, in4;
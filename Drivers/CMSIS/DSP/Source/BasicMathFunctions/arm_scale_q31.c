@@ -64,7 +64,51 @@ void arm_scale_q31(
   uint32_t blkCnt;                               /* loop counter */
   q31_t in, out;
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i inV, outV, shiftV;                     /* temporary variables */
+  const __m128i scaleV = _mm_set1_epi32(scaleFract);
+  const __m128i maxQ31 = _mm_set1_epi32(INT32_MAX);
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+  shiftV = _mm_cvtsi32_si128((sign == 0) ? kShift : -kShift);
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale */
+    inV = _mm_loadu_si128((__m128i *) pSrc);
+
+    /* Upper 32 bits of the 64-bit products of the even and odd lanes */
+    inV = _mm_blend_epi16(_mm_srli_epi64(_mm_mul_epi32(inV, scaleV), 32),
+                          _mm_mul_epi32(_mm_srli_epi64(inV, 32), scaleV), 0xCC);
+
+    if (sign == 0)
+    {
+      /* Saturate the lanes which do not survive the left shift */
+      outV = _mm_sll_epi32(inV, shiftV);
+      outV = _mm_blendv_epi8(_mm_xor_si128(maxQ31, _mm_srai_epi32(inV, 31)), outV,
+                             _mm_cmpeq_epi32(inV, _mm_sra_epi32(outV, shiftV)));
+    }
+    else
+    {
+      outV = _mm_sra_epi32(inV, shiftV);
+    }
+
+    _mm_storeu_si128((__m128i *) pDst, outV);
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
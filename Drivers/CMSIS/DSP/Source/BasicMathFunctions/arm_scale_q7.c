@@ -62,7 +62,47 @@ void arm_scale_q7(
   int8_t kShift = 7 - shift;                     /* shift to apply after scaling */
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i in;                                    /* temporary variable */
+  const __m128i scaleV = _mm_set1_epi16(scaleFract);
+  const __m128i shiftV = _mm_cvtsi32_si128(kShift);
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale */
+    in = _mm_loadu_si128((__m128i *) pSrc);
+
+    /* The 16-bit products cannot overflow, shift and saturate when packing */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_packs_epi16(
+                       _mm_sra_epi16(_mm_mullo_epi16(_mm_cvtepi8_epi16(in), scaleV), shiftV),
+                       _mm_sra_epi16(_mm_mullo_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(in, 8)), scaleV), shiftV)));
+
+    pSrc += 16;
+    pDst += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale */
+    *pDst++ = (q7_t) (__SSAT((((q15_t) * pSrc++ * scaleFract) >> kShift), 8));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
   q7_t in1, in2, in3, in4, out1, out2, out3, out4;      /* Temporary variables to store input & output */
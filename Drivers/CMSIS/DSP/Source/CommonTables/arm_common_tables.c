@@ -22174,3 +22174,171 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
 	-5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411,
 	-2009, -1608, -1206, -804, -402, 0
 };
+
+/**
+ * \par
+ * Table values are in Q31 (1.31 fixed-point format) and generation is done in
+ * three steps.  First,  generate the sigmoid in floating point with a spacing
+ * of 1/32 from 0 to 24:
+ * <pre>
+ * tableSize = 768;
+ * for(n = 0; n < (tableSize + 1); n++)
+ * {
+ *	sigmoidTable[n]= 1 / (1 + exp(-n / 32.0));
+ * } </pre>
+ * \par
+ * Second, convert floating-point to Q31 (Fixed point):
+ *	(sigmoidTable[i] * pow(2, 31))
+ * \par
+ * Finally, round to the nearest integer value and saturate to 0x7FFFFFFF:
+ * 	sigmoidTable[i] += 0.5;
+ */
+const q31_t sigmoidTable_q31[SIGMOID_TABLE_SIZE + 1] = {
+	0x40000000, 0x40FFFAAB, 0x41FFD55A, 0x42FF7020, 0x43FEAB33, 0x44FD66F5,
+	0x45FB8409, 0x46F8E361, 0x47F5664B, 0x48F0EE83, 0x49EB5E3E, 0x4AE49839,
+	0x4BDC7FC8, 0x4CD2F8DF, 0x4DC7E821, 0x4EBB32E8, 0x4FACBF53, 0x509C744F,
+	0x518A399E, 0x5275F7E2, 0x535F98A1, 0x54470650, 0x552C2C56, 0x560EF712,
+	0x56EF53DF, 0x57CD3116, 0x58A87E15, 0x59812B3B, 0x5A5729EE, 0x5B2A6C99,
+	0x5BFAE6AC, 0x5CC88C99, 0x5D9353D7, 0x5E5B32DC, 0x5F20211A, 0x5FE216FD,
+	0x60A10DE6, 0x615D0026, 0x6215E8FC, 0x62CBC48A, 0x637E8FD5, 0x642E48BB,
+	0x64DAEDEE, 0x65847EED, 0x662AFBFD, 0x66CE6622, 0x676EBF18, 0x680C0949,
+	0x68A647CB, 0x693D7E51, 0x69D1B12B, 0x6A62E538, 0x6AF11FE2, 0x6B7C6714,
+	0x6C04C135, 0x6C8A351F, 0x6D0CCA17, 0x6D8C87C7, 0x6E097637, 0x6E839DC4,
+	0x6EFB071C, 0x6F6FBB36, 0x6FE1C34A, 0x705128CD, 0x70BDF56A, 0x712832FE,
+	0x718FEB8D, 0x71F52945, 0x7257F66E, 0x72B85D70, 0x731668C7, 0x73722301,
+	0x73CB96B7, 0x7422CE8F, 0x7477D531, 0x74CAB546, 0x751B7978, 0x756A2C69,
+	0x75B6D8B2, 0x760188E1, 0x764A4777, 0x76911EE2, 0x76D6197E, 0x77194191,
+	0x775AA149, 0x779A42BC, 0x77D82FE4, 0x7814729C, 0x784F14A5, 0x78881F9D,
+	0x78BF9D03, 0x78F59633, 0x792A1467, 0x795D20B4, 0x798EC40E, 0x79BF073F,
+	0x79EDF2F1, 0x7A1B8FA3, 0x7A47E5B2, 0x7A72FD50, 0x7A9CDE8D, 0x7AC5914D,
+	0x7AED1D51, 0x7B138A32, 0x7B38DF60, 0x7B5D2426, 0x7B805FA9, 0x7BA298E5,
+	0x7BC3D6B2, 0x7BE41FC1, 0x7C037A9D, 0x7C21EDAC, 0x7C3F7F30, 0x7C5C3544,
+	0x7C7815E1, 0x7C9326DD, 0x7CAD6DE8, 0x7CC6F091, 0x7CDFB445, 0x7CF7BE50,
+	0x7D0F13DA, 0x7D25B9ED, 0x7D3BB572, 0x7D510B34, 0x7D65BFDC, 0x7D79D7F7,
+	0x7D8D57F4, 0x7DA04424, 0x7DB2A0BC, 0x7DC471D5, 0x7DD5BB6C, 0x7DE68164,
+	0x7DF6C784, 0x7E06917B, 0x7E15E2DD, 0x7E24BF28, 0x7E3329BF, 0x7E4125EF,
+	0x7E4EB6EF, 0x7E5BDFDC, 0x7E68A3C1, 0x7E750592, 0x7E81082D, 0x7E8CAE5D,
+	0x7E97FAD8, 0x7EA2F043, 0x7EAD912D, 0x7EB7E015, 0x7EC1DF66, 0x7ECB917A,
+	0x7ED4F89B, 0x7EDE1702, 0x7EE6EED6, 0x7EEF8232, 0x7EF7D31D, 0x7EFFE393,
+	0x7F07B57E, 0x7F0F4ABE, 0x7F16A520, 0x7F1DC669, 0x7F24B04C, 0x7F2B6473,
+	0x7F31E47A, 0x7F3831F1, 0x7F3E4E5C, 0x7F443B35, 0x7F49F9EA, 0x7F4F8BDE,
+	0x7F54F269, 0x7F5A2EDC, 0x7F5F4279, 0x7F642E7E, 0x7F68F41B, 0x7F6D947A,
+	0x7F7210BA, 0x7F7669F4, 0x7F7AA136, 0x7F7EB787, 0x7F82ADE8, 0x7F86854F,
+	0x7F8A3EAD, 0x7F8DDAEC, 0x7F915AEC, 0x7F94BF8A, 0x7F98099B, 0x7F9B39EE,
+	0x7F9E5149, 0x7FA15070, 0x7FA4381F, 0x7FA7090D, 0x7FA9C3EB, 0x7FAC6965,
+	0x7FAEFA22, 0x7FB176C4, 0x7FB3DFE6, 0x7FB63623, 0x7FB87A0C, 0x7FBAAC32,
+	0x7FBCCD1E, 0x7FBEDD57, 0x7FC0DD61, 0x7FC2CDB9, 0x7FC4AED9, 0x7FC6813A,
+	0x7FC8454E, 0x7FC9FB86, 0x7FCBA44D, 0x7FCD400D, 0x7FCECF2C, 0x7FD0520C,
+	0x7FD1C90E, 0x7FD3348F, 0x7FD494E8, 0x7FD5EA71, 0x7FD7357F, 0x7FD87664,
+	0x7FD9AD70, 0x7FDADAEF, 0x7FDBFF2D, 0x7FDD1A72, 0x7FDE2D05, 0x7FDF3729,
+	0x7FE03922, 0x7FE1332E, 0x7FE2258C, 0x7FE31079, 0x7FE3F42F, 0x7FE4D0E7,
+	0x7FE5A6D7, 0x7FE67634, 0x7FE73F33, 0x7FE80205, 0x7FE8BEDA, 0x7FE975E3,
+	0x7FEA274C, 0x7FEAD341, 0x7FEB79EE, 0x7FEC1B7B, 0x7FECB812, 0x7FED4FD8,
+	0x7FEDE2F5, 0x7FEE718C, 0x7FEEFBC1, 0x7FEF81B7, 0x7FF0038F, 0x7FF08169,
+	0x7FF0FB65, 0x7FF171A0, 0x7FF1E43A, 0x7FF2534D, 0x7FF2BEF7, 0x7FF32751,
+	0x7FF38C75, 0x7FF3EE7E, 0x7FF44D83, 0x7FF4A99D, 0x7FF502E1, 0x7FF55967,
+	0x7FF5AD44, 0x7FF5FE8C, 0x7FF64D55, 0x7FF699B2, 0x7FF6E3B5, 0x7FF72B72,
+	0x7FF770FA, 0x7FF7B45F, 0x7FF7F5B1, 0x7FF83501, 0x7FF8725F, 0x7FF8ADD9,
+	0x7FF8E77F, 0x7FF91F60, 0x7FF95588, 0x7FF98A06, 0x7FF9BCE7, 0x7FF9EE37,
+	0x7FFA1E03, 0x7FFA4C56, 0x7FFA793D, 0x7FFAA4C2, 0x7FFACEF1, 0x7FFAF7D3,
+	0x7FFB1F74, 0x7FFB45DC, 0x7FFB6B16, 0x7FFB8F2B, 0x7FFBB224, 0x7FFBD40A,
+	0x7FFBF4E4, 0x7FFC14BC, 0x7FFC3399, 0x7FFC5183, 0x7FFC6E82, 0x7FFC8A9C,
+	0x7FFCA5D9, 0x7FFCC03F, 0x7FFCD9D6, 0x7FFCF2A3, 0x7FFD0AAC, 0x7FFD21F9,
+	0x7FFD388E, 0x7FFD4E71, 0x7FFD63A8, 0x7FFD7837, 0x7FFD8C25, 0x7FFD9F76,
+	0x7FFDB22E, 0x7FFDC454, 0x7FFDD5EA, 0x7FFDE6F6, 0x7FFDF77C, 0x7FFE077F,
+	0x7FFE1704, 0x7FFE2610, 0x7FFE34A4, 0x7FFE42C6, 0x7FFE5079, 0x7FFE5DBF,
+	0x7FFE6A9D, 0x7FFE7716, 0x7FFE832D, 0x7FFE8EE4, 0x7FFE9A3F, 0x7FFEA541,
+	0x7FFEAFEC, 0x7FFEBA43, 0x7FFEC448, 0x7FFECDFF, 0x7FFED769, 0x7FFEE089,
+	0x7FFEE961, 0x7FFEF1F3, 0x7FFEFA42, 0x7FFF0250, 0x7FFF0A1E, 0x7FFF11AF,
+	0x7FFF1904, 0x7FFF201F, 0x7FFF2702, 0x7FFF2DAF, 0x7FFF3428, 0x7FFF3A6D,
+	0x7FFF4081, 0x7FFF4665, 0x7FFF4C1B, 0x7FFF51A4, 0x7FFF5701, 0x7FFF5C34,
+	0x7FFF613F, 0x7FFF6621, 0x7FFF6ADD, 0x7FFF6F73, 0x7FFF73E6, 0x7FFF7835,
+	0x7FFF7C63, 0x7FFF8070, 0x7FFF845C, 0x7FFF882A, 0x7FFF8BDA, 0x7FFF8F6D,
+	0x7FFF92E3, 0x7FFF963F, 0x7FFF9980, 0x7FFF9CA7, 0x7FFF9FB6, 0x7FFFA2AC,
+	0x7FFFA58B, 0x7FFFA853, 0x7FFFAB06, 0x7FFFADA3, 0x7FFFB02C, 0x7FFFB2A1,
+	0x7FFFB502, 0x7FFFB751, 0x7FFFB98D, 0x7FFFBBB8, 0x7FFFBDD2, 0x7FFFBFDB,
+	0x7FFFC1D4, 0x7FFFC3BE, 0x7FFFC599, 0x7FFFC765, 0x7FFFC923, 0x7FFFCAD3,
+	0x7FFFCC75, 0x7FFFCE0B, 0x7FFFCF95, 0x7FFFD112, 0x7FFFD284, 0x7FFFD3EA,
+	0x7FFFD545, 0x7FFFD696, 0x7FFFD7DC, 0x7FFFD918, 0x7FFFDA4B, 0x7FFFDB74,
+	0x7FFFDC94, 0x7FFFDDAB, 0x7FFFDEB9, 0x7FFFDFBF, 0x7FFFE0BD, 0x7FFFE1B3,
+	0x7FFFE2A2, 0x7FFFE389, 0x7FFFE469, 0x7FFFE543, 0x7FFFE615, 0x7FFFE6E1,
+	0x7FFFE7A7, 0x7FFFE867, 0x7FFFE921, 0x7FFFE9D5, 0x7FFFEA84, 0x7FFFEB2D,
+	0x7FFFEBD1, 0x7FFFEC70, 0x7FFFED0A, 0x7FFFED9F, 0x7FFFEE30, 0x7FFFEEBC,
+	0x7FFFEF44, 0x7FFFEFC8, 0x7FFFF048, 0x7FFFF0C4, 0x7FFFF13C, 0x7FFFF1B0,
+	0x7FFFF221, 0x7FFFF28E, 0x7FFFF2F8, 0x7FFFF35F, 0x7FFFF3C2, 0x7FFFF422,
+	0x7FFFF480, 0x7FFFF4DA, 0x7FFFF532, 0x7FFFF587, 0x7FFFF5DA, 0x7FFFF62A,
+	0x7FFFF677, 0x7FFFF6C2, 0x7FFFF70B, 0x7FFFF752, 0x7FFFF796, 0x7FFFF7D8,
+	0x7FFFF819, 0x7FFFF857, 0x7FFFF893, 0x7FFFF8CE, 0x7FFFF906, 0x7FFFF93D,
+	0x7FFFF972, 0x7FFFF9A6, 0x7FFFF9D8, 0x7FFFFA09, 0x7FFFFA38, 0x7FFFFA65,
+	0x7FFFFA91, 0x7FFFFABC, 0x7FFFFAE6, 0x7FFFFB0E, 0x7FFFFB35, 0x7FFFFB5A,
+	0x7FFFFB7F, 0x7FFFFBA3, 0x7FFFFBC5, 0x7FFFFBE6, 0x7FFFFC07, 0x7FFFFC26,
+	0x7FFFFC44, 0x7FFFFC62, 0x7FFFFC7E, 0x7FFFFC9A, 0x7FFFFCB4, 0x7FFFFCCE,
+	0x7FFFFCE8, 0x7FFFFD00, 0x7FFFFD18, 0x7FFFFD2F, 0x7FFFFD45, 0x7FFFFD5A,
+	0x7FFFFD6F, 0x7FFFFD83, 0x7FFFFD97, 0x7FFFFDAA, 0x7FFFFDBC, 0x7FFFFDCE,
+	0x7FFFFDDF, 0x7FFFFDF0, 0x7FFFFE00, 0x7FFFFE10, 0x7FFFFE1F, 0x7FFFFE2E,
+	0x7FFFFE3D, 0x7FFFFE4A, 0x7FFFFE58, 0x7FFFFE65, 0x7FFFFE72, 0x7FFFFE7E,
+	0x7FFFFE8A, 0x7FFFFE95, 0x7FFFFEA0, 0x7FFFFEAB, 0x7FFFFEB6, 0x7FFFFEC0,
+	0x7FFFFECA, 0x7FFFFED3, 0x7FFFFEDC, 0x7FFFFEE5, 0x7FFFFEEE, 0x7FFFFEF7,
+	0x7FFFFEFF, 0x7FFFFF07, 0x7FFFFF0E, 0x7FFFFF16, 0x7FFFFF1D, 0x7FFFFF24,
+	0x7FFFFF2B, 0x7FFFFF31, 0x7FFFFF38, 0x7FFFFF3E, 0x7FFFFF44, 0x7FFFFF4A,
+	0x7FFFFF4F, 0x7FFFFF55, 0x7FFFFF5A, 0x7FFFFF5F, 0x7FFFFF64, 0x7FFFFF69,
+	0x7FFFFF6D, 0x7FFFFF72, 0x7FFFFF76, 0x7FFFFF7B, 0x7FFFFF7F, 0x7FFFFF83,
+	0x7FFFFF86, 0x7FFFFF8A, 0x7FFFFF8E, 0x7FFFFF91, 0x7FFFFF95, 0x7FFFFF98,
+	0x7FFFFF9B, 0x7FFFFF9E, 0x7FFFFFA1, 0x7FFFFFA4, 0x7FFFFFA7, 0x7FFFFFAA,
+	0x7FFFFFAC, 0x7FFFFFAF, 0x7FFFFFB2, 0x7FFFFFB4, 0x7FFFFFB6, 0x7FFFFFB9,
+	0x7FFFFFBB, 0x7FFFFFBD, 0x7FFFFFBF, 0x7FFFFFC1, 0x7FFFFFC3, 0x7FFFFFC5,
+	0x7FFFFFC7, 0x7FFFFFC8, 0x7FFFFFCA, 0x7FFFFFCC, 0x7FFFFFCD, 0x7FFFFFCF,
+	0x7FFFFFD0, 0x7FFFFFD2, 0x7FFFFFD3, 0x7FFFFFD5, 0x7FFFFFD6, 0x7FFFFFD7,
+	0x7FFFFFD9, 0x7FFFFFDA, 0x7FFFFFDB, 0x7FFFFFDC, 0x7FFFFFDD, 0x7FFFFFDE,
+	0x7FFFFFDF, 0x7FFFFFE0, 0x7FFFFFE1, 0x7FFFFFE2, 0x7FFFFFE3, 0x7FFFFFE4,
+	0x7FFFFFE5, 0x7FFFFFE6, 0x7FFFFFE7, 0x7FFFFFE7, 0x7FFFFFE8, 0x7FFFFFE9,
+	0x7FFFFFEA, 0x7FFFFFEA, 0x7FFFFFEB, 0x7FFFFFEC, 0x7FFFFFEC, 0x7FFFFFED,
+	0x7FFFFFED, 0x7FFFFFEE, 0x7FFFFFEE, 0x7FFFFFEF, 0x7FFFFFF0, 0x7FFFFFF0,
+	0x7FFFFFF1, 0x7FFFFFF1, 0x7FFFFFF1, 0x7FFFFFF2, 0x7FFFFFF2, 0x7FFFFFF3,
+	0x7FFFFFF3, 0x7FFFFFF4, 0x7FFFFFF4, 0x7FFFFFF4, 0x7FFFFFF5, 0x7FFFFFF5,
+	0x7FFFFFF5, 0x7FFFFFF6, 0x7FFFFFF6, 0x7FFFFFF6, 0x7FFFFFF7, 0x7FFFFFF7,
+	0x7FFFFFF7, 0x7FFFFFF7, 0x7FFFFFF8, 0x7FFFFFF8, 0x7FFFFFF8, 0x7FFFFFF8,
+	0x7FFFFFF9, 0x7FFFFFF9, 0x7FFFFFF9, 0x7FFFFFF9, 0x7FFFFFFA, 0x7FFFFFFA,
+	0x7FFFFFFA, 0x7FFFFFFA, 0x7FFFFFFA, 0x7FFFFFFA, 0x7FFFFFFB, 0x7FFFFFFB,
+	0x7FFFFFFB, 0x7FFFFFFB, 0x7FFFFFFB, 0x7FFFFFFB, 0x7FFFFFFC, 0x7FFFFFFC,
+	0x7FFFFFFC, 0x7FFFFFFC, 0x7FFFFFFC, 0x7FFFFFFC, 0x7FFFFFFC, 0x7FFFFFFC,
+	0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD,
+	0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFE,
+	0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE,
+	0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE,
+	0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF,
+	0x7FFFFFFF
+};
+
+/**
+ * \par
+ * Angles of the CORDIC rotations, in Q31 (1.31 fixed-point format) units of pi:
+ * <pre>
+ * for(i = 0; i < 31; i++)
+ * {
+ *	atanTable[i]= atan(pow(2, -i)) / pi * pow(2, 31) + 0.5;
+ * } </pre>
+ */
+const q31_t atanTable_q31[ATAN_TABLE_SIZE] = {
+	0x20000000, 0x12E4051E, 0x09FB385B, 0x051111D4, 0x028B0D43, 0x0145D7E1,
+	0x00A2F61E, 0x00517C55, 0x0028BE53, 0x00145F2F, 0x000A2F98, 0x000517CC,
+	0x00028BE6, 0x000145F3, 0x0000A2FA, 0x0000517D, 0x000028BE, 0x0000145F,
+	0x00000A30, 0x00000518, 0x0000028C, 0x00000146, 0x000000A3, 0x00000051,
+	0x00000029, 0x00000014, 0x0000000A, 0x00000005, 0x00000003, 0x00000001,
+	0x00000001
+};
@@ -0,0 +1,365 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_common_tables_gen.c
+ * Description:  Run time generation of the FFT twiddle factor and bit reversal tables
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/* Number of recurrence steps between two directly evaluated twiddle factors */
+#define TWIDDLE_GEN_ANCHOR_STEP   32U
+
+#define TWIDDLE_GEN_PI_2          1.57079632679489661923
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for a table arena.
+* @param[out] *A        points to the arena.
+* @param[in]  *pBuffer  points to the memory handed out by the arena.
+* @param[in]  size      size of the buffer in bytes.
+*
+* \par
+* The arena receives the tables generated by arm_cfft_table_init_f32() and
+* arm_rfft_fast_table_init_f32(). Several instances can share one arena, and
+* the buffer must stay valid for the lifetime of the instances.
+*/
+
+void arm_table_arena_init(
+  arm_table_arena * A,
+  void * pBuffer,
+  uint32_t size)
+{
+  A->pBase = (uint8_t *) pBuffer;
+  A->size = size;
+  A->used = 0U;
+}
+
+/**
+* @brief  Hands out a block of a table arena.
+* @param[in,out] *A     points to the arena.
+* @param[in]     size   size of the block in bytes.
+* @return        pointer to a 4 byte aligned block, or NULL if the arena is exhausted.
+*/
+
+void * arm_table_arena_alloc(
+  arm_table_arena * A,
+  uint32_t size)
+{
+  uint32_t offset;
+
+  /* Align the block on the buffer address, not only on the offset */
+  offset = (uint32_t) ((((uintptr_t) A->pBase + A->used + 3U) & ~(uintptr_t) 3U) - (uintptr_t) A->pBase);
+
+  if ((offset > A->size) || (size > A->size - offset))
+  {
+    return (NULL);
+  }
+
+  A->used = offset + size;
+
+  return (A->pBase + offset);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
+
+/*
+* @brief  Double precision sine and cosine of an angle in [0, 2*pi], evaluated
+*         with a Taylor series on the angle folded into the first quadrant.
+*/
+
+static void arm_sin_cos_f64(
+  float64_t x,
+  float64_t * pSin,
+  float64_t * pCos)
+{
+  uint32_t quadrant = 0U;
+  float64_t x2, term, s, c;
+  uint32_t n;
+
+  while (x >= TWIDDLE_GEN_PI_2)
+  {
+    x -= TWIDDLE_GEN_PI_2;
+    quadrant++;
+  }
+
+  x2 = x * x;
+
+  /* sin(x) = x - x^3/3! + x^5/5! - ... */
+  s = x;
+  term = x;
+  for (n = 2U; n < 26U; n += 2U)
+  {
+    term = -term * x2 / (float64_t) (n * (n + 1U));
+    s += term;
+  }
+
+  /* cos(x) = 1 - x^2/2! + x^4/4! - ... */
+  c = 1.0;
+  term = 1.0;
+  for (n = 1U; n < 25U; n += 2U)
+  {
+    term = -term * x2 / (float64_t) (n * (n + 1U));
+    c += term;
+  }
+
+  switch (quadrant & 3U)
+  {
+  case 0U:
+    *pSin = s;
+    *pCos = c;
+    break;
+  case 1U:
+    *pSin = c;
+    *pCos = -s;
+    break;
+  case 2U:
+    *pSin = -s;
+    *pCos = -c;
+    break;
+  default:
+    *pSin = -c;
+    *pCos = s;
+    break;
+  }
+}
+
+/**
+ * @brief  Generates the twiddle factors of a length <code>fftLen</code> transform.
+ * @param[out] *pDst      points to a buffer of <code>2*numPairs</code> values.
+ * @param[in]  fftLen     length of the transform the angles are taken from.
+ * @param[in]  numPairs   number of angles 2*pi*k/fftLen to generate, k = 0 .. numPairs-1, numPairs <= fftLen.
+ * @param[in]  sinFirst   0 stores {cos, sin} pairs as in twiddleCoef_N, 1 stores {sin, cos} pairs as in twiddleCoef_rfft_N.
+ *
+ * Only the first octant (or the first quadrant or half when <code>fftLen</code>
+ * is not a multiple of 8) is computed; the other angles are copied from it
+ * with the exact symmetries of sine and cosine. Within the computed range the
+ * values come from the trigonometric recurrence
+ * <code>z(k+1) = z(k) + z(k) * (exp(j*theta) - 1)</code> in double precision,
+ * restarted every 32 steps from a directly evaluated value so the recurrence
+ * error never accumulates beyond a few double precision ulps, well below the
+ * rounding to float32_t. The angles pi/2 and pi give exact zeros.
+ * \par
+ * The static twiddleCoef_N and twiddleCoef_rfft_N tables were printed with 9
+ * decimals, so a few of their entries are 1 ulp away from the correctly rounded
+ * value. The generated tables differ from them by at most 1 ulp (0 for the
+ * lengths up to 64), and a zero may have the opposite sign.
+ */
+
+void arm_twiddle_gen_f32(
+  float32_t * pDst,
+  uint32_t fftLen,
+  uint32_t numPairs,
+  uint32_t sinFirst)
+{
+  uint32_t k, last, src;
+  float64_t theta, alpha, beta, c, s, dc, ds;
+  float32_t tmp;
+
+  if ((fftLen % 8U) == 0U)
+  {
+    last = fftLen / 8U;
+  }
+  else if ((fftLen % 4U) == 0U)
+  {
+    last = fftLen / 4U;
+  }
+  else if ((fftLen % 2U) == 0U)
+  {
+    last = fftLen / 2U;
+  }
+  else
+  {
+    last = fftLen - 1U;
+  }
+
+  if (last > numPairs - 1U)
+  {
+    last = numPairs - 1U;
+  }
+
+  /* Recurrence coefficients: exp(j*theta) - 1 = -alpha + j*beta */
+  theta = 4.0 * TWIDDLE_GEN_PI_2 / (float64_t) fftLen;
+  arm_sin_cos_f64(0.5 * theta, &s, &c);
+  alpha = 2.0 * s * s;
+  arm_sin_cos_f64(theta, &beta, &c);
+
+  c = 1.0;
+  s = 0.0;
+
+  for (k = 0U; k <= last; k++)
+  {
+    if ((k % TWIDDLE_GEN_ANCHOR_STEP) == 0U)
+    {
+      arm_sin_cos_f64(theta * (float64_t) k, &s, &c);
+    }
+
+    if (4U * k == fftLen)
+    {
+      /* theta = pi/2 */
+      c = 0.0;
+      s = 1.0;
+    }
+    else if (2U * k == fftLen)
+    {
+      /* theta = pi */
+      c = -1.0;
+      s = 0.0;
+    }
+
+    pDst[2U * k]      = (float32_t) c;
+    pDst[2U * k + 1U] = (float32_t) s;
+
+    dc = alpha * c + beta * s;
+    ds = beta * c - alpha * s;
+    c -= dc;
+    s += ds;
+  }
+
+  /* Remaining angles from the symmetries, each source index is below k */
+  for (k = last + 1U; k < numPairs; k++)
+  {
+    if (((fftLen % 2U) == 0U) && (2U * k > fftLen))
+    {
+      /* theta = 2*pi - phi */
+      src = fftLen - k;
+      pDst[2U * k]      =  pDst[2U * src];
+      pDst[2U * k + 1U] = -pDst[2U * src + 1U];
+    }
+    else if (((fftLen % 4U) == 0U) && (4U * k > fftLen))
+    {
+      /* theta = pi/2 + phi */
+      src = k - fftLen / 4U;
+      pDst[2U * k]      = -pDst[2U * src + 1U];
+      pDst[2U * k + 1U] =  pDst[2U * src];
+    }
+    else
+    {
+      /* theta = pi/2 - phi */
+      src = fftLen / 4U - k;
+      pDst[2U * k]      = pDst[2U * src + 1U];
+      pDst[2U * k + 1U] = pDst[2U * src];
+    }
+  }
+
+  if (sinFirst != 0U)
+  {
+    for (k = 0U; k < numPairs; k++)
+    {
+      tmp = pDst[2U * k];
+      pDst[2U * k] = pDst[2U * k + 1U];
+      pDst[2U * k + 1U] = tmp;
+    }
+  }
+}
+
+/**
+ * @brief  Generates the table restoring the natural order of the CFFT output.
+ * @param[out] *pTable     points to a buffer of at least <code>2*fftLen</code> entries.
+ * @param[in]  fftLen      length of the CFFT.
+ * @param[in]  *pRadix     points to the radix of each stage, first stage first.
+ * @param[in]  numStages   number of stages.
+ * @param[in]  *pVisited   points to a scratch buffer of <code>fftLen</code> bytes.
+ * @return     number of entries written to <code>pTable</code>.
+ *
+ * The stages leave frequency k at the position obtained by reversing the mixed
+ * radix digits of k. Each cycle of this permutation is written as a chain of
+ * swaps in the format used by arm_bitreversal_32 (byte offsets of the complex
+ * samples). For the power of two lengths the stages are the radix-2 or radix-4
+ * stage followed by radix-8 stages, and the result is the same permutation as
+ * the armBitRevIndexTableN tables with the same number of entries, although
+ * the swaps may be listed in a different order. The number of entries is
+ * always a non-zero multiple of 4, as required by arm_bitreversal_32.
+ */
+
+uint16_t arm_bitrev_table_gen(
+  uint16_t * pTable,
+  uint32_t fftLen,
+  const uint8_t * pRadix,
+  uint32_t numStages,
+  uint8_t * pVisited)
+{
+  uint32_t k, cur, next, digits, n1, stage;
+  uint32_t tableLen = 0U;
+
+  memset(pVisited, 0, fftLen);
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    if (pVisited[k] != 0U)
+    {
+      continue;
+    }
+
+    cur = k;
+    pVisited[cur] = 1U;
+
+    while (1)
+    {
+      /* Position of frequency cur in the digit reversed output */
+      digits = cur;
+      n1 = fftLen;
+      next = 0U;
+      for (stage = 0U; stage < numStages; stage++)
+      {
+        n1 /= pRadix[stage];
+        next += (digits % pRadix[stage]) * n1;
+        digits /= pRadix[stage];
+      }
+
+      if (next == k)
+      {
+        break;
+      }
+
+      pTable[tableLen++] = (uint16_t) (cur * 8U);
+      pTable[tableLen++] = (uint16_t) (next * 8U);
+      pVisited[next] = 1U;
+      cur = next;
+    }
+  }
+
+  /* The Cortex-M3/M4/M7 code of arm_bitreversal_32 performs two swaps per
+     loop and the Cortex-M0 code does not check for an empty table, so the
+     table is padded with no-op swaps of sample 0 to a non-zero multiple of
+     4 entries. k = 0 is always a fixed point, so the padding fits. */
+  while ((tableLen == 0U) || ((tableLen % 4U) != 0U))
+  {
+    pTable[tableLen++] = 0U;
+    pTable[tableLen++] = 0U;
+  }
+
+  return ((uint16_t) tableLen);
+}
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_cmplx_f32.c
+ * Description:  Floating-point numerically controlled oscillator with complex output
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Floating-point NCO with complex output.
+ * @param[in,out] *S          points to an instance of the floating-point NCO structure.
+ * @param[out]    *pDst       points to the complex output vector, cosine and sine interleaved.
+ * @param[in]     blockSize   number of complex samples to generate.
+ * @return none.
+ *
+ * The output vector has <code>2*blockSize</code> values.
+ */
+
+void arm_nco_cmplx_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i vphase, vinc;                          /* phases of 4 samples and their increment */
+  __m128 vsin, vcos;                             /* outputs */
+
+  vphase = _mm_add_epi32(_mm_set1_epi32((int32_t) phase),
+                         _mm_mullo_epi32(_mm_set1_epi32((int32_t) phaseInc), _mm_setr_epi32(0, 1, 2, 3)));
+  vinc = _mm_set1_epi32((int32_t) (phaseInc << 2));
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Index of the table and fractional value of each phase */
+    arm_x86_sin_cos_hermite_ps(sinTable_f32, _mm_srli_epi32(vphase, 23),
+                               _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(vphase, _mm_set1_epi32(0x007FFFFF))),
+                                          _mm_set1_ps(1.19209290e-7f)),
+                               &vsin, &vcos);
+
+    /* Interleave the real and imaginary parts */
+    _mm_storeu_ps(pDst, _mm_unpacklo_ps(vcos, vsin));
+    _mm_storeu_ps(pDst + 4, _mm_unpackhi_ps(vcos, vsin));
+
+    vphase = _mm_add_epi32(vphase, vinc);
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  phase = (uint32_t) _mm_cvtsi128_si32(vphase);
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* Index of the table and fractional value, the fraction has 23 bits */
+    arm_sin_cos_hermite_f32(sinTable_f32, phase >> 23, (float32_t) (phase & 0x007FFFFFU) * 1.19209290e-7f,
+                            pDst + 1, pDst);
+
+    phase += phaseInc;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the phase for the next block */
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_cmplx_q31.c
+ * Description:  Q31 numerically controlled oscillator with complex output
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Q31 NCO with complex output.
+ * @param[in,out] *S          points to an instance of the Q31 NCO structure.
+ * @param[out]    *pDst       points to the complex output vector, cosine and sine interleaved.
+ * @param[in]     blockSize   number of complex samples to generate.
+ * @return none.
+ *
+ * The output vector has <code>2*blockSize</code> values.
+ */
+
+void arm_nco_cmplx_q31(
+  arm_nco_instance_q31 * S,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Index of the table and fractional value in 1.31 format */
+    arm_sin_cos_hermite_q31(sinTable_q31, phase >> 23, (q31_t) ((phase & 0x007FFFFFU) << 8), pDst + 1, pDst);
+
+    phase += phaseInc;
+    pDst += 2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the phase for the next block */
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
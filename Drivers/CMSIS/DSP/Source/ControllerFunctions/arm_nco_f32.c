@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_f32.c
+ * Description:  Floating-point numerically controlled oscillator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup NCO Numerically Controlled Oscillator
+ *
+ * Generates the sine and cosine of a phase that advances by a constant step at each sample,
+ * for mixers, modulators and field oriented control. The phase is kept in a 32-bit accumulator
+ * where a full turn is 2<sup>32</sup>, so it wraps around without any range reduction and does
+ * not drift, whatever the number of samples.
+ * <pre>
+ *     pSinVal[n] = sin(2 * pi * (phase + n * phaseInc) / 2^32)
+ *     pCosVal[n] = cos(2 * pi * (phase + n * phaseInc) / 2^32)
+ * </pre>
+ * The outputs are either two separate vectors or one complex vector <code>exp(j*theta)</code>,
+ * with the cosine and the sine interleaved as {real, imag}.
+ *
+ * The sine and cosine are computed as in the \ref SinCos functions. The floating-point and Q31
+ * versions use the cubic interpolation of arm_sin_cos_f32() and arm_sin_cos_q31() and the Q15
+ * version the linear interpolation of arm_vsin_cos_q15().
+ *
+ * \par Instance Structure
+ * The phase and the phase increment are stored in an instance data structure. A separate instance
+ * structure must be defined for each oscillator. The phase is updated by each call, so consecutive
+ * blocks are continuous. The frequency may be changed between two calls, without a phase jump,
+ * by writing a new increment to the <code>phaseInc</code> field, which is the frequency in cycles
+ * per sample times 2<sup>32</sup>.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type. The initialization
+ * function converts the phase increment and the initial phase to the accumulator format.
+ * The floating-point version takes angles in degrees, like arm_sin_cos_f32(), and the Q31 and
+ * Q15 versions take Q31 angles, like arm_sin_cos_q31().
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Floating-point NCO with separate sine and cosine outputs.
+ * @param[in,out] *S          points to an instance of the floating-point NCO structure.
+ * @param[out]    *pSinVal    points to the sine output vector.
+ * @param[out]    *pCosVal    points to the cosine output vector.
+ * @param[in]     blockSize   number of samples to generate.
+ * @return none.
+ */
+
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128i vphase, vinc;                          /* phases of 4 samples and their increment */
+  __m128 vsin, vcos;                             /* outputs */
+
+  vphase = _mm_add_epi32(_mm_set1_epi32((int32_t) phase),
+                         _mm_mullo_epi32(_mm_set1_epi32((int32_t) phaseInc), _mm_setr_epi32(0, 1, 2, 3)));
+  vinc = _mm_set1_epi32((int32_t) (phaseInc << 2));
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Index of the table and fractional value of each phase */
+    arm_x86_sin_cos_hermite_ps(sinTable_f32, _mm_srli_epi32(vphase, 23),
+                               _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(vphase, _mm_set1_epi32(0x007FFFFF))),
+                                          _mm_set1_ps(1.19209290e-7f)),
+                               &vsin, &vcos);
+
+    _mm_storeu_ps(pSinVal, vsin);
+    _mm_storeu_ps(pCosVal, vcos);
+
+    vphase = _mm_add_epi32(vphase, vinc);
+    pSinVal += 4;
+    pCosVal += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  phase = (uint32_t) _mm_cvtsi128_si32(vphase);
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* Index of the table and fractional value, the fraction has 23 bits */
+    arm_sin_cos_hermite_f32(sinTable_f32, phase >> 23, (float32_t) (phase & 0x007FFFFFU) * 1.19209290e-7f,
+                            pSinVal++, pCosVal++);
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the phase for the next block */
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_f32.c
+ * Description:  Floating-point NCO initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * @brief  Conversion of an angle in degrees to a phase where a full turn is 2^32.
+ * @param[in] degrees  angle in degrees.
+ * @return  phase.
+ */
+
+static uint32_t arm_nco_phase_f32(
+  float32_t degrees)
+{
+  float32_t turns;                               /* Angle in turns */
+
+  /* Keep the fractional part of the turns, in [-0.5 0.5) */
+  turns = degrees * 0.00277777777778f;
+  turns = turns - (int32_t) turns;
+
+  if (turns >= 0.5f)
+  {
+    turns = turns - 1.0f;
+  }
+  else if (turns < -0.5f)
+  {
+    turns = turns + 1.0f;
+  }
+
+  return ((uint32_t) (int32_t) (turns * 4294967296.0f));
+}
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point NCO.
+ * @param[in,out] *S         points to an instance of the floating-point NCO structure.
+ * @param[in]     phaseInc   phase increment per sample in degrees, the frequency is phaseInc / 360 cycles per sample.
+ * @param[in]     phase      initial phase in degrees.
+ * @return none.
+ *
+ * Both angles are converted to the 32-bit phase accumulator, so the frequency resolution is
+ * limited by the 24-bit mantissa of phaseInc / 360, to 2<sup>-25</sup> cycles per sample at worst.
+ */
+
+void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t phaseInc,
+  float32_t phase)
+{
+  S->phase = arm_nco_phase_f32(phase);
+  S->phaseInc = arm_nco_phase_f32(phaseInc);
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_q31.c
+ * Description:  Q31 NCO initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 NCO.
+ * @param[in,out] *S         points to an instance of the Q31 NCO structure.
+ * @param[in]     phaseInc   phase increment per sample in Q31 format, [-1 0.999999] maps to [-180 180) degrees.
+ * @param[in]     phase      initial phase in Q31 format, [-1 0.999999] maps to [-180 180) degrees.
+ * @return none.
+ *
+ * The Q31 angles are the phase accumulator values, so the frequency resolution is
+ * 2<sup>-32</sup> cycles per sample.
+ */
+
+void arm_nco_init_q31(
+  arm_nco_instance_q31 * S,
+  q31_t phaseInc,
+  q31_t phase)
+{
+  S->phase = (uint32_t) phase;
+  S->phaseInc = (uint32_t) phaseInc;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_q15.c
+ * Description:  Q15 numerically controlled oscillator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Q15 NCO with separate sine and cosine outputs.
+ * @param[in,out] *S          points to an instance of the Q15 NCO structure.
+ * @param[out]    *pSinVal    points to the sine output vector.
+ * @param[out]    *pCosVal    points to the cosine output vector.
+ * @param[in]     blockSize   number of samples to generate.
+ * @return none.
+ */
+
+void arm_nco_q15(
+  arm_nco_instance_q15 * S,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Linear interpolation with a 16-bit fraction */
+    arm_sin_cos_linear_q15(sinTable_q15, phase, pSinVal++, pCosVal++);
+
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the phase for the next block */
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -56,6 +56,11 @@
  *  -# Sine value is computed as <code> *psinVal = y0 + (fract * (y1 - y0))</code>.
  *  -# Fetch the value corresponding to \c index from cosine table to \c y0 and also value from \c index+1 to \c y1.
  *  -# Cosine value is computed as <code> *pcosVal = y0 + (fract * (y1 - y0))</code>.
+ *
+ * The block functions arm_vsin_cos_f32() and arm_vsin_cos_q31() compute the same values for
+ * a vector of angles, without the cost of a function call per sample. arm_vsin_cos_q15()
+ * interpolates linearly in the Q15 sine table instead, with a maximum error of 2 LSB.
+ * For angles that advance by a constant step, see the \ref NCO functions.
  */
 
  /**
@@ -77,9 +82,8 @@ void arm_sin_cos_f32(
                       float32_t * pCosVal)
 {
     float32_t fract, in;                             /* Temporary variables for input, output */
-    uint16_t indexS, indexC;                         /* Index variable */
-    float32_t f1, f2, d1, d2;                        /* Two nearest output values */
-    float32_t findex, Dn, Df, temp;
+    uint16_t indexS;                                 /* Index variable */
+    float32_t findex;
 
     /* input x is in degrees */
     /* Scale the input, divide input by 360, for cosine add 0.25 (pi/2) to read sine table */
@@ -95,44 +99,12 @@ void arm_sin_cos_f32(
     /* Calculation of index of the table */
     findex = (float32_t) FAST_MATH_TABLE_SIZE * in;
     indexS = ((uint16_t)findex) & 0x1ff;
-    indexC = (indexS + (FAST_MATH_TABLE_SIZE / 4)) & 0x1ff;
 
     /* fractional value calculation */
     fract = findex - (float32_t) indexS;
 
-    /* Read two nearest values of input value from the cos & sin tables */
-    f1 = sinTable_f32[indexC+0];
-    f2 = sinTable_f32[indexC+1];
-    d1 = -sinTable_f32[indexS+0];
-    d2 = -sinTable_f32[indexS+1];
-
-    temp = (1.0f - fract) * f1 + fract * f2;
-
-    Dn = 0.0122718463030f; // delta between the two points (fixed), in this case 2*pi/FAST_MATH_TABLE_SIZE
-    Df = f2 - f1;          // delta between the values of the functions
-
-    temp = Dn *(d1 + d2) - 2 * Df;
-    temp = fract * temp + (3 * Df - (d2 + 2 * d1) * Dn);
-    temp = fract * temp + d1 * Dn;
-
-    /* Calculation of cosine value */
-    *pCosVal = fract * temp + f1;
-
-    /* Read two nearest values of input value from the cos & sin tables */
-    f1 = sinTable_f32[indexS+0];
-    f2 = sinTable_f32[indexS+1];
-    d1 = sinTable_f32[indexC+0];
-    d2 = sinTable_f32[indexC+1];
-
-    temp = (1.0f - fract) * f1 + fract * f2;
-
-    Df = f2 - f1; // delta between the values of the functions
-    temp = Dn*(d1 + d2) - 2*Df;
-    temp = fract*temp + (3*Df - (d2 + 2*d1)*Dn);
-    temp = fract*temp + d1*Dn;
-
-    /* Calculation of sine value */
-    *pSinVal = fract*temp + f1;
+    /* Calculation of sine and cosine values */
+    arm_sin_cos_hermite_f32(sinTable_f32, indexS, fract, pSinVal, pCosVal);
 
     if (theta < 0.0f)
     {
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_cos_f32.c
+ * Description:  Floating-point block sine and cosine
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup SinCos
+ * @{
+ */
+
+/**
+ * @brief  Floating-point block sine and cosine.
+ * @param[in]  *pTheta    points to the input angles in degrees.
+ * @param[out] *pSinVal   points to the sine output vector.
+ * @param[out] *pCosVal   points to the cosine output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * The result of each sample is the same as the one of arm_sin_cos_f32(), without the cost of
+ * a function call per sample. The output vectors may overwrite the input vector.
+ */
+
+void arm_vsin_cos_f32(
+  const float32_t * pTheta,
+  float32_t * pSinVal,
+  float32_t * pCosVal,
+  uint32_t blockSize)
+{
+  float32_t theta, in, findex, fract;            /* Temporary variables for input, output */
+  uint32_t indexS;                               /* Index variable */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 x, vin, vfindex, vsin, vcos, neg;       /* temporary variables */
+  __m128i vindex;                                /* table indexes */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = _mm_loadu_ps(pTheta);
+
+    /* Scale the input to turns and keep the fractional part of its absolute value */
+    vin = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_mul_ps(x, _mm_set1_ps(0.00277777777778f)));
+    vin = _mm_sub_ps(vin, _mm_round_ps(vin, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+
+    /* Calculation of index of the table and of the fractional value */
+    vfindex = _mm_mul_ps(_mm_set1_ps((float32_t) FAST_MATH_TABLE_SIZE), vin);
+    vindex = _mm_and_si128(_mm_cvttps_epi32(vfindex), _mm_set1_epi32(0x1ff));
+
+    arm_x86_sin_cos_hermite_ps(sinTable_f32, vindex, _mm_sub_ps(vfindex, _mm_cvtepi32_ps(vindex)),
+                               &vsin, &vcos);
+
+    /* sin(-x) = -sin(x) */
+    neg = _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+    _mm_storeu_ps(pSinVal, _mm_xor_ps(vsin, neg));
+    _mm_storeu_ps(pCosVal, vcos);
+
+    pTheta += 4;
+    pSinVal += 4;
+    pCosVal += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    theta = *pTheta++;
+
+    /* Scale the input to turns and keep the fractional part of its absolute value */
+    in = theta * 0.00277777777778f;
+
+    if (in < 0.0f)
+    {
+      in = -in;
+    }
+
+    in = in - (int32_t) in;
+
+    /* Calculation of index of the table and of the fractional value */
+    findex = (float32_t) FAST_MATH_TABLE_SIZE * in;
+    indexS = ((uint32_t) findex) & 0x1ff;
+    fract = findex - (float32_t) indexS;
+
+    arm_sin_cos_hermite_f32(sinTable_f32, indexS, fract, pSinVal, pCosVal);
+
+    if (theta < 0.0f)
+    {
+      *pSinVal = -*pSinVal;
+    }
+
+    pSinVal++;
+    pCosVal++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SinCos group
+ */
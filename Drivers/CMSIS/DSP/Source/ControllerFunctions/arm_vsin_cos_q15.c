@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_cos_q15.c
+ * Description:  Q15 block sine and cosine
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup SinCos
+ * @{
+ */
+
+/**
+ * @brief  Q15 block sine and cosine.
+ * @param[in]  *pTheta    points to the input angles, [-1 0.9999] maps to [-180 180) degrees.
+ * @param[out] *pSinVal   points to the sine output vector.
+ * @param[out] *pCosVal   points to the cosine output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * The sine and cosine are interpolated linearly in the table <code>sinTable_q15</code>, with a
+ * maximum error of 2 LSB. The output vectors may overwrite the input vector.
+ */
+
+void arm_vsin_cos_q15(
+  const q15_t * pTheta,
+  q15_t * pSinVal,
+  q15_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* The angle is the upper half of a phase where a full turn is 2^32 */
+    arm_sin_cos_linear_q15(sinTable_q15, (uint32_t) (uint16_t) *pTheta++ << 16, pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SinCos group
+ */
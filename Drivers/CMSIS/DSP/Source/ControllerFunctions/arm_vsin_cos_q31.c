@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsin_cos_q31.c
+ * Description:  Q31 block sine and cosine
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup SinCos
+ * @{
+ */
+
+/**
+ * @brief  Q31 block sine and cosine.
+ * @param[in]  *pTheta    points to the input angles, [-1 0.999999] maps to [-180 180) degrees.
+ * @param[out] *pSinVal   points to the sine output vector.
+ * @param[out] *pCosVal   points to the cosine output vector.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * The result of each sample is the same as the one of arm_sin_cos_q31(), without the cost of
+ * a function call per sample. The output vectors may overwrite the input vector.
+ */
+
+void arm_vsin_cos_q31(
+  const q31_t * pTheta,
+  q31_t * pSinVal,
+  q31_t * pCosVal,
+  uint32_t blockSize)
+{
+  uint32_t theta;                                /* Input angle */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    theta = (uint32_t) *pTheta++;
+
+    /* Index of the table and fractional value in 1.31 format */
+    arm_sin_cos_hermite_q31(sinTable_q31, theta >> CONTROLLER_Q31_SHIFT,
+                            (q31_t) ((theta & 0x007FFFFFU) << 8), pSinVal++, pCosVal++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of SinCos group
+ */
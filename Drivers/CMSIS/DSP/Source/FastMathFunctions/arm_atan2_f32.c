@@ -0,0 +1,238 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_f32.c
+ * Description:  Fast two-argument arctangent for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * @brief  Two-argument arctangent of one pair of values.
+ * @param[in] y  y coordinate.
+ * @param[in] x  x coordinate.
+ * @return  atan2(y, x) in radians.
+ */
+
+static float32_t arm_atan2_kernel_f32(
+  float32_t y,
+  float32_t x)
+{
+  float32_t ax, ay, num, den, t, z, a, base;    /* Temporary variables */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } sy;                                          /* Bits of y, for the sign of -0 */
+
+  ax = (x < 0.0f) ? -x : x;
+  ay = (y < 0.0f) ? -y : y;
+
+  /* Reduce to the first octant, t = min / max in [0 1] */
+  if (ay > ax)
+  {
+    num = ax;
+    den = ay;
+  }
+  else
+  {
+    num = ay;
+    den = ax;
+  }
+
+  if (den == 0.0f)
+  {
+    return (0.0f);
+  }
+
+  /* Above tan(pi/8), atan(t) = pi/4 + atan((t - 1) / (t + 1)) */
+  if (num > (0.414213562f * den))
+  {
+    t = (num - den) / (num + den);
+    base = 0.785398163f;
+  }
+  else
+  {
+    t = num / den;
+    base = 0.0f;
+  }
+
+  /* atan(t) = t + t^3 * P(t^2) for |t| <= tan(pi/8) */
+  z = t * t;
+  a = 8.05374449538e-2f;
+  a = (a * z) - 1.38776856032e-1f;
+  a = (a * z) + 1.99777106478e-1f;
+  a = (a * z) - 3.33329491539e-1f;
+  a = (((a * z) * t) + t) + base;
+
+  /* Back to the quadrant of (x, y) */
+  if (ay > ax)
+  {
+    a = 1.57079633f - a;
+  }
+
+  if (x < 0.0f)
+  {
+    a = 3.14159265f - a;
+  }
+
+  /* The result has the sign of y, so that -0 gives -pi on the negative x axis */
+  sy.f = y;
+  if (sy.i < 0)
+  {
+    a = -a;
+  }
+
+  return (a);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Two-argument Arctangent
+ *
+ * Computes the angle of each point <code>(x, y)</code> of a pair of vectors.
+ * <pre>
+ *     pDst[n] = atan2(pSrcY[n], pSrcX[n]),   0 <= n < blockSize.
+ * </pre>
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ *
+ * The floating-point function reduces the point to the first octant, where
+ * <code>t = min(|x|,|y|) / max(|x|,|y|)</code> is in [0 1], reduces <code>t</code> once more to
+ * [-tan(pi/8) +tan(pi/8)] and evaluates an odd polynomial of degree 9. The result is in radians,
+ * in the range [-pi +pi], with a maximum error of 3 ULP. The result has the sign of <code>y</code>,
+ * also when <code>y</code> is zero, so that the negative x axis gives +pi for <code>y = +0</code>
+ * and -pi for <code>y = -0</code>. <code>atan2(0, 0)</code> is 0 and the inputs must be finite.
+ *
+ * The fixed-point functions use the CORDIC algorithm in vectoring mode, with shifts and
+ * additions only: the point is rotated towards the x axis by the angles <code>atan(2<sup>-i</sup>)</code>
+ * of the table <code>atanTable_q31</code>, after its magnitude has been normalized so that small
+ * inputs keep their precision. The result is the angle divided by pi, in 1.31 or 1.15 format.
+ * -pi is 0x80000000 and 0x8000, and +pi, which is not representable, saturates to 0x7FFFFFFF and
+ * 0x7FFF, so that the sign of the result follows the sign of <code>y</code> on the negative x axis.
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief Floating-point two-argument arctangent.
+ * @param[in]  *pSrcY     points to the vector of y coordinates.
+ * @param[in]  *pSrcX     points to the vector of x coordinates.
+ * @param[out] *pDst      points to the output vector of angles in radians.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ */
+
+void arm_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 x, y, ax, ay, num, den, t, z, a;        /* temporary variables */
+  __m128 swap, big, mask;                        /* lane masks */
+  __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    y = _mm_loadu_ps(pSrcY);
+    x = _mm_loadu_ps(pSrcX);
+    ax = _mm_and_ps(x, absMask);
+    ay = _mm_and_ps(y, absMask);
+
+    /* Reduce to the first octant */
+    swap = _mm_cmpgt_ps(ay, ax);
+    num = _mm_blendv_ps(ay, ax, swap);
+    den = _mm_blendv_ps(ax, ay, swap);
+
+    /* Above tan(pi/8), atan(t) = pi/4 + atan((t - 1) / (t + 1)) */
+    big = _mm_cmpgt_ps(num, _mm_mul_ps(_mm_set1_ps(0.414213562f), den));
+    t = _mm_div_ps(_mm_blendv_ps(num, _mm_sub_ps(num, den), big),
+                   _mm_blendv_ps(den, _mm_add_ps(num, den), big));
+
+    z = _mm_mul_ps(t, t);
+    a = _mm_set1_ps(8.05374449538e-2f);
+    a = _mm_sub_ps(_mm_mul_ps(a, z), _mm_set1_ps(1.38776856032e-1f));
+    a = _mm_add_ps(_mm_mul_ps(a, z), _mm_set1_ps(1.99777106478e-1f));
+    a = _mm_sub_ps(_mm_mul_ps(a, z), _mm_set1_ps(3.33329491539e-1f));
+    a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(a, z), t), t),
+                   _mm_and_ps(big, _mm_set1_ps(0.785398163f)));
+
+    /* Back to the quadrant of (x, y) */
+    a = _mm_blendv_ps(a, _mm_sub_ps(_mm_set1_ps(1.57079633f), a), swap);
+    mask = _mm_cmplt_ps(x, _mm_setzero_ps());
+    a = _mm_blendv_ps(a, _mm_sub_ps(_mm_set1_ps(3.14159265f), a), mask);
+    a = _mm_xor_ps(a, _mm_and_ps(y, _mm_set1_ps(-0.0f)));
+
+    /* atan2(0, 0) = 0 */
+    a = _mm_andnot_ps(_mm_cmpeq_ps(den, _mm_setzero_ps()), a);
+    _mm_storeu_ps(pDst, a);
+
+    pSrcY += 4;
+    pSrcX += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = atan2(A, B) */
+    *pDst++ = arm_atan2_kernel_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Fast two-argument arctangent for Q31 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/**
+ * @brief Q31 two-argument arctangent.
+ * @param[in]  *pSrcY     points to the vector of y coordinates.
+ * @param[in]  *pSrcX     points to the vector of x coordinates.
+ * @param[out] *pDst      points to the output vector of angles divided by pi.
+ * @param[in]  blockSize  number of samples in each vector.
+ * @return none.
+ *
+ * The coordinates may have any common scaling. The maximum error is 24 LSB, or 3.5e-8 radians,
+ * for points of any magnitude, as the point is normalized before the rotations.
+ * <code>atan2(0, 0)</code> is 0.
+ */
+
+void arm_atan2_q31(
+  const q31_t * pSrcY,
+  const q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t inX, inY;                                /* Input coordinates */
+  q31_t x, y, t;                                 /* Rotated point */
+  uint32_t absX, absY;                           /* Magnitudes of the coordinates */
+  uint32_t angle;                                /* Angle in units of pi, modulo 2 */
+  uint32_t norm, i;                              /* Normalization shift and loop counter */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    inY = *pSrcY++;
+    inX = *pSrcX++;
+
+    absX = (inX < 0) ? (0U - (uint32_t) inX) : (uint32_t) inX;
+    absY = (inY < 0) ? (0U - (uint32_t) inY) : (uint32_t) inY;
+
+    if ((absX | absY) == 0U)
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* Normalize the larger coordinate to bit 28. The CORDIC gain of 1.65 then keeps
+       * the rotated point below 2^31 */
+      norm = __CLZ(absX | absY);
+
+      if (norm >= 3U)
+      {
+        x = (q31_t) (absX << (norm - 3U));
+        y = (q31_t) (absY << (norm - 3U));
+      }
+      else
+      {
+        x = (q31_t) (absX >> (3U - norm));
+        y = (q31_t) (absY >> (3U - norm));
+      }
+
+      /* Rotate the point of the first quadrant to the x axis, accumulating the angles */
+      angle = 0U;
+
+      for (i = 0U; i < ATAN_TABLE_SIZE; i++)
+      {
+        if (y >= 0)
+        {
+          t = x + (y >> i);
+          y = y - (x >> i);
+          angle += (uint32_t) atanTable_q31[i];
+        }
+        else
+        {
+          t = x - (y >> i);
+          y = y + (x >> i);
+          angle -= (uint32_t) atanTable_q31[i];
+        }
+
+        x = t;
+      }
+
+      /* The CORDIC error can take the angle slightly out of the first quadrant,
+       * clamp it so that the quadrant mapping below cannot wrap around pi */
+      if ((int32_t) angle < 0)
+      {
+        angle = 0U;
+      }
+      else if (angle > 0x40000000U)
+      {
+        angle = 0x40000000U;
+      }
+
+      /* Back to the quadrant of (x, y), modulo 2 * pi */
+      if (inX < 0)
+      {
+        angle = 0x80000000U - angle;
+      }
+
+      if (inY < 0)
+      {
+        angle = 0U - angle;
+      }
+
+      /* +pi is not representable, saturate it so that the sign follows y */
+      if ((inY >= 0) && (angle == 0x80000000U))
+      {
+        angle = 0x7FFFFFFFU;
+      }
+
+      *pDst++ = (q31_t) angle;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Fast vector exponential for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vexp Vector Exponential
+ *
+ * Computes the exponential of each element of a floating-point vector.
+ * <pre>
+ *     pDst[n] = exp(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The input is split into <code>x = n * ln(2) + r</code> with an integer <code>n</code> and
+ * <code>|r| <= ln(2)/2</code>. <code>exp(r)</code> is computed with a polynomial of degree 7
+ * and multiplied by <code>2<sup>n</sup></code>, which is built directly in the exponent field
+ * of the result, so there is no table and no division. The scalar kernel is arm_exp_f32().
+ *
+ * The maximum error is 1 ULP over the whole input range. Inputs above 88.72 give +Inf,
+ * inputs below -87.34 give 0 instead of a denormal number, and NaN inputs give NaN.
+ */
+
+/**
+ * @addtogroup vexp
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector exponential.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in the vector.
+ * @return none.
+ */
+
+void arm_vexp_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    _mm_storeu_ps(pDst, arm_x86_exp_ps(_mm_loadu_ps(pSrc)));
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = exp(A) */
+    *pDst++ = arm_exp_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vexp group
+ */
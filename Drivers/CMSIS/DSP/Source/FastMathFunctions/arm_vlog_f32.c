@@ -0,0 +1,267 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Fast vector natural logarithm for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * @brief  Natural logarithm of one finite positive normal value.
+ * @param[in] x  input value.
+ * @return  log(x).
+ */
+
+static float32_t arm_log_kernel_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } u;                                           /* Bits of the input */
+  float32_t m, z, y, e;                          /* Temporary variables */
+
+  /* x = 2^e * m with m in [sqrt(1/2), sqrt(2)) */
+  u.f = x;
+  e = (float32_t) ((u.i >> 23) - 126);
+  u.i = (u.i & 0x007FFFFF) | 0x3F000000;
+  m = u.f;
+
+  if (m < 0.707106781f)
+  {
+    e = e - 1.0f;
+    m = (m + m) - 1.0f;
+  }
+  else
+  {
+    m = m - 1.0f;
+  }
+
+  /* log(1 + m) = m - m^2 / 2 + m^3 * P(m) */
+  z = m * m;
+  y = 7.0376836292e-2f;
+  y = (y * m) - 1.1514610310e-1f;
+  y = (y * m) + 1.1676998740e-1f;
+  y = (y * m) - 1.2420140846e-1f;
+  y = (y * m) + 1.4249322787e-1f;
+  y = (y * m) - 1.6668057665e-1f;
+  y = (y * m) + 2.0000714765e-1f;
+  y = (y * m) - 2.4999993993e-1f;
+  y = (y * m) + 3.3333331174e-1f;
+  y = (y * m) * z;
+
+  /* e * ln(2), with ln(2) split so that e * 0.693359375 is exact */
+  y = y - (e * 2.12194440e-4f);
+  y = y - (0.5f * z);
+
+  return ((m + y) + (e * 0.693359375f));
+}
+
+/*
+ * @brief  Natural logarithm of one value, with the special cases.
+ * @param[in] x  input value.
+ * @return  log(x).
+ */
+
+static float32_t arm_log_scalar_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } special;                                     /* Result for the special inputs */
+
+  if ((x >= 1.17549435e-38f) && (x <= 3.40282347e+38f))
+  {
+    return (arm_log_kernel_f32(x));
+  }
+  else if (x > 0.0f)
+  {
+    /* Denormal number, scaled by 2^25, or +Inf */
+    return ((x < 1.0f) ? (arm_log_kernel_f32(x * 33554432.0f) - 17.3286795f) : x);
+  }
+  else if (x == 0.0f)
+  {
+    special.i = (int32_t) 0xFF800000;
+  }
+  else
+  {
+    /* Negative number or NaN */
+    special.i = 0x7FC00000;
+  }
+
+  return (special.f);
+}
+
+#if defined (ARM_MATH_X86_SIMD)
+
+/*
+ * @brief  Natural logarithm of four values, same result as arm_log_kernel_f32().
+ * @param[in] x  input values, finite positive normal numbers.
+ * @return  log(x).
+ */
+
+static __m128 arm_x86_log_ps(
+  __m128 x)
+{
+  __m128i u = _mm_castps_si128(x);
+  __m128 m, z, y, e, small;
+
+  /* x = 2^e * m with m in [sqrt(1/2), sqrt(2)) */
+  e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srai_epi32(u, 23), _mm_set1_epi32(126)));
+  u = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000));
+  m = _mm_castsi128_ps(u);
+
+  small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781f));
+  e = _mm_blendv_ps(e, _mm_sub_ps(e, _mm_set1_ps(1.0f)), small);
+  m = _mm_sub_ps(_mm_blendv_ps(m, _mm_add_ps(m, m), small), _mm_set1_ps(1.0f));
+
+  /* log(1 + m) = m - m^2 / 2 + m^3 * P(m) */
+  z = _mm_mul_ps(m, m);
+  y = _mm_set1_ps(7.0376836292e-2f);
+  y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1514610310e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1676998740e-1f));
+  y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.2420140846e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.4249322787e-1f));
+  y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.6668057665e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.0000714765e-1f));
+  y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.4999993993e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(3.3333331174e-1f));
+  y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+
+  y = _mm_sub_ps(y, _mm_mul_ps(e, _mm_set1_ps(2.12194440e-4f)));
+  y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+
+  return (_mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f))));
+}
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vlog Vector Natural Logarithm
+ *
+ * Computes the natural logarithm of each element of a floating-point vector.
+ * <pre>
+ *     pDst[n] = log(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ *
+ * The input is split into <code>x = 2<sup>e</sup> * (1 + m)</code> by reading its exponent
+ * and mantissa fields, with <code>1 + m</code> in <code>[sqrt(1/2), sqrt(2))</code>.
+ * <code>log(1 + m)</code> is computed with a polynomial of degree 11 and
+ * <code>e * ln(2)</code> is added in two parts so that the first one is exact.
+ *
+ * The maximum error is 1 ULP over the positive numbers, denormal numbers included.
+ * Zero gives -Inf, +Inf gives +Inf, and negative and NaN inputs give NaN.
+ */
+
+/**
+ * @addtogroup vlog
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector natural logarithm.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in the vector.
+ * @return none.
+ */
+
+void arm_vlog_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 x, normal;                              /* temporary variables */
+  float32_t in[4];                               /* lanes that take the scalar path */
+  uint32_t k;                                    /* lane index */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = _mm_loadu_ps(pSrc);
+
+    /* Lanes that are not positive normal numbers take the scalar path */
+    normal = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(1.17549435e-38f)),
+                        _mm_cmple_ps(x, _mm_set1_ps(3.40282347e+38f)));
+    if (_mm_movemask_ps(normal) == 0xF)
+    {
+      _mm_storeu_ps(pDst, arm_x86_log_ps(x));
+    }
+    else
+    {
+      _mm_storeu_ps(in, x);
+
+      for (k = 0U; k < 4U; k++)
+      {
+        pDst[k] = arm_log_scalar_f32(in[k]);
+      }
+    }
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = log(A) */
+    *pDst++ = arm_log_scalar_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vlog group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsigmoid_f32.c
+ * Description:  Fast vector sigmoid for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vsigmoid Vector Sigmoid
+ *
+ * Computes the logistic sigmoid of each element of a vector.
+ * <pre>
+ *     pDst[n] = 1 / (1 + exp(-pSrc[n])),   0 <= n < blockSize.
+ * </pre>
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ *
+ * The floating-point function uses arm_exp_f32() and one division. Below -80, where
+ * <code>sigmoid(x)</code> equals <code>exp(x)</code> to within 1e-35, it computes
+ * <code>exp(x/2)<sup>2</sup></code> instead, so that the results below 1.2e-38, for inputs
+ * below -87.34, are denormal numbers rather than zero. The maximum error is 3 ULP, and results
+ * round to zero only below -103.97.
+ *
+ * The fixed-point functions interpolate the table <code>sigmoidTable_q31</code>, which holds
+ * <code>sigmoid(x)</code> for <code>x</code> from 0 to 24 with a spacing of 1/32, and use
+ * <code>sigmoid(-x) = 1 - sigmoid(x)</code> for negative inputs. The Q31 function uses cubic
+ * Hermite interpolation, with the slopes <code>sigmoid(x) * (1 - sigmoid(x))</code> computed
+ * from the table values, and the Q15 function uses linear interpolation.
+ * The Q31 input is in 6.26 format, for the range [-32 +32), and the Q15 input is in 5.11 format,
+ * for the range [-16 +16). The outputs are in 1.31 and 1.15 format and saturate to 0x7FFFFFFF
+ * and 0x7FFF for large positive inputs.
+ */
+
+/**
+ * @addtogroup vsigmoid
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector sigmoid.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in the vector.
+ * @return none.
+ */
+
+void arm_vsigmoid_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in, h;                               /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 x, e, r, tiny;                          /* temporary variables */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = _mm_loadu_ps(pSrc);
+    e = arm_x86_exp_ps(_mm_xor_ps(x, _mm_set1_ps(-0.0f)));
+    r = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_set1_ps(1.0f), e));
+
+    /* Denormal results, sigmoid(x) = exp(x / 2)^2 below -80 */
+    tiny = _mm_cmplt_ps(x, _mm_set1_ps(-80.0f));
+    if (_mm_movemask_ps(tiny) != 0)
+    {
+      e = arm_x86_exp_ps(_mm_mul_ps(x, _mm_set1_ps(0.5f)));
+      r = _mm_blendv_ps(r, _mm_mul_ps(e, e), tiny);
+    }
+
+    _mm_storeu_ps(pDst, r);
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    if (in < -80.0f)
+    {
+      /* C = exp(A / 2)^2, which keeps the denormal results */
+      h = arm_exp_f32(0.5f * in);
+      *pDst++ = h * h;
+    }
+    else
+    {
+      /* C = 1 / (1 + exp(-A)) */
+      *pDst++ = 1.0f / (1.0f + arm_exp_f32(-in));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vsigmoid group
+ */
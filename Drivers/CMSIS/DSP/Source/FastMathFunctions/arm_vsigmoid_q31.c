@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsigmoid_q31.c
+ * Description:  Fast vector sigmoid for Q31 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vsigmoid
+ * @{
+ */
+
+/**
+ * @brief Q31 vector sigmoid.
+ * @param[in]  *pSrc      points to the input vector in 6.26 format.
+ * @param[out] *pDst      points to the output vector in 1.31 format.
+ * @param[in]  blockSize  number of samples in the vector.
+ * @return none.
+ *
+ * The input range is [-32 +32). The maximum error is 2 LSB, and the output saturates to
+ * 0x7FFFFFFF above +21.5.
+ */
+
+void arm_vsigmoid_q31(
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in, out;                                 /* Temporary variables */
+  uint32_t absIn, index;                         /* Magnitude of the input and table index */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* |x| in units of 1/32, the table spacing */
+    absIn = (in < 0) ? (0U - (uint32_t) in) : (uint32_t) in;
+    index = absIn >> (26 - SIGMOID_TABLE_SHIFT);
+
+    if (index >= SIGMOID_TABLE_SIZE)
+    {
+      out = 0x7FFFFFFF;
+    }
+    else
+    {
+      out = arm_sigmoid_hermite_q31(sigmoidTable_q31, index,
+                                    (q31_t) ((absIn & 0x1FFFFFU) << 10));
+    }
+
+    /* sigmoid(-x) = 1 - sigmoid(x) */
+    if (in < 0)
+    {
+      out = (q31_t) (0x80000000U - (uint32_t) out);
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vsigmoid group
+ */
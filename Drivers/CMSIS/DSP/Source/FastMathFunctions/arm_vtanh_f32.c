@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_f32.c
+ * Description:  Fast vector hyperbolic tangent for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * @brief  Hyperbolic tangent of one value.
+ * @param[in] x  input value.
+ * @return  tanh(x).
+ */
+
+static float32_t arm_tanh_kernel_f32(
+  float32_t x)
+{
+  float32_t z, y;                                /* Temporary variables */
+
+  z = (x < 0.0f) ? -x : x;
+
+  if (z > 0.625f)
+  {
+    /* tanh(|x|) = 1 - 2 / (exp(2|x|) + 1), exp() overflows to +Inf for large inputs */
+    y = 1.0f - (2.0f / (arm_exp_f32(z + z) + 1.0f));
+
+    if (x < 0.0f)
+    {
+      y = -y;
+    }
+  }
+  else
+  {
+    /* tanh(x) = x + x^3 * P(x^2), without the cancellation of the formula above */
+    z = x * x;
+    y = -5.70498872745e-3f;
+    y = (y * z) + 2.06390887954e-2f;
+    y = (y * z) - 5.37397155531e-2f;
+    y = (y * z) + 1.33314422036e-1f;
+    y = (y * z) - 3.33332819422e-1f;
+    y = ((y * z) * x) + x;
+  }
+
+  return (y);
+}
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup vtanh Vector Hyperbolic Tangent
+ *
+ * Computes the hyperbolic tangent of each element of a vector.
+ * <pre>
+ *     pDst[n] = tanh(pSrc[n]),   0 <= n < blockSize.
+ * </pre>
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ *
+ * The floating-point function evaluates an odd polynomial of degree 11 for
+ * <code>|x| <= 0.625</code> and <code>1 - 2 / (exp(2|x|) + 1)</code> with arm_exp_f32()
+ * above. The maximum error is 2 ULP.
+ *
+ * The fixed-point functions use <code>tanh(x) = 2 * sigmoid(2x) - 1</code> and the sigmoid
+ * table of the \ref vsigmoid functions. The Q31 input is in 6.26 format, for the range
+ * [-32 +32), and the Q15 input is in 5.11 format, for the range [-16 +16). The outputs are
+ * in 1.31 and 1.15 format and saturate to 0x7FFFFFFF and 0x7FFF for large positive inputs.
+ */
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector hyperbolic tangent.
+ * @param[in]  *pSrc      points to the input vector.
+ * @param[out] *pDst      points to the output vector.
+ * @param[in]  blockSize  number of samples in the vector.
+ * @return none.
+ */
+
+void arm_vtanh_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 x, z, y, p, sign;                       /* temporary variables */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    x = _mm_loadu_ps(pSrc);
+    sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+    z = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+    /* Both formulas of the scalar code, selected per lane */
+    y = arm_x86_exp_ps(_mm_add_ps(z, z));
+    y = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(y, _mm_set1_ps(1.0f))));
+    y = _mm_xor_ps(y, sign);
+
+    z = _mm_mul_ps(x, x);
+    p = _mm_set1_ps(-5.70498872745e-3f);
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(2.06390887954e-2f));
+    p = _mm_sub_ps(_mm_mul_ps(p, z), _mm_set1_ps(5.37397155531e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(1.33314422036e-1f));
+    p = _mm_sub_ps(_mm_mul_ps(p, z), _mm_set1_ps(3.33332819422e-1f));
+    p = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), x), x);
+
+    z = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    _mm_storeu_ps(pDst, _mm_blendv_ps(p, y, _mm_cmpgt_ps(z, _mm_set1_ps(0.625f))));
+
+    pSrc += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = tanh(A) */
+    *pDst++ = arm_tanh_kernel_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
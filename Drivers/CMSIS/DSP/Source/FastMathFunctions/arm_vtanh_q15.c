@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_q15.c
+ * Description:  Fast vector hyperbolic tangent for Q15 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup vtanh
+ * @{
+ */
+
+/**
+ * @brief Q15 vector hyperbolic tangent.
+ * @param[in]  *pSrc      points to the input vector in 5.11 format.
+ * @param[out] *pDst      points to the output vector in 1.15 format.
+ * @param[in]  blockSize  number of samples in the vector.
+ * @return none.
+ *
+ * The input range is [-16 +16). The maximum error is 1 LSB, and the output saturates to
+ * +/-0x7FFF above +/-5.9.
+ */
+
+void arm_vtanh_q15(
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t in, y0, y1, s;                           /* Temporary variables */
+  uint32_t absIn, index, fract;                  /* Magnitude of the input, table index and fraction */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* |2x| in units of 1/32, the table spacing */
+    absIn = (uint32_t) ((in < 0) ? -in : in);
+    index = absIn >> (10 - SIGMOID_TABLE_SHIFT);
+    fract = absIn & 0x1FU;
+
+    if (index >= SIGMOID_TABLE_SIZE)
+    {
+      s = 0x7FFF;
+    }
+    else
+    {
+      /* tanh(|x|) = 2 * sigmoid(2|x|) - 1, linear interpolation in 1.31 format */
+      y0 = sigmoidTable_q31[index];
+      y1 = sigmoidTable_q31[index + 1U];
+      s = y0 + (q31_t) ((y1 - y0) * (q31_t) fract >> 5);
+      s = (q31_t) ((uint32_t) (s - 0x40000000) << 1);
+
+      /* Round to 1.15 format */
+      s = (s >> 16) + ((s >> 15) & 1);
+      s = (s > 0x7FFF) ? 0x7FFF : s;
+    }
+
+    /* tanh(-x) = -tanh(x) */
+    *pDst++ = (q15_t) ((in < 0) ? -s : s);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of vtanh group
+ */
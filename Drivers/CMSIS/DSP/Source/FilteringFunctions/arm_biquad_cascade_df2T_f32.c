@@ -38,7 +38,8 @@
 * This set of functions implements arbitrary order recursive (IIR) filters using a transposed direct form II structure.
 * The filters are implemented as a cascade of second order Biquad sections.
 * These functions provide a slight memory savings as compared to the direct form I Biquad filter functions.
-* Only floating-point data is supported.
+* The library provides functions for Q15, Q31, floating-point and double precision data, and
+* multi-channel functions for interleaved Q15 and floating-point data.
 *
 * This function operate on blocks of input and output data and each call to the function
 * processes <code>blockSize</code> samples through the filter.
@@ -93,9 +94,21 @@
 * The advantage of the Direct Form I structure is that it is numerically more robust for fixed-point data types.
 * That is why the Direct Form I structure supports Q15 and Q31 data types.
 * The transposed Direct Form II structure, on the other hand, requires a wide dynamic range for the state variables <code>d1</code> and <code>d2</code>.
-* Because of this, the CMSIS library only has a floating-point version of the Direct Form II Biquad.
+* The Q31 version rounds the state variables to 1.31 format after each sample, and the Q15 version keeps
+* them in 2.30 format in 32-bit words, so the Q15 version needs as much state memory as the Direct Form I one.
 * The advantage of the Direct Form II Biquad is that it requires half the number of state variables, 2 rather than 4, per Biquad stage.
 *
+* \par Multi-Channel Functions
+* The arm_biquad_cascade_mc_df2T functions filter <code>numChannels</code> interleaved channels,
+* each with its own coefficients, in a single call. <code>pSrc</code> and <code>pDst</code> contain
+* <code>blockSize*numChannels</code> values. The coefficients and state variables of all the channels
+* of a stage are stored together, channel 0 first:
+* <pre>
+*     {coefficients of stage 1 channel 0, coefficients of stage 1 channel 1, ..., coefficients of stage 2 channel 0, ...}
+* </pre>
+* On hosts built with <code>ARM_MATH_X86_SIMD</code> four channels are processed in the lanes of a
+* vector register. The results are the same as filtering each channel separately.
+*
 * \par Instance Structure
 * The coefficients and state variables for a filter are stored together in an instance data structure.
 * A separate instance structure must be defined for each filter.
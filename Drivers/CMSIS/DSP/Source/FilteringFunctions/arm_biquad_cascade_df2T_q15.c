@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df2T_q15.c
+ * Description:  Processing function for Q15 transposed direct form II Biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the Q15 transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of input data.
+* @param[out] *pDst     points to the block of output data
+* @param[in]  blockSize number of samples to process.
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The coefficients are in 1.15 format scaled down by <code>2^postShift</code>, as for arm_biquad_cascade_df1_q15().
+* The products are 2.30 values and the state variables are kept in 2.30 format in 32-bit words,
+* so no precision is lost in the state variables. The sums are computed with saturating additions,
+* one product at a time in the order of the difference equation.
+* Each output is shifted left by <code>postShift</code> bits, truncated to 1.15 format and saturated.
+*/
+
+void arm_biquad_cascade_df2T_q15(
+  const arm_biquad_cascade_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  source pointer            */
+  q15_t *pOut = pDst;                            /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q31_t acc;                                     /*  accumulator               */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q15_t Xn, Yn;                                  /*  temporary input/output    */
+  q31_t d1, d2;                                  /*  state variables           */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  output shift              */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    pCoeffs++;  /* skip the 0 coefficient */
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1, converted from 2.30 to 1.15 with the post shift */
+      acc = __QADD((q31_t) b0 * Xn, d1);
+      Yn = (q15_t) __SSAT(acc >> shift, 16);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = __QADD(__QADD((q31_t) b1 * Xn, (q31_t) a1 * Yn), d2);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = __QADD((q31_t) b2 * Xn, (q31_t) a2 * Yn);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1, converted from 2.30 to 1.15 with the post shift */
+      acc = clip_q63_to_q31((q63_t) ((q31_t) b0 * Xn) + d1);
+      Yn = (q15_t) __SSAT(acc >> shift, 16);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = clip_q63_to_q31((q63_t) ((q31_t) b1 * Xn) + ((q31_t) a1 * Yn));
+      d1 = clip_q63_to_q31((q63_t) d1 + d2);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = clip_q63_to_q31((q63_t) ((q31_t) b2 * Xn) + ((q31_t) a2 * Yn));
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df2T_q31.c
+ * Description:  Processing function for Q31 transposed direct form II Biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the Q31 transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of input data.
+* @param[out] *pDst     points to the block of output data
+* @param[in]  blockSize number of samples to process.
+* @return none.
+*
+* <b>Scaling and Overflow Behavior:</b>
+* \par
+* The function uses 64-bit internal accumulators.
+* The coefficients are in 1.31 format scaled down by <code>2^postShift</code>, as for arm_biquad_cascade_df1_q31().
+* Each output is accumulated in 2.62 format, shifted left by <code>postShift</code> bits, truncated
+* to 1.31 format and saturated.
+* The state variables are accumulated in 2.62 format and rounded to 1.31 format at the scale of the
+* coefficients, which gives them <code>postShift</code> bits of headroom; they are saturated as well.
+* Compared with arm_biquad_cascade_df1_q31() this adds the rounding noise of the two state variables
+* in exchange for half the state memory.
+*/
+
+void arm_biquad_cascade_df2T_q31(
+  const arm_biquad_cascade_df2T_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /*  source pointer            */
+  q31_t *pOut = pDst;                            /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q63_t acc;                                     /*  accumulator               */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q31_t Xn, Yn;                                  /*  temporary input/output    */
+  q31_t d1, d2;                                  /*  state variables           */
+  uint32_t shift = 31U - (uint32_t) S->postShift; /*  output shift              */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Apply loop unrolling and compute 2 output values at a time. */
+    sample = blockSize >> 1U;
+
+    while (sample > 0U)
+    {
+      /* y[n] = b0 * x[n] + d1 */
+      Xn = pIn[0];
+      acc = (q63_t) b0 * Xn + ((q63_t) d1 << 31);
+      Yn = clip_q63_to_q31(acc >> shift);
+      pOut[0] = Yn;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      acc = (q63_t) b1 * Xn + (q63_t) a1 * Yn + ((q63_t) d2 << 31);
+      d1 = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc = (q63_t) b2 * Xn + (q63_t) a2 * Yn;
+      d2 = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+      /* Second sample */
+      Xn = pIn[1];
+      acc = (q63_t) b0 * Xn + ((q63_t) d1 << 31);
+      Yn = clip_q63_to_q31(acc >> shift);
+      pOut[1] = Yn;
+
+      acc = (q63_t) b1 * Xn + (q63_t) a1 * Yn + ((q63_t) d2 << 31);
+      d1 = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+      acc = (q63_t) b2 * Xn + (q63_t) a2 * Yn;
+      d2 = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+      pIn += 2U;
+      pOut += 2U;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* If the blockSize is not a multiple of 2, compute the remaining output sample here. */
+    sample = blockSize & 0x1U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    sample = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (sample > 0U)
+    {
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc = (q63_t) b0 * Xn + ((q63_t) d1 << 31);
+
+      /* The result is converted from 2.62 to 1.31 with the post shift and saturated */
+      Yn = clip_q63_to_q31(acc >> shift);
+
+      /* Store the output in the destination buffer. */
+      *pOut++ = Yn;
+
+      /* Every time after the output is computed state should be updated. */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      acc = (q63_t) b1 * Xn + (q63_t) a1 * Yn + ((q63_t) d2 << 31);
+      d1 = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      acc = (q63_t) b2 * Xn + (q63_t) a2 * Yn;
+      d2 = clip_q63_to_q31((acc + 0x40000000) >> 31);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
@@ -0,0 +1,253 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df2T_f32.c
+ * Description:  Processing function for floating-point multi-channel transposed direct form II Biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data
+* @param[in]  blockSize number of samples to process in each channel.
+* @return none.
+*
+* \par
+* Each stage is run over the whole block for one group of channels at a time, so the coefficients
+* and state variables of the group stay in registers. <code>pSrc</code> and <code>pDst</code> may
+* point to the same buffer.
+*/
+
+void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *pX, *pY;                            /*  channel input and output  */
+  float32_t acc1;                                /*  accumulator               */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn1;                                 /*  temporary input           */
+  float32_t d1, d2;                              /*  state variables           */
+  uint32_t numCh = S->numChannels;               /*  number of channels        */
+  uint32_t ch, sample, stage = S->numStages;     /*  loop counters             */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  __m128 vb0, vb1, vb2, va1, va2, vd1, vd2, vx, vacc;
+  float32_t d[8];
+
+#elif defined (ARM_MATH_DSP)
+
+  float32_t b0b, b1b, b2b, a1b, a2b;             /*  Second channel coefficients */
+  float32_t Xn1b, acc1b, d1b, d2b;               /*  Second channel variables  */
+
+#endif
+
+  do
+  {
+    ch = 0U;
+
+#if defined (ARM_MATH_X86_SIMD)
+
+    /* Run the below code for x86-64 hosts with SSE4.1 */
+
+    /* Four channels at a time, one per lane */
+    while ((ch + 4U) <= numCh)
+    {
+      vb0 = _mm_setr_ps(pCoeffs[0], pCoeffs[5], pCoeffs[10], pCoeffs[15]);
+      vb1 = _mm_setr_ps(pCoeffs[1], pCoeffs[6], pCoeffs[11], pCoeffs[16]);
+      vb2 = _mm_setr_ps(pCoeffs[2], pCoeffs[7], pCoeffs[12], pCoeffs[17]);
+      va1 = _mm_setr_ps(pCoeffs[3], pCoeffs[8], pCoeffs[13], pCoeffs[18]);
+      va2 = _mm_setr_ps(pCoeffs[4], pCoeffs[9], pCoeffs[14], pCoeffs[19]);
+      vd1 = _mm_setr_ps(pState[0], pState[2], pState[4], pState[6]);
+      vd2 = _mm_setr_ps(pState[1], pState[3], pState[5], pState[7]);
+
+      pX = pIn + ch;
+      pY = pDst + ch;
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        vx = _mm_loadu_ps(pX);
+
+        /* y[n] = b0 * x[n] + d1 */
+        vacc = _mm_add_ps(_mm_mul_ps(vb0, vx), vd1);
+        _mm_storeu_ps(pY, vacc);
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        vd1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vb1, vx), _mm_mul_ps(va1, vacc)), vd2);
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        vd2 = _mm_add_ps(_mm_mul_ps(vb2, vx), _mm_mul_ps(va2, vacc));
+
+        pX += numCh;
+        pY += numCh;
+        sample--;
+      }
+
+      /* Store the updated state variables back in channel order */
+      _mm_storeu_ps(d, _mm_unpacklo_ps(vd1, vd2));
+      _mm_storeu_ps(d + 4, _mm_unpackhi_ps(vd1, vd2));
+      memcpy(pState, d, sizeof(d));
+
+      pCoeffs += 20U;
+      pState += 8U;
+      ch += 4U;
+    }
+
+#elif defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two channels at a time, the two recursions hide each other's latency */
+    while ((ch + 2U) <= numCh)
+    {
+      b0 = pCoeffs[0];
+      b1 = pCoeffs[1];
+      b2 = pCoeffs[2];
+      a1 = pCoeffs[3];
+      a2 = pCoeffs[4];
+      b0b = pCoeffs[5];
+      b1b = pCoeffs[6];
+      b2b = pCoeffs[7];
+      a1b = pCoeffs[8];
+      a2b = pCoeffs[9];
+
+      d1 = pState[0];
+      d2 = pState[1];
+      d1b = pState[2];
+      d2b = pState[3];
+
+      pX = pIn + ch;
+      pY = pDst + ch;
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        Xn1 = pX[0];
+        Xn1b = pX[1];
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1 = (b0 * Xn1) + d1;
+        acc1b = (b0b * Xn1b) + d1b;
+
+        pY[0] = acc1;
+        pY[1] = acc1b;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d1b = ((b1b * Xn1b) + (a1b * acc1b)) + d2b;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn1) + (a2 * acc1);
+        d2b = (b2b * Xn1b) + (a2b * acc1b);
+
+        pX += numCh;
+        pY += numCh;
+        sample--;
+      }
+
+      pState[0] = d1;
+      pState[1] = d2;
+      pState[2] = d1b;
+      pState[3] = d2b;
+
+      pCoeffs += 10U;
+      pState += 4U;
+      ch += 2U;
+    }
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+    /* Remaining channels one at a time */
+    while (ch < numCh)
+    {
+      b0 = pCoeffs[0];
+      b1 = pCoeffs[1];
+      b2 = pCoeffs[2];
+      a1 = pCoeffs[3];
+      a2 = pCoeffs[4];
+
+      d1 = pState[0];
+      d2 = pState[1];
+
+      pX = pIn + ch;
+      pY = pDst + ch;
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        Xn1 = *pX;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1 = (b0 * Xn1) + d1;
+        *pY = acc1;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn1) + (a2 * acc1);
+
+        pX += numCh;
+        pY += numCh;
+        sample--;
+      }
+
+      pState[0] = d1;
+      pState[1] = d2;
+
+      pCoeffs += 5U;
+      pState += 2U;
+      ch++;
+    }
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df2T_q15.c
+ * Description:  Processing function for Q15 multi-channel transposed direct form II Biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the Q15 multi-channel transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input data.
+* @param[out] *pDst     points to the block of interleaved output data
+* @param[in]  blockSize number of samples to process in each channel.
+* @return none.
+*
+* \par
+* Each channel gives the same output as arm_biquad_cascade_df2T_q15() with the coefficients of
+* the channel, see that function for the scaling and overflow behavior. <code>pSrc</code> and
+* <code>pDst</code> may point to the same buffer.
+* \par
+* The Cortex-M dual 16-bit multiply-accumulate instructions add the two halfword products,
+* so they cannot keep two channels apart; on the target each stage is run over the whole block
+* for one channel at a time with its coefficients and state in registers.
+*/
+
+void arm_biquad_cascade_mc_df2T_q15(
+  const arm_biquad_cascade_mc_df2T_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /*  source pointer            */
+  q31_t *pState = S->pState;                     /*  State pointer             */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q15_t *pX, *pY;                                /*  channel input and output  */
+  q31_t acc;                                     /*  accumulator               */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q15_t Xn, Yn;                                  /*  temporary input/output    */
+  q31_t d1, d2;                                  /*  state variables           */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  output shift              */
+  uint32_t numCh = S->numChannels;               /*  number of channels        */
+  uint32_t ch, sample, stage = S->numStages;     /*  loop counters             */
+
+#if defined (ARM_MATH_X86_SIMD)
+
+  __m128i vb0, vb1, vb2, va1, va2, vd1, vd2, vx, vy, vacc;
+  __m128i vshift = _mm_cvtsi32_si128(shift);
+  q31_t d[8];
+
+#endif
+
+  do
+  {
+    ch = 0U;
+
+#if defined (ARM_MATH_X86_SIMD)
+
+    /* Run the below code for x86-64 hosts with SSE4.1 */
+
+    /* Four channels at a time, one per 32-bit lane */
+    while ((ch + 4U) <= numCh)
+    {
+      vb0 = _mm_setr_epi32(pCoeffs[0], pCoeffs[6], pCoeffs[12], pCoeffs[18]);
+      vb1 = _mm_setr_epi32(pCoeffs[2], pCoeffs[8], pCoeffs[14], pCoeffs[20]);
+      vb2 = _mm_setr_epi32(pCoeffs[3], pCoeffs[9], pCoeffs[15], pCoeffs[21]);
+      va1 = _mm_setr_epi32(pCoeffs[4], pCoeffs[10], pCoeffs[16], pCoeffs[22]);
+      va2 = _mm_setr_epi32(pCoeffs[5], pCoeffs[11], pCoeffs[17], pCoeffs[23]);
+      vd1 = _mm_setr_epi32(pState[0], pState[2], pState[4], pState[6]);
+      vd2 = _mm_setr_epi32(pState[1], pState[3], pState[5], pState[7]);
+
+      pX = pIn + ch;
+      pY = pDst + ch;
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        vx = _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i *) pX));
+
+        /* y[n] = b0 * x[n] + d1, the 16x16 products are exact in 32 bits */
+        vacc = arm_x86_qadd_q31(_mm_mullo_epi32(vb0, vx), vd1);
+
+        /* Shift and saturate to 1.15, same result as __SSAT(acc >> shift, 16) */
+        vy = _mm_packs_epi32(_mm_sra_epi32(vacc, vshift), _mm_setzero_si128());
+        _mm_storel_epi64((__m128i *) pY, vy);
+        vy = _mm_cvtepi16_epi32(vy);
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        vd1 = arm_x86_qadd_q31(arm_x86_qadd_q31(_mm_mullo_epi32(vb1, vx), _mm_mullo_epi32(va1, vy)), vd2);
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        vd2 = arm_x86_qadd_q31(_mm_mullo_epi32(vb2, vx), _mm_mullo_epi32(va2, vy));
+
+        pX += numCh;
+        pY += numCh;
+        sample--;
+      }
+
+      /* Store the updated state variables back in channel order */
+      _mm_storeu_si128((__m128i *) d, _mm_unpacklo_epi32(vd1, vd2));
+      _mm_storeu_si128((__m128i *) (d + 4), _mm_unpackhi_epi32(vd1, vd2));
+      memcpy(pState, d, sizeof(d));
+
+      pCoeffs += 24U;
+      pState += 8U;
+      ch += 4U;
+    }
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+    /* Remaining channels one at a time */
+    while (ch < numCh)
+    {
+      /* Reading the coefficients */
+      b0 = pCoeffs[0];
+      b1 = pCoeffs[2];
+      b2 = pCoeffs[3];
+      a1 = pCoeffs[4];
+      a2 = pCoeffs[5];
+
+      /* Reading the state values */
+      d1 = pState[0];
+      d2 = pState[1];
+
+      pX = pIn + ch;
+      pY = pDst + ch;
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        Xn = *pX;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc = __QADD((q31_t) b0 * Xn, d1);
+        Yn = (q15_t) __SSAT(acc >> shift, 16);
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = __QADD(__QADD((q31_t) b1 * Xn, (q31_t) a1 * Yn), d2);
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = __QADD((q31_t) b2 * Xn, (q31_t) a2 * Yn);
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc = clip_q63_to_q31((q63_t) ((q31_t) b0 * Xn) + d1);
+        Yn = (q15_t) __SSAT(acc >> shift, 16);
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = clip_q63_to_q31((q63_t) ((q31_t) b1 * Xn) + ((q31_t) a1 * Yn));
+        d1 = clip_q63_to_q31((q63_t) d1 + d2);
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = clip_q63_to_q31((q63_t) ((q31_t) b2 * Xn) + ((q31_t) a2 * Yn));
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        *pY = Yn;
+
+        pX += numCh;
+        pY += numCh;
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = d1;
+      pState[1] = d2;
+
+      pCoeffs += 6U;
+      pState += 2U;
+      ch++;
+    }
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+* @} end of BiquadCascadeDF2T group
+*/
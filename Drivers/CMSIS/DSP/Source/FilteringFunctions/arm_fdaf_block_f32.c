@@ -0,0 +1,270 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_block_f32.c
+ * Description:  Floating-point frequency-domain adaptive filter, one block
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * @brief  Adds the product of two packed real FFT outputs to a third one.
+ * @param[in]     *pA      points to the first spectrum.
+ * @param[in]     *pB      points to the second spectrum.
+ * @param[in,out] *pAcc    points to the accumulated spectrum.
+ * @param[in]     fftLen   real FFT length.
+ */
+
+static void arm_fdaf_cmac_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pAcc,
+  uint32_t fftLen)
+{
+  uint32_t blkCnt = (fftLen >> 1U) - 1U;         /* Bins between DC and Nyquist */
+  float32_t ar, ai, br, bi;                      /* Temporary variables */
+
+  /* DC and Nyquist are real, packed in the first two slots */
+  pAcc[0] += pA[0] * pB[0];
+  pAcc[1] += pA[1] * pB[1];
+
+  pA += 2;
+  pB += 2;
+  pAcc += 2;
+
+  while (blkCnt > 0U)
+  {
+    /* Acc += A * B */
+    ar = *pA++;
+    ai = *pA++;
+    br = *pB++;
+    bi = *pB++;
+
+    *pAcc++ += (ar * br) - (ai * bi);
+    *pAcc++ += (ar * bi) + (ai * br);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/*
+ * @brief  Adds the product of the conjugate of a packed real FFT output and
+ *         of another one to a third one.
+ * @param[in]     *pA      points to the spectrum that is conjugated.
+ * @param[in]     *pB      points to the second spectrum.
+ * @param[in,out] *pAcc    points to the accumulated spectrum.
+ * @param[in]     fftLen   real FFT length.
+ */
+
+static void arm_fdaf_cmac_conj_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+  float32_t * pAcc,
+  uint32_t fftLen)
+{
+  uint32_t blkCnt = (fftLen >> 1U) - 1U;         /* Bins between DC and Nyquist */
+  float32_t ar, ai, br, bi;                      /* Temporary variables */
+
+  pAcc[0] += pA[0] * pB[0];
+  pAcc[1] += pA[1] * pB[1];
+
+  pA += 2;
+  pB += 2;
+  pAcc += 2;
+
+  while (blkCnt > 0U)
+  {
+    /* Acc += conj(A) * B */
+    ar = *pA++;
+    ai = *pA++;
+    br = *pB++;
+    bi = *pB++;
+
+    *pAcc++ += (ar * br) + (ai * bi);
+    *pAcc++ += (ar * bi) - (ai * br);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/*
+ * @brief  Updates the input power of each bin and scales the error spectrum by
+ *         the normalized step size of its bin.
+ * @param[in,out] *S      points to an instance of the frequency-domain adaptive filter.
+ * @param[in]     *pX0    points to the spectrum of the newest input block.
+ */
+
+static void arm_fdaf_normalize_f32(
+  arm_fdaf_instance_f32 * S,
+  const float32_t * pX0)
+{
+  float32_t *pPower = S->pPower;                 /* Power of the bins */
+  float32_t *pE = S->pE;                         /* Error spectrum */
+  uint32_t L = S->blockLen;                      /* Number of bins but one */
+  float32_t minPower = 2.0f * (float32_t) L * S->delta;  /* Power floor of a bin */
+  float32_t gain = S->mu / (float32_t) S->numPartitions;  /* Step shared by the partitions */
+  float32_t beta = 1.0f - S->alpha;              /* Weight of the new power */
+  float32_t re, im, p;                           /* Temporary variables */
+  uint32_t k;                                    /* Bin index */
+
+  /* The first block sets the estimates */
+  if (pPower[0] < 0.0f)
+  {
+    beta = 1.0f;
+    pPower[0] = 0.0f;
+    pPower[L] = 0.0f;
+
+    for (k = 1U; k < L; k++)
+    {
+      pPower[k] = 0.0f;
+    }
+  }
+
+  /* DC and Nyquist, packed in the first two slots */
+  p = pX0[0] * pX0[0];
+  pPower[0] += beta * (p - pPower[0]);
+  pE[0] *= gain / (pPower[0] + minPower);
+
+  p = pX0[1] * pX0[1];
+  pPower[L] += beta * (p - pPower[L]);
+  pE[1] *= gain / (pPower[L] + minPower);
+
+  for (k = 1U; k < L; k++)
+  {
+    re = pX0[2U * k];
+    im = pX0[2U * k + 1U];
+    p = (re * re) + (im * im);
+    pPower[k] += beta * (p - pPower[k]);
+
+    p = gain / (pPower[k] + minPower);
+    pE[2U * k] *= p;
+    pE[2U * k + 1U] *= p;
+  }
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Processing function for one block of the floating-point frequency-domain adaptive filter.
+ * @param[in,out] *S      points to an instance of the floating-point frequency-domain adaptive filter structure.
+ * @param[in]     *pSrc   points to the <code>blockLen</code> input samples.
+ * @param[in]     *pRef   points to the <code>blockLen</code> reference samples.
+ * @param[out]    *pOut   points to the <code>blockLen</code> output samples.
+ * @param[out]    *pErr   points to the <code>blockLen</code> error samples.
+ * @return        none.
+ *
+ * \par
+ * The output and the error are those of the input block, without delay. The
+ * buffers of arm_fdaf_f32() are not used, so the two functions must not be
+ * mixed on the same instance.
+ */
+
+void arm_fdaf_block_f32(
+  arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr)
+{
+  uint32_t L = S->blockLen;                      /* Block length */
+  uint32_t N = 2U * L;                           /* FFT length */
+  uint32_t P = S->numPartitions;                 /* Number of partitions */
+  float32_t *pX0;                                /* Spectrum of the newest input block */
+  float32_t *pWc;                                /* Weights constrained by this block */
+  float32_t y, e;                                /* Output and error samples */
+  uint32_t p, slot, n;                           /* Loop counters and slot index */
+
+  /* Spectrum of the last two input blocks, stored in the slot of the oldest one */
+  memmove(S->pIn, S->pIn + L, L * sizeof(float32_t));
+  memcpy(S->pIn + L, pSrc, L * sizeof(float32_t));
+
+  S->head = (S->head == 0U) ? (uint16_t) (P - 1U) : (uint16_t) (S->head - 1U);
+  pX0 = S->pX + S->head * N;
+
+  memcpy(S->pWork, S->pIn, N * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, S->pWork, pX0, 0U);
+
+  /* Output spectrum: partition p filters the input spectrum p blocks old */
+  memset(S->pE, 0, N * sizeof(float32_t));
+  slot = S->head;
+
+  for (p = 0U; p < P; p++)
+  {
+    arm_fdaf_cmac_f32(S->pW + p * N, S->pX + slot * N, S->pE, N);
+    slot = ((slot + 1U) == P) ? 0U : (slot + 1U);
+  }
+
+  /* Overlap-save: the last blockLen samples of the circular convolution are valid */
+  arm_rfft_fast_f32(&S->rfft, S->pE, S->pWork, 1U);
+
+  for (n = 0U; n < L; n++)
+  {
+    y = S->pWork[L + n];
+    e = pRef[n] - y;
+
+    pOut[n] = y;
+    pErr[n] = e;
+
+    /* Error block behind blockLen zeros, to correlate it with the input */
+    S->pWork[n] = 0.0f;
+    S->pWork[L + n] = e;
+  }
+
+  arm_rfft_fast_f32(&S->rfft, S->pWork, S->pE, 0U);
+  arm_fdaf_normalize_f32(S, pX0);
+
+  /* Unconstrained gradient step of every partition */
+  slot = S->head;
+
+  for (p = 0U; p < P; p++)
+  {
+    arm_fdaf_cmac_conj_f32(S->pX + slot * N, S->pE, S->pW + p * N, N);
+    slot = ((slot + 1U) == P) ? 0U : (slot + 1U);
+  }
+
+  /* Gradient constraint of one partition per block: the second half of its
+     impulse response, which would wrap around in the circular convolution,
+     is cleared */
+  pWc = S->pW + S->constrainIndex * N;
+
+  arm_rfft_fast_f32(&S->rfft, pWc, S->pWork, 1U);
+  memset(S->pWork + L, 0, L * sizeof(float32_t));
+  arm_rfft_fast_f32(&S->rfft, S->pWork, pWc, 0U);
+
+  S->constrainIndex = ((S->constrainIndex + 1U) == P) ? 0U : (uint16_t) (S->constrainIndex + 1U);
+}
+
+/**
+ * @} end of FDAF group
+ */
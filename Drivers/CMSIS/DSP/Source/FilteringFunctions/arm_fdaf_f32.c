@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_f32.c
+ * Description:  Floating-point frequency-domain adaptive filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FDAF Frequency-Domain Adaptive Filter
+ *
+ * Partitioned block frequency-domain adaptive filter (PBFDAF, also called
+ * multidelay block frequency-domain filter, MDF). It identifies the same kind of
+ * FIR filter as the \ref LMS and \ref LMS_NORM filters, for instance an echo path
+ * in an acoustic echo canceller, with the input as the far end signal and the
+ * reference as the microphone signal:
+ * <pre>
+ *     y[n] = sum(w[k] * x[n-k]),   0 <= k < blockLen * numPartitions,
+ *     e[n] = d[n] - y[n].
+ * </pre>
+ *
+ * The filter is cut into <code>numPartitions</code> partitions of <code>blockLen</code>
+ * taps, each one kept as a spectrum of <code>2*blockLen</code> points. For each block of
+ * <code>blockLen</code> samples:
+ * - the last two input blocks are transformed with arm_rfft_fast_f32() and the result
+ *   is kept for the next <code>numPartitions-1</code> blocks,
+ * - the output is the overlap-save sum of the products of each partition with the
+ *   input spectrum of its delay,
+ * - the error block, behind <code>blockLen</code> zeros, is transformed and scaled in
+ *   each bin by <code>mu / (numPartitions * (P[k] + 2 * blockLen * delta))</code>, where
+ *   <code>P[k]</code> is the input power of the bin smoothed with the forgetting factor
+ *   <code>alpha</code>,
+ * - each partition moves by the product of the conjugate of its input spectrum and the
+ *   scaled error spectrum, then one partition, in turn, has the second half of its
+ *   impulse response cleared (gradient constraint).
+ *
+ * Each block costs five real FFTs of length <code>2*blockLen</code> and
+ * <code>2*numPartitions</code> complex products per bin, instead of
+ * <code>2*blockLen*numPartitions</code> multiply-accumulates per sample for
+ * arm_lms_norm_f32(). The normalization in each bin also makes the convergence
+ * speed much less sensitive to the color of the input, such as speech.
+ * Constraining one partition per block, as in the MDF filter of Speex,
+ * saves <code>2*numPartitions-2</code> FFTs per block for a small loss of convergence speed.
+ *
+ * arm_fdaf_block_f32() processes one block without delay. arm_fdaf_f32() takes
+ * blocks of any size and returns the output and error samples delayed by
+ * <code>blockLen</code> samples. A <code>mu</code> of 0.5 is a good start;
+ * with 1 the filter converges in the fewest blocks when there is no noise.
+ *
+ * Memory comes from an arm_table_arena of
+ * <code>ARM_FDAF_ARENA_SIZE_F32(blockLen, numPartitions)</code> bytes.
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point frequency-domain adaptive filter.
+ * @param[in,out] *S          points to an instance of the floating-point frequency-domain adaptive filter structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[in]     *pRef       points to the block of reference data.
+ * @param[out]    *pOut       points to the block of output data.
+ * @param[out]    *pErr       points to the block of error data.
+ * @param[in]     blockSize   number of samples to process.
+ * @return        none.
+ *
+ * \par
+ * The samples are gathered into blocks of <code>blockLen</code>, so
+ * <code>pOut[n]</code> and <code>pErr[n]</code> belong to the input sample
+ * <code>blockLen</code> samples before <code>pSrc[n]</code>. The first
+ * <code>blockLen</code> output and error samples after the initialization are zero.
+ */
+
+void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  uint32_t L = S->blockLen;                      /* Block length */
+  float32_t *pInBlk = S->pBlock;                 /* Input block being gathered */
+  float32_t *pRefBlk = pInBlk + L;               /* Reference block being gathered */
+  float32_t *pOutBlk = pRefBlk + L;              /* Output of the previous block */
+  float32_t *pErrBlk = pOutBlk + L;              /* Error of the previous block */
+  uint32_t fill = S->fill;                       /* Position in the blocks */
+
+  while (blockSize > 0U)
+  {
+    /* Return the result of the previous block in the slot of the new sample */
+    *pOut++ = pOutBlk[fill];
+    *pErr++ = pErrBlk[fill];
+
+    pInBlk[fill] = *pSrc++;
+    pRefBlk[fill] = *pRef++;
+    fill++;
+
+    if (fill == L)
+    {
+      arm_fdaf_block_f32(S, pInBlk, pRefBlk, pOutBlk, pErrBlk);
+      fill = 0U;
+    }
+
+    /* Decrement the loop counter */
+    blockSize--;
+  }
+
+  S->fill = (uint16_t) fill;
+}
+
+/**
+ * @} end of FDAF group
+ */
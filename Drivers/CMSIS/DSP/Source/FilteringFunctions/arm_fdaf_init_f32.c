@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_init_f32.c
+ * Description:  Floating-point frequency-domain adaptive filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point frequency-domain adaptive filter.
+ * @param[out]    *S              points to an instance of the floating-point frequency-domain adaptive filter structure.
+ * @param[in]     blockLen        block length, half of a length supported by arm_rfft_fast_table_init_f32().
+ * @param[in]     numPartitions   number of partitions of <code>blockLen</code> taps.
+ * @param[in]     mu              step size, from 0 to 1.
+ * @param[in,out] *A              points to the arena receiving the buffers and the FFT tables.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a parameter is not supported or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par
+ * The arena must provide <code>ARM_FDAF_ARENA_SIZE_F32(blockLen, numPartitions)</code> bytes.
+ * The weights, the input history and the power estimates are cleared, <code>alpha</code>
+ * is set to 0.9 and <code>delta</code> to 1e-6; both fields can be changed afterwards.
+ * On error the arena is left as it was.
+ */
+
+arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t blockLen,
+  uint16_t numPartitions,
+  float32_t mu,
+  arm_table_arena * A)
+{
+  arm_status status;
+  uint32_t used = A->used;
+  uint32_t fftLen = 2U * (uint32_t) blockLen;
+  uint32_t bytes = fftLen * sizeof(float32_t);
+
+  if ((blockLen == 0U) || (numPartitions == 0U) || (fftLen > 0xFFFFU))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->pX = (float32_t *) arm_table_arena_alloc(A, numPartitions * bytes);
+  S->pW = (float32_t *) arm_table_arena_alloc(A, numPartitions * bytes);
+  S->pPower = (float32_t *) arm_table_arena_alloc(A, (blockLen + 1U) * sizeof(float32_t));
+  S->pIn = (float32_t *) arm_table_arena_alloc(A, bytes);
+  S->pE = (float32_t *) arm_table_arena_alloc(A, bytes);
+  S->pWork = (float32_t *) arm_table_arena_alloc(A, bytes);
+  S->pBlock = (float32_t *) arm_table_arena_alloc(A, 2U * bytes);
+
+  if ((S->pX == NULL) || (S->pW == NULL) || (S->pPower == NULL) || (S->pIn == NULL) ||
+      (S->pE == NULL) || (S->pWork == NULL) || (S->pBlock == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  status = arm_rfft_fast_table_init_f32(&S->rfft, (uint16_t) fftLen, A);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    A->used = used;
+    return (status);
+  }
+
+  memset(S->pX, 0, numPartitions * bytes);
+  memset(S->pW, 0, numPartitions * bytes);
+  memset(S->pIn, 0, bytes);
+  memset(S->pBlock, 0, 2U * bytes);
+
+  /* A negative power marks the first block, which sets the estimates */
+  S->pPower[0] = -1.0f;
+
+  S->blockLen = blockLen;
+  S->numPartitions = numPartitions;
+  S->head = 0U;
+  S->constrainIndex = 0U;
+  S->fill = 0U;
+  S->mu = mu;
+  S->alpha = 0.9f;
+  S->delta = 1e-6f;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FDAF group
+ */
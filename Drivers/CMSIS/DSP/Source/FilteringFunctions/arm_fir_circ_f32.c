@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_f32.c
+ * Description:  Floating-point FIR filter with a circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern uint32_t arm_fir_fixed_window_f32(
+  uint16_t numTaps,
+  const float32_t * pState,
+  const float32_t * pCoeffs,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR filter with a circular state buffer.
+ * @param[in,out] *S points to an instance of the floating-point FIR structure.
+ * @param[in] *pSrc points to the block of input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in] blockSize number of samples to process, at most the block size given to arm_fir_circ_init_f32().
+ * @return none.
+ *
+ * \par Circular State
+ * arm_fir_f32() moves the last <code>numTaps-1</code> samples back to the start of its state
+ * buffer after each block. This function keeps the last <code>stateLen = numTaps+blockSize-1</code>
+ * samples in a circular buffer instead, written twice with arm_circularWriteDouble_f32(), so the
+ * samples of the block are always contiguous and no sample is moved.
+ * Each block costs <code>2*blockSize</code> stores against <code>blockSize+numTaps-1</code> copies
+ * for arm_fir_f32(): the circular buffer is faster when <code>blockSize</code> is below
+ * <code>numTaps-1</code>, as for low-latency audio with blocks of 16 or 32 samples.
+ * The outputs are the same as those of arm_fir_f32() for the same input, bit for bit,
+ * including the tap counts of ARM_FIR_FIXED_TAPS, which use the same fully unrolled kernels.
+ */
+
+void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  const float32_t *pState;                       /* Points to the oldest sample of the block */
+  const float32_t *px, *pb;                      /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t stateLen = S->stateLen;               /* Length of the circular buffer */
+  uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Samples and coefficient */
+#endif
+
+  /* Write the new samples to both halves of the circular buffer */
+  arm_circularWriteDouble_f32(S->pState, (int32_t) stateLen, &S->stateIndex, pSrc, blockSize);
+
+  /* The last stateLen samples end stateLen samples after the write index:
+   * the block needs the last numTaps - 1 + blockSize of them */
+  pState = S->pState + S->stateIndex + (stateLen - (numTaps - 1U) - blockSize);
+
+  /* Tap counts with a fully unrolled kernel */
+  if (arm_fir_fixed_window_f32(S->numTaps, pState, pCoeffs, pDst, blockSize) != 0U)
+  {
+    return;
+  }
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Compute 4 outputs at a time, each one summed in the order of arm_fir_f32() */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+
+    /* Read the first three samples, the sample of acc3 is read with each coefficient */
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = numTaps >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* acc0 =  b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n] */
+      c0 = *pb++;
+      x3 = *px++;
+      acc0 += x0 * c0;
+      acc1 += x1 * c0;
+      acc2 += x2 * c0;
+      acc3 += x3 * c0;
+
+      c0 = *pb++;
+      x0 = *px++;
+      acc0 += x1 * c0;
+      acc1 += x2 * c0;
+      acc2 += x3 * c0;
+      acc3 += x0 * c0;
+
+      c0 = *pb++;
+      x1 = *px++;
+      acc0 += x2 * c0;
+      acc1 += x3 * c0;
+      acc2 += x0 * c0;
+      acc3 += x1 * c0;
+
+      c0 = *pb++;
+      x2 = *px++;
+      acc0 += x3 * c0;
+      acc1 += x0 * c0;
+      acc2 += x1 * c0;
+      acc3 += x2 * c0;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the filter length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = numTaps % 0x4U;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      x3 = *px++;
+      acc0 += x0 * c0;
+      acc1 += x1 * c0;
+      acc2 += x2 * c0;
+      acc3 += x3 * c0;
+
+      /* Slide the samples by one tap */
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the results in the destination buffer */
+    pDst[0] = acc0;
+    pDst[1] = acc1;
+    pDst[2] = acc2;
+    pDst[3] = acc3;
+    pDst += 4U;
+
+    /* Advance the state pointer by 4 for the next outputs */
+    pState += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute the remaining outputs here */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    acc0 = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      acc0 += *px++ * *pb++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is stored in the destination buffer */
+    *pDst++ = acc0;
+
+    /* Advance the state pointer by 1 for the next output */
+    pState++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_init_f32.c
+ * Description:  Floating-point FIR filter with circular state initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point FIR filter with a circular state buffer.
+ * @param[in,out] *S points to an instance of the floating-point FIR filter structure.
+ * @param[in]     numTaps  Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.
+ * @param[in]     *pState points to the state buffer.
+ * @param[in]     blockSize maximum number of samples that are processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful,
+ * ARM_MATH_ARGUMENT_ERROR if <code>numTaps</code> or <code>blockSize</code> is zero or
+ * ARM_MATH_LENGTH_ERROR if <code>numTaps+blockSize-1</code> is above 65535.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>2*(numTaps+blockSize-1)</code> samples, where <code>blockSize</code>
+ * is the largest number of input samples processed by a call to <code>arm_fir_circ_f32()</code>.
+ */
+
+arm_status arm_fir_circ_init_f32(
+  arm_fir_circ_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  uint32_t stateLen = numTaps + (blockSize - 1U);  /* Length of the circular buffer */
+
+  if ((numTaps == 0U) || (blockSize == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (stateLen > 0xFFFFU)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear both halves of the state buffer */
+  memset(pState, 0, 2U * stateLen * sizeof(float32_t));
+
+  /* Assign state pointer and start writing at the beginning of the buffer */
+  S->pState = pState;
+  S->stateLen = (uint16_t) stateLen;
+  S->stateIndex = 0U;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_decimate_circ_f32.c
+ * Description:  FIR decimation for floating-point sequences with a circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+  /**
+   * @brief Processing function for the floating-point FIR decimator with a circular state buffer.
+   * @param[in,out] *S    points to an instance of the floating-point FIR decimator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call, a multiple of the decimation
+   *                      factor and at most the block size given to arm_fir_decimate_circ_init_f32().
+   * @return none.
+   *
+   * \par
+   * The samples are kept in a circular buffer written twice with arm_circularWriteDouble_f32(),
+   * which saves the copy of <code>numTaps-1</code> samples of arm_fir_decimate_f32() after
+   * each block at the cost of <code>blockSize</code> more stores; the output is the same, bit for bit.
+   * It is faster when <code>blockSize</code> is below <code>numTaps-1</code>.
+   */
+
+void arm_fir_decimate_circ_f32(
+  arm_fir_decimate_circ_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  const float32_t *pState;                       /* Points to the oldest sample of the block */
+  const float32_t *px, *pb;                      /* Temporary pointers for state and coefficient buffers */
+  float32_t sum0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t stateLen = S->stateLen;               /* Length of the circular buffer */
+  uint32_t M = S->M;                             /* Decimation factor */
+  uint32_t tapCnt, blkCnt, outBlockSize = blockSize / M;  /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t c0;                                  /* Coefficient */
+#endif
+
+  /* Write the new samples to both halves of the circular buffer */
+  arm_circularWriteDouble_f32(S->pState, (int32_t) stateLen, &S->stateIndex, pSrc, blockSize);
+
+  /* The block needs the last numTaps - 1 + blockSize samples, which end
+   * stateLen samples after the write index */
+  pState = S->pState + S->stateIndex + (stateLen - (numTaps - 1U) - blockSize);
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Compute 4 outputs at a time, each one summed in the order of arm_fir_decimate_f32() */
+  blkCnt = outBlockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    sum0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      sum0 += px[0] * c0;
+      acc1 += px[M] * c0;
+      acc2 += px[2U * M] * c0;
+      acc3 += px[3U * M] * c0;
+      px++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the results in the destination buffer */
+    pDst[0] = sum0;
+    pDst[1] = acc1;
+    pDst[2] = acc2;
+    pDst[3] = acc3;
+    pDst += 4U;
+
+    /* Advance the state pointer by 4 times the decimation factor */
+    pState += 4U * M;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the number of outputs is not a multiple of 4, compute the remaining outputs here */
+  blkCnt = outBlockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = outBlockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    sum0 = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      sum0 += *px++ * *pb++;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = sum0;
+
+    /* Advance the state pointer by the decimation factor */
+    pState += M;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
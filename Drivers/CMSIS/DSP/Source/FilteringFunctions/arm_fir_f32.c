@@ -28,6 +28,147 @@
 
 #include "arm_math.h"
 
+/* Four taps from k of four consecutive outputs */
+#define FIR_FIXED_MAC4_F32(k)                                                   \
+  c0 = pCoeffs[(k)];                                                            \
+  acc0 += px[(k)] * c0;                                                         \
+  acc1 += px[(k) + 1U] * c0;                                                    \
+  acc2 += px[(k) + 2U] * c0;                                                    \
+  acc3 += px[(k) + 3U] * c0;                                                    \
+  c0 = pCoeffs[(k) + 1U];                                                       \
+  acc0 += px[(k) + 1U] * c0;                                                    \
+  acc1 += px[(k) + 2U] * c0;                                                    \
+  acc2 += px[(k) + 3U] * c0;                                                    \
+  acc3 += px[(k) + 4U] * c0;                                                    \
+  c0 = pCoeffs[(k) + 2U];                                                       \
+  acc0 += px[(k) + 2U] * c0;                                                    \
+  acc1 += px[(k) + 3U] * c0;                                                    \
+  acc2 += px[(k) + 4U] * c0;                                                    \
+  acc3 += px[(k) + 5U] * c0;                                                    \
+  c0 = pCoeffs[(k) + 3U];                                                       \
+  acc0 += px[(k) + 3U] * c0;                                                    \
+  acc1 += px[(k) + 4U] * c0;                                                    \
+  acc2 += px[(k) + 5U] * c0;                                                    \
+  acc3 += px[(k) + 6U] * c0;
+
+/* Four taps from k of one output */
+#define FIR_FIXED_MAC1_F32(k)                                                   \
+  acc0 += px[(k)] * pCoeffs[(k)];                                               \
+  acc0 += px[(k) + 1U] * pCoeffs[(k) + 1U];                                     \
+  acc0 += px[(k) + 2U] * pCoeffs[(k) + 2U];                                     \
+  acc0 += px[(k) + 3U] * pCoeffs[(k) + 3U];
+
+/*
+ * @brief  Defines arm_fir_fixed_<N>_f32(), the FIR filter of N taps with the
+ *         tap loop fully unrolled, on the N - 1 + blockSize samples from pState.
+ *         The taps of each output are summed in the same order as in the
+ *         generic kernels, so the results are identical.
+ */
+#define FIR_FIXED_KERNEL_F32(N)                                                 \
+static void arm_fir_fixed_##N##_f32(                                            \
+  const float32_t * pState,                                                     \
+  const float32_t * pCoeffs,                                                    \
+  float32_t * pDst,                                                             \
+  uint32_t blockSize)                                                           \
+{                                                                               \
+  const float32_t *px = pState;                  /* State pointer */            \
+  float32_t acc0, acc1, acc2, acc3;              /* Accumulators */             \
+  float32_t c0;                                  /* Coefficient */              \
+  uint32_t blkCnt;                               /* Loop counter */             \
+                                                                                \
+  /* Four outputs at a time */                                                  \
+  blkCnt = blockSize >> 2U;                                                     \
+                                                                                \
+  while (blkCnt > 0U)                                                           \
+  {                                                                             \
+    acc0 = 0.0f;                                                                \
+    acc1 = 0.0f;                                                                \
+    acc2 = 0.0f;                                                                \
+    acc3 = 0.0f;                                                                \
+                                                                                \
+    ARM_FIR_UNROLL_##N(FIR_FIXED_MAC4_F32)                                      \
+                                                                                \
+    pDst[0] = acc0;                                                             \
+    pDst[1] = acc1;                                                             \
+    pDst[2] = acc2;                                                             \
+    pDst[3] = acc3;                                                             \
+                                                                                \
+    px += 4U;                                                                   \
+    pDst += 4U;                                                                 \
+    blkCnt--;                                                                   \
+  }                                                                             \
+                                                                                \
+  blkCnt = blockSize % 0x4U;                                                    \
+                                                                                \
+  while (blkCnt > 0U)                                                           \
+  {                                                                             \
+    acc0 = 0.0f;                                                                \
+                                                                                \
+    ARM_FIR_UNROLL_##N(FIR_FIXED_MAC1_F32)                                      \
+                                                                                \
+    *pDst++ = acc0;                                                             \
+    px++;                                                                       \
+    blkCnt--;                                                                   \
+  }                                                                             \
+}
+
+ARM_FIR_FIXED_TAPS(FIR_FIXED_KERNEL_F32)
+
+#define FIR_FIXED_CASE_F32(N)                                                   \
+  case N:                                                                       \
+    /* New samples behind the N - 1 samples of the previous block */           \
+    memcpy(S->pState + (N - 1U), pSrc, blockSize * sizeof(float32_t));          \
+    arm_fir_fixed_##N##_f32(S->pState, S->pCoeffs, pDst, blockSize);            \
+    /* Keep the last N - 1 samples for the next block */                       \
+    memmove(S->pState, S->pState + blockSize, (N - 1U) * sizeof(float32_t));    \
+    return (1U);
+
+#define FIR_FIXED_WINDOW_CASE_F32(N)                                            \
+  case N:                                                                       \
+    arm_fir_fixed_##N##_f32(pState, pCoeffs, pDst, blockSize);                  \
+    return (1U);
+
+/*
+ * @brief  Runs the fully unrolled kernel of the tap count of the filter, if
+ *         it is one of ARM_FIR_FIXED_TAPS.
+ * @return 1 if the block was processed, 0 otherwise.
+ */
+static uint32_t arm_fir_fixed_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  switch (S->numTaps)
+  {
+    ARM_FIR_FIXED_TAPS(FIR_FIXED_CASE_F32)
+
+  default:
+    return (0U);
+  }
+}
+
+/*
+ * @brief  Runs the fully unrolled kernel of numTaps taps on the numTaps - 1 + blockSize
+ *         samples from pState, without updating them. Also used by arm_fir_circ_f32().
+ * @return 1 if numTaps is one of ARM_FIR_FIXED_TAPS, 0 otherwise.
+ */
+uint32_t arm_fir_fixed_window_f32(
+  uint16_t numTaps,
+  const float32_t * pState,
+  const float32_t * pCoeffs,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  switch (numTaps)
+  {
+    ARM_FIR_FIXED_TAPS(FIR_FIXED_WINDOW_CASE_F32)
+
+  default:
+    return (0U);
+  }
+}
+
 /**
 * @ingroup groupFilters
 */
@@ -136,6 +277,12 @@ uint32_t blockSize)
    uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
    uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
 
+   /* Tap counts with a fully unrolled kernel */
+   if (arm_fir_fixed_f32(S, pSrc, pDst, blockSize) != 0U)
+   {
+      return;
+   }
+
    /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
    /* pStateCurnt points to the location where the new input data should be written */
    pStateCurnt = &(S->pState[(numTaps - 1U)]);
@@ -484,6 +631,12 @@ uint32_t blockSize)
 
    float32_t acc;
 
+   /* Tap counts with a fully unrolled kernel */
+   if (arm_fir_fixed_f32(S, pSrc, pDst, blockSize) != 0U)
+   {
+      return;
+   }
+
    /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
    /* pStateCurnt points to the location where the new input data should be written */
    pStateCurnt = &(S->pState[(numTaps - 1U)]);
@@ -566,6 +719,12 @@ uint32_t blockSize)
    uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
    float32_t p0,p1,p2,p3,p4,p5,p6,p7;             /* Temporary product values */
 
+   /* Tap counts with a fully unrolled kernel */
+   if (arm_fir_fixed_f32(S, pSrc, pDst, blockSize) != 0U)
+   {
+      return;
+   }
+
    /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
    /* pStateCurnt points to the location where the new input data should be written */
    pStateCurnt = &(S->pState[(numTaps - 1U)]);
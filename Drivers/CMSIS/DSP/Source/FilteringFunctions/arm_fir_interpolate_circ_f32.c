@@ -0,0 +1,249 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_interpolate_circ_f32.c
+ * Description:  Floating-point FIR interpolation with a circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Interpolate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR interpolator with a circular state buffer.
+ * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process per call, at most the block size
+ *                          given to arm_fir_interpolate_circ_init_f32().
+ * @return none.
+ *
+ * \par
+ * The samples are kept in a circular buffer written twice with arm_circularWriteDouble_f32(),
+ * which saves the copy of <code>phaseLength-1</code> samples of arm_fir_interpolate_f32() after
+ * each block at the cost of <code>blockSize</code> more stores; the output is the same, bit for bit.
+ * The copy is small against the <code>L*phaseLength</code> multiply-accumulates of each input sample,
+ * so the gain is small too, and only when <code>blockSize</code> is below <code>phaseLength-1</code>.
+ */
+
+void arm_fir_interpolate_circ_f32(
+  arm_fir_interpolate_circ_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  const float32_t *pState;                       /* Points to the oldest sample of the block */
+  const float32_t *ptr1, *ptr2;                  /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t stateLen = S->stateLen;               /* Length of the circular buffer */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Samples and coefficient */
+#endif
+
+  /* Write the new samples to both halves of the circular buffer */
+  arm_circularWriteDouble_f32(S->pState, (int32_t) stateLen, &S->stateIndex, pSrc, blockSize);
+
+  /* The block needs the last phaseLen - 1 + blockSize samples, which end
+   * stateLen samples after the write index */
+  pState = S->pState + S->stateIndex + (stateLen - (phaseLen - 1U) - blockSize);
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Compute each phase for 4 input samples at a time, each output summed
+   * in the order of arm_fir_interpolate_f32() */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Loop over the Interpolation factor. */
+    i = L;
+
+    while (i > 0U)
+    {
+      sum = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      ptr1 = pState;
+      ptr2 = S->pCoeffs + (i - 1U);
+
+      /* Read the first three samples, the sample of acc3 is read with each coefficient */
+      x0 = *ptr1++;
+      x1 = *ptr1++;
+      x2 = *ptr1++;
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      tapCnt = phaseLen >> 2U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *ptr2;
+        x3 = *ptr1++;
+        sum += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        c0 = *(ptr2 + L);
+        x0 = *ptr1++;
+        sum += x1 * c0;
+        acc1 += x2 * c0;
+        acc2 += x3 * c0;
+        acc3 += x0 * c0;
+
+        c0 = *(ptr2 + 2U * L);
+        x1 = *ptr1++;
+        sum += x2 * c0;
+        acc1 += x3 * c0;
+        acc2 += x0 * c0;
+        acc3 += x1 * c0;
+
+        c0 = *(ptr2 + 3U * L);
+        x2 = *ptr1++;
+        sum += x3 * c0;
+        acc1 += x0 * c0;
+        acc2 += x1 * c0;
+        acc3 += x2 * c0;
+
+        /* Increment the coefficient pointer by 4 times the interpolation factor. */
+        ptr2 += 4U * L;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the polyphase length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = phaseLen % 0x4U;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *ptr2;
+        x3 = *ptr1++;
+        sum += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        /* Slide the samples by one tap */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        /* Increment the coefficient pointer by interpolation factor times. */
+        ptr2 += L;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the outputs of this phase for the 4 input samples */
+      pDst[0U] = sum;
+      pDst[L] = acc1;
+      pDst[2U * L] = acc2;
+      pDst[3U * L] = acc3;
+      pDst++;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Advance to the outputs of the next 4 input samples */
+    pDst += 3U * L;
+    pState += 4U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute the remaining outputs here */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Loop over the Interpolation factor. */
+    i = L;
+
+    while (i > 0U)
+    {
+      sum = 0.0f;
+
+      ptr1 = pState;
+      ptr2 = S->pCoeffs + (i - 1U);
+
+      tapCnt = phaseLen;
+
+      while (tapCnt > 0U)
+      {
+        /* Perform the multiply-accumulate */
+        sum += *ptr1++ * *ptr2;
+
+        /* Increment the coefficient pointer by interpolation factor times. */
+        ptr2 += L;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* The result is in the accumulator, store in the destination buffer. */
+      *pDst++ = sum;
+
+      /* Decrement the loop counter */
+      i--;
+    }
+
+    /* Advance the state pointer by 1
+     * to process the next group of interpolation factor number samples */
+    pState++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+ /**
+  * @} end of FIR_Interpolate group
+  */
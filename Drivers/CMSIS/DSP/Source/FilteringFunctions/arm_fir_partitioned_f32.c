@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_partitioned_f32.c
+ * Description:  Floating-point partitioned FIR filter processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @defgroup FIRPartitioned Partitioned Frequency Domain FIR Filter
+*
+* Computes the same output as arm_fir_f32() with fast convolution, for
+* filters with hundreds or thousands of taps where the direct form is too slow.
+*
+* \par Algorithm:
+* The impulse response is split into partitions. The input is transformed by
+* arm_rfft_fast_f32() in overlapping blocks of twice the partition length, and
+* the spectra of the past blocks are kept in a frequency-domain delay line.
+* Each output block is the inverse transform of the sum of the delayed input
+* spectra multiplied by the partition spectra (uniformly partitioned
+* overlap-save). The cost per output sample grows with the number of
+* partitions instead of the number of taps.
+* \par
+* With non-uniform partitions the first taps use short partitions and longer
+* partitions cover the rest of the filter. Each segment costs two FFTs per
+* partition length of input whatever its number of partitions: the short
+* partitions allow small blocks and the long ones keep the cost of the tail
+* of the filter low. The output of a segment of long
+* partitions is computed one partition ahead, when the input block it needs is
+* complete, and is then added to the output over the next calls.
+* \par
+* The filter has no delay: output sample <code>n</code> depends on the input up
+* to sample <code>n</code>, as with arm_fir_f32(). The smallest partition
+* length is the processing granularity, and the number of samples passed to
+* each call must be a multiple of it. The work of a segment of long partitions
+* is done in the call where its input block completes.
+* \par Instance Structure
+* The instance holds pointers into the arena given to the init function, which
+* holds the input history, the spectra and the FFT tables. A separate instance
+* and arena area is needed for each filter.
+*/
+
+/*
+* @brief  Accumulates the product of two spectra in the arm_rfft_fast_f32 packed format.
+*/
+
+static void arm_fir_partitioned_cmac_f32(
+  const float32_t * pX,
+  const float32_t * pH,
+  float32_t * pY,
+  uint32_t fftLen)
+{
+  float32_t xR, xI, hR, hI;
+  uint32_t k;
+
+  /* Real values at DC and at the Nyquist frequency */
+  pY[0] += pX[0] * pH[0];
+  pY[1] += pX[1] * pH[1];
+
+  for (k = 2U; k < fftLen; k += 2U)
+  {
+    xR = pX[k];
+    xI = pX[k + 1U];
+    hR = pH[k];
+    hI = pH[k + 1U];
+
+    pY[k]      += xR * hR - xI * hI;
+    pY[k + 1U] += xR * hI + xI * hR;
+  }
+}
+
+/*
+* @brief  Transforms the newest input block of a segment, then computes the
+*         segment output into pWork + blockSize.
+*/
+
+static void arm_fir_partitioned_block_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  arm_fir_partitioned_segment_f32 * pSeg)
+{
+  uint32_t B = pSeg->blockSize;
+  uint32_t fftLen = 2U * B;
+  uint32_t histLen = (uint32_t) S->histMask + 1U;
+  uint32_t start, first, p, slot;
+  float32_t *pIn = S->pWork;
+  float32_t *pAcc = S->pWork + histLen;
+  float32_t *pX;
+
+  /* Last 2*B input samples, the history may wrap */
+  start = (S->histIndex - fftLen) & S->histMask;
+  first = histLen - start;
+  if (first >= fftLen)
+  {
+    memcpy(pIn, S->pHist + start, fftLen * sizeof(float32_t));
+  }
+  else
+  {
+    memcpy(pIn, S->pHist + start, first * sizeof(float32_t));
+    memcpy(pIn + first, S->pHist, (fftLen - first) * sizeof(float32_t));
+  }
+
+  /* Newest spectrum in the frequency-domain delay line */
+  slot = pSeg->fdlIndex + 1U;
+  if (slot == pSeg->numPartitions)
+  {
+    slot = 0U;
+  }
+  pSeg->fdlIndex = (uint16_t) slot;
+
+  pX = pSeg->pFdl + slot * fftLen;
+  arm_rfft_fast_f32(&pSeg->rfft, pIn, pX, 0U);
+
+  /* Partition p is applied to the spectrum p blocks old */
+  memset(pAcc, 0, fftLen * sizeof(float32_t));
+
+  for (p = 0U; p < pSeg->numPartitions; p++)
+  {
+    arm_fir_partitioned_cmac_f32(pSeg->pFdl + slot * fftLen,
+                                 pSeg->pCoeffSpec + p * fftLen,
+                                 pAcc, fftLen);
+
+    slot = (slot == 0U) ? pSeg->numPartitions - 1U : slot - 1U;
+  }
+
+  /* Overlap-save: the second half is the linear convolution */
+  arm_rfft_fast_f32(&pSeg->rfft, pAcc, pIn, 1U);
+}
+
+/**
+* @addtogroup FIRPartitioned
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point partitioned FIR filter.
+* @param[in,out] *S          points to an instance of the floating-point partitioned FIR filter structure.
+* @param[in]     *pSrc       points to the block of input data.
+* @param[out]    *pDst       points to the block of output data.
+* @param[in]     blockSize   number of samples to process, a multiple of the smallest partition length.
+* @return        none.
+*/
+
+void arm_fir_partitioned_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  arm_fir_partitioned_segment_f32 *pSeg;
+  uint32_t B0 = S->blockSize;
+  uint32_t blkCnt, k, i;
+  float32_t *pSegOut;
+
+  for (blkCnt = blockSize / B0; blkCnt > 0U; blkCnt--)
+  {
+    /* Append the input block to the history, B0 divides the history length */
+    memcpy(S->pHist + S->histIndex, pSrc, B0 * sizeof(float32_t));
+    S->histIndex = (S->histIndex + B0) & S->histMask;
+
+    /* Short partitions: output of the block just received */
+    arm_fir_partitioned_block_f32(S, &S->seg[0]);
+    memcpy(pDst, S->pWork + B0, B0 * sizeof(float32_t));
+
+    /* Long partitions: add the output computed one partition ahead */
+    for (k = 1U; k < S->numSegments; k++)
+    {
+      pSeg = &S->seg[k];
+      pSegOut = pSeg->pOut + pSeg->outIndex;
+
+      for (i = 0U; i < B0; i++)
+      {
+        pDst[i] += pSegOut[i];
+      }
+
+      pSeg->outIndex += (uint16_t) B0;
+
+      if (pSeg->outIndex == pSeg->blockSize)
+      {
+        /* The input block of the segment is complete */
+        arm_fir_partitioned_block_f32(S, pSeg);
+        memcpy(pSeg->pOut, S->pWork + pSeg->blockSize,
+               pSeg->blockSize * sizeof(float32_t));
+        pSeg->outIndex = 0U;
+      }
+    }
+
+    pSrc += B0;
+    pDst += B0;
+  }
+}
+
+/**
+* @} end of FIRPartitioned group
+*/
@@ -0,0 +1,284 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_partitioned_init_f32.c
+ * Description:  Floating-point partitioned FIR filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Ratio between the partition lengths of two consecutive segments */
+#define ARM_FIR_PARTITIONED_GROWTH 8U
+
+/*
+* @brief  Splits the filter into segments of partitions.
+* @param[in]  numTaps       number of filter coefficients.
+* @param[in]  blockSize     smallest partition length.
+* @param[in]  maxBlockSize  largest partition length.
+* @param[out] *pBlock       partition length of each segment.
+* @param[out] *pParts       number of partitions of each segment.
+* @return     number of segments.
+*
+* The partition length grows by ARM_FIR_PARTITIONED_GROWTH from one segment to
+* the next, up to maxBlockSize. The first segment covers the taps
+* [0, pBlock[1]) and segment k covers [pBlock[k], pBlock[k+1]), so every
+* segment after the first starts at a tap index equal to its partition length
+* and its output can be computed one partition ahead. The last segment covers
+* the rest of the filter.
+*/
+
+static uint32_t arm_fir_partitioned_plan(
+  uint32_t numTaps,
+  uint32_t blockSize,
+  uint32_t maxBlockSize,
+  uint16_t * pBlock,
+  uint16_t * pParts)
+{
+  uint32_t numSegments = 0U;
+  uint32_t B = blockSize;
+  uint32_t start = 0U;
+  uint32_t next, end;
+
+  while (1)
+  {
+    next = B * ARM_FIR_PARTITIONED_GROWTH;
+    if (next > maxBlockSize)
+    {
+      next = maxBlockSize;
+    }
+
+    end = ((B < maxBlockSize) && (next < numTaps)) ? next : numTaps;
+
+    pBlock[numSegments] = (uint16_t) B;
+    pParts[numSegments] = (uint16_t) ((end - start + B - 1U) / B);
+    numSegments++;
+
+    if (end == numTaps)
+    {
+      break;
+    }
+
+    start = next;
+    B = next;
+  }
+
+  return (numSegments);
+}
+
+/*
+* @brief  Checks that the partition length can be processed by arm_rfft_fast_f32.
+*/
+
+static uint32_t arm_fir_partitioned_valid_block(
+  uint32_t B)
+{
+  return ((B >= 16U) && (B <= 2048U) && ((B & (B - 1U)) == 0U));
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIRPartitioned
+ * @{
+ */
+
+/**
+ * @brief  Arena size needed by arm_fir_partitioned_init_f32().
+ * @param[in] numTaps       number of filter coefficients in the filter.
+ * @param[in] blockSize     smallest partition length.
+ * @param[in] maxBlockSize  largest partition length.
+ * @return    size in bytes, or 0 if the partition lengths are not supported.
+ */
+
+uint32_t arm_fir_partitioned_arena_size_f32(
+  uint16_t numTaps,
+  uint16_t blockSize,
+  uint16_t maxBlockSize)
+{
+  uint16_t block[ARM_FIR_PARTITIONED_MAX_SEGMENTS];
+  uint16_t parts[ARM_FIR_PARTITIONED_MAX_SEGMENTS];
+  uint32_t numSegments, k, size;
+
+  if ((numTaps == 0U) || (maxBlockSize < blockSize) ||
+      !arm_fir_partitioned_valid_block(blockSize) ||
+      !arm_fir_partitioned_valid_block(maxBlockSize))
+  {
+    return (0U);
+  }
+
+  numSegments = arm_fir_partitioned_plan(numTaps, blockSize, maxBlockSize, block, parts);
+
+  /* Input history and work buffers, plus the alignment of the first block */
+  size = 3U * 2U * (uint32_t) maxBlockSize * sizeof(float32_t) + 3U;
+
+  for (k = 0U; k < numSegments; k++)
+  {
+    size += ARM_RFFT_FAST_TABLE_ARENA_SIZE_F32(2U * block[k]);
+    size += 2U * parts[k] * 2U * (uint32_t) block[k] * sizeof(float32_t);
+
+    if (k > 0U)
+    {
+      size += (uint32_t) block[k] * sizeof(float32_t);
+    }
+  }
+
+  return (size);
+}
+
+/**
+ * @brief  Initialization function for the floating-point partitioned FIR filter.
+ * @param[in,out] *S            points to an instance of the floating-point partitioned FIR filter structure.
+ * @param[in]     numTaps       number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs      points to the filter coefficients, in the order used by arm_fir_f32().
+ * @param[in]     blockSize     smallest partition length, a power of two from 16 to 2048.
+ * @param[in]     maxBlockSize  largest partition length, a power of two from <code>blockSize</code> to 2048.
+ * @param[in,out] *A            points to the arena receiving the state, the coefficient spectra and the FFT tables.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a partition length is not supported or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * The coefficients are transformed into the arena at initialization and are
+ * not accessed afterwards.
+ * \par
+ * With <code>maxBlockSize</code> equal to <code>blockSize</code> the filter is
+ * split into uniform partitions. A larger <code>maxBlockSize</code> selects
+ * non-uniform partitions: partitions of length <code>blockSize</code> cover
+ * the first taps and the partition length is multiplied by 8 from one segment
+ * to the next, up to <code>maxBlockSize</code>. The arena size is given by
+ * arm_fir_partitioned_arena_size_f32(). On error the arena is left as it was.
+ */
+
+arm_status arm_fir_partitioned_init_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  uint16_t numTaps,
+  const float32_t * pCoeffs,
+  uint16_t blockSize,
+  uint16_t maxBlockSize,
+  arm_table_arena * A)
+{
+  uint16_t block[ARM_FIR_PARTITIONED_MAX_SEGMENTS];
+  uint16_t parts[ARM_FIR_PARTITIONED_MAX_SEGMENTS];
+  arm_fir_partitioned_segment_f32 *pSeg;
+  uint32_t numSegments, k, p, i, B, tap, specLen, used;
+  float32_t *pSpec;
+
+  if (arm_fir_partitioned_arena_size_f32(numTaps, blockSize, maxBlockSize) == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  used = A->used;
+  numSegments = arm_fir_partitioned_plan(numTaps, blockSize, maxBlockSize, block, parts);
+
+  /* The largest partition in use sets the length of the shared buffers */
+  B = block[numSegments - 1U];
+
+  S->pHist = (float32_t *) arm_table_arena_alloc(A, 2U * B * sizeof(float32_t));
+  S->pWork = (float32_t *) arm_table_arena_alloc(A, 2U * 2U * B * sizeof(float32_t));
+
+  if ((S->pHist == NULL) || (S->pWork == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  memset(S->pHist, 0, 2U * B * sizeof(float32_t));
+
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->numSegments = (uint16_t) numSegments;
+  S->histMask = (uint16_t) (2U * B - 1U);
+  S->histIndex = 0U;
+
+  for (k = 0U; k < numSegments; k++)
+  {
+    pSeg = &S->seg[k];
+    B = block[k];
+    specLen = 2U * B;
+
+    pSeg->blockSize = (uint16_t) B;
+    pSeg->numPartitions = parts[k];
+    pSeg->fdlIndex = 0U;
+    pSeg->outIndex = 0U;
+
+    if (arm_rfft_fast_table_init_f32(&pSeg->rfft, (uint16_t) specLen, A) != ARM_MATH_SUCCESS)
+    {
+      A->used = used;
+      return (ARM_MATH_LENGTH_ERROR);
+    }
+
+    pSeg->pCoeffSpec = (float32_t *) arm_table_arena_alloc(A, parts[k] * specLen * sizeof(float32_t));
+    pSeg->pFdl = (float32_t *) arm_table_arena_alloc(A, parts[k] * specLen * sizeof(float32_t));
+    pSeg->pOut = NULL;
+
+    if (k > 0U)
+    {
+      pSeg->pOut = (float32_t *) arm_table_arena_alloc(A, B * sizeof(float32_t));
+    }
+
+    if ((pSeg->pCoeffSpec == NULL) || (pSeg->pFdl == NULL) ||
+        ((k > 0U) && (pSeg->pOut == NULL)))
+    {
+      A->used = used;
+      return (ARM_MATH_LENGTH_ERROR);
+    }
+
+    memset(pSeg->pFdl, 0, parts[k] * specLen * sizeof(float32_t));
+
+    if (pSeg->pOut != NULL)
+    {
+      memset(pSeg->pOut, 0, B * sizeof(float32_t));
+    }
+
+    /* The first segment starts at tap 0, the others at their partition length */
+    tap = (k == 0U) ? 0U : B;
+
+    for (p = 0U; p < parts[k]; p++)
+    {
+      /* b[tap] ... b[tap+B-1] followed by B zeros, zero beyond the last tap */
+      for (i = 0U; i < specLen; i++)
+      {
+        S->pWork[i] = ((i < B) && (tap + i < numTaps)) ?
+                      pCoeffs[numTaps - 1U - (tap + i)] : 0.0f;
+      }
+
+      pSpec = pSeg->pCoeffSpec + p * specLen;
+      arm_rfft_fast_f32(&pSeg->rfft, S->pWork, pSpec, 0U);
+
+      tap += B;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIRPartitioned group
+ */
@@ -28,6 +28,156 @@
 
 #include "arm_math.h"
 
+#if !defined (ARM_MATH_DSP) || !defined (UNALIGNED_SUPPORT_DISABLE)
+
+#if defined (ARM_MATH_DSP)
+
+/* Four taps from k of four consecutive outputs, two taps per SMLALD */
+#define FIR_FIXED_MAC4_Q15(k)                                                   \
+  c0 = _SIMD32_OFFSET(pCoeffs + (k));                                           \
+  acc0 = __SMLALD(_SIMD32_OFFSET(px + (k)), c0, acc0);                          \
+  acc1 = __SMLALD(_SIMD32_OFFSET(px + (k) + 1U), c0, acc1);                     \
+  acc2 = __SMLALD(_SIMD32_OFFSET(px + (k) + 2U), c0, acc2);                     \
+  acc3 = __SMLALD(_SIMD32_OFFSET(px + (k) + 3U), c0, acc3);                     \
+  c0 = _SIMD32_OFFSET(pCoeffs + (k) + 2U);                                      \
+  acc0 = __SMLALD(_SIMD32_OFFSET(px + (k) + 2U), c0, acc0);                     \
+  acc1 = __SMLALD(_SIMD32_OFFSET(px + (k) + 3U), c0, acc1);                     \
+  acc2 = __SMLALD(_SIMD32_OFFSET(px + (k) + 4U), c0, acc2);                     \
+  acc3 = __SMLALD(_SIMD32_OFFSET(px + (k) + 5U), c0, acc3);
+
+/* Four taps from k of one output */
+#define FIR_FIXED_MAC1_Q15(k)                                                   \
+  c0 = _SIMD32_OFFSET(pCoeffs + (k));                                           \
+  acc0 = __SMLALD(_SIMD32_OFFSET(px + (k)), c0, acc0);                          \
+  c0 = _SIMD32_OFFSET(pCoeffs + (k) + 2U);                                      \
+  acc0 = __SMLALD(_SIMD32_OFFSET(px + (k) + 2U), c0, acc0);
+
+#else
+
+/* Four taps from k of four consecutive outputs */
+#define FIR_FIXED_MAC4_Q15(k)                                                   \
+  c0 = pCoeffs[(k)];                                                            \
+  acc0 += (q31_t) px[(k)] * c0;                                                 \
+  acc1 += (q31_t) px[(k) + 1U] * c0;                                            \
+  acc2 += (q31_t) px[(k) + 2U] * c0;                                            \
+  acc3 += (q31_t) px[(k) + 3U] * c0;                                            \
+  c0 = pCoeffs[(k) + 1U];                                                       \
+  acc0 += (q31_t) px[(k) + 1U] * c0;                                            \
+  acc1 += (q31_t) px[(k) + 2U] * c0;                                            \
+  acc2 += (q31_t) px[(k) + 3U] * c0;                                            \
+  acc3 += (q31_t) px[(k) + 4U] * c0;                                            \
+  c0 = pCoeffs[(k) + 2U];                                                       \
+  acc0 += (q31_t) px[(k) + 2U] * c0;                                            \
+  acc1 += (q31_t) px[(k) + 3U] * c0;                                            \
+  acc2 += (q31_t) px[(k) + 4U] * c0;                                            \
+  acc3 += (q31_t) px[(k) + 5U] * c0;                                            \
+  c0 = pCoeffs[(k) + 3U];                                                       \
+  acc0 += (q31_t) px[(k) + 3U] * c0;                                            \
+  acc1 += (q31_t) px[(k) + 4U] * c0;                                            \
+  acc2 += (q31_t) px[(k) + 5U] * c0;                                            \
+  acc3 += (q31_t) px[(k) + 6U] * c0;
+
+/* Four taps from k of one output */
+#define FIR_FIXED_MAC1_Q15(k)                                                   \
+  acc0 += (q31_t) px[(k)] * pCoeffs[(k)];                                       \
+  acc0 += (q31_t) px[(k) + 1U] * pCoeffs[(k) + 1U];                             \
+  acc0 += (q31_t) px[(k) + 2U] * pCoeffs[(k) + 2U];                             \
+  acc0 += (q31_t) px[(k) + 3U] * pCoeffs[(k) + 3U];
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+/*
+ * @brief  Defines arm_fir_fixed_<N>_q15(), the Q15 FIR filter of N taps with
+ *         the tap loop fully unrolled. The 64-bit accumulators make the
+ *         results identical to those of the generic kernels.
+ */
+#define FIR_FIXED_KERNEL_Q15(N)                                                 \
+static void arm_fir_fixed_##N##_q15(                                            \
+  q15_t * pState,                                                               \
+  const q15_t * pCoeffs,                                                        \
+  const q15_t * pSrc,                                                           \
+  q15_t * pDst,                                                                 \
+  uint32_t blockSize)                                                           \
+{                                                                               \
+  const q15_t *px = pState;                      /* State pointer */            \
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */             \
+  q31_t c0;                                      /* Coefficients */             \
+  uint32_t blkCnt;                               /* Loop counter */             \
+                                                                                \
+  /* New samples behind the N - 1 samples of the previous block */             \
+  memcpy(pState + (N - 1U), pSrc, blockSize * sizeof(q15_t));                   \
+                                                                                \
+  /* Four outputs at a time */                                                  \
+  blkCnt = blockSize >> 2U;                                                     \
+                                                                                \
+  while (blkCnt > 0U)                                                           \
+  {                                                                             \
+    acc0 = 0;                                                                   \
+    acc1 = 0;                                                                   \
+    acc2 = 0;                                                                   \
+    acc3 = 0;                                                                   \
+                                                                                \
+    ARM_FIR_UNROLL_##N(FIR_FIXED_MAC4_Q15)                                      \
+                                                                                \
+    /* The results are in 34.30 format, convert them to 1.15 */                 \
+    pDst[0] = (q15_t) (__SSAT((acc0 >> 15), 16));                               \
+    pDst[1] = (q15_t) (__SSAT((acc1 >> 15), 16));                               \
+    pDst[2] = (q15_t) (__SSAT((acc2 >> 15), 16));                               \
+    pDst[3] = (q15_t) (__SSAT((acc3 >> 15), 16));                               \
+                                                                                \
+    px += 4U;                                                                   \
+    pDst += 4U;                                                                 \
+    blkCnt--;                                                                   \
+  }                                                                             \
+                                                                                \
+  blkCnt = blockSize % 0x4U;                                                    \
+                                                                                \
+  while (blkCnt > 0U)                                                           \
+  {                                                                             \
+    acc0 = 0;                                                                   \
+                                                                                \
+    ARM_FIR_UNROLL_##N(FIR_FIXED_MAC1_Q15)                                      \
+                                                                                \
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));                               \
+    px++;                                                                       \
+    blkCnt--;                                                                   \
+  }                                                                             \
+                                                                                \
+  /* Keep the last N - 1 samples for the next block */                         \
+  memmove(pState, px, (N - 1U) * sizeof(q15_t));                                \
+}
+
+ARM_FIR_FIXED_TAPS(FIR_FIXED_KERNEL_Q15)
+
+#define FIR_FIXED_CASE_Q15(N)                                                   \
+  case N:                                                                       \
+    arm_fir_fixed_##N##_q15(S->pState, S->pCoeffs, pSrc, pDst, blockSize);      \
+    return (1U);
+
+/*
+ * @brief  Runs the fully unrolled kernel of the tap count of the filter, if
+ *         it is one of ARM_FIR_FIXED_TAPS. Without unaligned accesses, the
+ *         Cortex-M3/M4 builds keep the generic kernel, whose word accesses
+ *         are all aligned.
+ * @return 1 if the block was processed, 0 otherwise.
+ */
+static uint32_t arm_fir_fixed_q15(
+  const arm_fir_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  switch (S->numTaps)
+  {
+    ARM_FIR_FIXED_TAPS(FIR_FIXED_CASE_Q15)
+
+  default:
+    return (0U);
+  }
+}
+
+#endif /* #if !defined (ARM_MATH_DSP) || !defined (UNALIGNED_SUPPORT_DISABLE) */
+
 /**
  * @ingroup groupFilters
  */
@@ -86,6 +236,11 @@ void arm_fir_q15(
   uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
   uint32_t tapCnt, blkCnt;                       /* Loop counters */
 
+  /* Tap counts with a fully unrolled kernel */
+  if (arm_fir_fixed_q15(S, pSrc, pDst, blockSize) != 0U)
+  {
+    return;
+  }
 
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
@@ -606,6 +761,12 @@ void arm_fir_q15(
   uint32_t numTaps = S->numTaps;                 /* Number of nTaps in the filter */
   uint32_t tapCnt, blkCnt;                       /* Loop counters */
 
+  /* Tap counts with a fully unrolled kernel */
+  if (arm_fir_fixed_q15(S, pSrc, pDst, blockSize) != 0U)
+  {
+    return;
+  }
+
   /* S->pState buffer contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1U)]);
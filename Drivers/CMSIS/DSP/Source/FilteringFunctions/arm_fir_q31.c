@@ -28,6 +28,118 @@
 
 #include "arm_math.h"
 
+/* Four taps from k of three consecutive outputs */
+#define FIR_FIXED_MAC3_Q31(k)                                                   \
+  c0 = pCoeffs[(k)];                                                            \
+  acc0 += (q63_t) px[(k)] * c0;                                                 \
+  acc1 += (q63_t) px[(k) + 1U] * c0;                                            \
+  acc2 += (q63_t) px[(k) + 2U] * c0;                                            \
+  c0 = pCoeffs[(k) + 1U];                                                       \
+  acc0 += (q63_t) px[(k) + 1U] * c0;                                            \
+  acc1 += (q63_t) px[(k) + 2U] * c0;                                            \
+  acc2 += (q63_t) px[(k) + 3U] * c0;                                            \
+  c0 = pCoeffs[(k) + 2U];                                                       \
+  acc0 += (q63_t) px[(k) + 2U] * c0;                                            \
+  acc1 += (q63_t) px[(k) + 3U] * c0;                                            \
+  acc2 += (q63_t) px[(k) + 4U] * c0;                                            \
+  c0 = pCoeffs[(k) + 3U];                                                       \
+  acc0 += (q63_t) px[(k) + 3U] * c0;                                            \
+  acc1 += (q63_t) px[(k) + 4U] * c0;                                            \
+  acc2 += (q63_t) px[(k) + 5U] * c0;
+
+/* Four taps from k of one output */
+#define FIR_FIXED_MAC1_Q31(k)                                                   \
+  acc0 += (q63_t) px[(k)] * pCoeffs[(k)];                                       \
+  acc0 += (q63_t) px[(k) + 1U] * pCoeffs[(k) + 1U];                             \
+  acc0 += (q63_t) px[(k) + 2U] * pCoeffs[(k) + 2U];                             \
+  acc0 += (q63_t) px[(k) + 3U] * pCoeffs[(k) + 3U];
+
+/*
+ * @brief  Defines arm_fir_fixed_<N>_q31(), the Q31 FIR filter of N taps with
+ *         the tap loop fully unrolled. As in arm_fir_q31(), three outputs are
+ *         computed at a time so that their 64-bit accumulators stay in registers.
+ */
+#define FIR_FIXED_KERNEL_Q31(N)                                                 \
+static void arm_fir_fixed_##N##_q31(                                            \
+  q31_t * pState,                                                               \
+  const q31_t * pCoeffs,                                                        \
+  const q31_t * pSrc,                                                           \
+  q31_t * pDst,                                                                 \
+  uint32_t blockSize)                                                           \
+{                                                                               \
+  const q31_t *px = pState;                      /* State pointer */            \
+  q63_t acc0, acc1, acc2;                        /* Accumulators */             \
+  q31_t c0;                                      /* Coefficient */              \
+  uint32_t blkCnt;                               /* Loop counter */             \
+                                                                                \
+  /* New samples behind the N - 1 samples of the previous block */             \
+  memcpy(pState + (N - 1U), pSrc, blockSize * sizeof(q31_t));                   \
+                                                                                \
+  /* Three outputs at a time */                                                 \
+  blkCnt = blockSize / 3U;                                                      \
+                                                                                \
+  while (blkCnt > 0U)                                                           \
+  {                                                                             \
+    acc0 = 0;                                                                   \
+    acc1 = 0;                                                                   \
+    acc2 = 0;                                                                   \
+                                                                                \
+    ARM_FIR_UNROLL_##N(FIR_FIXED_MAC3_Q31)                                      \
+                                                                                \
+    /* The results are in 2.62 format, convert them to 1.31 */                  \
+    pDst[0] = (q31_t) (acc0 >> 31U);                                            \
+    pDst[1] = (q31_t) (acc1 >> 31U);                                            \
+    pDst[2] = (q31_t) (acc2 >> 31U);                                            \
+                                                                                \
+    px += 3U;                                                                   \
+    pDst += 3U;                                                                 \
+    blkCnt--;                                                                   \
+  }                                                                             \
+                                                                                \
+  blkCnt = blockSize % 3U;                                                      \
+                                                                                \
+  while (blkCnt > 0U)                                                           \
+  {                                                                             \
+    acc0 = 0;                                                                   \
+                                                                                \
+    ARM_FIR_UNROLL_##N(FIR_FIXED_MAC1_Q31)                                      \
+                                                                                \
+    *pDst++ = (q31_t) (acc0 >> 31U);                                            \
+    px++;                                                                       \
+    blkCnt--;                                                                   \
+  }                                                                             \
+                                                                                \
+  /* Keep the last N - 1 samples for the next block */                         \
+  memmove(pState, px, (N - 1U) * sizeof(q31_t));                                \
+}
+
+ARM_FIR_FIXED_TAPS(FIR_FIXED_KERNEL_Q31)
+
+#define FIR_FIXED_CASE_Q31(N)                                                   \
+  case N:                                                                       \
+    arm_fir_fixed_##N##_q31(S->pState, S->pCoeffs, pSrc, pDst, blockSize);      \
+    return (1U);
+
+/*
+ * @brief  Runs the fully unrolled kernel of the tap count of the filter, if
+ *         it is one of ARM_FIR_FIXED_TAPS.
+ * @return 1 if the block was processed, 0 otherwise.
+ */
+static uint32_t arm_fir_fixed_q31(
+  const arm_fir_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  switch (S->numTaps)
+  {
+    ARM_FIR_FIXED_TAPS(FIR_FIXED_CASE_Q31)
+
+  default:
+    return (0U);
+  }
+}
+
 /**
  * @ingroup groupFilters
  */
@@ -80,6 +192,12 @@ void arm_fir_q31(
   uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
   uint32_t i, tapCnt, blkCnt, tapCntN3;          /* Loop counters */
 
+  /* Tap counts with a fully unrolled kernel */
+  if (arm_fir_fixed_q31(S, pSrc, pDst, blockSize) != 0U)
+  {
+    return;
+  }
+
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1U)]);
@@ -282,6 +400,12 @@ void arm_fir_q31(
   uint32_t numTaps = S->numTaps;                 /* Length of the filter */
   uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
 
+  /* Tap counts with a fully unrolled kernel */
+  if (arm_fir_fixed_q31(S, pSrc, pDst, blockSize) != 0U)
+  {
+    return;
+  }
+
   /* S->pState buffer contains previous frame (numTaps - 1) samples */
   /* pStateCurnt points to the location where the new input data should be written */
   pStateCurnt = &(S->pState[(numTaps - 1U)]);
@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point rational FIR resampler processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Resampler
+ *
+ * These functions change the sample rate of a signal by an arbitrary ratio.
+ * Conceptually, they are an FIR interpolator by a factor <code>L</code> followed by
+ * a downsampler by a factor <code>M</code>, giving an output rate of <code>L/M</code>
+ * times the input rate. Only the samples kept by the downsampler are computed, so
+ * the cost per output sample is one polyphase component of <code>phaseLength</code>
+ * taps whatever the values of <code>L</code> and <code>M</code>. For 44.1 kHz to
+ * 48 kHz (<code>L=160</code>, <code>M=147</code>) this is 147 times less work than
+ * running arm_fir_interpolate_f32() and then keeping one output in 147.
+ *
+ * The filter must be designed for the upsampled rate: a lowpass with a normalized
+ * cutoff frequency of <code>1/max(L, M)</code> removes both the images of the
+ * upsampler and the aliases of the downsampler.
+ * The library provides separate functions for Q15, Q31, and floating-point data types.
+ *
+ * \par Algorithm:
+ * Output sample <code>m</code> is sample <code>m*M</code> of the interpolator output.
+ * With <code>n = (m*M)/L</code> and <code>r = (m*M)%L</code> it is computed from the
+ * input samples up to <code>x[n]</code> with polyphase component <code>r</code>:
+ * <pre>
+ *    y[m] = b[r] * x[n] + b[L+r] * x[n-1] + ... + b[L*(phaseLength-1)+r] * x[n-phaseLength+1]
+ * </pre>
+ * The input position <code>n</code> and the phase <code>r</code> are kept in the instance
+ * structure between calls, so the output is the same whatever way the input is split
+ * into blocks. The number of outputs produced by a call varies between
+ * <code>floor(blockSize*L/M)</code> and <code>ceil(blockSize*L/M)</code> and is returned
+ * by the processing functions; <code>pDst</code> must have room for
+ * <code>ceil(blockSize*L/M)</code> samples.
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>,
+ * which must be a multiple of <code>L</code>, stored in time reversed order as for the
+ * FIR interpolator:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+ *
+ * \par Fractional Resampler
+ * The arm_fir_resample_frac functions handle ratios that are not a simple fraction
+ * or that change while the signal is running, for example to follow the drift between
+ * two crystal oscillators. The step between output samples is given in input samples
+ * in unsigned 8.24 format in the <code>step</code> field of the instance structure and
+ * may be written between calls. The coefficients are those of an interpolator by
+ * <code>numPhases</code>, typically 32 to 256, and each output is linearly interpolated
+ * between the two nearest polyphase components, at a cost of two components per output.
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength</code>
+ * and <code>pDst</code> must have room for <code>blockSize*2^24/step + 1</code> samples.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks to make sure that the length of the filter is a multiple of the number of phases.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * L, M, phaseLength (numTaps / L), phase and index (both zero), pCoeffs, pState. Also set all of the values in pState to zero.
+ * <pre>
+ * arm_fir_resample_instance_f32 S = {L, M, phaseLength, 0, 0, pCoeffs, pState};
+ * arm_fir_resample_frac_instance_f32 S = {numPhases, phaseLength, step, 0, 0, pCoeffs, pState};
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The fixed-point versions accumulate in 64 bits as the M0 code of the FIR interpolator and
+ * do not overflow in the accumulator. The Q15 results are saturated, the Q31 results are truncated
+ * and the input must be scaled down by log2(phaseLength) bits to avoid wrap around.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point rational FIR resampler.
+ * @param[in,out] *S        points to an instance of the floating-point rational FIR resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *ptr1, *ptr2;                        /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t n = S->index;                         /* Input position of the next output */
+  uint32_t r = S->phase;                         /* Phase of the next output */
+  uint32_t numOut = 0U;                          /* Number of outputs written */
+  uint32_t tapCnt, i;                            /* Loop counters */
+
+  /* Copy the new input samples after the phaseLength - 1 previous ones */
+  pStateCurnt = pState + (phaseLen - 1U);
+  for (i = 0U; i < blockSize; i++)
+  {
+    pStateCurnt[i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    /* Window ending on x[n] and coefficients of phase r */
+    ptr1 = pState + n;
+    ptr2 = pCoeffs + (L - (r + 1U));
+    sum = 0.0f;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2U;
+    while (tapCnt > 0U)
+    {
+      sum += ptr1[0] * ptr2[0];
+      sum += ptr1[1] * ptr2[L];
+      sum += ptr1[2] * ptr2[2U * L];
+      sum += ptr1[3] * ptr2[3U * L];
+
+      ptr1 += 4U;
+      ptr2 += 4U * L;
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining taps here. */
+    tapCnt = phaseLen % 4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      sum += *ptr1++ * *ptr2;
+      ptr2 += L;
+      tapCnt--;
+    }
+
+    pDst[numOut++] = sum;
+
+    /* Advance by M samples of the upsampled signal */
+    r += M;
+    n += r / L;
+    r = r % L;
+  }
+
+  /* Position of the next output relative to the next block */
+  S->index = n - blockSize;
+  S->phase = (uint16_t) r;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  for (i = 0U; i < (phaseLen - 1U); i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_frac_init_q31.c
+ * Description:  Q31 fractional FIR resampler initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 fractional FIR resampler.
+ * @param[in,out] *S        points to an instance of the Q31 fractional FIR resampler structure.
+ * @param[in]     numPhases number of polyphase filter components.
+ * @param[in]     numTaps   number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+ * @param[in]     *pState   points to the state buffer.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @param[in]     step      input samples per output sample in unsigned 8.24 format.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>numPhases</code> or <code>step</code> is zero or ARM_MATH_LENGTH_ERROR if the filter length
+ * <code>numTaps</code> is not a multiple of <code>numPhases</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the coefficients of an interpolator by <code>numPhases</code>
+ * stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>step</code> is the ratio of the input rate to the output rate, for example
+ * <code>(uint32_t) (44100.0 / 48000.0 * 16777216.0)</code>. It may be changed at any time
+ * by writing the <code>step</code> field of the instance structure.
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>(numTaps/numPhases)+blockSize</code> words
+ * where <code>blockSize</code> is the number of input samples processed by each call to <code>arm_fir_resample_frac_q31()</code>.
+ */
+
+arm_status arm_fir_resample_frac_init_q31(
+  arm_fir_resample_frac_instance_q31 * S,
+  uint16_t numPhases,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize,
+  uint32_t step)
+{
+  arm_status status;
+
+  if ((numPhases == 0U) || (step == 0U))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  /* The filter length must be a multiple of the number of phases */
+  else if ((numTaps % numPhases) != 0U)
+  {
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Assign number of phases and polyPhaseLength */
+    S->numPhases = numPhases;
+    S->phaseLength = numTaps / numPhases;
+
+    /* The first output is at the first input sample */
+    S->step = step;
+    S->frac = 0U;
+    S->index = 0;
+
+    /* Clear state buffer and size of state array is always phaseLength + blockSize */
+    memset(pState, 0, (blockSize + (uint32_t) S->phaseLength) * sizeof(q31_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
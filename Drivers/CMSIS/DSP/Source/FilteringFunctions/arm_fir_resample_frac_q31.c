@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_frac_q31.c
+ * Description:  Q31 fractional FIR resampler processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * @brief  Polyphase component ending on the last sample of the window.
+ * @param[in]  *ptr1      points to the oldest sample of the window.
+ * @param[in]  *ptr2      points to the first coefficient of the component.
+ * @param[in]  L          coefficient stride, the number of phases.
+ * @param[in]  phaseLen   number of taps of the component.
+ */
+
+static q63_t arm_fir_resample_frac_dot_q31(
+  const q31_t * ptr1,
+  const q31_t * ptr2,
+  uint32_t L,
+  uint32_t phaseLen)
+{
+  q63_t sum = 0;
+  uint32_t tapCnt;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling.  Process 4 taps at a time. */
+  tapCnt = phaseLen >> 2U;
+  while (tapCnt > 0U)
+  {
+    sum += (q63_t) ptr1[0] * ptr2[0];
+    sum += (q63_t) ptr1[1] * ptr2[L];
+    sum += (q63_t) ptr1[2] * ptr2[2U * L];
+    sum += (q63_t) ptr1[3] * ptr2[3U * L];
+
+    ptr1 += 4U;
+    ptr2 += 4U * L;
+    tapCnt--;
+  }
+
+  /* If the polyPhase length is not a multiple of 4, compute the remaining taps here. */
+  tapCnt = phaseLen % 4U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (tapCnt > 0U)
+  {
+    sum += (q63_t) *ptr1++ * *ptr2;
+    ptr2 += L;
+    tapCnt--;
+  }
+
+  return (sum);
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 fractional FIR resampler.
+ * @param[in,out] *S        points to an instance of the Q31 fractional FIR resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each polyphase component is accumulated in a 64-bit accumulator in 2.62 format as in arm_fir_resample_q31(),
+ * and the two components are interpolated in the same format before the result is truncated to 1.31 format.
+ * The input signal must be scaled down by <code>1/phaseLength</code> to avoid wrap around.
+ */
+
+uint32_t arm_fir_resample_frac_q31(
+  arm_fir_resample_frac_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *pWin;                                   /* Window of the current output */
+  q63_t s0, s1;                                  /* Accumulators of the two phases */
+  uint32_t L = S->numPhases;                     /* Number of phases */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t step = S->step;                       /* Input samples per output, 8.24 format */
+  uint32_t frac = S->frac;                       /* Fractional position, 0.24 format */
+  int32_t n = S->index;                          /* Input position of the next output */
+  uint64_t u;                                    /* Position in units of the phase spacing */
+  uint32_t r, a;                                 /* Phase and fraction of a phase */
+  uint32_t numOut = 0U;                          /* Number of outputs written */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Copy the new input samples after the phaseLength previous ones */
+  pStateCurnt = pState + phaseLen;
+  for (i = 0U; i < blockSize; i++)
+  {
+    pStateCurnt[i] = pSrc[i];
+  }
+
+  /* Both phases around the output position must be available */
+  while ((n + 1) < (int32_t) blockSize)
+  {
+    /* Split the position between x[n] and x[n+1] into a phase and a fraction of a phase */
+    u = (uint64_t) frac * L;
+    r = (uint32_t) (u >> 24U);
+    a = (uint32_t) u & 0xFFFFFFU;
+
+    /* Window ending on x[n] */
+    pWin = pState + (n + 1);
+    s0 = arm_fir_resample_frac_dot_q31(pWin, pCoeffs + (L - (r + 1U)), L, phaseLen);
+
+    if (a != 0U)
+    {
+      /* The next phase after the last one is phase 0 on the window ending on x[n+1] */
+      if ((r + 1U) < L)
+      {
+        s1 = arm_fir_resample_frac_dot_q31(pWin, pCoeffs + (L - (r + 2U)), L, phaseLen);
+      }
+      else
+      {
+        s1 = arm_fir_resample_frac_dot_q31(pWin + 1, pCoeffs + (L - 1U), L, phaseLen);
+      }
+
+      /* Linear interpolation between the two phases, in 2.62 format */
+      s0 += (q63_t) (((s1 - s0) >> 24) * (q63_t) a);
+    }
+
+    pDst[numOut++] = (q31_t) (s0 >> 31);
+
+    /* Advance by step input samples */
+    frac += step;
+    n += (int32_t) (frac >> 24U);
+    frac &= 0xFFFFFFU;
+  }
+
+  /* Position of the next output relative to the next block, -1 at least */
+  S->index = n - (int32_t) blockSize;
+  S->frac = frac;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  for (i = 0U; i < phaseLen; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
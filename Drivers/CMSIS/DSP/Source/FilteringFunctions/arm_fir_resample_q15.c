@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 rational FIR resampler processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 rational FIR resampler.
+ * @param[in,out] *S        points to an instance of the Q15 rational FIR resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *ptr1, *ptr2;                            /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t n = S->index;                         /* Input position of the next output */
+  uint32_t r = S->phase;                         /* Phase of the next output */
+  uint32_t numOut = 0U;                          /* Number of outputs written */
+  uint32_t tapCnt, i;                            /* Loop counters */
+
+  /* Copy the new input samples after the phaseLength - 1 previous ones */
+  pStateCurnt = pState + (phaseLen - 1U);
+  for (i = 0U; i < blockSize; i++)
+  {
+    pStateCurnt[i] = pSrc[i];
+  }
+
+  while (n < blockSize)
+  {
+    /* Window ending on x[n] and coefficients of phase r */
+    ptr1 = pState + n;
+    ptr2 = pCoeffs + (L - (r + 1U));
+    sum = 0;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 taps at a time. */
+    tapCnt = phaseLen >> 2U;
+    while (tapCnt > 0U)
+    {
+      sum += (q63_t) ptr1[0] * ptr2[0];
+      sum += (q63_t) ptr1[1] * ptr2[L];
+      sum += (q63_t) ptr1[2] * ptr2[2U * L];
+      sum += (q63_t) ptr1[3] * ptr2[3U * L];
+
+      ptr1 += 4U;
+      ptr2 += 4U * L;
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining taps here. */
+    tapCnt = phaseLen % 4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      sum += (q63_t) *ptr1++ * *ptr2;
+      ptr2 += L;
+      tapCnt--;
+    }
+
+    pDst[numOut++] = (q15_t) (__SSAT((sum >> 15), 16));
+
+    /* Advance by M samples of the upsampled signal */
+    r += M;
+    n += r / L;
+    r = r % L;
+  }
+
+  /* Position of the next output relative to the next block */
+  S->index = n - blockSize;
+  S->phase = (uint16_t) r;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  for (i = 0U; i < (phaseLen - 1U); i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+
+  return (numOut);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
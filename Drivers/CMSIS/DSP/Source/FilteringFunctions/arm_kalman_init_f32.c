@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_init_f32.c
+ * Description:  Floating-point Kalman filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[in,out] *S          points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     numStates   number of state variables n.
+ * @param[in]     numMeas     number of measurements m.
+ * @param[in]     *pX         points to the initial state vector of length n.
+ * @param[in]     *pP         points to the initial n x n state covariance matrix.
+ * @param[in]     *pF         points to the n x n state transition matrix.
+ * @param[in]     *pQ         points to the n x n process noise covariance matrix.
+ * @param[in]     *pH         points to the m x n measurement matrix.
+ * @param[in]     *pR         points to the m x m measurement noise covariance matrix.
+ * @param[in]     *pWork      points to a workspace of <code>2*n*n + 2*n*m + m*m</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numStates</code> or <code>numMeas</code> is zero.
+ *
+ * \par
+ * The state and the covariance are updated in place by the filter and keep the
+ * estimate between calls.
+ */
+
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint16_t numMeas,
+  float32_t * pX,
+  float32_t * pP,
+  float32_t * pF,
+  float32_t * pQ,
+  float32_t * pH,
+  float32_t * pR,
+  float32_t * pWork)
+{
+  if ((numStates == 0U) || (numMeas == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStates = numStates;
+  S->numMeas = numMeas;
+  S->pX = pX;
+  S->pP = pP;
+  S->pF = pF;
+  S->pQ = pQ;
+  S->pH = pH;
+  S->pR = pR;
+  S->pWork = pWork;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
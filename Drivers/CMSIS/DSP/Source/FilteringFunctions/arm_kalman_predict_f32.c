@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_predict_f32.c
+ * Description:  Floating-point Kalman filter prediction step
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * These functions implement the linear and the extended Kalman filter for a state vector
+ * <code>x</code> of <code>n</code> variables with covariance <code>P</code>, observed through
+ * <code>m</code> measurements <code>z</code>:
+ * <pre>
+ *     x[k] = F * x[k-1] + w,    cov(w) = Q
+ *     z[k] = H * x[k] + v,      cov(v) = R
+ * </pre>
+ * Each time step is a call to arm_kalman_predict_f32() followed by a call to
+ * arm_kalman_update_f32() or arm_kalman_update_sequential_f32() when a measurement is available.
+ * All the matrices are stored in row order, and the intermediate results are kept in a workspace
+ * supplied at initialization, so a step does no dimension checks and writes no temporary
+ * matrix structures.
+ *
+ * \par Algorithm
+ * The prediction computes
+ * <pre>
+ *     x = F * x
+ *     P = F * P * F' + Q
+ * </pre>
+ * The update computes the innovation covariance <code>S = H * P * H' + R</code>, factorizes it with
+ * arm_mat_cholesky_f32() and obtains the gain <code>K = P * H' * inv(S)</code> with
+ * arm_mat_solve_cholesky_f32(), so no matrix is inverted. The state and the covariance are then
+ * updated with
+ * <pre>
+ *     x = x + K * (z - H * x)
+ *     P = (I - K * H) * P * (I - K * H)' + K * R * K'
+ * </pre>
+ * This Joseph form keeps <code>P</code> symmetric positive definite despite the rounding errors
+ * of the gain, at the price of about <code>1.5*n<sup>3</sup></code> multiply-accumulates instead
+ * of <code>n<sup>2</sup>*m</code> for the short form <code>P = P - K * H * P</code>.
+ * As <code>P</code> is symmetric, only its upper triangle is computed and it is copied to the
+ * lower triangle. <code>P</code>, <code>Q</code> and <code>R</code> must be symmetric.
+ *
+ * \par Sequential Update
+ * When <code>R</code> is diagonal, which is the case for independent sensors, the measurements can
+ * be processed one at a time with arm_kalman_update_sequential_f32(). Each scalar measurement costs
+ * about <code>2.5*n<sup>2</sup></code> multiply-accumulates and one division, with no factorization
+ * and no <code>n<sup>3</sup></code> term, and still uses the Joseph form. The off-diagonal
+ * elements of <code>R</code> are ignored.
+ *
+ * \par Extended Kalman Filter
+ * For a nonlinear model <code>x[k] = f(x[k-1])</code>, <code>z[k] = h(x[k])</code>, write the Jacobians
+ * of <code>f</code> and <code>h</code> to the matrices pointed to by <code>pF</code> and <code>pH</code>
+ * before each step, and pass the predicted state <code>f(x)</code> to arm_kalman_predict_f32() and the
+ * predicted measurement <code>h(x)</code> to the update function. Passing NULL instead gives the
+ * linear filter.
+ *
+ * \par Instance Structure
+ * The dimensions and the pointers to the matrices and the workspace are stored in an instance
+ * data structure. A separate instance structure must be defined for each filter. The model matrices
+ * may be shared among several instances, while the state, the covariance and the workspace must be
+ * allocated separately. The workspace is an array of <code>2*n*n + 2*n*m + m*m</code> values.
+ *
+ * \par Initialization Functions
+ * The initialization function sets the values of the internal structure fields. The state
+ * and the covariance are not modified and must hold the initial estimate.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief Prediction step of the floating-point Kalman filter.
+ * @param[in,out] *S      points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pXPred points to the predicted state f(x) of an extended filter, or NULL to compute F * x.
+ * @return none.
+ */
+
+void arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pXPred)
+{
+  float32_t *pX = S->pX;                         /* State vector */
+  float32_t *pP = S->pP;                         /* State covariance */
+  float32_t *pF = S->pF;                         /* State transition matrix */
+  float32_t *pQ = S->pQ;                         /* Process noise covariance */
+  float32_t *pT = S->pWork;                      /* F * P */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t i, j;                                 /* Loop counters */
+
+  /* x = f(x) given by the caller, or F * x */
+  if (pXPred != NULL)
+  {
+    for (i = 0U; i < n; i++)
+    {
+      pX[i] = pXPred[i];
+    }
+  }
+  else
+  {
+    for (i = 0U; i < n; i++)
+    {
+      arm_dot_prod_f32(pF + (i * n), pX, n, &pT[i]);
+    }
+
+    for (i = 0U; i < n; i++)
+    {
+      pX[i] = pT[i];
+    }
+  }
+
+  /* T = F * P. P is symmetric, so column j of P is its row j */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < n; j++)
+    {
+      arm_dot_prod_f32(pF + (i * n), pP + (j * n), n, &pT[(i * n) + j]);
+    }
+  }
+
+  /* P = T * F' + Q, upper triangle copied to the lower one */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      arm_dot_prod_f32(pT + (i * n), pF + (j * n), n, &sum);
+      sum += pQ[(i * n) + j];
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+}
+
+/**
+ * @} end of Kalman group
+ */
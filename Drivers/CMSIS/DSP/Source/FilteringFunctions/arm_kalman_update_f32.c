@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_update_f32.c
+ * Description:  Floating-point Kalman filter measurement update
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief Measurement update of the floating-point Kalman filter.
+ * @param[in,out] *S    points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pZ   points to the measurement vector of length m.
+ * @param[in]     *pHx  points to the predicted measurement h(x) of an extended filter, or NULL to compute H * x.
+ * @return        The function returns ARM_MATH_DECOMPOSITION_FAILURE if the innovation covariance
+ * <code>H * P * H' + R</code> is not positive definite, in which case the state and the covariance
+ * are not modified. Otherwise, the function returns ARM_MATH_SUCCESS.
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ,
+  float32_t * pHx)
+{
+  float32_t *pX = S->pX;                         /* State vector */
+  float32_t *pP = S->pP;                         /* State covariance */
+  float32_t *pH = S->pH;                         /* Measurement matrix */
+  float32_t *pR = S->pR;                         /* Measurement noise covariance */
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t m = S->numMeas;                       /* Number of measurements */
+  float32_t *pKt = S->pWork;                     /* H * P, then K', then K * R (m x n) */
+  float32_t *pS = pKt + (m * n);                 /* Innovation covariance (m x m) */
+  float32_t *pK = pS + (m * m);                  /* Innovation, then K (n x m) */
+  float32_t *pA = pK + (n * m);                  /* I - K * H (n x n) */
+  float32_t *pT = pA + (n * n);                  /* (I - K * H) * P (n x n) */
+  float32_t *pU = pKt;                           /* K * R (n x m) */
+  float32_t *pY = pK;                            /* Innovation */
+  float32_t *pRowA;                              /* Row of I - K * H */
+  float32_t sum, sumKRK;                         /* Accumulators */
+  float32_t kia;                                 /* Element of K */
+  arm_matrix_instance_f32 matS, matKt;           /* Views of S and K' for the solve */
+  uint32_t i, j, a, b;                           /* Loop counters */
+
+  /* y = z - h(x), or z - H * x */
+  for (a = 0U; a < m; a++)
+  {
+    if (pHx != NULL)
+    {
+      sum = pHx[a];
+    }
+    else
+    {
+      arm_dot_prod_f32(pH + (a * n), pX, n, &sum);
+    }
+
+    pY[a] = pZ[a] - sum;
+  }
+
+  /* H * P. P is symmetric, so column j of P is its row j */
+  for (a = 0U; a < m; a++)
+  {
+    for (j = 0U; j < n; j++)
+    {
+      arm_dot_prod_f32(pH + (a * n), pP + (j * n), n, &pKt[(a * n) + j]);
+    }
+  }
+
+  /* Lower triangle of S = H * P * H' + R, the only part read by the factorization */
+  for (a = 0U; a < m; a++)
+  {
+    for (b = 0U; b <= a; b++)
+    {
+      arm_dot_prod_f32(pKt + (a * n), pH + (b * n), n, &sum);
+      pS[(a * m) + b] = sum + pR[(a * m) + b];
+    }
+  }
+
+  /* S * K' = H * P, solved in place from the Cholesky factor of S */
+  matS.numRows = (uint16_t) m;
+  matS.numCols = (uint16_t) m;
+  matS.pData = pS;
+  matKt.numRows = (uint16_t) m;
+  matKt.numCols = (uint16_t) n;
+  matKt.pData = pKt;
+
+  if (arm_mat_cholesky_f32(&matS, &matS) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_DECOMPOSITION_FAILURE);
+  }
+
+  arm_mat_solve_cholesky_f32(&matS, &matKt, &matKt);
+
+  /* x = x + K * y */
+  for (a = 0U; a < m; a++)
+  {
+    for (i = 0U; i < n; i++)
+    {
+      pX[i] += pKt[(a * n) + i] * pY[a];
+    }
+  }
+
+  /* K from K', the innovation is no longer needed */
+  for (i = 0U; i < n; i++)
+  {
+    for (a = 0U; a < m; a++)
+    {
+      pK[(i * m) + a] = pKt[(a * n) + i];
+    }
+  }
+
+  /* U = K * R, overwriting K'. R is symmetric, so column a of R is its row a */
+  for (i = 0U; i < n; i++)
+  {
+    for (a = 0U; a < m; a++)
+    {
+      arm_dot_prod_f32(pK + (i * m), pR + (a * m), m, &pU[(i * m) + a]);
+    }
+  }
+
+  /* A = I - K * H, built row by row from the rows of H */
+  for (i = 0U; i < n; i++)
+  {
+    pRowA = pA + (i * n);
+
+    for (j = 0U; j < n; j++)
+    {
+      pRowA[j] = 0.0f;
+    }
+
+    pRowA[i] = 1.0f;
+
+    for (a = 0U; a < m; a++)
+    {
+      kia = pK[(i * m) + a];
+
+      for (j = 0U; j < n; j++)
+      {
+        pRowA[j] -= kia * pH[(a * n) + j];
+      }
+    }
+  }
+
+  /* T = A * P */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < n; j++)
+    {
+      arm_dot_prod_f32(pA + (i * n), pP + (j * n), n, &pT[(i * n) + j]);
+    }
+  }
+
+  /* P = T * A' + U * K', upper triangle copied to the lower one */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      arm_dot_prod_f32(pT + (i * n), pA + (j * n), n, &sum);
+      arm_dot_prod_f32(pU + (i * m), pK + (j * m), m, &sumKRK);
+      sum += sumKRK;
+      pP[(i * n) + j] = sum;
+      pP[(j * n) + i] = sum;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_update_sequential_f32.c
+ * Description:  Floating-point Kalman filter sequential scalar measurement update
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief Sequential scalar measurement update of the floating-point Kalman filter.
+ * @param[in,out] *S    points to an instance of the floating-point Kalman filter structure.
+ * @param[in]     *pZ   points to the measurement vector of length m.
+ * @param[in]     *pHx  points to the predicted measurement h(x) of an extended filter, or NULL to compute H * x.
+ * @return        The function returns ARM_MATH_DECOMPOSITION_FAILURE if the innovation variance
+ * <code>h * P * h' + r</code> of a measurement is not positive, in which case the measurements
+ * before it have been applied. Otherwise, the function returns ARM_MATH_SUCCESS.
+ *
+ * \par
+ * The measurements are applied one after the other, with the diagonal elements of <code>R</code>
+ * as their variances. For an extended filter the predicted measurements are corrected for the
+ * change of the state made by the previous measurements of the same call, with the Jacobian in
+ * <code>pH</code>.
+ */
+
+arm_status arm_kalman_update_sequential_f32(
+  arm_kalman_instance_f32 * S,
+  float32_t * pZ,
+  float32_t * pHx)
+{
+  float32_t *pX = S->pX;                         /* State vector */
+  float32_t *pP = S->pP;                         /* State covariance */
+  float32_t *pH = S->pH;                         /* Measurement matrix */
+  float32_t *pR = S->pR;                         /* Measurement noise covariance */
+  uint32_t n = S->numStates;                     /* Number of states */
+  uint32_t m = S->numMeas;                       /* Number of measurements */
+  float32_t *pPh = S->pWork;                     /* P * h' */
+  float32_t *pK = pPh + n;                       /* Gain */
+  float32_t *pX0 = pK + n;                       /* State before the update */
+  float32_t *pRowH;                              /* Row of H */
+  float32_t s, pred, innov, hx0;                 /* Innovation variance, predicted measurement, innovation, h * x0 */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t i, j, a;                              /* Loop counters */
+
+  if (pHx != NULL)
+  {
+    for (i = 0U; i < n; i++)
+    {
+      pX0[i] = pX[i];
+    }
+  }
+
+  for (a = 0U; a < m; a++)
+  {
+    pRowH = pH + (a * n);
+
+    /* P * h'. P is symmetric, so column i of P is its row i */
+    for (i = 0U; i < n; i++)
+    {
+      arm_dot_prod_f32(pP + (i * n), pRowH, n, &pPh[i]);
+    }
+
+    /* s = h * P * h' + r */
+    arm_dot_prod_f32(pRowH, pPh, n, &s);
+    s += pR[(a * m) + a];
+
+    if (!(s > 0.0f))
+    {
+      return (ARM_MATH_DECOMPOSITION_FAILURE);
+    }
+
+    /* Predicted measurement h * x, or h(x) + h * (x - x0) */
+    arm_dot_prod_f32(pRowH, pX, n, &pred);
+
+    if (pHx != NULL)
+    {
+      arm_dot_prod_f32(pRowH, pX0, n, &hx0);
+      pred += pHx[a] - hx0;
+    }
+
+    innov = pZ[a] - pred;
+
+    /* k = P * h' / s, x = x + k * innovation */
+    for (i = 0U; i < n; i++)
+    {
+      pK[i] = pPh[i] / s;
+      pX[i] += pK[i] * innov;
+    }
+
+    /* Joseph form P = (I - k * h) * P * (I - k * h)' + k * r * k'
+     *               = P - k * Ph' - Ph * k' + s * k * k',
+     * upper triangle copied to the lower one */
+    for (i = 0U; i < n; i++)
+    {
+      for (j = i; j < n; j++)
+      {
+        sum = pP[(i * n) + j] + (pK[i] * ((s * pK[j]) - pPh[j])) - (pPh[i] * pK[j]);
+        pP[(i * n) + j] = sum;
+        pP[(j * n) + i] = sum;
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
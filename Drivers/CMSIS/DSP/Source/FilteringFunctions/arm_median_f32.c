@@ -0,0 +1,312 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_f32.c
+ * Description:  Floating-point running median filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * The window is kept in a double heap around the median, addressed by a position p
+ * from -L to U with L = (windowSize - 1) / 2 and U = windowSize / 2. Position 0 is
+ * the median, positions 1 to U are a min-heap of the larger samples and positions
+ * -1 to -L a max-heap of the smaller samples, and the parent of p is p / 2.
+ * pHeap[L + p] is the state index of the sample at position p, and
+ * pHeap[windowSize + i] is L + the position of the sample at state index i.
+ */
+
+/*
+ * @brief  Swaps the samples at two positions of the heap.
+ * @param[in,out] *pHeap      points to the heap buffer.
+ * @param[in]     windowSize  number of samples in the window.
+ * @param[in]     a           heap slot, L + position.
+ * @param[in]     b           heap slot, L + position.
+ * @return none.
+ */
+
+static void arm_median_swap_f32(
+  uint16_t * pHeap,
+  uint16_t windowSize,
+  int32_t a,
+  int32_t b)
+{
+  uint16_t index = pHeap[a];                     /* temporary variable */
+
+  pHeap[a] = pHeap[b];
+  pHeap[b] = index;
+  pHeap[windowSize + pHeap[a]] = (uint16_t) a;
+  pHeap[windowSize + pHeap[b]] = (uint16_t) b;
+}
+
+/*
+ * @brief  Moves a sample towards the median while it is on the wrong side of its parent.
+ * @param[in,out] *S  points to an instance of the floating-point running median structure.
+ * @param[in]     p   position of the sample.
+ * @return  the final position of the sample.
+ */
+
+static int32_t arm_median_up_f32(
+  arm_median_instance_f32 * S,
+  int32_t p)
+{
+  const float32_t *pState = S->pState;           /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  int32_t L = ((int32_t) S->windowSize - 1) >> 1; /* size of the lower heap */
+  int32_t parent;                                /* parent position */
+  float32_t in, above;                           /* sample and parent values */
+
+  while (p != 0)
+  {
+    parent = p / 2;
+    in = pState[pHeap[L + p]];
+    above = pState[pHeap[L + parent]];
+
+    if ((p > 0) ? (in < above) : (in > above))
+    {
+      arm_median_swap_f32(pHeap, S->windowSize, L + p, L + parent);
+      p = parent;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return (p);
+}
+
+/*
+ * @brief  Moves a sample down the min-heap of the larger samples.
+ * @param[in,out] *S  points to an instance of the floating-point running median structure.
+ * @param[in]     p   position of the sample, 0 or positive.
+ * @return none.
+ */
+
+static void arm_median_down_upper_f32(
+  arm_median_instance_f32 * S,
+  int32_t p)
+{
+  const float32_t *pState = S->pState;           /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  int32_t L = ((int32_t) S->windowSize - 1) >> 1; /* size of the lower heap */
+  int32_t U = (int32_t) S->windowSize >> 1;      /* size of the upper heap */
+  int32_t child;                                 /* child position */
+
+  for (;;)
+  {
+    child = (p == 0) ? 1 : (2 * p);
+    if (child > U)
+    {
+      break;
+    }
+
+    /* Smaller of the two children */
+    if ((p > 0) && ((child + 1) <= U) &&
+        (pState[pHeap[L + child + 1]] < pState[pHeap[L + child]]))
+    {
+      child++;
+    }
+
+    if (pState[pHeap[L + child]] < pState[pHeap[L + p]])
+    {
+      arm_median_swap_f32(pHeap, S->windowSize, L + p, L + child);
+      p = child;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/*
+ * @brief  Moves a sample down the max-heap of the smaller samples.
+ * @param[in,out] *S  points to an instance of the floating-point running median structure.
+ * @param[in]     p   position of the sample, 0 or negative.
+ * @return none.
+ */
+
+static void arm_median_down_lower_f32(
+  arm_median_instance_f32 * S,
+  int32_t p)
+{
+  const float32_t *pState = S->pState;           /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  int32_t L = ((int32_t) S->windowSize - 1) >> 1; /* size of the lower heap */
+  int32_t child;                                 /* child position */
+
+  for (;;)
+  {
+    child = (p == 0) ? -1 : (2 * p);
+    if (child < -L)
+    {
+      break;
+    }
+
+    /* Larger of the two children */
+    if ((p < 0) && ((child - 1) >= -L) &&
+        (pState[pHeap[L + child - 1]] > pState[pHeap[L + child]]))
+    {
+      child--;
+    }
+
+    if (pState[pHeap[L + child]] > pState[pHeap[L + p]])
+    {
+      arm_median_swap_f32(pHeap, S->windowSize, L + p, L + child);
+      p = child;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Median Running Median Filter
+ *
+ * Replaces each sample by the median of the last <code>windowSize</code> input samples:
+ * <pre>
+ *     y[n] = median(x[n-windowSize+1], ..., x[n-1], x[n])
+ * </pre>
+ * An odd window gives the middle sample, and an even window the average of the two
+ * middle samples. The median removes isolated spikes of up to <code>(windowSize - 1) / 2</code>
+ * samples from a sensor signal, and keeps its steps, which a linear filter smooths.
+ *
+ * \par Algorithm
+ * The window is kept in a heap of the samples larger than the median and a heap of
+ * the samples smaller than the median, which meet at the median. Each new sample
+ * replaces the oldest one in place and is moved up or down the heaps, so an output
+ * takes at most <code>2 log2(windowSize)</code> comparisons instead of sorting the window.
+ *
+ * \par Instance Structure
+ * The state of the filter is the window samples <code>pState</code> and the heap
+ * <code>pHeap</code>, of windowSize and 2*windowSize elements, given to the init function.
+ * The filter works in place: <code>pSrc</code> and <code>pDst</code> may be the same buffer.
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point running median filter.
+ * @param[in,out] *S          points to an instance of the floating-point running median structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+
+void arm_median_f32(
+  arm_median_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  uint16_t windowSize = S->windowSize;           /* number of samples in the window */
+  uint16_t oldest = S->oldest;                   /* state index of the oldest sample */
+  int32_t L = ((int32_t) windowSize - 1) >> 1;   /* size of the lower heap */
+  int32_t p;                                     /* position of the new sample */
+  float32_t in, out;                             /* new and replaced samples */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* Replace the oldest sample */
+    in = *pSrc++;
+    out = pState[oldest];
+    pState[oldest] = in;
+    p = (int32_t) pHeap[windowSize + oldest] - L;
+
+    if (p > 0)
+    {
+      /* A smaller sample can move up to the median, then down the lower heap */
+      if (in < out)
+      {
+        if (arm_median_up_f32(S, p) == 0)
+        {
+          arm_median_down_lower_f32(S, 0);
+        }
+      }
+      else
+      {
+        arm_median_down_upper_f32(S, p);
+      }
+    }
+    else if (p < 0)
+    {
+      /* A larger sample can move up to the median, then down the upper heap */
+      if (in > out)
+      {
+        if (arm_median_up_f32(S, p) == 0)
+        {
+          arm_median_down_upper_f32(S, 0);
+        }
+      }
+      else
+      {
+        arm_median_down_lower_f32(S, p);
+      }
+    }
+    else if (in > out)
+    {
+      arm_median_down_upper_f32(S, 0);
+    }
+    else
+    {
+      arm_median_down_lower_f32(S, 0);
+    }
+
+    oldest = (oldest == (windowSize - 1U)) ? 0U : (oldest + 1U);
+
+    /* Median, or average of the two middle samples for an even window */
+    if ((windowSize & 1U) != 0U)
+    {
+      *pDst++ = pState[pHeap[L]];
+    }
+    else
+    {
+      *pDst++ = 0.5f * (pState[pHeap[L]] + pState[pHeap[L + 1]]);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->oldest = oldest;
+}
+
+/**
+ * @} end of Median group
+ */
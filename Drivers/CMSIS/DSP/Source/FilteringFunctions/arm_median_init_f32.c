@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_init_f32.c
+ * Description:  Floating-point running median filter initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief Initialization function for the floating-point running median filter.
+ * @param[in,out] *S            points to an instance of the floating-point running median structure.
+ * @param[in]     windowSize    number of samples in the window, from 1 to 32767.
+ * @param[in]     *pState       points to the state buffer of windowSize samples.
+ * @param[in]     *pHeap        points to the heap buffer of 2*windowSize indices.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The window is cleared, so the first outputs are the median of the first
+ * inputs and of zeros, as the FIR filters start from a zero state.
+ */
+
+void arm_median_init_f32(
+  arm_median_instance_f32 * S,
+  uint16_t windowSize,
+  float32_t * pState,
+  uint16_t * pHeap)
+{
+  uint16_t i;                                    /* loop counter */
+
+  S->windowSize = windowSize;
+  S->oldest = 0U;
+  S->pState = pState;
+  S->pHeap = pHeap;
+
+  /* Equal samples are a valid heap in any order */
+  memset(pState, 0, windowSize * sizeof(float32_t));
+
+  for (i = 0U; i < windowSize; i++)
+  {
+    pHeap[i] = i;
+    pHeap[windowSize + i] = i;
+  }
+}
+
+/**
+ * @} end of Median group
+ */
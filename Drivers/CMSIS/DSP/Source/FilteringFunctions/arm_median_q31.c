@@ -0,0 +1,284 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_q31.c
+ * Description:  Q31 running median filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * The layout of the heap is described in arm_median_f32.c.
+ */
+
+/*
+ * @brief  Swaps the samples at two positions of the heap.
+ * @param[in,out] *pHeap      points to the heap buffer.
+ * @param[in]     windowSize  number of samples in the window.
+ * @param[in]     a           heap slot, L + position.
+ * @param[in]     b           heap slot, L + position.
+ * @return none.
+ */
+
+static void arm_median_swap_q31(
+  uint16_t * pHeap,
+  uint16_t windowSize,
+  int32_t a,
+  int32_t b)
+{
+  uint16_t index = pHeap[a];                     /* temporary variable */
+
+  pHeap[a] = pHeap[b];
+  pHeap[b] = index;
+  pHeap[windowSize + pHeap[a]] = (uint16_t) a;
+  pHeap[windowSize + pHeap[b]] = (uint16_t) b;
+}
+
+/*
+ * @brief  Moves a sample towards the median while it is on the wrong side of its parent.
+ * @param[in,out] *S  points to an instance of the Q31 running median structure.
+ * @param[in]     p   position of the sample.
+ * @return  the final position of the sample.
+ */
+
+static int32_t arm_median_up_q31(
+  arm_median_instance_q31 * S,
+  int32_t p)
+{
+  const q31_t *pState = S->pState;               /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  int32_t L = ((int32_t) S->windowSize - 1) >> 1; /* size of the lower heap */
+  int32_t parent;                                /* parent position */
+  q31_t in, above;                               /* sample and parent values */
+
+  while (p != 0)
+  {
+    parent = p / 2;
+    in = pState[pHeap[L + p]];
+    above = pState[pHeap[L + parent]];
+
+    if ((p > 0) ? (in < above) : (in > above))
+    {
+      arm_median_swap_q31(pHeap, S->windowSize, L + p, L + parent);
+      p = parent;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return (p);
+}
+
+/*
+ * @brief  Moves a sample down the min-heap of the larger samples.
+ * @param[in,out] *S  points to an instance of the Q31 running median structure.
+ * @param[in]     p   position of the sample, 0 or positive.
+ * @return none.
+ */
+
+static void arm_median_down_upper_q31(
+  arm_median_instance_q31 * S,
+  int32_t p)
+{
+  const q31_t *pState = S->pState;               /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  int32_t L = ((int32_t) S->windowSize - 1) >> 1; /* size of the lower heap */
+  int32_t U = (int32_t) S->windowSize >> 1;      /* size of the upper heap */
+  int32_t child;                                 /* child position */
+
+  for (;;)
+  {
+    child = (p == 0) ? 1 : (2 * p);
+    if (child > U)
+    {
+      break;
+    }
+
+    /* Smaller of the two children */
+    if ((p > 0) && ((child + 1) <= U) &&
+        (pState[pHeap[L + child + 1]] < pState[pHeap[L + child]]))
+    {
+      child++;
+    }
+
+    if (pState[pHeap[L + child]] < pState[pHeap[L + p]])
+    {
+      arm_median_swap_q31(pHeap, S->windowSize, L + p, L + child);
+      p = child;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/*
+ * @brief  Moves a sample down the max-heap of the smaller samples.
+ * @param[in,out] *S  points to an instance of the Q31 running median structure.
+ * @param[in]     p   position of the sample, 0 or negative.
+ * @return none.
+ */
+
+static void arm_median_down_lower_q31(
+  arm_median_instance_q31 * S,
+  int32_t p)
+{
+  const q31_t *pState = S->pState;               /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  int32_t L = ((int32_t) S->windowSize - 1) >> 1; /* size of the lower heap */
+  int32_t child;                                 /* child position */
+
+  for (;;)
+  {
+    child = (p == 0) ? -1 : (2 * p);
+    if (child < -L)
+    {
+      break;
+    }
+
+    /* Larger of the two children */
+    if ((p < 0) && ((child - 1) >= -L) &&
+        (pState[pHeap[L + child - 1]] > pState[pHeap[L + child]]))
+    {
+      child--;
+    }
+
+    if (pState[pHeap[L + child]] > pState[pHeap[L + p]])
+    {
+      arm_median_swap_q31(pHeap, S->windowSize, L + p, L + child);
+      p = child;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 running median filter.
+ * @param[in,out] *S          points to an instance of the Q31 running median structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+
+void arm_median_q31(
+  arm_median_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* window samples */
+  uint16_t *pHeap = S->pHeap;                    /* heap buffer */
+  uint16_t windowSize = S->windowSize;           /* number of samples in the window */
+  uint16_t oldest = S->oldest;                   /* state index of the oldest sample */
+  int32_t L = ((int32_t) windowSize - 1) >> 1;   /* size of the lower heap */
+  int32_t p;                                     /* position of the new sample */
+  q31_t in, out;                                 /* new and replaced samples */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* Replace the oldest sample */
+    in = *pSrc++;
+    out = pState[oldest];
+    pState[oldest] = in;
+    p = (int32_t) pHeap[windowSize + oldest] - L;
+
+    if (p > 0)
+    {
+      /* A smaller sample can move up to the median, then down the lower heap */
+      if (in < out)
+      {
+        if (arm_median_up_q31(S, p) == 0)
+        {
+          arm_median_down_lower_q31(S, 0);
+        }
+      }
+      else
+      {
+        arm_median_down_upper_q31(S, p);
+      }
+    }
+    else if (p < 0)
+    {
+      /* A larger sample can move up to the median, then down the upper heap */
+      if (in > out)
+      {
+        if (arm_median_up_q31(S, p) == 0)
+        {
+          arm_median_down_upper_q31(S, 0);
+        }
+      }
+      else
+      {
+        arm_median_down_lower_q31(S, p);
+      }
+    }
+    else if (in > out)
+    {
+      arm_median_down_upper_q31(S, 0);
+    }
+    else
+    {
+      arm_median_down_lower_q31(S, 0);
+    }
+
+    oldest = (oldest == (windowSize - 1U)) ? 0U : (oldest + 1U);
+
+    /* Median, or average of the two middle samples for an even window */
+    if ((windowSize & 1U) != 0U)
+    {
+      *pDst++ = pState[pHeap[L]];
+    }
+    else
+    {
+      *pDst++ = (q31_t) (((q63_t) pState[pHeap[L]] + pState[pHeap[L + 1]]) >> 1);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->oldest = oldest;
+}
+
+/**
+ * @} end of Median group
+ */
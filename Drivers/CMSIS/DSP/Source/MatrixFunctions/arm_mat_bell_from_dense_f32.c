@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_bell_from_dense_f32.c
+ * Description:  Floating-point dense to blocked-ELL matrix conversion
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/*
+ * @brief  Tells whether a block of a dense matrix has an element above the threshold.
+ */
+
+static uint32_t arm_mat_bell_block_kept_f32(
+  const float32_t * pIn,
+  uint32_t stride,
+  uint32_t blockSize,
+  float32_t threshold)
+{
+  uint32_t r, q;                                 /* loop counters */
+
+  for (r = 0U; r < blockSize; r++)
+  {
+    for (q = 0U; q < blockSize; q++)
+    {
+      if ((pIn[q] > threshold) || (pIn[q] < -threshold))
+      {
+        return (1U);
+      }
+    }
+
+    pIn += stride;
+  }
+
+  return (0U);
+}
+
+/**
+ * @brief  Conversion of a floating-point dense matrix to blocked-ELL, dropping the small blocks.
+ * @param[in]     *pSrc        points to the dense matrix.
+ * @param[in]     threshold    elements with a magnitude at most threshold are dropped, non-negative.
+ * @param[in]     maxBlocks    number of blocks that fit in pColIdx and pData of pDst.
+ * @param[in,out] *pDst        points to the blocked-ELL matrix, initialized with its block size.
+ * @return        ARM_MATH_ARGUMENT_ERROR if the block size does not divide the dimensions,
+ *                ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+ *
+ * The block size must be non-zero and divide both dimensions of pSrc. A block
+ * is stored when one of its elements has a magnitude above the threshold, and
+ * its other small elements are set to zero, so
+ * the result holds the same matrix as arm_mat_csr_from_dense_f32() with the
+ * same threshold. The dimensions of pDst are set from pSrc and blockCols is set
+ * to the largest number of stored blocks in a block row; the shorter block rows
+ * end with padding blocks.
+ */
+
+arm_status arm_mat_bell_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t threshold,
+  uint32_t maxBlocks,
+  arm_mat_bell_instance_f32 * pDst)
+{
+  const float32_t *pIn;                          /* input block pointer */
+  float32_t *pOut = pDst->pData;                 /* output block pointer */
+  uint16_t *pCol = pDst->pColIdx;                /* output index pointer */
+  uint32_t b = pDst->blockSize;                  /* block size */
+  uint32_t K = pSrc->numCols;                    /* number of columns */
+  uint32_t blockRows, blocksPerRow;              /* matrix size in blocks */
+  uint32_t blockCols = 0U;                       /* stored blocks per block row */
+  uint32_t br, bc, s, r, q;                      /* loop counters */
+  float32_t a;                                   /* current element */
+
+  if ((b == 0U) || ((pSrc->numRows % b) != 0U) || ((K % b) != 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  blockRows = pSrc->numRows / b;
+  blocksPerRow = K / b;
+
+  /* The longest block row sets the number of blocks stored per block row */
+  for (br = 0U; br < blockRows; br++)
+  {
+    s = 0U;
+
+    for (bc = 0U; bc < blocksPerRow; bc++)
+    {
+      s += arm_mat_bell_block_kept_f32(pSrc->pData + (br * K + bc) * b, K, b, threshold);
+    }
+
+    blockCols = (s > blockCols) ? s : blockCols;
+  }
+
+  if ((blockRows * blockCols) > maxBlocks)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  pDst->numRows = pSrc->numRows;
+  pDst->numCols = pSrc->numCols;
+  pDst->blockCols = blockCols;
+
+  for (br = 0U; br < blockRows; br++)
+  {
+    s = 0U;
+
+    for (bc = 0U; bc < blocksPerRow; bc++)
+    {
+      pIn = pSrc->pData + (br * K + bc) * b;
+
+      if (arm_mat_bell_block_kept_f32(pIn, K, b, threshold) != 0U)
+      {
+        /* Copy the block by rows, without its small elements */
+        for (r = 0U; r < b; r++)
+        {
+          for (q = 0U; q < b; q++)
+          {
+            a = pIn[q];
+            *pOut++ = ((a > threshold) || (a < -threshold)) ? a : 0.0f;
+          }
+
+          pIn += K;
+        }
+
+        *pCol++ = bc;
+        s++;
+      }
+    }
+
+    /* Pad the block row with zero blocks */
+    for (; s < blockCols; s++)
+    {
+      for (r = 0U; r < (b * b); r++)
+      {
+        *pOut++ = 0.0f;
+      }
+
+      *pCol++ = ARM_MAT_BELL_PAD;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
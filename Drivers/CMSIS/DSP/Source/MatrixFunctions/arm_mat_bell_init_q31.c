@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_bell_init_q31.c
+ * Description:  Q31 blocked-ELL matrix initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Q31 blocked-ELL matrix initialization.
+ * @param[in,out] *S          points to an instance of the Q31 blocked-ELL matrix structure.
+ * @param[in]     nRows       number of rows in the matrix, a multiple of blockSize.
+ * @param[in]     nColumns    number of columns in the matrix, a multiple of blockSize.
+ * @param[in]     blockSize   size of the square blocks.
+ * @param[in]     blockCols   number of blocks stored per block row.
+ * @param[in]     *pColIdx    points to the block column indexes, nRows/blockSize*blockCols values.
+ * @param[in]     *pData      points to the blocks, nRows*blockSize*blockCols values.
+ * @return        none
+ */
+
+void arm_mat_bell_init_q31(
+  arm_mat_bell_instance_q31 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint16_t blockSize,
+  uint16_t blockCols,
+  uint16_t * pColIdx,
+  q31_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign the block geometry */
+  S->blockSize = blockSize;
+  S->blockCols = blockCols;
+
+  /* Assign the index and data pointers */
+  S->pColIdx = pColIdx;
+  S->pData = pData;
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
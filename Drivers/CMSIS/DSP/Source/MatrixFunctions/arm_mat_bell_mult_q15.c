@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_bell_mult_q15.c
+ * Description:  Q15 blocked-ELL matrix times dense matrix
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Q15 blocked-ELL matrix times dense matrix.
+ * @param[in]  *pSrcA  points to the blocked-ELL matrix.
+ * @param[in]  *pSrcB  points to the dense matrix.
+ * @param[out] *pDst   points to the dense output matrix.
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using an internal 64-bit accumulator. The products
+ * of two 1.15 values are added in 34.30 format, so there is no risk of overflow.
+ * The accumulator is right shifted by 15 bits and saturated to 1.15 format to yield
+ * each result, as in arm_mat_mult_q15().
+ */
+
+arm_status arm_mat_bell_mult_q15(
+  const arm_mat_bell_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst)
+{
+  const q15_t *pB = pSrcB->pData;                /* input data matrix pointer B */
+  q15_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  const uint16_t *pCol = pSrcA->pColIdx;         /* block column index pointer */
+  const q15_t *pBlk = pSrcA->pData;              /* block data pointer */
+  const q15_t *pA, *pRowB;                       /* block row and B row pointers */
+  q63_t c0, c1, c2, c3;                          /* accumulators */
+  q15_t a;                                       /* element of A */
+  uint32_t N = pSrcB->numCols;                   /* number of columns of B */
+  uint32_t b = pSrcA->blockSize;                 /* block size */
+  uint32_t blockSlots = pSrcA->blockCols;        /* blocks per block row */
+  uint32_t blockRows = pSrcA->numRows / b;       /* number of block rows */
+  uint32_t br, r, col, s, q;                     /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (br = 0U; br < blockRows; br++)
+  {
+    for (r = 0U; r < b; r++)
+    {
+      /* Four columns of the output row at a time, padding blocks coming last in a block row */
+      for (col = 0U; (col + 4U) <= N; col += 4U)
+      {
+        c0 = c1 = c2 = c3 = 0;
+
+        for (s = 0U; (s < blockSlots) && (pCol[s] != ARM_MAT_BELL_PAD); s++)
+        {
+          pA = pBlk + (s * b + r) * b;
+          pRowB = pB + (uint32_t) pCol[s] * b * N + col;
+
+          for (q = 0U; q < b; q++)
+          {
+            a = pA[q];
+
+            c0 += (q31_t) a * pRowB[0];
+            c1 += (q31_t) a * pRowB[1];
+            c2 += (q31_t) a * pRowB[2];
+            c3 += (q31_t) a * pRowB[3];
+
+            pRowB += N;
+          }
+        }
+
+        pOut[col] = (q15_t) __SSAT((c0 >> 15), 16);
+        pOut[col + 1U] = (q15_t) __SSAT((c1 >> 15), 16);
+        pOut[col + 2U] = (q15_t) __SSAT((c2 >> 15), 16);
+        pOut[col + 3U] = (q15_t) __SSAT((c3 >> 15), 16);
+      }
+
+      /* Remaining columns */
+      for (; col < N; col++)
+      {
+        c0 = 0;
+
+        for (s = 0U; (s < blockSlots) && (pCol[s] != ARM_MAT_BELL_PAD); s++)
+        {
+          pA = pBlk + (s * b + r) * b;
+          pRowB = pB + (uint32_t) pCol[s] * b * N + col;
+
+          for (q = 0U; q < b; q++)
+          {
+            c0 += (q31_t) pA[q] * pRowB[q * N];
+          }
+        }
+
+        pOut[col] = (q15_t) __SSAT((c0 >> 15), 16);
+      }
+
+      pOut += N;
+    }
+
+    pCol += blockSlots;
+    pBlk += blockSlots * b * b;
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_bell_mult_q31.c
+ * Description:  Q31 blocked-ELL matrix times dense matrix
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Q31 blocked-ELL matrix times dense matrix.
+ * @param[in]  *pSrcA  points to the blocked-ELL matrix.
+ * @param[in]  *pSrcB  points to the dense matrix.
+ * @param[out] *pDst   points to the dense output matrix.
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format,
+ * with no saturation on the intermediate additions. The accumulator is right shifted
+ * by 31 bits and saturated to 1.31 format to yield each result, as in arm_mat_mult_q31().
+ */
+
+arm_status arm_mat_bell_mult_q31(
+  const arm_mat_bell_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  const q31_t *pB = pSrcB->pData;                /* input data matrix pointer B */
+  q31_t *pOut = pDst->pData;                     /* output data matrix pointer */
+  const uint16_t *pCol = pSrcA->pColIdx;         /* block column index pointer */
+  const q31_t *pBlk = pSrcA->pData;              /* block data pointer */
+  const q31_t *pA, *pRowB;                       /* block row and B row pointers */
+  q63_t c0, c1, c2, c3;                          /* accumulators */
+  q31_t a;                                       /* element of A */
+  uint32_t N = pSrcB->numCols;                   /* number of columns of B */
+  uint32_t b = pSrcA->blockSize;                 /* block size */
+  uint32_t blockSlots = pSrcA->blockCols;        /* blocks per block row */
+  uint32_t blockRows = pSrcA->numRows / b;       /* number of block rows */
+  uint32_t br, r, col, s, q;                     /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (br = 0U; br < blockRows; br++)
+  {
+    for (r = 0U; r < b; r++)
+    {
+      /* Four columns of the output row at a time, padding blocks coming last in a block row */
+      for (col = 0U; (col + 4U) <= N; col += 4U)
+      {
+        c0 = c1 = c2 = c3 = 0;
+
+        for (s = 0U; (s < blockSlots) && (pCol[s] != ARM_MAT_BELL_PAD); s++)
+        {
+          pA = pBlk + (s * b + r) * b;
+          pRowB = pB + (uint32_t) pCol[s] * b * N + col;
+
+          for (q = 0U; q < b; q++)
+          {
+            a = pA[q];
+
+            c0 += (q63_t) a * pRowB[0];
+            c1 += (q63_t) a * pRowB[1];
+            c2 += (q63_t) a * pRowB[2];
+            c3 += (q63_t) a * pRowB[3];
+
+            pRowB += N;
+          }
+        }
+
+        pOut[col] = clip_q63_to_q31(c0 >> 31);
+        pOut[col + 1U] = clip_q63_to_q31(c1 >> 31);
+        pOut[col + 2U] = clip_q63_to_q31(c2 >> 31);
+        pOut[col + 3U] = clip_q63_to_q31(c3 >> 31);
+      }
+
+      /* Remaining columns */
+      for (; col < N; col++)
+      {
+        c0 = 0;
+
+        for (s = 0U; (s < blockSlots) && (pCol[s] != ARM_MAT_BELL_PAD); s++)
+        {
+          pA = pBlk + (s * b + r) * b;
+          pRowB = pB + (uint32_t) pCol[s] * b * N + col;
+
+          for (q = 0U; q < b; q++)
+          {
+            c0 += (q63_t) pA[q] * pRowB[q * N];
+          }
+        }
+
+        pOut[col] = clip_q63_to_q31(c0 >> 31);
+      }
+
+      pOut += N;
+    }
+
+    pCol += blockSlots;
+    pBlk += blockSlots * b * b;
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_bell_vec_mult_f32.c
+ * Description:  Floating-point blocked-ELL matrix times dense vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Floating-point blocked-ELL matrix times dense vector.
+ * @param[in]  *pSrc   points to the blocked-ELL matrix.
+ * @param[in]  *pVec   points to the input vector, numCols values.
+ * @param[out] *pDst   points to the output vector, numRows values.
+ * @return     none
+ */
+
+void arm_mat_bell_vec_mult_f32(
+  const arm_mat_bell_instance_f32 * pSrc,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const uint16_t *pCol = pSrc->pColIdx;          /* block column index pointer */
+  const float32_t *pBlk = pSrc->pData;           /* block data pointer */
+  const float32_t *pA, *pX;                      /* block row and vector pointers */
+  float32_t sum;                                 /* accumulator */
+  uint32_t b = pSrc->blockSize;                  /* block size */
+  uint32_t blockSlots = pSrc->blockCols;         /* blocks per block row */
+  uint32_t blockRows = pSrc->numRows / b;        /* number of block rows */
+  uint32_t br, s, r, q;                          /* loop counters */
+
+  for (br = 0U; br < blockRows; br++)
+  {
+    for (r = 0U; r < b; r++)
+    {
+      sum = 0.0f;
+
+      /* Row r of each block, padding blocks coming last in a block row */
+      for (s = 0U; (s < blockSlots) && (pCol[s] != ARM_MAT_BELL_PAD); s++)
+      {
+        pA = pBlk + (s * b + r) * b;
+        pX = pVec + (uint32_t) pCol[s] * b;
+
+        for (q = 0U; q < b; q++)
+        {
+          sum += pA[q] * pX[q];
+        }
+      }
+
+      /* Store the result in the destination buffer */
+      *pDst++ = sum;
+    }
+
+    pCol += blockSlots;
+    pBlk += blockSlots * b * b;
+  }
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_bell_vec_mult_q31.c
+ * Description:  Q31 blocked-ELL matrix times dense vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Q31 blocked-ELL matrix times dense vector.
+ * @param[in]  *pSrc   points to the blocked-ELL matrix.
+ * @param[in]  *pVec   points to the input vector, numCols values.
+ * @param[out] *pDst   points to the output vector, numRows values.
+ * @return     none
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format,
+ * with no saturation on the intermediate additions. The accumulator is right shifted
+ * by 31 bits and saturated to 1.31 format to yield each result, as in arm_mat_mult_q31().
+ */
+
+void arm_mat_bell_vec_mult_q31(
+  const arm_mat_bell_instance_q31 * pSrc,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  const uint16_t *pCol = pSrc->pColIdx;          /* block column index pointer */
+  const q31_t *pBlk = pSrc->pData;               /* block data pointer */
+  const q31_t *pA, *pX;                          /* block row and vector pointers */
+  q63_t sum;                                     /* accumulator */
+  uint32_t b = pSrc->blockSize;                  /* block size */
+  uint32_t blockSlots = pSrc->blockCols;         /* blocks per block row */
+  uint32_t blockRows = pSrc->numRows / b;        /* number of block rows */
+  uint32_t br, s, r, q;                          /* loop counters */
+
+  for (br = 0U; br < blockRows; br++)
+  {
+    for (r = 0U; r < b; r++)
+    {
+      sum = 0;
+
+      /* Row r of each block, padding blocks coming last in a block row */
+      for (s = 0U; (s < blockSlots) && (pCol[s] != ARM_MAT_BELL_PAD); s++)
+      {
+        pA = pBlk + (s * b + r) * b;
+        pX = pVec + (uint32_t) pCol[s] * b;
+
+        for (q = 0U; q < b; q++)
+        {
+          sum += (q63_t) pA[q] * pX[q];
+        }
+      }
+
+      /* Store the result in the destination buffer */
+      *pDst++ = clip_q63_to_q31(sum >> 31);
+    }
+
+    pCol += blockSlots;
+    pBlk += blockSlots * b * b;
+  }
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
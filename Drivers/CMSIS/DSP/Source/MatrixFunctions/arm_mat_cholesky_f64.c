@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f64.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the instance of the input symmetric positive definite matrix.
+ * @param[out]      *pDst points to the instance of the output lower triangular matrix.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * <code>pSrc</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float64_t *pRowI, *pRowJ;                      /* rows of the factor */
+  float64_t sum;                                 /* accumulator */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (i = 0U; i < n; i++)
+    {
+      pRowI = pOut + (i * n);
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pOut + (j * n);
+
+        /* a(i,j) - sum(l(i,k) * l(j,k)) over the columns left of j */
+        sum = pIn[(i * n) + j];
+        k = 0U;
+
+#if defined (ARM_MATH_DSP)
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling.  Process 4 columns at a time. */
+        while ((k + 4U) <= j)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+          sum -= pRowI[k + 1U] * pRowJ[k + 1U];
+          sum -= pRowI[k + 2U] * pRowJ[k + 2U];
+          sum -= pRowI[k + 3U] * pRowJ[k + 3U];
+          k += 4U;
+        }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+        while (k < j)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+          k++;
+        }
+
+        if (i == j)
+        {
+          /* A negative, zero or NaN pivot ends the decomposition */
+          if (!(sum > 0.0))
+          {
+            return ARM_MATH_DECOMPOSITION_FAILURE;
+          }
+
+          pRowI[i] = sqrt(sum);
+        }
+        else
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1U; j < n; j++)
+      {
+        pRowI[j] = 0.0;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_update_f64.c
+ * Description:  Floating-point rank-1 update of a Cholesky factor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point rank-1 update of a Cholesky factor.
+ * @param[in,out]   *pL   points to the instance of the lower triangular Cholesky factor.
+ * @param[in,out]   *pX   points to the vector x of <code>pL->numRows</code> elements, which is overwritten.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the factor is not square.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Replaces the factor <code>L</code> of <code>A = L * L'</code> by the factor of
+ * <code>A + x * x'</code>, as computed by arm_mat_cholesky_f64(). Only the lower triangle of
+ * <code>pL</code> is read and written.
+ */
+
+arm_status arm_mat_cholesky_update_f64(
+  arm_matrix_instance_f64 * pL,
+  float64_t * pX)
+{
+  float64_t *pData = pL->pData;                  /* factor pointer */
+  float64_t *pLik;                               /* element of column k of the factor */
+  float64_t lkk, xk, r;                          /* diagonal element, x(k) and new diagonal element */
+  float64_t c, cInv, s;                          /* rotation coefficients */
+  uint32_t n = pL->numRows;                      /* size of the factor */
+  uint32_t i, k;                                 /* loop counters */
+  arm_status status;                             /* status of the update */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if (pL->numRows != pL->numCols)
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    for (k = 0U; k < n; k++)
+    {
+      lkk = pData[(k * n) + k];
+      xk = pX[k];
+
+      /* r = sqrt(l(k,k)^2 + x(k)^2) */
+      r = sqrt((lkk * lkk) + (xk * xk));
+
+      /* Givens rotation zeroing x(k) against l(k,k) */
+      c = r / lkk;
+      cInv = lkk / r;
+      s = xk / lkk;
+      pData[(k * n) + k] = r;
+
+      pLik = pData + (((k + 1U) * n) + k);
+      for (i = k + 1U; i < n; i++)
+      {
+        *pLik = (*pLik + (s * pX[i])) * cInv;
+        pX[i] = (c * pX[i]) - (s * *pLik);
+        pLik += n;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
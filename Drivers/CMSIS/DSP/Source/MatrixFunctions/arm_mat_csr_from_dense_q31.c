@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_from_dense_q31.c
+ * Description:  Q31 dense to CSR matrix conversion
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Conversion of a Q31 dense matrix to CSR, dropping the small elements.
+ * @param[in]     *pSrc        points to the dense matrix.
+ * @param[in]     threshold    elements with a magnitude at most threshold are dropped, non-negative.
+ * @param[in]     maxNonZeros  number of elements that fit in pColIdx and pData of pDst.
+ * @param[in,out] *pDst        points to the CSR matrix, with pRowStart holding numRows+1 values.
+ * @return        ARM_MATH_LENGTH_ERROR if the buffers are too small, else ARM_MATH_SUCCESS.
+ *
+ * The dimensions of pDst are set from pSrc. A threshold of zero keeps every
+ * non-zero element. When ARM_MATH_LENGTH_ERROR is returned the content of pDst
+ * is undefined.
+ */
+
+arm_status arm_mat_csr_from_dense_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  q31_t threshold,
+  uint32_t maxNonZeros,
+  arm_mat_csr_instance_q31 * pDst)
+{
+  const q31_t *pIn = pSrc->pData;                /* input data pointer */
+  uint32_t nnz = 0U;                             /* number of stored elements */
+  uint16_t i, j;                                 /* loop counters */
+  q31_t a;                                       /* current element */
+
+  pDst->numRows = pSrc->numRows;
+  pDst->numCols = pSrc->numCols;
+
+  for (i = 0U; i < pSrc->numRows; i++)
+  {
+    pDst->pRowStart[i] = nnz;
+
+    for (j = 0U; j < pSrc->numCols; j++)
+    {
+      a = *pIn++;
+
+      /* Keep the elements with a magnitude above the threshold */
+      if ((a > threshold) || (a < -threshold))
+      {
+        if (nnz == maxNonZeros)
+        {
+          return (ARM_MATH_LENGTH_ERROR);
+        }
+
+        pDst->pColIdx[nnz] = j;
+        pDst->pData[nnz] = a;
+        nnz++;
+      }
+    }
+  }
+
+  pDst->pRowStart[pSrc->numRows] = nnz;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
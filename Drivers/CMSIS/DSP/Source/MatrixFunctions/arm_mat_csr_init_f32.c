@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_init_f32.c
+ * Description:  Floating-point CSR matrix initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Floating-point CSR matrix initialization.
+ * @param[in,out] *S          points to an instance of the floating-point CSR matrix structure.
+ * @param[in]     nRows       number of rows in the matrix.
+ * @param[in]     nColumns    number of columns in the matrix.
+ * @param[in]     *pRowStart  points to the row start indexes, nRows+1 values.
+ * @param[in]     *pColIdx    points to the column indexes of the elements.
+ * @param[in]     *pData      points to the elements.
+ * @return        none
+ */
+
+void arm_mat_csr_init_f32(
+  arm_mat_csr_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t * pRowStart,
+  uint16_t * pColIdx,
+  float32_t * pData)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign the index and data pointers */
+  S->pRowStart = pRowStart;
+  S->pColIdx = pColIdx;
+  S->pData = pData;
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
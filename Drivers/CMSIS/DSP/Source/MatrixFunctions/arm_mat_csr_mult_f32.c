@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_mult_f32.c
+ * Description:  Floating-point CSR matrix times dense matrix
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Floating-point CSR matrix times dense matrix.
+ * @param[in]  *pSrcA  points to the CSR matrix.
+ * @param[in]  *pSrcB  points to the dense matrix.
+ * @param[out] *pDst   points to the dense output matrix.
+ * @return     The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ */
+
+arm_status arm_mat_csr_mult_f32(
+  const arm_mat_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pB = pSrcB->pData;            /* input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  const float32_t *pA, *pRowB;                   /* row pointers in A and B */
+  const uint16_t *pCol;                          /* column index pointer */
+  float32_t c0;                                  /* accumulators */
+  float32_t a;                                   /* element of A */
+  uint32_t N = pSrcB->numCols;                   /* number of columns of B */
+  uint32_t row, col, k, nnz;                     /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (row = 0U; row < pSrcA->numRows; row++)
+  {
+    pCol = pSrcA->pColIdx + pSrcA->pRowStart[row];
+    pA = pSrcA->pData + pSrcA->pRowStart[row];
+    nnz = pSrcA->pRowStart[row + 1U] - pSrcA->pRowStart[row];
+
+    /* Four columns of the output row at a time, so each index is read once per tile */
+    for (col = 0U; (col + 4U) <= N; col += 4U)
+    {
+#if defined (ARM_MATH_X86_SIMD)
+
+      /* Run the below code for x86-64 hosts with SSE4.1 */
+      __m128 acc = _mm_setzero_ps();
+
+      for (k = 0U; k < nnz; k++)
+      {
+        pRowB = pB + (uint32_t) pCol[k] * N + col;
+        a = pA[k];
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(a), _mm_loadu_ps(pRowB)));
+      }
+
+      _mm_storeu_ps(pOut + col, acc);
+
+#else
+
+      /* Run the below code for Cortex-M4, Cortex-M3 and Cortex-M0 */
+      float32_t c1, c2, c3;                      /* accumulators of the other columns */
+
+      c0 = c1 = c2 = c3 = 0.0f;
+
+      for (k = 0U; k < nnz; k++)
+      {
+        a = pA[k];
+        pRowB = pB + (uint32_t) pCol[k] * N + col;
+
+        c0 += a * pRowB[0];
+        c1 += a * pRowB[1];
+        c2 += a * pRowB[2];
+        c3 += a * pRowB[3];
+      }
+
+      pOut[col] = c0;
+      pOut[col + 1U] = c1;
+      pOut[col + 2U] = c2;
+      pOut[col + 3U] = c3;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+    }
+
+    /* Remaining columns */
+    for (; col < N; col++)
+    {
+      c0 = 0.0f;
+
+      for (k = 0U; k < nnz; k++)
+      {
+        c0 += pA[k] * pB[(uint32_t) pCol[k] * N + col];
+      }
+
+      pOut[col] = c0;
+    }
+
+    pOut += N;
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_vec_mult_f32.c
+ * Description:  Floating-point CSR matrix times dense vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup SparseMatrix Sparse Matrix Multiplication
+ *
+ * Multiplies a sparse matrix by a dense vector or by a dense matrix, with the
+ * sparse matrix in one of two storage formats.
+ *
+ * The CSR (compressed sparse row) format keeps the non-zero elements row after row
+ * in <code>pData</code>, the column of each one in <code>pColIdx</code>, and the
+ * index of the first element of each row in <code>pRowStart</code>, with
+ * <code>pRowStart[numRows]</code> the number of stored elements:
+ * <pre>
+ *     A[i][pColIdx[k]] = pData[k],   pRowStart[i] <= k < pRowStart[i+1].
+ * </pre>
+ *
+ * The blocked-ELL format cuts the matrix into square blocks of
+ * <code>blockSize</code> rows and columns and stores the same number,
+ * <code>blockCols</code>, of dense blocks for each block row, each one stored by rows.
+ * <code>pColIdx</code> holds the block column of each block, and the block rows with
+ * fewer blocks end with padding blocks, whose index is <code>ARM_MAT_BELL_PAD</code>.
+ * There is one index per block instead of one per element, and the inner loops run over
+ * contiguous elements of A, so this format suits matrices whose non-zero elements come
+ * in clusters, such as pruned neural network layers or finite element matrices.
+ *
+ * arm_mat_csr_from_dense_f32() and arm_mat_bell_from_dense_f32() build either format
+ * from a dense matrix, dropping the elements with a magnitude at most a threshold.
+ * Both conversions hold the same matrix for the same threshold: blocked-ELL stores the
+ * blocks with at least one element above the threshold and sets their other small
+ * elements to zero.
+ *
+ * The sparse products pay one index load per stored element, or per stored block row
+ * segment, and lose the register tiling of arm_mat_mult_f32(). Against the dense functions
+ * on the same matrix, the matrix-vector product gains from CSR once about a third of
+ * the elements are zero, and the matrix product once about half of them are.
+ * Blocked-ELL is as fast as CSR when whole blocks are zero, and slower than
+ * the dense product when the zero elements are scattered, since almost no block is
+ * then dropped.
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Floating-point CSR matrix times dense vector.
+ * @param[in]  *pSrc   points to the CSR matrix.
+ * @param[in]  *pVec   points to the input vector, numCols values.
+ * @param[out] *pDst   points to the output vector, numRows values.
+ * @return     none
+ */
+
+void arm_mat_csr_vec_mult_f32(
+  const arm_mat_csr_instance_f32 * pSrc,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  const uint32_t *pRowStart = pSrc->pRowStart;   /* row start pointer */
+  const uint16_t *pCol;                          /* column index pointer */
+  const float32_t *pA;                           /* matrix data pointer */
+  float32_t sum;                                 /* accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+  uint16_t row;                                  /* row loop counter */
+
+  pCol = pSrc->pColIdx + pRowStart[0];
+  pA = pSrc->pData + pRowStart[0];
+
+  for (row = 0U; row < pSrc->numRows; row++)
+  {
+    sum = 0.0f;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    blkCnt = (pRowStart[row + 1U] - pRowStart[row]) >> 2U;
+
+    /* Gather four elements of the vector per iteration */
+    while (blkCnt > 0U)
+    {
+      sum += *pA++ * pVec[*pCol++];
+      sum += *pA++ * pVec[*pCol++];
+      sum += *pA++ * pVec[*pCol++];
+      sum += *pA++ * pVec[*pCol++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the row length is not a multiple of 4, compute the remaining elements here */
+    blkCnt = (pRowStart[row + 1U] - pRowStart[row]) % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = pRowStart[row + 1U] - pRowStart[row];
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      sum += *pA++ * pVec[*pCol++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = sum;
+  }
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_vec_mult_q31.c
+ * Description:  Q31 CSR matrix times dense vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup SparseMatrix
+ * @{
+ */
+
+/**
+ * @brief  Q31 CSR matrix times dense vector.
+ * @param[in]  *pSrc   points to the CSR matrix.
+ * @param[in]  *pVec   points to the input vector, numCols values.
+ * @param[out] *pDst   points to the output vector, numRows values.
+ * @return     none
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using an internal 64-bit accumulator in 2.62 format,
+ * with no saturation on the intermediate additions. The accumulator is right shifted
+ * by 31 bits and saturated to 1.31 format to yield each result, as in arm_mat_mult_q31().
+ */
+
+void arm_mat_csr_vec_mult_q31(
+  const arm_mat_csr_instance_q31 * pSrc,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  const uint32_t *pRowStart = pSrc->pRowStart;   /* row start pointer */
+  const uint16_t *pCol;                          /* column index pointer */
+  const q31_t *pA;                               /* matrix data pointer */
+  q63_t sum;                                     /* accumulator */
+  uint32_t blkCnt;                               /* loop counter */
+  uint16_t row;                                  /* row loop counter */
+
+  pCol = pSrc->pColIdx + pRowStart[0];
+  pA = pSrc->pData + pRowStart[0];
+
+  for (row = 0U; row < pSrc->numRows; row++)
+  {
+    sum = 0;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling */
+    blkCnt = (pRowStart[row + 1U] - pRowStart[row]) >> 2U;
+
+    /* Gather four elements of the vector per iteration */
+    while (blkCnt > 0U)
+    {
+      sum += (q63_t) *pA++ * pVec[*pCol++];
+      sum += (q63_t) *pA++ * pVec[*pCol++];
+      sum += (q63_t) *pA++ * pVec[*pCol++];
+      sum += (q63_t) *pA++ * pVec[*pCol++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the row length is not a multiple of 4, compute the remaining elements here */
+    blkCnt = (pRowStart[row + 1U] - pRowStart[row]) % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = pRowStart[row + 1U] - pRowStart[row];
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      sum += (q63_t) *pA++ * pVec[*pCol++];
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = clip_q63_to_q31(sum >> 31);
+  }
+}
+
+/**
+ * @} end of SparseMatrix group
+ */
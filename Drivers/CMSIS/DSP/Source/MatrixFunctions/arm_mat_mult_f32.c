@@ -28,6 +28,306 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_X86_SIMD) || defined (ARM_MATH_DSP)
+
+/* Size of the output tiles kept in registers */
+#define MAT_MULT_TILE_MR   4U
+#if defined (ARM_MATH_X86_SIMD)
+#define MAT_MULT_TILE_NR   8U
+#else
+#define MAT_MULT_TILE_NR   4U
+#endif
+
+/*
+ * @brief  Adds the product of mr rows of A and a packed panel of B to an mr x nr tile of C.
+ * @param[in]     *pA       points to the first element of the tile rows in A.
+ * @param[in]     strideA   number of columns of A.
+ * @param[in]     *pB       points to the panel, kc rows of MAT_MULT_TILE_NR values.
+ * @param[in,out] *pC       points to the first element of the tile in C.
+ * @param[in]     strideC   number of columns of C.
+ * @param[in]     kc        depth of the panel.
+ * @param[in]     mr        number of rows of the tile.
+ * @param[in]     nr        number of columns of the tile.
+ * @param[in]     first     nonzero if the tile is not accumulated yet.
+ *
+ * Each element of C is still summed in the order of the inner dimension,
+ * so the result is the same as the untiled loops.
+ */
+
+static void arm_mat_mult_tile_f32(
+  const float32_t * pA,
+  uint32_t strideA,
+  const float32_t * pB,
+  float32_t * pC,
+  uint32_t strideC,
+  uint32_t kc,
+  uint32_t mr,
+  uint32_t nr,
+  uint32_t first)
+{
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = pA + strideA;
+  const float32_t *pA2 = pA + 2U * strideA;
+  const float32_t *pA3 = pA + 3U * strideA;
+  float32_t sum;
+  uint32_t i, j, k;
+
+  if ((mr == MAT_MULT_TILE_MR) && (nr == MAT_MULT_TILE_NR))
+  {
+
+#if defined (ARM_MATH_X86_SIMD)
+
+    /* Run the below code for x86-64 hosts with SSE4.1 */
+
+    __m128 c00, c01, c10, c11, c20, c21, c30, c31, b0, b1, a;
+
+    if (first != 0U)
+    {
+      c00 = c01 = c10 = c11 = c20 = c21 = c30 = c31 = _mm_setzero_ps();
+    }
+    else
+    {
+      c00 = _mm_loadu_ps(pC);
+      c01 = _mm_loadu_ps(pC + 4);
+      c10 = _mm_loadu_ps(pC + strideC);
+      c11 = _mm_loadu_ps(pC + strideC + 4);
+      c20 = _mm_loadu_ps(pC + 2U * strideC);
+      c21 = _mm_loadu_ps(pC + 2U * strideC + 4);
+      c30 = _mm_loadu_ps(pC + 3U * strideC);
+      c31 = _mm_loadu_ps(pC + 3U * strideC + 4);
+    }
+
+    for (k = 0U; k < kc; k++)
+    {
+      b0 = _mm_loadu_ps(pB);
+      b1 = _mm_loadu_ps(pB + 4);
+      pB += MAT_MULT_TILE_NR;
+
+      a = _mm_set1_ps(pA0[k]);
+      c00 = _mm_add_ps(c00, _mm_mul_ps(a, b0));
+      c01 = _mm_add_ps(c01, _mm_mul_ps(a, b1));
+      a = _mm_set1_ps(pA1[k]);
+      c10 = _mm_add_ps(c10, _mm_mul_ps(a, b0));
+      c11 = _mm_add_ps(c11, _mm_mul_ps(a, b1));
+      a = _mm_set1_ps(pA2[k]);
+      c20 = _mm_add_ps(c20, _mm_mul_ps(a, b0));
+      c21 = _mm_add_ps(c21, _mm_mul_ps(a, b1));
+      a = _mm_set1_ps(pA3[k]);
+      c30 = _mm_add_ps(c30, _mm_mul_ps(a, b0));
+      c31 = _mm_add_ps(c31, _mm_mul_ps(a, b1));
+    }
+
+    _mm_storeu_ps(pC, c00);
+    _mm_storeu_ps(pC + 4, c01);
+    _mm_storeu_ps(pC + strideC, c10);
+    _mm_storeu_ps(pC + strideC + 4, c11);
+    _mm_storeu_ps(pC + 2U * strideC, c20);
+    _mm_storeu_ps(pC + 2U * strideC + 4, c21);
+    _mm_storeu_ps(pC + 3U * strideC, c30);
+    _mm_storeu_ps(pC + 3U * strideC + 4, c31);
+
+#else
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    float32_t c00, c01, c02, c03, c10, c11, c12, c13;
+    float32_t c20, c21, c22, c23, c30, c31, c32, c33;
+    float32_t a0, a1, a2, a3, b0, b1, b2, b3;
+    float32_t *pC0 = pC, *pC1 = pC + strideC, *pC2 = pC + 2U * strideC, *pC3 = pC + 3U * strideC;
+
+    if (first != 0U)
+    {
+      c00 = c01 = c02 = c03 = c10 = c11 = c12 = c13 = 0.0f;
+      c20 = c21 = c22 = c23 = c30 = c31 = c32 = c33 = 0.0f;
+    }
+    else
+    {
+      c00 = pC0[0]; c01 = pC0[1]; c02 = pC0[2]; c03 = pC0[3];
+      c10 = pC1[0]; c11 = pC1[1]; c12 = pC1[2]; c13 = pC1[3];
+      c20 = pC2[0]; c21 = pC2[1]; c22 = pC2[2]; c23 = pC2[3];
+      c30 = pC3[0]; c31 = pC3[1]; c32 = pC3[2]; c33 = pC3[3];
+    }
+
+    /* 16 MACs for 8 loads */
+    for (k = 0U; k < kc; k++)
+    {
+      b0 = pB[0];
+      b1 = pB[1];
+      b2 = pB[2];
+      b3 = pB[3];
+      pB += MAT_MULT_TILE_NR;
+
+      a0 = pA0[k];
+      a1 = pA1[k];
+      a2 = pA2[k];
+      a3 = pA3[k];
+
+      c00 += a0 * b0; c01 += a0 * b1; c02 += a0 * b2; c03 += a0 * b3;
+      c10 += a1 * b0; c11 += a1 * b1; c12 += a1 * b2; c13 += a1 * b3;
+      c20 += a2 * b0; c21 += a2 * b1; c22 += a2 * b2; c23 += a2 * b3;
+      c30 += a3 * b0; c31 += a3 * b1; c32 += a3 * b2; c33 += a3 * b3;
+    }
+
+    pC0[0] = c00; pC0[1] = c01; pC0[2] = c02; pC0[3] = c03;
+    pC1[0] = c10; pC1[1] = c11; pC1[2] = c12; pC1[3] = c13;
+    pC2[0] = c20; pC2[1] = c21; pC2[2] = c22; pC2[3] = c23;
+    pC3[0] = c30; pC3[1] = c31; pC3[2] = c32; pC3[3] = c33;
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  }
+#if defined (ARM_MATH_X86_SIMD)
+  else if ((mr == MAT_MULT_TILE_MR) && (nr == 4U))
+  {
+    /* Right edge of four columns, the first half of the full kernel */
+    __m128 c0, c1, c2, c3, b0, a;
+
+    if (first != 0U)
+    {
+      c0 = c1 = c2 = c3 = _mm_setzero_ps();
+    }
+    else
+    {
+      c0 = _mm_loadu_ps(pC);
+      c1 = _mm_loadu_ps(pC + strideC);
+      c2 = _mm_loadu_ps(pC + 2U * strideC);
+      c3 = _mm_loadu_ps(pC + 3U * strideC);
+    }
+
+    for (k = 0U; k < kc; k++)
+    {
+      b0 = _mm_loadu_ps(pB);
+      pB += MAT_MULT_TILE_NR;
+
+      a = _mm_set1_ps(pA0[k]);
+      c0 = _mm_add_ps(c0, _mm_mul_ps(a, b0));
+      a = _mm_set1_ps(pA1[k]);
+      c1 = _mm_add_ps(c1, _mm_mul_ps(a, b0));
+      a = _mm_set1_ps(pA2[k]);
+      c2 = _mm_add_ps(c2, _mm_mul_ps(a, b0));
+      a = _mm_set1_ps(pA3[k]);
+      c3 = _mm_add_ps(c3, _mm_mul_ps(a, b0));
+    }
+
+    _mm_storeu_ps(pC, c0);
+    _mm_storeu_ps(pC + strideC, c1);
+    _mm_storeu_ps(pC + 2U * strideC, c2);
+    _mm_storeu_ps(pC + 3U * strideC, c3);
+  }
+  else if (mr == MAT_MULT_TILE_MR)
+  {
+    /* Right edge: the padded columns of the panel are zero, so the full kernel
+     * runs on a copy of the tile. Matrices narrower than the tile, such as
+     * tall and skinny ones, only have such tiles. */
+    float32_t tile[MAT_MULT_TILE_MR * MAT_MULT_TILE_NR];
+
+    for (i = 0U; i < MAT_MULT_TILE_MR; i++)
+    {
+      for (j = 0U; j < MAT_MULT_TILE_NR; j++)
+      {
+        tile[i * MAT_MULT_TILE_NR + j] = ((first != 0U) || (j >= nr)) ? 0.0f : pC[i * strideC + j];
+      }
+    }
+
+    arm_mat_mult_tile_f32(pA, strideA, pB, tile, MAT_MULT_TILE_NR, kc,
+                          MAT_MULT_TILE_MR, MAT_MULT_TILE_NR, first);
+
+    for (i = 0U; i < MAT_MULT_TILE_MR; i++)
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        pC[i * strideC + j] = tile[i * MAT_MULT_TILE_NR + j];
+      }
+    }
+  }
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+  else
+  {
+    /* Partial tiles at the bottom and right edges */
+    for (i = 0U; i < mr; i++)
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        sum = (first != 0U) ? 0.0f : pC[i * strideC + j];
+
+        for (k = 0U; k < kc; k++)
+        {
+          sum += pA[i * strideA + k] * pB[k * MAT_MULT_TILE_NR + j];
+        }
+
+        pC[i * strideC + j] = sum;
+      }
+    }
+  }
+}
+
+/*
+ * @brief  Cache-tiled floating-point matrix multiplication.
+ *
+ * B is processed in panels of MAT_MULT_TILE_NR columns and ARM_MAT_MULT_TILE_K
+ * rows, copied to a contiguous buffer on the stack so the micro-kernel reads
+ * it sequentially. Each panel is used for all the rows of A before the next
+ * one is packed, the partial sums are accumulated in the output matrix.
+ */
+
+static arm_status arm_mat_mult_tiled_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t panel[ARM_MAT_MULT_TILE_K * MAT_MULT_TILE_NR];  /* packed B panel */
+  float32_t *pA = pSrcA->pData;                  /* input data matrix pointer A */
+  float32_t *pB = pSrcB->pData;                  /* input data matrix pointer B */
+  float32_t *pC = pDst->pData;                   /* output data matrix pointer */
+  uint32_t M = pSrcA->numRows;                   /* number of rows of input matrix A */
+  uint32_t K = pSrcA->numCols;                   /* number of columns of input matrix A */
+  uint32_t N = pSrcB->numCols;                   /* number of columns of input matrix B */
+  uint32_t ic, jc, pc, mr, nr, kc, j, k;         /* loop counters and tile sizes */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (jc = 0U; jc < N; jc += MAT_MULT_TILE_NR)
+  {
+    nr = ((N - jc) < MAT_MULT_TILE_NR) ? (N - jc) : MAT_MULT_TILE_NR;
+
+    for (pc = 0U; pc < K; pc += ARM_MAT_MULT_TILE_K)
+    {
+      kc = ((K - pc) < ARM_MAT_MULT_TILE_K) ? (K - pc) : ARM_MAT_MULT_TILE_K;
+
+      /* Pack the panel, the missing columns of the right edge are zero */
+      for (k = 0U; k < kc; k++)
+      {
+        for (j = 0U; j < MAT_MULT_TILE_NR; j++)
+        {
+          panel[k * MAT_MULT_TILE_NR + j] = (j < nr) ? pB[(pc + k) * N + jc + j] : 0.0f;
+        }
+      }
+
+      for (ic = 0U; ic < M; ic += MAT_MULT_TILE_MR)
+      {
+        mr = ((M - ic) < MAT_MULT_TILE_MR) ? (M - ic) : MAT_MULT_TILE_MR;
+
+        arm_mat_mult_tile_f32(pA + ic * K + pc, K, panel, pC + ic * N + jc, N,
+                              kc, mr, nr, (pc == 0U) ? 1U : 0U);
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) || defined (ARM_MATH_DSP) */
+
 /**
  * @ingroup groupMatrix
  */
@@ -46,6 +346,26 @@
  * When matrix size checking is enabled, the functions check: (1) that the inner dimensions of
  * <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output
  * matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.
+ *
+ * \par Tiled Multiplication
+ * On cores with the DSP extension (<code>ARM_MATH_DSP</code>: Cortex-M4, Cortex-M7 and ARMv8-M
+ * Mainline with DSP) and in <code>ARM_MATH_X86_SIMD</code> builds, products of more than
+ * <code>ARM_MAT_MULT_TILE_MIN_MACS</code> multiply-accumulates use cache-tiled kernels,
+ * which compute the output in small tiles held in registers (4 x 4, or 4 x 8 floating-point
+ * values on the host) instead of one element at a time. This reads each element of A and B
+ * a quarter as often as the row by column loops and walks B row-wise instead of
+ * column-wise, which matters for large matrices on cores with a data cache.
+ * The floating-point version also copies panels of <code>ARM_MAT_MULT_TILE_K</code> rows
+ * of B to a stack buffer so the kernel reads them sequentially. The buffer holds
+ * <code>ARM_MAT_MULT_TILE_K * 4</code> values, 512 bytes with the default of 32 rows on Cortex-M,
+ * and <code>ARM_MAT_MULT_TILE_K * 8</code> values, 2 KB with the default of 64 rows, on the host.
+ * Tasks with little stack can define a smaller <code>ARM_MAT_MULT_TILE_K</code>, which does not
+ * change the results.
+ * The fixed-point versions keep their 64-bit accumulators in registers over the whole inner
+ * dimension, with 2 x 2 tiles on Cortex-M, and need no buffer.
+ * The results are identical to the untiled code: every output is accumulated in the same
+ * order, the fixed-point accumulators are exact, and the Q31 and Q15 outputs saturate in both.
+ * Cortex-M3 and Cortex-M0 targets always use the untiled loops.
  */
 
 
@@ -86,6 +406,12 @@ arm_status arm_mat_mult_f32(
   uint16_t col, i = 0U, j, row = numRowsA, colCnt;      /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
+  /* Large products go through the cache-tiled kernel */
+  if (((uint64_t) numRowsA * numColsA * numColsB) > ARM_MAT_MULT_TILE_MIN_MACS)
+  {
+    return (arm_mat_mult_tiled_f32(pSrcA, pSrcB, pDst));
+  }
+
 #ifdef ARM_MATH_MATRIX_CHECK
 
 
@@ -190,6 +516,16 @@ arm_status arm_mat_mult_f32(
   uint16_t col, i = 0U, row = numRowsA, colCnt;  /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Large products go through the cache-tiled kernel */
+  if (((uint64_t) numRowsA * numColsA * numColsB) > ARM_MAT_MULT_TILE_MIN_MACS)
+  {
+    return (arm_mat_mult_tiled_f32(pSrcA, pSrcB, pDst));
+  }
+
+#endif
+
 #ifdef ARM_MATH_MATRIX_CHECK
 
   /* Check for matrix mismatch condition */
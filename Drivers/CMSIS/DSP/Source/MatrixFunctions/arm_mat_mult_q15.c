@@ -28,6 +28,249 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_X86_SIMD) || defined (ARM_MATH_DSP)
+
+/* Size of the output tiles kept in registers */
+#if defined (ARM_MATH_X86_SIMD)
+#define MAT_MULT_TILE_MR   4U
+#define MAT_MULT_TILE_NR   4U
+#else
+#define MAT_MULT_TILE_MR   2U
+#define MAT_MULT_TILE_NR   2U
+#endif
+
+#if defined (ARM_MATH_X86_SIMD)
+
+/*
+ * @brief  Converts one row of the SSE tile from 34.30 to 1.15 format, with
+ *         columns 0 and 1 in the 64-bit lanes of c0 and columns 2 and 3 in c1.
+ */
+
+static void arm_mat_mult_store_row_q15(
+  q15_t * pC,
+  __m128i c0,
+  __m128i c1)
+{
+  q63_t acc[4];
+
+  _mm_storeu_si128((__m128i *) acc, c0);
+  _mm_storeu_si128((__m128i *) (acc + 2), c1);
+
+  pC[0] = (q15_t) __SSAT((acc[0] >> 15), 16);
+  pC[1] = (q15_t) __SSAT((acc[1] >> 15), 16);
+  pC[2] = (q15_t) __SSAT((acc[2] >> 15), 16);
+  pC[3] = (q15_t) __SSAT((acc[3] >> 15), 16);
+}
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+/*
+ * @brief  Computes an mr x nr tile of C over the whole inner dimension.
+ * @param[in]  *pA       points to the first element of the tile rows in A.
+ * @param[in]  *pB       points to the first element of the tile columns in B.
+ * @param[out] *pC       points to the first element of the tile in C.
+ * @param[in]  K         number of columns of A.
+ * @param[in]  N         number of columns of B and C.
+ * @param[in]  mr        number of rows of the tile.
+ * @param[in]  nr        number of columns of the tile.
+ */
+
+static void arm_mat_mult_tile_q15(
+  const q15_t * pA,
+  const q15_t * pB,
+  q15_t * pC,
+  uint32_t K,
+  uint32_t N,
+  uint32_t mr,
+  uint32_t nr)
+{
+  q63_t sum;
+  uint32_t i, j, k;
+
+  if ((mr == MAT_MULT_TILE_MR) && (nr == MAT_MULT_TILE_NR))
+  {
+
+#if defined (ARM_MATH_X86_SIMD)
+
+    /* Run the below code for x86-64 hosts with SSE4.1 */
+
+    /* The 2.30 products are exact in 32 bits and summed in 64-bit lanes,
+     * columns 0 and 1 in cX0, columns 2 and 3 in cX1 */
+    __m128i c00, c01, c10, c11, c20, c21, c30, c31, b, p, a;
+
+    c00 = c01 = c10 = c11 = c20 = c21 = c30 = c31 = _mm_setzero_si128();
+
+    for (k = 0U; k < K; k++)
+    {
+      b = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) pB));
+      pB += N;
+
+      a = _mm_set1_epi32(pA[k]);
+      p = _mm_mullo_epi32(a, b);
+      c00 = _mm_add_epi64(c00, _mm_cvtepi32_epi64(p));
+      c01 = _mm_add_epi64(c01, _mm_cvtepi32_epi64(_mm_srli_si128(p, 8)));
+      a = _mm_set1_epi32(pA[K + k]);
+      p = _mm_mullo_epi32(a, b);
+      c10 = _mm_add_epi64(c10, _mm_cvtepi32_epi64(p));
+      c11 = _mm_add_epi64(c11, _mm_cvtepi32_epi64(_mm_srli_si128(p, 8)));
+      a = _mm_set1_epi32(pA[2U * K + k]);
+      p = _mm_mullo_epi32(a, b);
+      c20 = _mm_add_epi64(c20, _mm_cvtepi32_epi64(p));
+      c21 = _mm_add_epi64(c21, _mm_cvtepi32_epi64(_mm_srli_si128(p, 8)));
+      a = _mm_set1_epi32(pA[3U * K + k]);
+      p = _mm_mullo_epi32(a, b);
+      c30 = _mm_add_epi64(c30, _mm_cvtepi32_epi64(p));
+      c31 = _mm_add_epi64(c31, _mm_cvtepi32_epi64(_mm_srli_si128(p, 8)));
+    }
+
+    arm_mat_mult_store_row_q15(pC, c00, c01);
+    arm_mat_mult_store_row_q15(pC + N, c10, c11);
+    arm_mat_mult_store_row_q15(pC + 2U * N, c20, c21);
+    arm_mat_mult_store_row_q15(pC + 3U * N, c30, c31);
+
+#else
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    q63_t c00 = 0, c01 = 0, c10 = 0, c11 = 0;
+    const q15_t *pA0 = pA;
+    const q15_t *pA1 = pA + K;
+
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+    q31_t a0, a1, b0, b1;
+
+    /* Two rows of B are paired in a word per column, as the transpose did,
+     * and consumed by dual multiply-accumulates */
+    k = K >> 1U;
+
+    while (k > 0U)
+    {
+      a0 = *__SIMD32(pA0)++;
+      a1 = *__SIMD32(pA1)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      b0 = __PKHBT(pB[0], pB[N], 16);
+      b1 = __PKHBT(pB[1], pB[N + 1U], 16);
+
+#else
+
+      b0 = __PKHBT(pB[N], pB[0], 16);
+      b1 = __PKHBT(pB[N + 1U], pB[1], 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      pB += 2U * N;
+
+      c00 = __SMLALD(a0, b0, c00);
+      c01 = __SMLALD(a0, b1, c01);
+      c10 = __SMLALD(a1, b0, c10);
+      c11 = __SMLALD(a1, b1, c11);
+
+      k--;
+    }
+
+    /* Odd inner dimension */
+    k = K & 1U;
+
+#else
+
+    k = K;
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+    while (k > 0U)
+    {
+      c00 += (q31_t) pA0[0] * pB[0];
+      c01 += (q31_t) pA0[0] * pB[1];
+      c10 += (q31_t) pA1[0] * pB[0];
+      c11 += (q31_t) pA1[0] * pB[1];
+      pA0++;
+      pA1++;
+      pB += N;
+
+      k--;
+    }
+
+    pC[0]      = (q15_t) __SSAT((c00 >> 15), 16);
+    pC[1]      = (q15_t) __SSAT((c01 >> 15), 16);
+    pC[N]      = (q15_t) __SSAT((c10 >> 15), 16);
+    pC[N + 1U] = (q15_t) __SSAT((c11 >> 15), 16);
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  }
+  else
+  {
+    /* Partial tiles at the bottom and right edges */
+    for (i = 0U; i < mr; i++)
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        sum = 0;
+
+        for (k = 0U; k < K; k++)
+        {
+          sum += (q31_t) pA[i * K + k] * pB[k * N + j];
+        }
+
+        pC[i * N + j] = (q15_t) __SSAT((sum >> 15), 16);
+      }
+    }
+  }
+}
+
+/*
+ * @brief  Register-tiled Q15 matrix multiplication.
+ *
+ * Each block of MAT_MULT_TILE_NR columns of B is used for all the rows of A
+ * before moving to the next one, so it stays in the data cache. B is read in
+ * place and no transposed copy is needed.
+ */
+
+static arm_status arm_mat_mult_tiled_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+  arm_matrix_instance_q15 * pDst)
+{
+  q15_t *pA = pSrcA->pData;                      /* input data matrix pointer A */
+  q15_t *pB = pSrcB->pData;                      /* input data matrix pointer B */
+  q15_t *pC = pDst->pData;                       /* output data matrix pointer */
+  uint32_t M = pSrcA->numRows;                   /* number of rows of input matrix A */
+  uint32_t K = pSrcA->numCols;                   /* number of columns of input matrix A */
+  uint32_t N = pSrcB->numCols;                   /* number of columns of input matrix B */
+  uint32_t ic, jc, mr, nr;                       /* loop counters and tile sizes */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (jc = 0U; jc < N; jc += MAT_MULT_TILE_NR)
+  {
+    nr = ((N - jc) < MAT_MULT_TILE_NR) ? (N - jc) : MAT_MULT_TILE_NR;
+
+    for (ic = 0U; ic < M; ic += MAT_MULT_TILE_MR)
+    {
+      mr = ((M - ic) < MAT_MULT_TILE_MR) ? (M - ic) : MAT_MULT_TILE_MR;
+
+      arm_mat_mult_tile_q15(pA + ic * K, pB + jc, pC + ic * N + jc, K, N, mr, nr);
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) || defined (ARM_MATH_DSP) */
+
 /**
  * @ingroup groupMatrix
  */
@@ -43,7 +286,7 @@
  * @param[in]       *pSrcA points to the first input matrix structure
  * @param[in]       *pSrcB points to the second input matrix structure
  * @param[out]      *pDst points to output matrix structure
- * @param[in]       *pState points to the array for storing intermediate results (Unused)
+ * @param[in]       *pState points to the array for storing intermediate results, may be NULL
  * @return          The function returns either
  * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
  *
@@ -60,6 +303,13 @@
  * 1.15 format.
  *
  * \par
+ * With the DSP extension (Cortex-M4/M7) the untiled code stores the transpose of <code>pSrcB</code> in
+ * <code>pState</code>, which must then hold <code>numRowsB * numColsB</code> values. The tiled
+ * code used for products above <code>ARM_MAT_MULT_TILE_MIN_MACS</code> multiply-accumulates
+ * reads <code>pSrcB</code> in place; it is also used for every size when <code>pState</code> is NULL,
+ * so the buffer can be left out. The results are the same.
+ *
+ * \par
  * Refer to <code>arm_mat_mult_fast_q15()</code> for a faster but less precise version of this function for Cortex-M3 and Cortex-M4.
  *
  */
@@ -99,6 +349,13 @@ arm_status arm_mat_mult_q15(
 
 #endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
 
+  /* Large products, or no buffer for the transpose of B, go through the tiled kernel */
+  if ((pState == NULL) ||
+      (((uint64_t) numRowsA * numColsA * numColsB) > ARM_MAT_MULT_TILE_MIN_MACS))
+  {
+    return (arm_mat_mult_tiled_q15(pSrcA, pSrcB, pDst));
+  }
+
 #ifdef ARM_MATH_MATRIX_CHECK
   /* Check for matrix mismatch condition */
   if ((pSrcA->numCols != pSrcB->numRows) ||
@@ -371,6 +628,16 @@ arm_status arm_mat_mult_q15(
   uint16_t col, i = 0U, row = numRowsA, colCnt;  /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Large products go through the cache-tiled kernel */
+  if (((uint64_t) numRowsA * numColsA * numColsB) > ARM_MAT_MULT_TILE_MIN_MACS)
+  {
+    return (arm_mat_mult_tiled_q15(pSrcA, pSrcB, pDst));
+  }
+
+#endif
+
 #ifdef ARM_MATH_MATRIX_CHECK
 
   /* Check for matrix mismatch condition */
@@ -28,6 +28,202 @@
 
 #include "arm_math.h"
 
+#if defined (ARM_MATH_X86_SIMD) || defined (ARM_MATH_DSP)
+
+/* Size of the output tiles kept in registers */
+#if defined (ARM_MATH_X86_SIMD)
+#define MAT_MULT_TILE_MR   4U
+#define MAT_MULT_TILE_NR   4U
+#else
+#define MAT_MULT_TILE_MR   2U
+#define MAT_MULT_TILE_NR   2U
+#endif
+
+#if defined (ARM_MATH_X86_SIMD)
+
+/*
+ * @brief  Converts one row of the SSE tile from 2.62 to 1.31 format, with the
+ *         even columns in the 64-bit lanes of ce and the odd columns in co.
+ */
+
+static void arm_mat_mult_store_row_q31(
+  q31_t * pC,
+  __m128i ce,
+  __m128i co)
+{
+  q63_t even[2], odd[2];
+
+  _mm_storeu_si128((__m128i *) even, ce);
+  _mm_storeu_si128((__m128i *) odd, co);
+
+  pC[0] = clip_q63_to_q31(even[0] >> 31);
+  pC[1] = clip_q63_to_q31(odd[0] >> 31);
+  pC[2] = clip_q63_to_q31(even[1] >> 31);
+  pC[3] = clip_q63_to_q31(odd[1] >> 31);
+}
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+/*
+ * @brief  Computes an mr x nr tile of C over the whole inner dimension.
+ * @param[in]  *pA       points to the first element of the tile rows in A.
+ * @param[in]  *pB       points to the first element of the tile columns in B.
+ * @param[out] *pC       points to the first element of the tile in C.
+ * @param[in]  K         number of columns of A.
+ * @param[in]  N         number of columns of B and C.
+ * @param[in]  mr        number of rows of the tile.
+ * @param[in]  nr        number of columns of the tile.
+ */
+
+static void arm_mat_mult_tile_q31(
+  const q31_t * pA,
+  const q31_t * pB,
+  q31_t * pC,
+  uint32_t K,
+  uint32_t N,
+  uint32_t mr,
+  uint32_t nr)
+{
+  q63_t sum;
+  uint32_t i, j, k;
+
+  if ((mr == MAT_MULT_TILE_MR) && (nr == MAT_MULT_TILE_NR))
+  {
+
+#if defined (ARM_MATH_X86_SIMD)
+
+    /* Run the below code for x86-64 hosts with SSE4.1 */
+
+    /* Even columns in the cX0 and odd columns in the cX1 64-bit lanes */
+    __m128i c00, c01, c10, c11, c20, c21, c30, c31, b, bo, a;
+
+    c00 = c01 = c10 = c11 = c20 = c21 = c30 = c31 = _mm_setzero_si128();
+
+    for (k = 0U; k < K; k++)
+    {
+      b = _mm_loadu_si128((const __m128i *) pB);
+      bo = _mm_srli_epi64(b, 32);
+      pB += N;
+
+      a = _mm_set1_epi32(pA[k]);
+      c00 = _mm_add_epi64(c00, _mm_mul_epi32(a, b));
+      c01 = _mm_add_epi64(c01, _mm_mul_epi32(a, bo));
+      a = _mm_set1_epi32(pA[K + k]);
+      c10 = _mm_add_epi64(c10, _mm_mul_epi32(a, b));
+      c11 = _mm_add_epi64(c11, _mm_mul_epi32(a, bo));
+      a = _mm_set1_epi32(pA[2U * K + k]);
+      c20 = _mm_add_epi64(c20, _mm_mul_epi32(a, b));
+      c21 = _mm_add_epi64(c21, _mm_mul_epi32(a, bo));
+      a = _mm_set1_epi32(pA[3U * K + k]);
+      c30 = _mm_add_epi64(c30, _mm_mul_epi32(a, b));
+      c31 = _mm_add_epi64(c31, _mm_mul_epi32(a, bo));
+    }
+
+    arm_mat_mult_store_row_q31(pC, c00, c01);
+    arm_mat_mult_store_row_q31(pC + N, c10, c11);
+    arm_mat_mult_store_row_q31(pC + 2U * N, c20, c21);
+    arm_mat_mult_store_row_q31(pC + 3U * N, c30, c31);
+
+#else
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    /* Four 64-bit accumulators fit in the register file next to the operands */
+    q63_t c00 = 0, c01 = 0, c10 = 0, c11 = 0;
+    q31_t a0, a1, b0, b1;
+    const q31_t *pA1 = pA + K;
+
+    for (k = 0U; k < K; k++)
+    {
+      a0 = pA[k];
+      a1 = pA1[k];
+      b0 = pB[0];
+      b1 = pB[1];
+      pB += N;
+
+      c00 += (q63_t) a0 * b0;
+      c01 += (q63_t) a0 * b1;
+      c10 += (q63_t) a1 * b0;
+      c11 += (q63_t) a1 * b1;
+    }
+
+    pC[0]      = clip_q63_to_q31(c00 >> 31);
+    pC[1]      = clip_q63_to_q31(c01 >> 31);
+    pC[N]      = clip_q63_to_q31(c10 >> 31);
+    pC[N + 1U] = clip_q63_to_q31(c11 >> 31);
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) */
+
+  }
+  else
+  {
+    /* Partial tiles at the bottom and right edges */
+    for (i = 0U; i < mr; i++)
+    {
+      for (j = 0U; j < nr; j++)
+      {
+        sum = 0;
+
+        for (k = 0U; k < K; k++)
+        {
+          sum += (q63_t) pA[i * K + k] * pB[k * N + j];
+        }
+
+        pC[i * N + j] = clip_q63_to_q31(sum >> 31);
+      }
+    }
+  }
+}
+
+/*
+ * @brief  Register-tiled Q31 matrix multiplication.
+ *
+ * Each block of MAT_MULT_TILE_NR columns of B is used for all the rows of A
+ * before moving to the next one, so it stays in the data cache.
+ */
+
+static arm_status arm_mat_mult_tiled_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pA = pSrcA->pData;                      /* input data matrix pointer A */
+  q31_t *pB = pSrcB->pData;                      /* input data matrix pointer B */
+  q31_t *pC = pDst->pData;                       /* output data matrix pointer */
+  uint32_t M = pSrcA->numRows;                   /* number of rows of input matrix A */
+  uint32_t K = pSrcA->numCols;                   /* number of columns of input matrix A */
+  uint32_t N = pSrcB->numCols;                   /* number of columns of input matrix B */
+  uint32_t ic, jc, mr, nr;                       /* loop counters and tile sizes */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (jc = 0U; jc < N; jc += MAT_MULT_TILE_NR)
+  {
+    nr = ((N - jc) < MAT_MULT_TILE_NR) ? (N - jc) : MAT_MULT_TILE_NR;
+
+    for (ic = 0U; ic < M; ic += MAT_MULT_TILE_MR)
+    {
+      mr = ((M - ic) < MAT_MULT_TILE_MR) ? (M - ic) : MAT_MULT_TILE_MR;
+
+      arm_mat_mult_tile_q31(pA + ic * K, pB + jc, pC + ic * N + jc, K, N, mr, nr);
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+#endif /* #if defined (ARM_MATH_X86_SIMD) || defined (ARM_MATH_DSP) */
+
 /**
  * @ingroup groupMatrix
  */
@@ -86,6 +282,12 @@ arm_status arm_mat_mult_q31(
   arm_status status;                             /* status of matrix multiplication */
   q31_t a0, a1, a2, a3, b0, b1, b2, b3;
 
+  /* Large products go through the cache-tiled kernel */
+  if (((uint64_t) numRowsA * numColsA * numColsB) > ARM_MAT_MULT_TILE_MIN_MACS)
+  {
+    return (arm_mat_mult_tiled_q31(pSrcA, pSrcB, pDst));
+  }
+
 #ifdef ARM_MATH_MATRIX_CHECK
 
 
@@ -177,7 +379,7 @@ arm_status arm_mat_mult_q31(
         }
 
         /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
-        *px++ = (q31_t) (sum >> 31);
+        *px++ = (q31_t) clip_q63_to_q31(sum >> 31);
 
         /* Update the pointer pIn2 to point to the  starting address of the next column */
         j++;
@@ -196,6 +398,15 @@ arm_status arm_mat_mult_q31(
   uint16_t col, i = 0U, row = numRowsA, colCnt;  /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Large products go through the cache-tiled kernel */
+  if (((uint64_t) numRowsA * numColsA * numColsB) > ARM_MAT_MULT_TILE_MIN_MACS)
+  {
+    return (arm_mat_mult_tiled_q31(pSrcA, pSrcB, pDst));
+  }
+
+#endif
 
 #ifdef ARM_MATH_MATRIX_CHECK
 
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_ldlt_f64.c
+ * Description:  Floating-point solve from an LDLT factorization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * @brief  Subtracts a multiple of a row from another row.
+ * @param[in,out] *pX       points to the row that is updated.
+ * @param[in]     *pY       points to the row that is subtracted.
+ * @param[in]     a         multiplier of pY.
+ * @param[in]     numCols   number of elements of the rows.
+ */
+
+static void arm_mat_row_sub_f64(
+  float64_t * pX,
+  const float64_t * pY,
+  float64_t a,
+  uint32_t numCols)
+{
+  uint32_t col = numCols;                        /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling.  Process 4 columns at a time. */
+  col = numCols >> 2U;
+  while (col > 0U)
+  {
+    pX[0] -= a * pY[0];
+    pX[1] -= a * pY[1];
+    pX[2] -= a * pY[2];
+    pX[3] -= a * pY[3];
+    pX += 4U;
+    pY += 4U;
+    col--;
+  }
+
+  /* If the number of columns is not a multiple of 4, process the remaining ones here. */
+  col = numCols % 4U;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (col > 0U)
+  {
+    *pX++ -= a * *pY++;
+    col--;
+  }
+}
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point solve from an LDLT factorization.
+ * @param[in]       *pLD  points to the instance of the factors computed by arm_mat_ldlt_f64().
+ * @param[in]       *pA   points to the instance of the right hand side matrix.
+ * @param[out]      *pDst points to the instance of the solution matrix.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the factor is not square or if the sizes
+ * of the other matrices do not match it.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * Solves <code>L * D * L' * X = A</code>. The upper triangle of <code>pLD</code> is not read.
+ * <code>pA</code> and <code>pDst</code> may point to the same matrix.
+ */
+
+arm_status arm_mat_solve_ldlt_f64(
+  const arm_matrix_instance_f64 * pLD,
+  const arm_matrix_instance_f64 * pA,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pT = pLD->pData;                    /* factors pointer */
+  float64_t *pIn = pA->pData;                    /* right hand side pointer */
+  float64_t *pOut = pDst->pData;                 /* solution pointer */
+  float64_t *pRowX;                              /* row of the solution */
+  float64_t diag;                                /* diagonal element */
+  uint32_t n = pLD->numRows;                     /* size of the factors */
+  uint32_t numCols = pA->numCols;                /* number of columns of the solution */
+  uint32_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pLD->numRows != pLD->numCols) || (pA->numRows != n)
+     || (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Forward substitution with the unit diagonal L, top row first */
+    for (i = 0U; i < n; i++)
+    {
+      pRowX = pOut + (i * numCols);
+
+      for (col = 0U; col < numCols; col++)
+      {
+        pRowX[col] = pIn[(i * numCols) + col];
+      }
+
+      for (k = 0U; k < i; k++)
+      {
+        arm_mat_row_sub_f64(pRowX, pOut + (k * numCols), pT[(i * n) + k], numCols);
+      }
+    }
+
+    /* Division by D and back substitution with L', bottom row first.
+     * Row i of L' is column i of L */
+    i = n;
+    while (i > 0U)
+    {
+      i--;
+      pRowX = pOut + (i * numCols);
+      diag = pT[(i * n) + i];
+
+      for (col = 0U; col < numCols; col++)
+      {
+        pRowX[col] /= diag;
+      }
+
+      for (k = i + 1U; k < n; k++)
+      {
+        arm_mat_row_sub_f64(pRowX, pOut + (k * numCols), pT[(k * n) + i], numCols);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
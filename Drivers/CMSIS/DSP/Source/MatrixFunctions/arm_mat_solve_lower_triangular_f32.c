@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f32.c
+ * Description:  Floating-point lower triangular solve
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * @brief  Subtracts a multiple of a row from another row.
+ * @param[in,out] *pX       points to the row that is updated.
+ * @param[in]     *pY       points to the row that is subtracted.
+ * @param[in]     a         multiplier of pY.
+ * @param[in]     numCols   number of elements of the rows.
+ */
+
+static void arm_mat_row_sub_f32(
+  float32_t * pX,
+  const float32_t * pY,
+  float32_t a,
+  uint32_t numCols)
+{
+  uint32_t col = numCols;                        /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling.  Process 4 columns at a time. */
+  col = numCols >> 2U;
+  while (col > 0U)
+  {
+    pX[0] -= a * pY[0];
+    pX[1] -= a * pY[1];
+    pX[2] -= a * pY[2];
+    pX[3] -= a * pY[3];
+    pX += 4U;
+    pY += 4U;
+    col--;
+  }
+
+  /* If the number of columns is not a multiple of 4, process the remaining ones here. */
+  col = numCols % 4U;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (col > 0U)
+  {
+    *pX++ -= a * *pY++;
+    col--;
+  }
+}
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Triangular Solve
+ *
+ * Solves the system <code>T * X = A</code> where <code>T</code> is a triangular matrix and
+ * <code>A</code> has one or more columns.
+ *
+ * arm_mat_solve_lower_triangular_f32() and arm_mat_solve_upper_triangular_f32() take a general
+ * triangular matrix and only read its lower or upper triangle. arm_mat_solve_cholesky_f32()
+ * and arm_mat_solve_ldlt_f32() solve <code>S * X = A</code> for a symmetric matrix <code>S</code>
+ * from the factors computed by arm_mat_cholesky_f32() and arm_mat_ldlt_f32(), with a forward
+ * substitution followed by a back substitution on the transposed factor, which is read in
+ * place.
+ *
+ * \par Algorithm
+ * Each row of <code>X</code> is computed from the same row of <code>A</code> and the rows of
+ * <code>X</code> already solved, by subtracting multiples of whole rows. The inner loop therefore
+ * runs over contiguous memory whatever the number of columns, and <code>A</code> and
+ * <code>X</code> may be the same matrix. A solve costs <code>n<sup>2</sup>/2</code>
+ * multiply-accumulates per column of <code>A</code>, <code>n<sup>2</sup></code> for the
+ * Cholesky and LDLT solves. If a diagonal element of a triangular matrix is zero, the
+ * function returns error status <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point lower triangular solve.
+ * @param[in]       *pLT  points to the instance of the lower triangular matrix.
+ * @param[in]       *pA   points to the instance of the right hand side matrix.
+ * @param[out]      *pDst points to the instance of the solution matrix.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the triangular matrix is not square or if the sizes
+ * of the other matrices do not match it.
+ * If a diagonal element of the triangular matrix is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The upper triangle of <code>pLT</code> is not read. <code>pA</code> and <code>pDst</code> may
+ * point to the same matrix.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pLT,
+  const arm_matrix_instance_f32 * pA,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pT = pLT->pData;                    /* triangular matrix pointer */
+  float32_t *pIn = pA->pData;                    /* right hand side pointer */
+  float32_t *pOut = pDst->pData;                 /* solution pointer */
+  float32_t *pRowX;                              /* row of the solution */
+  float32_t diag;                                /* diagonal element */
+  uint32_t n = pLT->numRows;                     /* size of the triangular matrix */
+  uint32_t numCols = pA->numCols;                /* number of columns of the solution */
+  uint32_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pLT->numRows != pLT->numCols) || (pA->numRows != n)
+     || (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Forward substitution, top row first */
+    for (i = 0U; i < n; i++)
+    {
+      pRowX = pOut + (i * numCols);
+
+      for (col = 0U; col < numCols; col++)
+      {
+        pRowX[col] = pIn[(i * numCols) + col];
+      }
+
+      for (k = 0U; k < i; k++)
+      {
+        arm_mat_row_sub_f32(pRowX, pOut + (k * numCols), pT[(i * n) + k], numCols);
+      }
+
+      diag = pT[(i * n) + i];
+
+      if (diag == 0.0f)
+      {
+        return ARM_MATH_SINGULAR;
+      }
+
+      for (col = 0U; col < numCols; col++)
+      {
+        pRowX[col] /= diag;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_init_f32.c
+ * Description:  Streaming statistics initialization for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Initialization function for the floating-point streaming statistics.
+ * @param[in,out] *S        points to an instance of the floating-point streaming statistics structure.
+ * @param[in]     *pHist    points to an array of numBins histogram bins, or NULL for no histogram.
+ * @param[in]     numBins   number of histogram bins.
+ * @param[in]     histMin   lower edge of the first bin.
+ * @param[in]     histMax   upper edge of the last bin.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The bins are <code>(histMax - histMin) / numBins</code> wide and are cleared here.
+ * The histogram is only needed by arm_stats_percentile_f32().
+ */
+
+void arm_stats_init_f32(
+  arm_stats_instance_f32 * S,
+  uint32_t * pHist,
+  uint16_t numBins,
+  float32_t histMin,
+  float32_t histMax)
+{
+  S->count = 0U;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->min = 3.40282347e+38f;
+  S->max = -3.40282347e+38f;
+
+  S->pHist = pHist;
+  S->numBins = numBins;
+  S->histMin = histMin;
+  S->binScale = 0.0f;
+
+  if (pHist != NULL)
+  {
+    S->binScale = (float32_t) numBins / (histMax - histMin);
+    memset(pHist, 0, numBins * sizeof(uint32_t));
+  }
+}
+
+/**
+ * @} end of stats group
+ */
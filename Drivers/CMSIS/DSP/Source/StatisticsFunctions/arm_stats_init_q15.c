@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_init_q15.c
+ * Description:  Streaming statistics initialization for Q15 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Initialization function for the Q15 streaming statistics.
+ * @param[in,out] *S        points to an instance of the Q15 streaming statistics structure.
+ * @param[in]     *pHist    points to an array of numBins histogram bins, or NULL for no histogram.
+ * @param[in]     numBins   number of histogram bins.
+ * @param[in]     histMin   lower edge of the first bin.
+ * @param[in]     binShift  the width of the bins is 2^binShift, from 0 to 16.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The bins are found with a shift, so their width is a power of 2.
+ * For example, 256 bins with <code>histMin = 0x8000</code> and
+ * <code>binShift = 8</code> cover the whole Q15 range. The bins are cleared here.
+ */
+
+void arm_stats_init_q15(
+  arm_stats_instance_q15 * S,
+  uint32_t * pHist,
+  uint16_t numBins,
+  q15_t histMin,
+  uint8_t binShift)
+{
+  S->count = 0U;
+  S->sum = 0;
+  S->sumOfSquares = 0;
+  S->min = 0x7FFF;
+  S->max = (q15_t) 0x8000;
+
+  S->pHist = pHist;
+  S->numBins = numBins;
+  S->histMin = histMin;
+  S->binShift = binShift;
+
+  if (pHist != NULL)
+  {
+    memset(pHist, 0, numBins * sizeof(uint32_t));
+  }
+}
+
+/**
+ * @} end of stats group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_merge_f32.c
+ * Description:  Streaming statistics merge for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Merges two floating-point streaming statistics.
+ * @param[in,out] *S      points to the instance that receives the samples of the other one.
+ * @param[in]     *S2     points to the other instance, with the same histogram bins.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * After the call, <code>S</code> holds the statistics of the samples of both instances.
+ * The histograms are added when both instances have one.
+ */
+
+void arm_stats_merge_f32(
+  arm_stats_instance_f32 * S,
+  const arm_stats_instance_f32 * S2)
+{
+  float32_t delta, ratio;                        /* temporary variables */
+  uint32_t n;                                    /* merged count */
+  uint32_t i;                                    /* loop counter */
+
+  if (S2->count == 0U)
+  {
+    return;
+  }
+
+  /* mean = meanA + delta * nb / n,  M2 = M2a + M2b + delta^2 * na * nb / n */
+  n = S->count + S2->count;
+  delta = S2->mean - S->mean;
+  ratio = (float32_t) S2->count / (float32_t) n;
+  S->mean += delta * ratio;
+  S->m2 += S2->m2 + (delta * delta * (float32_t) S->count * ratio);
+  S->count = n;
+
+  S->min = (S2->min < S->min) ? S2->min : S->min;
+  S->max = (S2->max > S->max) ? S2->max : S->max;
+
+  if ((S->pHist != NULL) && (S2->pHist != NULL))
+  {
+    for (i = 0U; i < S->numBins; i++)
+    {
+      S->pHist[i] += S2->pHist[i];
+    }
+  }
+}
+
+/**
+ * @} end of stats group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_merge_q31.c
+ * Description:  Streaming statistics merge for Q31 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Merges two Q31 streaming statistics.
+ * @param[in,out] *S      points to the instance that receives the samples of the other one.
+ * @param[in]     *S2     points to the other instance, with the same histogram bins.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * After the call, <code>S</code> holds the statistics of the samples of both instances.
+ * The accumulators are exact, so the result does not depend on how the samples were split.
+ * The histograms are added when both instances have one.
+ */
+
+void arm_stats_merge_q31(
+  arm_stats_instance_q31 * S,
+  const arm_stats_instance_q31 * S2)
+{
+  uint32_t i;                                    /* loop counter */
+
+  S->count += S2->count;
+  S->sum += S2->sum;
+  S->sumOfSquares += S2->sumOfSquares;
+  S->sumOfSquaresLow += S2->sumOfSquaresLow;
+  S->min = (S2->min < S->min) ? S2->min : S->min;
+  S->max = (S2->max > S->max) ? S2->max : S->max;
+
+  if ((S->pHist != NULL) && (S2->pHist != NULL))
+  {
+    for (i = 0U; i < S->numBins; i++)
+    {
+      S->pHist[i] += S2->pHist[i];
+    }
+  }
+}
+
+/**
+ * @} end of stats group
+ */
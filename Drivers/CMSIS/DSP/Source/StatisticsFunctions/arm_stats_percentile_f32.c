@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_percentile_f32.c
+ * Description:  Streaming statistics percentile for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Percentile of the floating-point streaming statistics, from the histogram.
+ * @param[in]  *S         points to an instance of the floating-point streaming statistics structure.
+ * @param[in]  fraction   fraction of the samples below the result, in [0 1].
+ * @return percentile value.
+ *
+ * <b>Description:</b>
+ * \par
+ * The bin that holds the requested sample is found from the cumulative counts,
+ * and the result is interpolated linearly inside that bin, then limited to the
+ * minimum and the maximum of the samples. The function returns 0 when there are
+ * no samples or no histogram.
+ */
+
+float32_t arm_stats_percentile_f32(
+  const arm_stats_instance_f32 * S,
+  float32_t fraction)
+{
+  float32_t target;                              /* rank of the requested sample */
+  float32_t below = 0.0f;                        /* samples below the current bin */
+  float32_t out;                                 /* result */
+  uint32_t bin;                                  /* bin index */
+
+  if ((S->count == 0U) || (S->pHist == NULL))
+  {
+    return (0.0f);
+  }
+
+  target = fraction * (float32_t) S->count;
+
+  /* Find the bin the cumulative count reaches the target in */
+  for (bin = 0U; bin < (S->numBins - 1U); bin++)
+  {
+    if ((below + (float32_t) S->pHist[bin]) >= target)
+    {
+      break;
+    }
+
+    below += (float32_t) S->pHist[bin];
+  }
+
+  out = (float32_t) bin;
+  if (S->pHist[bin] > 0U)
+  {
+    out += (target - below) / (float32_t) S->pHist[bin];
+  }
+  out = S->histMin + (out / S->binScale);
+
+  out = (out < S->min) ? S->min : out;
+  out = (out > S->max) ? S->max : out;
+
+  return (out);
+}
+
+/**
+ * @} end of stats group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_percentile_q31.c
+ * Description:  Streaming statistics percentile for Q31 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Percentile of the Q31 streaming statistics, from the histogram.
+ * @param[in]  *S         points to an instance of the Q31 streaming statistics structure.
+ * @param[in]  fraction   fraction of the samples below the result, in [0 1).
+ * @return percentile value.
+ *
+ * <b>Description:</b>
+ * \par
+ * The bin that holds the requested sample is found from the cumulative counts,
+ * and the result is interpolated linearly inside that bin, then limited to the
+ * minimum and the maximum of the samples. The function returns 0 when there are
+ * no samples or no histogram. Negative fractions are handled as 0.
+ */
+
+q31_t arm_stats_percentile_q31(
+  const arm_stats_instance_q31 * S,
+  q31_t fraction)
+{
+  uint64_t target;                               /* rank of the requested sample in 32.31 format */
+  uint64_t below = 0U;                           /* samples below the current bin */
+  q63_t inBin;                                   /* position inside the bin in 1.31 format */
+  q63_t out;                                     /* result */
+  uint32_t bin;                                  /* bin index */
+
+  if ((S->count == 0U) || (S->pHist == NULL))
+  {
+    return (0);
+  }
+
+  fraction = (fraction > 0) ? fraction : 0;
+  target = (uint64_t) fraction * S->count;
+
+  /* Find the bin the cumulative count reaches the target in */
+  for (bin = 0U; bin < (S->numBins - 1U); bin++)
+  {
+    if (((below + S->pHist[bin]) << 31) >= target)
+    {
+      break;
+    }
+
+    below += S->pHist[bin];
+  }
+
+  inBin = 0;
+  if (S->pHist[bin] > 0U)
+  {
+    inBin = (q63_t) ((target - (below << 31)) / S->pHist[bin]);
+    inBin = (inBin < 0x7FFFFFFF) ? inBin : 0x7FFFFFFF;
+  }
+
+  out = (q63_t) S->histMin + ((q63_t) bin << S->binShift) + ((inBin << S->binShift) >> 31);
+
+  out = (out < S->min) ? S->min : out;
+  out = (out > S->max) ? S->max : out;
+
+  return ((q31_t) out);
+}
+
+/**
+ * @} end of stats group
+ */
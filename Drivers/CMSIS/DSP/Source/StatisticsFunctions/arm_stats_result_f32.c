@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_result_f32.c
+ * Description:  Streaming statistics results for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, minimum and maximum of the floating-point streaming statistics.
+ * @param[in]  *S       points to an instance of the floating-point streaming statistics structure.
+ * @param[out] *pMean   mean value returned here.
+ * @param[out] *pVar    variance value returned here.
+ * @param[out] *pStd    standard deviation value returned here.
+ * @param[out] *pMin    minimum value returned here.
+ * @param[out] *pMax    maximum value returned here.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The variance is 0 for less than two samples. The instance is not modified,
+ * so the results can be read at any time while the samples keep coming.
+ */
+
+void arm_stats_result_f32(
+  const arm_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar,
+  float32_t * pStd,
+  float32_t * pMin,
+  float32_t * pMax)
+{
+  float32_t var = 0.0f;                          /* variance */
+
+  if (S->count > 1U)
+  {
+    var = S->m2 / (float32_t) (S->count - 1U);
+  }
+
+  *pMean = S->mean;
+  *pVar = var;
+  arm_sqrt_f32(var, pStd);
+  *pMin = S->min;
+  *pMax = S->max;
+}
+
+/**
+ * @} end of stats group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_result_q15.c
+ * Description:  Streaming statistics results for Q15 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, minimum and maximum of the Q15 streaming statistics.
+ * @param[in]  *S       points to an instance of the Q15 streaming statistics structure.
+ * @param[out] *pMean   mean value returned here.
+ * @param[out] *pVar    variance value returned here.
+ * @param[out] *pStd    standard deviation value returned here.
+ * @param[out] *pMin    minimum value returned here.
+ * @param[out] *pMax    maximum value returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The variance is computed in 2.30 format as
+ * <pre>
+ *     sumOfSquares / (count - 1) - mean^2 * count / (count - 1)
+ * </pre>
+ * with the mean in 1.31 format, then shifted and saturated to 1.15 format.
+ * The variance is 0 for less than two samples.
+ */
+
+void arm_stats_result_q15(
+  const arm_stats_instance_q15 * S,
+  q15_t * pMean,
+  q15_t * pVar,
+  q15_t * pStd,
+  q15_t * pMin,
+  q15_t * pMax)
+{
+  q63_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
+  q31_t meanQ31;                                 /* mean in 1.31 format */
+  q15_t mean = 0, var = 0;                       /* results */
+
+  if (S->count > 0U)
+  {
+    mean = (q15_t) (S->sum / (q63_t) S->count);
+  }
+
+  if (S->count > 1U)
+  {
+    meanQ31 = (q31_t) ((S->sum << 16) / (q63_t) S->count);
+
+    /* Both terms in 2.30 format */
+    meanOfSquares = S->sumOfSquares / (q63_t) (S->count - 1U);
+    squareOfMean = ((q63_t) meanQ31 * meanQ31) >> 32;
+    squareOfMean += squareOfMean / (q63_t) (S->count - 1U);
+
+    meanOfSquares -= squareOfMean;
+    meanOfSquares = (meanOfSquares > 0) ? meanOfSquares : 0;
+    var = (q15_t) __SSAT((q31_t) (meanOfSquares >> 15), 16);
+  }
+
+  *pMean = mean;
+  *pVar = var;
+  arm_sqrt_q15(var, pStd);
+  *pMin = S->min;
+  *pMax = S->max;
+}
+
+/**
+ * @} end of stats group
+ */
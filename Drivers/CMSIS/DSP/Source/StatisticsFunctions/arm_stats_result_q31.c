@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_result_q31.c
+ * Description:  Streaming statistics results for Q31 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Mean, variance, standard deviation, minimum and maximum of the Q31 streaming statistics.
+ * @param[in]  *S       points to an instance of the Q31 streaming statistics structure.
+ * @param[out] *pMean   mean value returned here.
+ * @param[out] *pVar    variance value returned here.
+ * @param[out] *pStd    standard deviation value returned here.
+ * @param[out] *pMin    minimum value returned here.
+ * @param[out] *pMax    maximum value returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The variance is computed in 18.46 format as
+ * <pre>
+ *     sumOfSquares / (count - 1) - mean^2 * count / (count - 1)
+ * </pre>
+ * from the exact sums, with the remainder of the division by <code>count</code>
+ * kept in the square of the mean, then rounded and saturated to 1.31 format.
+ * The variance is 0 for less than two samples.
+ */
+
+void arm_stats_result_q31(
+  const arm_stats_instance_q31 * S,
+  q31_t * pMean,
+  q31_t * pVar,
+  q31_t * pStd,
+  q31_t * pMin,
+  q31_t * pMax)
+{
+  q63_t meanOfSquares, squareOfMean;             /* square of mean and mean of square */
+  q63_t sumOfSquares, quot, rem;                 /* temporary variables */
+  q31_t mean = 0, var = 0;                       /* results */
+
+  if (S->count > 0U)
+  {
+    mean = (q31_t) (S->sum / (q63_t) S->count);
+  }
+
+  if (S->count > 1U)
+  {
+    /* Mean of squares in 18.46 format, from the upper and lower sums */
+    sumOfSquares = S->sumOfSquares + (q63_t) (S->sumOfSquaresLow >> 32);
+    quot = sumOfSquares / (q63_t) (S->count - 1U);
+    rem = sumOfSquares % (q63_t) (S->count - 1U);
+    meanOfSquares = (quot << 16) +
+      (((rem << 16) + (q63_t) ((S->sumOfSquaresLow & 0xFFFFFFFFU) >> 16)) / (q63_t) (S->count - 1U));
+
+    /* (mean + rem / count)^2 in 2.62 format, then in 18.46 format */
+    rem = S->sum % (q63_t) S->count;
+    squareOfMean = ((q63_t) mean * mean) + ((((q63_t) mean * rem) / (q63_t) S->count) * 2);
+    squareOfMean >>= 16;
+    squareOfMean += squareOfMean / (q63_t) (S->count - 1U);
+
+    meanOfSquares -= squareOfMean;
+    meanOfSquares = (meanOfSquares > 0) ? meanOfSquares : 0;
+    var = clip_q63_to_q31((meanOfSquares + (1 << 14)) >> 15);
+  }
+
+  *pMean = mean;
+  *pVar = var;
+  arm_sqrt_q31(var, pStd);
+  *pMin = S->min;
+  *pMax = S->max;
+}
+
+/**
+ * @} end of stats group
+ */
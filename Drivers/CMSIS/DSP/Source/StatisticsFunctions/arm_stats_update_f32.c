@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_update_f32.c
+ * Description:  Streaming statistics update for floating-point values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* Number of samples summed around a fixed shift before they are merged */
+#define ARM_STATS_CHUNK_F32  256U
+
+/*
+ * @brief  Adds one sample to the histogram.
+ * @param[in,out] *S  points to an instance of the floating-point streaming statistics structure.
+ * @param[in]     in  sample value.
+ * @return none.
+ */
+
+static void arm_stats_bin_f32(
+  arm_stats_instance_f32 * S,
+  float32_t in)
+{
+  float32_t pos = (in - S->histMin) * S->binScale;
+  uint32_t bin;
+
+  /* Samples outside of the bins, and NaN, go to the first or the last bin */
+  if (!(pos >= 0.0f))
+  {
+    bin = 0U;
+  }
+  else if (pos >= (float32_t) S->numBins)
+  {
+    bin = S->numBins - 1U;
+  }
+  else
+  {
+    bin = (uint32_t) pos;
+  }
+
+  S->pHist[bin]++;
+}
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup stats Streaming Statistics
+ *
+ * Accumulates the mean, the variance, the standard deviation, the minimum,
+ * the maximum and optionally a histogram of a signal that arrives block by block.
+ * Every sample is read once, where calling arm_mean, arm_var, arm_min and arm_max
+ * reads the block five times.
+ *
+ * The functions are used as follows:
+ * <pre>
+ *     arm_stats_init_f32(&S, pHist, numBins, histMin, histMax);
+ *     arm_stats_update_f32(&S, pSrc, blockSize);        for each block
+ *     arm_stats_result_f32(&S, &mean, &var, &std, &min, &max);
+ *     median = arm_stats_percentile_f32(&S, 0.5f);
+ * </pre>
+ *
+ * Two instances that accumulated different parts of a signal, for example on
+ * two cores or in two tasks, are combined with arm_stats_merge_f32().
+ *
+ * \par Algorithm
+ * The floating-point version keeps the count, the mean and the sum of the squared
+ * differences to the mean <code>M2</code>. The samples of a block are summed in chunks
+ * of 256 around the current mean <code>K</code>:
+ * <pre>
+ *     s1 = sum(x[n] - K),   s2 = sum((x[n] - K)^2)
+ * </pre>
+ * and each chunk, of mean <code>K + s1 / nb</code> and <code>M2b = s2 - s1^2 / nb</code>,
+ * is merged with the instance with the formula of Chan:
+ * <pre>
+ *     delta = meanB - meanA
+ *     mean  = meanA + delta * nb / n
+ *     M2    = M2a + M2b + delta^2 * na * nb / n
+ * </pre>
+ * This is as stable as the update of Welford, without a division per sample.
+ * The fixed-point versions keep the exact sum of the samples and the sum of their
+ * squares in 64-bit accumulators, which simply add when merging.
+ *
+ * The variance is the sample variance, divided by <code>count - 1</code> as in arm_var_f32().
+ *
+ * \par Histogram
+ * When <code>pHist</code> is not NULL, each sample also increments one of <code>numBins</code>
+ * bins of equal width. Samples below the first bin are counted in the first bin and samples
+ * above the last bin in the last one. The percentiles are read from the histogram by
+ * linear interpolation inside a bin, so their accuracy is one bin width.
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Adds a block of samples to the floating-point streaming statistics.
+ * @param[in,out] *S          points to an instance of the floating-point streaming statistics structure.
+ * @param[in]     *pSrc       points to the block of samples.
+ * @param[in]     blockSize   number of samples in the block.
+ * @return none.
+ */
+
+void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t shift;                               /* value the chunk is summed around */
+  float32_t sum, sumOfSquares;                   /* sums of the chunk */
+  float32_t minVal = S->min, maxVal = S->max;    /* extreme values */
+  float32_t in, d;                               /* temporary variables */
+  float32_t meanB, m2B, delta, ratio;            /* chunk statistics */
+  uint32_t chunkSize, blkCnt;                    /* loop counters */
+  uint32_t n;                                    /* merged count */
+
+  while (blockSize > 0U)
+  {
+    chunkSize = (blockSize < ARM_STATS_CHUNK_F32) ? blockSize : ARM_STATS_CHUNK_F32;
+
+    /* Sum around the current mean, or around the first sample */
+    shift = (S->count > 0U) ? S->mean : pSrc[0];
+    sum = 0.0f;
+    sumOfSquares = 0.0f;
+
+    if (S->pHist != NULL)
+    {
+      for (blkCnt = 0U; blkCnt < chunkSize; blkCnt++)
+      {
+        arm_stats_bin_f32(S, pSrc[blkCnt]);
+      }
+    }
+
+#if defined (ARM_MATH_DSP)
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* loop Unrolling */
+    blkCnt = chunkSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+      d = in - shift;
+      sum += d;
+      sumOfSquares += d * d;
+      minVal = (in < minVal) ? in : minVal;
+      maxVal = (in > maxVal) ? in : maxVal;
+
+      in = *pSrc++;
+      d = in - shift;
+      sum += d;
+      sumOfSquares += d * d;
+      minVal = (in < minVal) ? in : minVal;
+      maxVal = (in > maxVal) ? in : maxVal;
+
+      in = *pSrc++;
+      d = in - shift;
+      sum += d;
+      sumOfSquares += d * d;
+      minVal = (in < minVal) ? in : minVal;
+      maxVal = (in > maxVal) ? in : maxVal;
+
+      in = *pSrc++;
+      d = in - shift;
+      sum += d;
+      sumOfSquares += d * d;
+      minVal = (in < minVal) ? in : minVal;
+      maxVal = (in > maxVal) ? in : maxVal;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the chunkSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = chunkSize % 0x4U;
+
+#else
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over chunkSize number of values */
+    blkCnt = chunkSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+      d = in - shift;
+      sum += d;
+      sumOfSquares += d * d;
+      minVal = (in < minVal) ? in : minVal;
+      maxVal = (in > maxVal) ? in : maxVal;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Mean and M2 of the chunk */
+    meanB = shift + (sum / (float32_t) chunkSize);
+    m2B = sumOfSquares - ((sum * sum) / (float32_t) chunkSize);
+    m2B = (m2B > 0.0f) ? m2B : 0.0f;
+
+    /* Merge the chunk with the previous samples */
+    n = S->count + chunkSize;
+    delta = meanB - S->mean;
+    ratio = (float32_t) chunkSize / (float32_t) n;
+    S->mean += delta * ratio;
+    S->m2 += m2B + (delta * delta * (float32_t) S->count * ratio);
+    S->count = n;
+
+    blockSize -= chunkSize;
+  }
+
+  S->min = minVal;
+  S->max = maxVal;
+}
+
+/**
+ * @} end of stats group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_update_q15.c
+ * Description:  Streaming statistics update for Q15 values
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup stats
+ * @{
+ */
+
+/**
+ * @brief Adds a block of samples to the Q15 streaming statistics.
+ * @param[in,out] *S          points to an instance of the Q15 streaming statistics structure.
+ * @param[in]     *pSrc       points to the block of samples.
+ * @param[in]     blockSize   number of samples in the block.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The samples are summed exactly in a 49.15 accumulator, and their exact squares
+ * in 2.30 format are summed in a 34.30 accumulator.
+ * Both accumulators overflow only after 2^32 samples.
+ */
+
+void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum = S->sum;                            /* Accumulator */
+  q63_t sumOfSquares = S->sumOfSquares;          /* Accumulator */
+  q15_t minVal = S->min, maxVal = S->max;        /* extreme values */
+  q15_t in;                                      /* input value */
+  q31_t pos;                                     /* histogram bin */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if (S->pHist != NULL)
+  {
+    for (blkCnt = 0U; blkCnt < blockSize; blkCnt++)
+    {
+      /* Samples outside of the bins go to the first or the last bin */
+      pos = ((q31_t) pSrc[blkCnt] - S->histMin) >> S->binShift;
+      pos = (pos < 0) ? 0 : pos;
+      pos = (pos >= S->numBins) ? (S->numBins - 1) : pos;
+      S->pHist[pos]++;
+    }
+  }
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+    minVal = (in < minVal) ? in : minVal;
+    maxVal = (in > maxVal) ? in : maxVal;
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+    minVal = (in < minVal) ? in : minVal;
+    maxVal = (in > maxVal) ? in : maxVal;
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+    minVal = (in < minVal) ? in : minVal;
+    maxVal = (in > maxVal) ? in : maxVal;
+
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+    minVal = (in < minVal) ? in : minVal;
+    maxVal = (in > maxVal) ? in : maxVal;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += (q31_t) in * in;
+    minVal = (in < minVal) ? in : minVal;
+    maxVal = (in > maxVal) ? in : maxVal;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count += blockSize;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+}
+
+/**
+ * @} end of stats group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_argsort_f32.c
+ * Description:  Floating-point index sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* Length of the runs sorted by insertion before merging */
+#define ARM_SORT_RUN  8U
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Indices that sort a floating-point vector in ascending order.
+ * @param[in]  *pSrc       points to the vector, which is not modified.
+ * @param[out] *pIndex     points to the blockSize output indices.
+ * @param[in]  *pScratch   points to a scratch buffer of blockSize indices.
+ * @param[in]  blockSize   number of elements in the vector.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * After the call, <code>pSrc[pIndex[0]] <= pSrc[pIndex[1]] <= ...</code>.
+ * Equal elements keep their order, so their indices are increasing.
+ */
+
+void arm_argsort_f32(
+  const float32_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t *pIn = pIndex, *pOut = pScratch, *pTmp; /* merge source and destination */
+  uint32_t in;                                   /* temporary variable */
+  uint32_t width, start, mid, end;               /* runs to merge */
+  uint32_t i, j, k;                              /* loop counters */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    pIndex[i] = i;
+  }
+
+  /* Sort the runs of ARM_SORT_RUN elements by insertion */
+  for (start = 0U; start < blockSize; start += ARM_SORT_RUN)
+  {
+    end = ((blockSize - start) < ARM_SORT_RUN) ? blockSize : (start + ARM_SORT_RUN);
+
+    for (i = start + 1U; i < end; i++)
+    {
+      in = pIndex[i];
+      for (j = i; (j > start) && (pSrc[pIndex[j - 1U]] > pSrc[in]); j--)
+      {
+        pIndex[j] = pIndex[j - 1U];
+      }
+      pIndex[j] = in;
+    }
+  }
+
+  /* Merge the runs pairwise, from pIn to pOut */
+  for (width = ARM_SORT_RUN; width < blockSize; width <<= 1U)
+  {
+    for (start = 0U; start < blockSize; start += (width << 1U))
+    {
+      mid = ((blockSize - start) < width) ? blockSize : (start + width);
+      end = ((blockSize - mid) < width) ? blockSize : (mid + width);
+
+      i = start;
+      j = mid;
+      k = start;
+
+      while ((i < mid) && (j < end))
+      {
+        /* Take the first run on ties, so that the sort is stable */
+        pOut[k++] = (pSrc[pIn[j]] < pSrc[pIn[i]]) ? pIn[j++] : pIn[i++];
+      }
+
+      while (i < mid)
+      {
+        pOut[k++] = pIn[i++];
+      }
+
+      while (j < end)
+      {
+        pOut[k++] = pIn[j++];
+      }
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* Copy the result back after an odd number of passes */
+  if (pIn != pIndex)
+  {
+    memcpy(pIndex, pIn, blockSize * sizeof(uint32_t));
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
@@ -53,7 +53,14 @@ void arm_fill_q7(
 {
   uint32_t blkCnt;                               /* loop counter */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts */
+  /* Byte fills are a memset, which the C library does faster than 16-byte stores */
+  memset(pDst, value, blockSize);
+  blkCnt = 0U;
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
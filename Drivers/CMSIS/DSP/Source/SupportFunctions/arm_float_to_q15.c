@@ -75,7 +75,74 @@ void arm_float_to_q15(
 
 #endif /*      #ifdef ARM_MATH_ROUNDING        */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 in1, in2;                               /* temporary input variables */
+  const __m128 scaleV = _mm_set1_ps(32768.0f);
+
+#ifdef ARM_MATH_ROUNDING
+
+  const __m128 posHalf = _mm_set1_ps(0.5f);
+  const __m128 negHalf = _mm_set1_ps(-0.5f);
+  const __m128 zero = _mm_setzero_ps();
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+  /* Compute 8 outputs at a time */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 32768 */
+    in1 = _mm_mul_ps(_mm_loadu_ps(pIn), scaleV);
+    in2 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), scaleV);
+
+#ifdef ARM_MATH_ROUNDING
+
+    in1 = _mm_add_ps(in1, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in1, zero)));
+    in2 = _mm_add_ps(in2, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in2, zero)));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Convert to 32 bits and saturate to 16 bits when packing */
+    _mm_storeu_si128((__m128i *) pDst, _mm_packs_epi32(_mm_cvttps_epi32(in1), _mm_cvttps_epi32(in2)));
+
+    pIn += 8;
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x8U;
+
+  while (blkCnt > 0U)
+  {
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* C = A * 32768 */
+    /* convert from float to q15 and then store the results in the destination buffer */
+    in = *pIn++;
+    in = (in * 32768.0f);
+    in += in > 0.0f ? 0.5f : -0.5f;
+    *pDst++ = (q15_t) (__SSAT((q31_t) (in), 16));
+
+#else
+
+    /* C = A * 32768 */
+    /* convert from float to q15 and then store the results in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((q31_t) (*pIn++ * 32768.0f), 16));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
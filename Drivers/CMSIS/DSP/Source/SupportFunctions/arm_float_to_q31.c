@@ -79,7 +79,75 @@ void arm_float_to_q31(
 
 #endif /*      #ifdef ARM_MATH_ROUNDING        */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 in4;                                    /* temporary input variable */
+  __m128i out4;                                  /* temporary output variable */
+  const __m128 scaleV = _mm_set1_ps(2147483648.0f);
+
+#ifdef ARM_MATH_ROUNDING
+
+  const __m128 posHalf = _mm_set1_ps(0.5f);
+  const __m128 negHalf = _mm_set1_ps(-0.5f);
+  const __m128 zero = _mm_setzero_ps();
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 2147483648 */
+    in4 = _mm_mul_ps(_mm_loadu_ps(pIn), scaleV);
+
+#ifdef ARM_MATH_ROUNDING
+
+    in4 = _mm_add_ps(in4, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in4, zero)));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Lanes out of range convert to 0x80000000, the positive ones are flipped to 0x7FFFFFFF */
+    out4 = _mm_cvttps_epi32(in4);
+    out4 = _mm_xor_si128(out4, _mm_castps_si128(_mm_cmpge_ps(in4, scaleV)));
+    _mm_storeu_si128((__m128i *) pDst, out4);
+
+    pIn += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* C = A * 2147483648 */
+    /* convert from float to q31 and then store the results in the destination buffer */
+    in = *pIn++;
+    in = (in * 2147483648.0f);
+    in += in > 0.0f ? 0.5f : -0.5f;
+    *pDst++ = clip_q63_to_q31((q63_t) (in));
+
+#else
+
+    /* C = A * 2147483648 */
+    /* convert from float to q31 and then store the results in the destination buffer */
+    *pDst++ = clip_q63_to_q31((q63_t) (*pIn++ * 2147483648.0f));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
@@ -74,7 +74,80 @@ void arm_float_to_q7(
 
 #endif /*      #ifdef ARM_MATH_ROUNDING        */
 
-#if defined (ARM_MATH_DSP)
+#if defined (ARM_MATH_X86_SIMD)
+
+  /* Run the below code for x86-64 hosts with SSE4.1 */
+  __m128 in1, in2, in3, in4;                     /* temporary input variables */
+  const __m128 scaleV = _mm_set1_ps(128.0f);
+
+#ifdef ARM_MATH_ROUNDING
+
+  const __m128 posHalf = _mm_set1_ps(0.5f);
+  const __m128 negHalf = _mm_set1_ps(-0.5f);
+  const __m128 zero = _mm_setzero_ps();
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+  /* Compute 16 outputs at a time */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * 128 */
+    in1 = _mm_mul_ps(_mm_loadu_ps(pIn), scaleV);
+    in2 = _mm_mul_ps(_mm_loadu_ps(pIn + 4), scaleV);
+    in3 = _mm_mul_ps(_mm_loadu_ps(pIn + 8), scaleV);
+    in4 = _mm_mul_ps(_mm_loadu_ps(pIn + 12), scaleV);
+
+#ifdef ARM_MATH_ROUNDING
+
+    in1 = _mm_add_ps(in1, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in1, zero)));
+    in2 = _mm_add_ps(in2, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in2, zero)));
+    in3 = _mm_add_ps(in3, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in3, zero)));
+    in4 = _mm_add_ps(in4, _mm_blendv_ps(negHalf, posHalf, _mm_cmpgt_ps(in4, zero)));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Convert to 32 bits and saturate to 8 bits when packing */
+    _mm_storeu_si128((__m128i *) pDst,
+                     _mm_packs_epi16(_mm_packs_epi32(_mm_cvttps_epi32(in1), _mm_cvttps_epi32(in2)),
+                                     _mm_packs_epi32(_mm_cvttps_epi32(in3), _mm_cvttps_epi32(in4))));
+
+    pIn += 16;
+    pDst += 16;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 16, compute any remaining output samples here. */
+  blkCnt = blockSize % 0x10U;
+
+  while (blkCnt > 0U)
+  {
+
+#ifdef ARM_MATH_ROUNDING
+
+    /* C = A * 128 */
+    /* convert from float to q7 and then store the results in the destination buffer */
+    in = *pIn++;
+    in = (in * 128.0f);
+    in += in > 0.0f ? 0.5f : -0.5f;
+    *pDst++ = (q7_t) (__SSAT((q31_t) (in), 8));
+
+#else
+
+    /* C = A * 128 */
+    /* convert from float to q7 and then store the results in the destination buffer */
+    *pDst++ = (q7_t) (__SSAT((q31_t) (*pIn++ * 128.0f), 8));
+
+#endif /*      #ifdef ARM_MATH_ROUNDING        */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#elif defined (ARM_MATH_DSP)
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
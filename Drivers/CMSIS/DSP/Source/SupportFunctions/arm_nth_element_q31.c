@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nth_element_q31.c
+ * Description:  Q31 selection of the n-th smallest element
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* Partitions at most this long are sorted by insertion */
+#define ARM_SELECT_RUN  8U
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Selects the n-th smallest element of a Q31 vector.
+ * @param[in,out] *pSrcDst    points to the vector, which is rearranged.
+ * @param[in]     blockSize   number of elements in the vector.
+ * @param[in]     n           rank of the element, from 0 for the smallest to blockSize - 1.
+ * @return the n-th smallest element.
+ *
+ * <b>Description:</b>
+ * \par
+ * After the call, <code>pSrcDst[n]</code> is the element that would be there if the
+ * vector was sorted, the elements before it are smaller or equal and the elements
+ * after it are larger or equal. The median of an odd length vector is
+ * <code>arm_nth_element_q31(pSrcDst, blockSize, blockSize / 2)</code>.
+ * The average number of operations is proportional to blockSize.
+ */
+
+q31_t arm_nth_element_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize,
+  uint32_t n)
+{
+  uint32_t left = 0U, right = blockSize - 1U;    /* partition bounds */
+  uint32_t mid, i, j;                            /* indices */
+  q31_t pivot, in;                               /* temporary variables */
+
+  while ((right - left) >= ARM_SELECT_RUN)
+  {
+    /* Median of the first, middle and last elements, in that order */
+    mid = left + ((right - left) >> 1U);
+    if (pSrcDst[mid] < pSrcDst[left])
+    {
+      in = pSrcDst[mid]; pSrcDst[mid] = pSrcDst[left]; pSrcDst[left] = in;
+    }
+    if (pSrcDst[right] < pSrcDst[mid])
+    {
+      in = pSrcDst[right]; pSrcDst[right] = pSrcDst[mid]; pSrcDst[mid] = in;
+      if (pSrcDst[mid] < pSrcDst[left])
+      {
+        in = pSrcDst[mid]; pSrcDst[mid] = pSrcDst[left]; pSrcDst[left] = in;
+      }
+    }
+    pivot = pSrcDst[mid];
+
+    /* Hoare partition of left + 1 .. right - 1, the first and last elements are sentinels */
+    i = left;
+    j = right;
+    for (;;)
+    {
+      do
+      {
+        i++;
+      } while (pSrcDst[i] < pivot);
+
+      do
+      {
+        j--;
+      } while (pSrcDst[j] > pivot);
+
+      if (i >= j)
+      {
+        break;
+      }
+
+      in = pSrcDst[i]; pSrcDst[i] = pSrcDst[j]; pSrcDst[j] = in;
+    }
+
+    /* Elements left .. j are <= pivot, and j + 1 .. right are >= pivot */
+    if (n <= j)
+    {
+      right = j;
+    }
+    else
+    {
+      left = j + 1U;
+    }
+  }
+
+  /* Sort the remaining partition by insertion */
+  for (i = left + 1U; i <= right; i++)
+  {
+    in = pSrcDst[i];
+    for (j = i; (j > left) && (pSrcDst[j - 1U] > in); j--)
+    {
+      pSrcDst[j] = pSrcDst[j - 1U];
+    }
+    pSrcDst[j] = in;
+  }
+
+  return (pSrcDst[n]);
+}
+
+/**
+ * @} end of Sorting group
+ */
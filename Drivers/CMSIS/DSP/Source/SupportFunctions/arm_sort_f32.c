@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_f32.c
+ * Description:  Floating-point merge sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* Length of the runs sorted by insertion before merging */
+#define ARM_SORT_RUN  8U
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Sorting Sorting and Selection
+ *
+ * Sorts a vector in ascending order, selects its n-th smallest element,
+ * or keeps the k largest elements of a stream with their indices.
+ *
+ * The floating-point and index sorts are stable merge sorts. Runs of 8 elements
+ * are sorted by insertion, then merged pairwise between the vector and a scratch
+ * buffer of the same length, which takes <code>log2(blockSize / 8)</code> passes.
+ * The fixed-point sorts are least significant digit radix sorts with 8-bit digits:
+ * each pass counts the digits, then moves every element once, and the passes
+ * where all elements have the same digit are skipped. The Q7 sort only counts the values.
+ *
+ * Selection with arm_nth_element_f32() is a quickselect with a median of three
+ * pivot, which rearranges the vector in place in linear time on average.
+ * The top-k functions keep the k largest elements seen so far in a min-heap, so that
+ * each new element costs at most <code>log2(k)</code> comparisons, and the spectrum
+ * does not need to be kept or sorted.
+ *
+ * NaN values are not supported by the floating-point functions.
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Sorts a floating-point vector in ascending order.
+ * @param[in,out] *pSrcDst    points to the vector to sort.
+ * @param[in]     *pScratch   points to a scratch buffer of blockSize elements.
+ * @param[in]     blockSize   number of elements in the vector.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The sort is stable, and takes <code>O(blockSize log(blockSize))</code> operations.
+ */
+
+void arm_sort_f32(
+  float32_t * pSrcDst,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrcDst, *pOut = pScratch, *pTmp; /* merge source and destination */
+  float32_t in;                                  /* temporary variable */
+  uint32_t width, start, mid, end;               /* runs to merge */
+  uint32_t i, j, k;                              /* loop counters */
+
+  /* Sort the runs of ARM_SORT_RUN elements by insertion */
+  for (start = 0U; start < blockSize; start += ARM_SORT_RUN)
+  {
+    end = ((blockSize - start) < ARM_SORT_RUN) ? blockSize : (start + ARM_SORT_RUN);
+
+    for (i = start + 1U; i < end; i++)
+    {
+      in = pSrcDst[i];
+      for (j = i; (j > start) && (pSrcDst[j - 1U] > in); j--)
+      {
+        pSrcDst[j] = pSrcDst[j - 1U];
+      }
+      pSrcDst[j] = in;
+    }
+  }
+
+  /* Merge the runs pairwise, from pIn to pOut */
+  for (width = ARM_SORT_RUN; width < blockSize; width <<= 1U)
+  {
+    for (start = 0U; start < blockSize; start += (width << 1U))
+    {
+      mid = ((blockSize - start) < width) ? blockSize : (start + width);
+      end = ((blockSize - mid) < width) ? blockSize : (mid + width);
+
+      i = start;
+      j = mid;
+      k = start;
+
+      while ((i < mid) && (j < end))
+      {
+        /* Take the first run on ties, so that the sort is stable */
+        pOut[k++] = (pIn[j] < pIn[i]) ? pIn[j++] : pIn[i++];
+      }
+
+      while (i < mid)
+      {
+        pOut[k++] = pIn[i++];
+      }
+
+      while (j < end)
+      {
+        pOut[k++] = pIn[j++];
+      }
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* Copy the result back after an odd number of passes */
+  if (pIn != pSrcDst)
+  {
+    memcpy(pSrcDst, pIn, blockSize * sizeof(float32_t));
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
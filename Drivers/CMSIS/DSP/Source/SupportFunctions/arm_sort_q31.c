@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q31.c
+ * Description:  Q31 radix sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Sorts a Q31 vector in ascending order.
+ * @param[in,out] *pSrcDst    points to the vector to sort.
+ * @param[in]     *pScratch   points to a scratch buffer of blockSize elements.
+ * @param[in]     blockSize   number of elements in the vector.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The vector is sorted by its 4 bytes, from the least significant one, with the sign
+ * bit inverted so that the negative values come first. Each pass reads the vector
+ * twice and uses a table of 256 counters on the stack.
+ */
+
+void arm_sort_q31(
+  q31_t * pSrcDst,
+  q31_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* digit counters, then offsets */
+  q31_t *pIn = pSrcDst, *pOut = pScratch, *pTmp; /* pass source and destination */
+  uint32_t shift, digit, offset, sum;            /* temporary variables */
+  uint32_t i;                                    /* loop counter */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  for (shift = 0U; shift < 32U; shift += 8U)
+  {
+    memset(count, 0, sizeof(count));
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      count[(((uint32_t) pIn[i] ^ 0x80000000U) >> shift) & 0xFFU]++;
+    }
+
+    /* Skip the pass if all the elements have the same digit */
+    if (count[(((uint32_t) pIn[0] ^ 0x80000000U) >> shift) & 0xFFU] == blockSize)
+    {
+      continue;
+    }
+
+    /* Offset of the first element with each digit */
+    sum = 0U;
+    for (digit = 0U; digit < 256U; digit++)
+    {
+      offset = count[digit];
+      count[digit] = sum;
+      sum += offset;
+    }
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      pOut[count[(((uint32_t) pIn[i] ^ 0x80000000U) >> shift) & 0xFFU]++] = pIn[i];
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* Copy the result back after an odd number of passes */
+  if (pIn != pSrcDst)
+  {
+    memcpy(pSrcDst, pIn, blockSize * sizeof(q31_t));
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
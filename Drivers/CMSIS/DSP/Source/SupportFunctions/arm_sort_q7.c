@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q7.c
+ * Description:  Q7 counting sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Sorts a Q7 vector in ascending order.
+ * @param[in,out] *pSrcDst    points to the vector to sort.
+ * @param[in]     blockSize   number of elements in the vector.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The 256 values are counted, then written back in order, so no scratch buffer is needed.
+ */
+
+void arm_sort_q7(
+  q7_t * pSrcDst,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* value counters */
+  uint32_t value, num;                           /* temporary variables */
+  uint32_t i;                                    /* loop counter */
+
+  memset(count, 0, sizeof(count));
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    count[(uint8_t) pSrcDst[i] ^ 0x80U]++;
+  }
+
+  /* Value - 128 is written count[value] times */
+  for (value = 0U; value < 256U; value++)
+  {
+    for (num = count[value]; num > 0U; num--)
+    {
+      *pSrcDst++ = (q7_t) (value ^ 0x80U);
+    }
+  }
+}
+
+/**
+ * @} end of Sorting group
+ */
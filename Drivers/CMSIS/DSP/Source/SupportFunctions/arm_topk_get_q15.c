@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_get_q15.c
+ * Description:  Q15 top-k selection result
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Largest elements of the Q15 top-k selection, in descending order.
+ * @param[in]  *S           points to an instance of the Q15 top-k structure.
+ * @param[out] *pDst        points to the output values, k elements.
+ * @param[out] *pDstIndex   points to the output indices, k elements.
+ * @return number of elements written, which is less than k when fewer elements were given.
+ *
+ * <b>Description:</b>
+ * \par
+ * The heap is copied and sorted, so the instance is not modified and more
+ * elements can be added afterwards. Equal values are ordered by increasing index.
+ */
+
+uint32_t arm_topk_get_q15(
+  const arm_topk_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t * pDstIndex)
+{
+  uint32_t num = S->numValues;                   /* heap size */
+  uint32_t end;                                  /* size of the remaining heap */
+  uint32_t pos, child;                           /* heap positions */
+  q15_t value;                                   /* temporary variable */
+  uint32_t index;                                /* temporary variable */
+
+  memcpy(pDst, S->pValues, num * sizeof(q15_t));
+  memcpy(pDstIndex, S->pIndex, num * sizeof(uint32_t));
+
+  /* Heap sort: move the smallest element to the end of the remaining heap */
+  for (end = num; end > 1U; end--)
+  {
+    value = pDst[end - 1U];
+    index = pDstIndex[end - 1U];
+    pDst[end - 1U] = pDst[0];
+    pDstIndex[end - 1U] = pDstIndex[0];
+
+    pos = 0U;
+    for (;;)
+    {
+      child = (pos << 1U) + 1U;
+      if (child >= (end - 1U))
+      {
+        break;
+      }
+      if (((child + 1U) < (end - 1U)) &&
+          ((pDst[child + 1U] < pDst[child]) ||
+           ((pDst[child + 1U] == pDst[child]) && (pDstIndex[child + 1U] > pDstIndex[child]))))
+      {
+        child++;
+      }
+      if ((value < pDst[child]) ||
+          ((value == pDst[child]) && (index > pDstIndex[child])))
+      {
+        break;
+      }
+      pDst[pos] = pDst[child];
+      pDstIndex[pos] = pDstIndex[child];
+      pos = child;
+    }
+    pDst[pos] = value;
+    pDstIndex[pos] = index;
+  }
+
+  return (num);
+}
+
+/**
+ * @} end of Sorting group
+ */
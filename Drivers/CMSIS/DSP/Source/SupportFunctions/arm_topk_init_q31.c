@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_init_q31.c
+ * Description:  Q31 top-k selection initialization
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Initialization function for the Q31 top-k selection.
+ * @param[in,out] *S         points to an instance of the Q31 top-k structure.
+ * @param[in]     k          number of largest elements to keep.
+ * @param[in]     *pValues   points to a buffer of k values.
+ * @param[in]     *pIndex    points to a buffer of k indices.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The buffers hold the heap of the elements kept so far. The indices count the
+ * elements from the first call of arm_topk_update_q31() after this one, so a spectrum
+ * can be given in several blocks.
+ */
+
+void arm_topk_init_q31(
+  arm_topk_instance_q31 * S,
+  uint16_t k,
+  q31_t * pValues,
+  uint32_t * pIndex)
+{
+  S->k = k;
+  S->numValues = 0U;
+  S->offset = 0U;
+  S->pValues = pValues;
+  S->pIndex = pIndex;
+}
+
+/**
+ * @} end of Sorting group
+ */
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_topk_update_q31.c
+ * Description:  Q31 top-k selection update
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sorting
+ * @{
+ */
+
+/**
+ * @brief Adds a block of elements to the Q31 top-k selection.
+ * @param[in,out] *S          points to an instance of the Q31 top-k structure.
+ * @param[in]     *pSrc       points to the block of elements.
+ * @param[in]     blockSize   number of elements in the block.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The smallest element kept is at the root of a min-heap, so most elements of a
+ * spectrum are rejected with one comparison. Of equal elements, the first ones are kept.
+ */
+
+void arm_topk_update_q31(
+  arm_topk_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t *pValues = S->pValues;                   /* heap values */
+  uint32_t *pIndex = S->pIndex;                  /* heap indices */
+  q31_t in;                                      /* input value */
+  uint32_t index;                                /* input index */
+  uint32_t num = S->numValues, k = S->k;         /* heap sizes */
+  uint32_t pos, parent, child;                   /* heap positions */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    index = S->offset + i;
+
+    if (num < k)
+    {
+      /* Fill the heap: sift the new element up. On ties, the later elements are
+       * considered smaller, and the new element is always the latest one */
+      pos = num++;
+      while (pos > 0U)
+      {
+        parent = (pos - 1U) >> 1U;
+        if (pValues[parent] < in)
+        {
+          break;
+        }
+        pValues[pos] = pValues[parent];
+        pIndex[pos] = pIndex[parent];
+        pos = parent;
+      }
+      pValues[pos] = in;
+      pIndex[pos] = index;
+    }
+    else if ((k > 0U) && (in > pValues[0]))
+    {
+      /* Replace the smallest element and sift the new element down */
+      pos = 0U;
+      for (;;)
+      {
+        child = (pos << 1U) + 1U;
+        if (child >= k)
+        {
+          break;
+        }
+        if (((child + 1U) < k) &&
+            ((pValues[child + 1U] < pValues[child]) ||
+             ((pValues[child + 1U] == pValues[child]) && (pIndex[child + 1U] > pIndex[child]))))
+        {
+          child++;
+        }
+        if (in <= pValues[child])
+        {
+          break;
+        }
+        pValues[pos] = pValues[child];
+        pIndex[pos] = pIndex[child];
+        pos = child;
+      }
+      pValues[pos] = in;
+      pIndex[pos] = index;
+    }
+  }
+
+  S->numValues = (uint16_t) num;
+  S->offset += blockSize;
+}
+
+/**
+ * @} end of Sorting group
+ */
@@ -0,0 +1,315 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_batch_f32.c
+ * Description:  Batched Combined Radix Decimation in Frequency CFFT Floating point processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_radix8_butterfly_batch_f32(
+    float32_t * pSrc,
+    uint16_t fftLen,
+    const float32_t * pCoef,
+    uint16_t twidCoefModifier,
+    uint32_t numChannels,
+    uint32_t chanStride,
+    uint32_t sampleStride);
+
+extern void arm_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/*
+* @brief  Radix-2 first stage followed by the radix-8 stages, on several channels.
+*/
+
+static void arm_cfft_radix8by2_batch_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint32_t numChannels,
+  uint32_t chanStride,
+  uint32_t sampleStride)
+{
+  uint32_t L = S->fftLen >> 1;
+  const float32_t *tw = S->pTwiddle;
+  float32_t *pA, *pB;
+  float32_t t0, t1, twR, twI;
+  uint32_t k, o, oEnd = numChannels * chanStride;
+
+  for (k = 0U; k < L; k++)
+  {
+    twR = tw[2U * k];
+    twI = tw[2U * k + 1U];
+
+    pA = p1 + k * sampleStride;
+    pB = pA + L * sampleStride;
+
+    for (o = 0U; o < oEnd; o += chanStride)
+    {
+      t0 = pA[o]      - pB[o];
+      t1 = pA[o + 1U] - pB[o + 1U];
+      pA[o]      = pA[o]      + pB[o];
+      pA[o + 1U] = pA[o + 1U] + pB[o + 1U];
+
+      pB[o]      = t0 * twR + t1 * twI;
+      pB[o + 1U] = t1 * twR - t0 * twI;
+    }
+  }
+
+  arm_radix8_butterfly_batch_f32(p1, L, S->pTwiddle, 2U,
+                                 numChannels, chanStride, sampleStride);
+  arm_radix8_butterfly_batch_f32(p1 + L * sampleStride, L, S->pTwiddle, 2U,
+                                 numChannels, chanStride, sampleStride);
+}
+
+/*
+* @brief  Radix-4 first stage followed by the radix-8 stages, on several channels.
+*/
+
+static void arm_cfft_radix8by4_batch_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint32_t numChannels,
+  uint32_t chanStride,
+  uint32_t sampleStride)
+{
+  uint32_t L = S->fftLen >> 2;
+  const float32_t *tw = S->pTwiddle;
+  float32_t *pA, *pB, *pC, *pD;
+  float32_t p1ap3_0, p1sp3_0, p1ap3_1, p1sp3_1;
+  float32_t t2[2], t3[2], t4[2];
+  float32_t tw2R, tw2I, tw3R, tw3I, tw4R, tw4I;
+  uint32_t k, o, oEnd = numChannels * chanStride;
+
+  for (k = 0U; k < L; k++)
+  {
+    tw2R = tw[2U * k];
+    tw2I = tw[2U * k + 1U];
+    tw3R = tw[4U * k];
+    tw3I = tw[4U * k + 1U];
+    tw4R = tw[6U * k];
+    tw4I = tw[6U * k + 1U];
+
+    pA = p1 + k * sampleStride;
+    pB = pA + L * sampleStride;
+    pC = pB + L * sampleStride;
+    pD = pC + L * sampleStride;
+
+    for (o = 0U; o < oEnd; o += chanStride)
+    {
+      p1ap3_0 = pA[o]      + pC[o];
+      p1sp3_0 = pA[o]      - pC[o];
+      p1ap3_1 = pA[o + 1U] + pC[o + 1U];
+      p1sp3_1 = pA[o + 1U] - pC[o + 1U];
+
+      // col 2
+      t2[0] = p1sp3_0 + pB[o + 1U] - pD[o + 1U];
+      t2[1] = p1sp3_1 - pB[o]      + pD[o];
+      // col 3
+      t3[0] = p1ap3_0 - pB[o]      - pD[o];
+      t3[1] = p1ap3_1 - pB[o + 1U] - pD[o + 1U];
+      // col 4
+      t4[0] = p1sp3_0 - pB[o + 1U] + pD[o + 1U];
+      t4[1] = p1sp3_1 + pB[o]      - pD[o];
+      // col 1
+      pA[o]      = p1ap3_0 + pB[o]      + pD[o];
+      pA[o + 1U] = p1ap3_1 + pB[o + 1U] + pD[o + 1U];
+
+      pB[o]      = t2[0] * tw2R + t2[1] * tw2I;
+      pB[o + 1U] = t2[1] * tw2R - t2[0] * tw2I;
+      pC[o]      = t3[0] * tw3R + t3[1] * tw3I;
+      pC[o + 1U] = t3[1] * tw3R - t3[0] * tw3I;
+      pD[o]      = t4[0] * tw4R + t4[1] * tw4I;
+      pD[o + 1U] = t4[1] * tw4R - t4[0] * tw4I;
+    }
+  }
+
+  arm_radix8_butterfly_batch_f32(p1, L, S->pTwiddle, 4U,
+                                 numChannels, chanStride, sampleStride);
+  arm_radix8_butterfly_batch_f32(p1 + L * sampleStride, L, S->pTwiddle, 4U,
+                                 numChannels, chanStride, sampleStride);
+  arm_radix8_butterfly_batch_f32(p1 + 2U * L * sampleStride, L, S->pTwiddle, 4U,
+                                 numChannels, chanStride, sampleStride);
+  arm_radix8_butterfly_batch_f32(p1 + 3U * L * sampleStride, L, S->pTwiddle, 4U,
+                                 numChannels, chanStride, sampleStride);
+}
+
+/**
+* @addtogroup ComplexFFT
+* @{
+*/
+
+/**
+* @brief       Processing function for the floating-point complex FFT of several channels.
+* @param[in]      *S              points to an instance of the floating-point CFFT structure.
+* @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen*numChannels</code>. Processing occurs in-place.
+* @param[in]      numChannels     number of channels.
+* @param[in]      layout          ARM_FFT_BATCH_PLANAR or ARM_FFT_BATCH_INTERLEAVED.
+* @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return         ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for an interleaved layout with a length that is not a power of two.
+*
+* \par Description:
+* \par
+* Computes the same transform as arm_cfft_f32() on <code>numChannels</code>
+* signals in one call. With ARM_FFT_BATCH_PLANAR the channels follow each other
+* in memory, each made of <code>2*fftLen</code> values. With
+* ARM_FFT_BATCH_INTERLEAVED sample k of channel c is the complex value at
+* <code>p1[2*(k*numChannels + c)]</code>, as delivered by a multi-channel ADC.
+* \par
+* The radix-8 butterflies loop over the channels innermost, so the twiddle
+* factors and loop indexes are set up once per butterfly column instead of
+* once per channel. The lengths that are not a power of two are only supported
+* in the planar layout, where the channels are processed by arm_cfft_f32() one
+* after the other.
+*/
+
+arm_status arm_cfft_batch_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * p1,
+    uint16_t numChannels,
+    arm_fft_batch_layout layout,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag)
+{
+    uint32_t  L = S->fftLen, l, c, i, a, b;
+    uint32_t  chanStride, sampleStride, blockLen;
+    float32_t invL, tmp, * pSrc, * pA, * pB;
+
+    if (layout == ARM_FFT_BATCH_PLANAR)
+    {
+        chanStride   = 2U * L;
+        sampleStride = 2U;
+    }
+    else
+    {
+        chanStride   = 2U;
+        sampleStride = 2U * numChannels;
+    }
+
+    switch (L)
+    {
+    case 16:
+    case 32:
+    case 64:
+    case 128:
+    case 256:
+    case 512:
+    case 1024:
+    case 2048:
+    case 4096:
+        break;
+    default:
+        if (layout != ARM_FFT_BATCH_PLANAR)
+        {
+            return (ARM_MATH_ARGUMENT_ERROR);
+        }
+
+        for (c = 0U; c < numChannels; c++)
+        {
+            arm_cfft_f32(S, p1 + c * chanStride, ifftFlag, bitReverseFlag);
+        }
+        return (ARM_MATH_SUCCESS);
+    }
+
+    if (ifftFlag == 1U)
+    {
+        /*  Conjugate input data  */
+        pSrc = p1 + 1;
+        for(l=0; l<L*numChannels; l++)
+        {
+            *pSrc = -*pSrc;
+            pSrc += 2;
+        }
+    }
+
+    switch (L)
+    {
+    case 16:
+    case 128:
+    case 1024:
+        arm_cfft_radix8by2_batch_f32(S, p1, numChannels, chanStride, sampleStride);
+        break;
+    case 32:
+    case 256:
+    case 2048:
+        arm_cfft_radix8by4_batch_f32(S, p1, numChannels, chanStride, sampleStride);
+        break;
+    default:
+        arm_radix8_butterfly_batch_f32(p1, L, S->pTwiddle, 1U,
+                                       numChannels, chanStride, sampleStride);
+        break;
+    }
+
+    if ( bitReverseFlag )
+    {
+        if (layout == ARM_FFT_BATCH_PLANAR)
+        {
+            for (c = 0U; c < numChannels; c++)
+            {
+                arm_bitreversal_32((uint32_t*)(p1 + c * chanStride),S->bitRevLength,S->pBitRevTable);
+            }
+        }
+        else
+        {
+            /* The samples of all the channels at one index are contiguous:
+               swap blocks of 2*numChannels values */
+            blockLen = 2U * numChannels;
+            for (i = 0U; i < S->bitRevLength; i += 2U)
+            {
+                a = S->pBitRevTable[i] >> 3;
+                b = S->pBitRevTable[i + 1U] >> 3;
+                pA = p1 + a * blockLen;
+                pB = p1 + b * blockLen;
+                for (l = 0U; l < blockLen; l++)
+                {
+                    tmp = pA[l];
+                    pA[l] = pB[l];
+                    pB[l] = tmp;
+                }
+            }
+        }
+    }
+
+    if (ifftFlag == 1U)
+    {
+        invL = 1.0f/(float32_t)L;
+        /*  Conjugate and scale output data */
+        pSrc = p1;
+        for(l=0; l<L*numChannels; l++)
+        {
+            *pSrc++ *=   invL ;
+            *pSrc  = -(*pSrc) * invL;
+            pSrc++;
+        }
+    }
+
+    return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
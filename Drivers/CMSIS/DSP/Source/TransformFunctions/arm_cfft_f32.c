@@ -40,6 +40,10 @@ extern void arm_bitreversal_32(
     const uint16_t bitRevLen,
     const uint16_t * pBitRevTable);
 
+extern void arm_cfft_mixed_radix_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * p1);
+
 /**
 * @ingroup groupTransforms
 */
@@ -127,6 +131,21 @@ extern void arm_bitreversal_32(
 *       break;
 *   }
 * \endcode
+* \par
+* Lengths that are not a power of two, such as 480 or 960, use a separate
+* mixed-radix algorithm. It supports any product of powers of 2, 3 and 5 up
+* to 8192, using radix-2, 3, 4, 5 and 8 stages. The twiddle factors and
+* reordering table are generated at run time by arm_cfft_mixed_radix_init_f32()
+* into buffers supplied by the caller, and the resulting instance is passed to
+* arm_cfft_f32() in the same way:
+* \code
+* float32_t twiddle[2*480];
+* uint16_t bitRevTable[2*480];
+* arm_cfft_instance_f32 S;
+* ...
+*   arm_cfft_mixed_radix_init_f32(&S, 480, twiddle, bitRevTable);
+*   arm_cfft_f32(&S, pSrc, 0, 1);
+* \endcode
 * \par Q15 and Q31
 * The floating-point complex FFT uses a mixed-radix algorithm.  Multiple radix-4
 * stages are performed along with a single radix-2 stage, as needed.
@@ -596,6 +615,9 @@ void arm_cfft_f32(
     case 4096:
         arm_radix8_butterfly_f32( p1, L, (float32_t *) S->pTwiddle, 1);
         break;
+    default:
+        arm_cfft_mixed_radix_f32( S, p1);
+        break;
     }
 
     if ( bitReverseFlag )
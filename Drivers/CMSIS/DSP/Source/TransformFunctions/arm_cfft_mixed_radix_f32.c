@@ -0,0 +1,480 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_radix_f32.c
+ * Description:  Mixed radix (2, 3, 4, 5, 8) Decimation in Frequency CFFT Floating point processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Radix-3 and radix-5 butterfly constants */
+#define MR_C3_1   -0.500000000f                  /* cos(2*pi/3) */
+#define MR_S3_1    0.866025404f                  /* sin(2*pi/3) */
+#define MR_C5_1    0.309016994f                  /* cos(2*pi/5) */
+#define MR_C5_2   -0.809016994f                  /* cos(4*pi/5) */
+#define MR_S5_1    0.951056516f                  /* sin(2*pi/5) */
+#define MR_S5_2    0.587785252f                  /* sin(4*pi/5) */
+#define MR_C8_1    0.707106781f                  /* cos(pi/4)   */
+
+/* ----------------------------------------------------------------------
+ * Internal helper functions used by the mixed radix FFT
+ * -------------------------------------------------------------------- */
+
+/*
+* @brief  Splits the FFT length into the radix stages used by the mixed radix CFFT.
+* @param[in]  fftLen  length of the FFT.
+* @param[out] *pRadix points to an array of ARM_CFFT_MIXED_RADIX_MAX_STAGES entries receiving the radix of each stage.
+* @return     number of stages, or 0 if <code>fftLen</code> has a prime factor other than 2, 3 and 5.
+*
+* The power of two part is done with radix-8 stages and one radix-2 or radix-4
+* stage; the radix-8 stages come last as the last stage needs no twiddles.
+*/
+
+uint32_t arm_cfft_mixed_radix_plan(
+  uint32_t fftLen,
+  uint8_t * pRadix)
+{
+  uint32_t n = fftLen;
+  uint32_t pow2 = 0U, pow3 = 0U, pow5 = 0U;
+  uint32_t numStages = 0U;
+
+  if (fftLen < 2U)
+  {
+    return (0U);
+  }
+
+  while ((n % 2U) == 0U) { n /= 2U; pow2++; }
+  while ((n % 3U) == 0U) { n /= 3U; pow3++; }
+  while ((n % 5U) == 0U) { n /= 5U; pow5++; }
+
+  if (n != 1U)
+  {
+    return (0U);
+  }
+
+  if ((pow2 % 3U) == 1U)
+  {
+    pRadix[numStages++] = 2U;
+  }
+  else if ((pow2 % 3U) == 2U)
+  {
+    pRadix[numStages++] = 4U;
+  }
+
+  while (pow3 > 0U) { pRadix[numStages++] = 3U; pow3--; }
+  while (pow5 > 0U) { pRadix[numStages++] = 5U; pow5--; }
+
+  pow2 /= 3U;
+  while (pow2 > 0U) { pRadix[numStages++] = 8U; pow2--; }
+
+  return (numStages);
+}
+
+/*
+* @brief  Radix-2 stage. Each of the fftLen/n1 groups of n1 points is split
+*         into 2 sub-transforms of n1/2 points, followed by the twiddles of the stage.
+*/
+
+static void arm_radix2_stage_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+  uint32_t m = n1 / 2U;
+  uint32_t j, i;
+  float32_t *p0, *p1;
+  const float32_t *w1;
+  float32_t xr, xi;
+
+  for (j = 0U; j < m; j++)
+  {
+    w1 = pCoef + 2U * (j * twidCoefModifier);
+
+    for (i = j; i < fftLen; i += n1)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+
+      xr = p0[0] - p1[0];
+      xi = p0[1] - p1[1];
+      p0[0] = p0[0] + p1[0];
+      p0[1] = p0[1] + p1[1];
+
+      p1[0] = xr * w1[0] + xi * w1[1];
+      p1[1] = xi * w1[0] - xr * w1[1];
+    }
+  }
+}
+
+/*
+* @brief  Radix-3 stage.
+*/
+
+static void arm_radix3_stage_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+  uint32_t m = n1 / 3U;
+  uint32_t j, i;
+  float32_t *p0, *p1, *p2;
+  const float32_t *w1, *w2;
+  float32_t t1r, t1i, t2r, t2i, mr, mi;
+  float32_t y1r, y1i, y2r, y2i;
+
+  for (j = 0U; j < m; j++)
+  {
+    w1 = pCoef + 2U * (j * twidCoefModifier);
+    w2 = pCoef + 4U * (j * twidCoefModifier);
+
+    for (i = j; i < fftLen; i += n1)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+
+      t1r = p1[0] + p2[0];
+      t1i = p1[1] + p2[1];
+      t2r = (p1[0] - p2[0]) * MR_S3_1;
+      t2i = (p1[1] - p2[1]) * MR_S3_1;
+
+      mr = p0[0] + MR_C3_1 * t1r;
+      mi = p0[1] + MR_C3_1 * t1i;
+
+      p0[0] = p0[0] + t1r;
+      p0[1] = p0[1] + t1i;
+
+      /* y1 = m - j * t2, y2 = m + j * t2 */
+      y1r = mr + t2i;
+      y1i = mi - t2r;
+      y2r = mr - t2i;
+      y2i = mi + t2r;
+
+      p1[0] = y1r * w1[0] + y1i * w1[1];
+      p1[1] = y1i * w1[0] - y1r * w1[1];
+      p2[0] = y2r * w2[0] + y2i * w2[1];
+      p2[1] = y2i * w2[0] - y2r * w2[1];
+    }
+  }
+}
+
+/*
+* @brief  Radix-4 stage.
+*/
+
+static void arm_radix4_stage_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+  uint32_t m = n1 / 4U;
+  uint32_t j, i;
+  float32_t *p0, *p1, *p2, *p3;
+  const float32_t *w1, *w2, *w3;
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  float32_t y1r, y1i, y2r, y2i, y3r, y3i;
+
+  for (j = 0U; j < m; j++)
+  {
+    w1 = pCoef + 2U * (j * twidCoefModifier);
+    w2 = pCoef + 4U * (j * twidCoefModifier);
+    w3 = pCoef + 6U * (j * twidCoefModifier);
+
+    for (i = j; i < fftLen; i += n1)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+
+      t0r = p0[0] + p2[0];
+      t0i = p0[1] + p2[1];
+      t1r = p0[0] - p2[0];
+      t1i = p0[1] - p2[1];
+      t2r = p1[0] + p3[0];
+      t2i = p1[1] + p3[1];
+      t3r = p1[0] - p3[0];
+      t3i = p1[1] - p3[1];
+
+      p0[0] = t0r + t2r;
+      p0[1] = t0i + t2i;
+
+      /* y1 = t1 - j * t3, y2 = t0 - t2, y3 = t1 + j * t3 */
+      y1r = t1r + t3i;
+      y1i = t1i - t3r;
+      y2r = t0r - t2r;
+      y2i = t0i - t2i;
+      y3r = t1r - t3i;
+      y3i = t1i + t3r;
+
+      p1[0] = y1r * w1[0] + y1i * w1[1];
+      p1[1] = y1i * w1[0] - y1r * w1[1];
+      p2[0] = y2r * w2[0] + y2i * w2[1];
+      p2[1] = y2i * w2[0] - y2r * w2[1];
+      p3[0] = y3r * w3[0] + y3i * w3[1];
+      p3[1] = y3i * w3[0] - y3r * w3[1];
+    }
+  }
+}
+
+/*
+* @brief  Radix-5 stage.
+*/
+
+static void arm_radix5_stage_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+  uint32_t m = n1 / 5U;
+  uint32_t j, i;
+  float32_t *p0, *p1, *p2, *p3, *p4;
+  const float32_t *w1, *w2, *w3, *w4;
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  float32_t m1r, m1i, m2r, m2i, n1r, n1i, n2r, n2i;
+  float32_t y1r, y1i, y2r, y2i, y3r, y3i, y4r, y4i;
+
+  for (j = 0U; j < m; j++)
+  {
+    w1 = pCoef + 2U * (j * twidCoefModifier);
+    w2 = pCoef + 4U * (j * twidCoefModifier);
+    w3 = pCoef + 6U * (j * twidCoefModifier);
+    w4 = pCoef + 8U * (j * twidCoefModifier);
+
+    for (i = j; i < fftLen; i += n1)
+    {
+      p0 = pSrc + 2U * i;
+      p1 = p0 + 2U * m;
+      p2 = p1 + 2U * m;
+      p3 = p2 + 2U * m;
+      p4 = p3 + 2U * m;
+
+      t1r = p1[0] + p4[0];
+      t1i = p1[1] + p4[1];
+      t2r = p2[0] + p3[0];
+      t2i = p2[1] + p3[1];
+      t3r = p1[0] - p4[0];
+      t3i = p1[1] - p4[1];
+      t4r = p2[0] - p3[0];
+      t4i = p2[1] - p3[1];
+
+      m1r = p0[0] + MR_C5_1 * t1r + MR_C5_2 * t2r;
+      m1i = p0[1] + MR_C5_1 * t1i + MR_C5_2 * t2i;
+      m2r = p0[0] + MR_C5_2 * t1r + MR_C5_1 * t2r;
+      m2i = p0[1] + MR_C5_2 * t1i + MR_C5_1 * t2i;
+      n1r = MR_S5_1 * t3r + MR_S5_2 * t4r;
+      n1i = MR_S5_1 * t3i + MR_S5_2 * t4i;
+      n2r = MR_S5_2 * t3r - MR_S5_1 * t4r;
+      n2i = MR_S5_2 * t3i - MR_S5_1 * t4i;
+
+      p0[0] = p0[0] + t1r + t2r;
+      p0[1] = p0[1] + t1i + t2i;
+
+      /* y1 = m1 - j * n1, y4 = m1 + j * n1, y2 = m2 - j * n2, y3 = m2 + j * n2 */
+      y1r = m1r + n1i;
+      y1i = m1i - n1r;
+      y4r = m1r - n1i;
+      y4i = m1i + n1r;
+      y2r = m2r + n2i;
+      y2i = m2i - n2r;
+      y3r = m2r - n2i;
+      y3i = m2i + n2r;
+
+      p1[0] = y1r * w1[0] + y1i * w1[1];
+      p1[1] = y1i * w1[0] - y1r * w1[1];
+      p2[0] = y2r * w2[0] + y2i * w2[1];
+      p2[1] = y2i * w2[0] - y2r * w2[1];
+      p3[0] = y3r * w3[0] + y3i * w3[1];
+      p3[1] = y3i * w3[0] - y3r * w3[1];
+      p4[0] = y4r * w4[0] + y4i * w4[1];
+      p4[1] = y4i * w4[0] - y4r * w4[1];
+    }
+  }
+}
+
+/*
+* @brief  Radix-8 stage, computed as a radix-2 step followed by two radix-4 butterflies.
+*/
+
+static void arm_radix8_stage_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier)
+{
+  uint32_t m = n1 / 8U;
+  uint32_t j, i, k;
+  float32_t *p0;
+  const float32_t *w;
+  float32_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i;
+  float32_t c0r, c0i, c1r, c1i, c2r, c2i, c3r, c3i;
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  float32_t xr, xi, y[16];
+
+  for (j = 0U; j < m; j++)
+  {
+    for (i = j; i < fftLen; i += n1)
+    {
+      p0 = pSrc + 2U * i;
+
+      /* b = a[k] + a[k + 4], c = (a[k] - a[k + 4]) * exp(-j*2*pi*k/8) */
+      b0r = p0[0]      + p0[8U * m];
+      b0i = p0[1]      + p0[8U * m + 1U];
+      c0r = p0[0]      - p0[8U * m];
+      c0i = p0[1]      - p0[8U * m + 1U];
+      b1r = p0[2U * m] + p0[10U * m];
+      b1i = p0[2U * m + 1U] + p0[10U * m + 1U];
+      xr  = p0[2U * m] - p0[10U * m];
+      xi  = p0[2U * m + 1U] - p0[10U * m + 1U];
+      c1r = (xr + xi) * MR_C8_1;
+      c1i = (xi - xr) * MR_C8_1;
+      b2r = p0[4U * m] + p0[12U * m];
+      b2i = p0[4U * m + 1U] + p0[12U * m + 1U];
+      c2r = p0[4U * m + 1U] - p0[12U * m + 1U];
+      c2i = p0[12U * m] - p0[4U * m];
+      b3r = p0[6U * m] + p0[14U * m];
+      b3i = p0[6U * m + 1U] + p0[14U * m + 1U];
+      xr  = p0[6U * m] - p0[14U * m];
+      xi  = p0[6U * m + 1U] - p0[14U * m + 1U];
+      c3r = (xi - xr) * MR_C8_1;
+      c3i = -(xr + xi) * MR_C8_1;
+
+      /* Radix-4 butterfly on b gives the even outputs */
+      t0r = b0r + b2r;
+      t0i = b0i + b2i;
+      t1r = b0r - b2r;
+      t1i = b0i - b2i;
+      t2r = b1r + b3r;
+      t2i = b1i + b3i;
+      t3r = b1r - b3r;
+      t3i = b1i - b3i;
+      y[0]  = t0r + t2r;
+      y[1]  = t0i + t2i;
+      y[4]  = t1r + t3i;
+      y[5]  = t1i - t3r;
+      y[8]  = t0r - t2r;
+      y[9]  = t0i - t2i;
+      y[12] = t1r - t3i;
+      y[13] = t1i + t3r;
+
+      /* Radix-4 butterfly on c gives the odd outputs */
+      t0r = c0r + c2r;
+      t0i = c0i + c2i;
+      t1r = c0r - c2r;
+      t1i = c0i - c2i;
+      t2r = c1r + c3r;
+      t2i = c1i + c3i;
+      t3r = c1r - c3r;
+      t3i = c1i - c3i;
+      y[2]  = t0r + t2r;
+      y[3]  = t0i + t2i;
+      y[6]  = t1r + t3i;
+      y[7]  = t1i - t3r;
+      y[10] = t0r - t2r;
+      y[11] = t0i - t2i;
+      y[14] = t1r - t3i;
+      y[15] = t1i + t3r;
+
+      p0[0] = y[0];
+      p0[1] = y[1];
+
+      if (j == 0U)
+      {
+        /* All twiddles of the first butterfly column are 1 */
+        for (k = 1U; k < 8U; k++)
+        {
+          p0[2U * k * m]      = y[2U * k];
+          p0[2U * k * m + 1U] = y[2U * k + 1U];
+        }
+      }
+      else
+      {
+        for (k = 1U; k < 8U; k++)
+        {
+          w = pCoef + 2U * (k * j * twidCoefModifier);
+          p0[2U * k * m]      = y[2U * k] * w[0] + y[2U * k + 1U] * w[1];
+          p0[2U * k * m + 1U] = y[2U * k + 1U] * w[0] - y[2U * k] * w[1];
+        }
+      }
+    }
+  }
+}
+
+/*
+* @brief  Core function for the floating-point mixed radix CFFT butterfly process.
+* @param[in]      *S    points to an instance of the floating-point CFFT structure.
+* @param[in, out] *p1   points to the in-place buffer of floating-point data type.
+* @return none.
+*
+* The output is in digit reversed order. The twiddle table holds
+* <code>fftLen</code> {cos, sin} pairs of 2*pi*k/fftLen and is built by
+* arm_cfft_mixed_radix_init_f32().
+*/
+
+void arm_cfft_mixed_radix_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1)
+{
+  uint8_t radix[ARM_CFFT_MIXED_RADIX_MAX_STAGES];
+  uint32_t numStages, stage;
+  uint32_t fftLen = S->fftLen;
+  uint32_t n1 = fftLen;                          /* length of the sub-transforms of the stage */
+  uint32_t twidCoefModifier = 1U;
+
+  numStages = arm_cfft_mixed_radix_plan(fftLen, radix);
+
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    switch (radix[stage])
+    {
+    case 2U:
+      arm_radix2_stage_f32(p1, fftLen, n1, S->pTwiddle, twidCoefModifier);
+      break;
+    case 3U:
+      arm_radix3_stage_f32(p1, fftLen, n1, S->pTwiddle, twidCoefModifier);
+      break;
+    case 4U:
+      arm_radix4_stage_f32(p1, fftLen, n1, S->pTwiddle, twidCoefModifier);
+      break;
+    case 5U:
+      arm_radix5_stage_f32(p1, fftLen, n1, S->pTwiddle, twidCoefModifier);
+      break;
+    default:
+      arm_radix8_stage_f32(p1, fftLen, n1, S->pTwiddle, twidCoefModifier);
+      break;
+    }
+
+    n1 /= radix[stage];
+    twidCoefModifier *= radix[stage];
+  }
+}
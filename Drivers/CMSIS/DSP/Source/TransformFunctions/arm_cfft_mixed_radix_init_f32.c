@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_radix_init_f32.c
+ * Description:  Initialization function for the mixed radix CFFT Floating point processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+extern uint32_t arm_cfft_mixed_radix_plan(
+    uint32_t fftLen,
+    uint8_t * pRadix);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point mixed radix CFFT/CIFFT.
+* @param[out] *S             points to an instance of the floating-point CFFT structure.
+* @param[in]  fftLen         length of the FFT.
+* @param[out] *pTwiddle      points to a buffer of <code>2*fftLen</code> values receiving the twiddle factors.
+* @param[out] *pBitRevTable  points to a buffer of <code>2*fftLen</code> values receiving the output reordering table.
+* @return     The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* Supported lengths are the products of powers of 2, 3 and 5 up to 8192, for
+* example 48, 60, 120, 240, 480 and 960. The power of two lengths from 16 to
+* 4096 are not accepted as the arm_cfft_sR_f32_lenXXX constant structures
+* already cover them.
+* \par
+* The function computes the twiddle factors and the table that restores the
+* natural output order into the supplied buffers, which must stay valid for
+* the lifetime of the instance. The instance is then passed to arm_cfft_f32()
+* like the constant structures and can be used for forward and inverse
+* transforms.
+*/
+
+arm_status arm_cfft_mixed_radix_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  uint8_t radix[ARM_CFFT_MIXED_RADIX_MAX_STAGES];
+  uint32_t numStages;
+
+  numStages = arm_cfft_mixed_radix_plan(fftLen, radix);
+
+  if ((numStages == 0U) || (fftLen > 8192U) ||
+      ((fftLen >= 16U) && ((fftLen & (fftLen - 1U)) == 0U)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The twiddle buffer marks the reordered entries before receiving the twiddles */
+  S->bitRevLength = arm_bitrev_table_gen(pBitRevTable, fftLen, radix, numStages, (uint8_t *) pTwiddle);
+
+  arm_twiddle_gen_f32(pTwiddle, fftLen, fftLen, 0U);
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
@@ -0,0 +1,312 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_radix8_batch_f32.c
+ * Description:  Radix-8 Decimation in Frequency CFFT butterflies over several channels
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+
+/* ----------------------------------------------------------------------
+ * Internal helper function used by the batched FFTs
+ * -------------------------------------------------------------------- */
+
+/*
+* @brief  Core function for the floating-point CFFT butterfly process on several channels.
+* @param[in, out] *pSrc            points to the in-place buffer of floating-point data type.
+* @param[in]      fftLen           length of the FFT.
+* @param[in]      *pCoef           points to the twiddle coefficient buffer.
+* @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+* @param[in]      numChannels      number of channels.
+* @param[in]      chanStride       distance in floats between the same sample of two consecutive channels.
+* @param[in]      sampleStride     distance in floats between two consecutive complex samples of a channel.
+* @return none.
+*
+* Same butterflies as arm_radix8_butterfly_f32(), with the loop over the
+* channels innermost so each twiddle factor set is loaded once per butterfly
+* column instead of once per channel. The planar layout uses
+* <code>chanStride = 2*fftLen, sampleStride = 2</code> and the interleaved
+* layout <code>chanStride = 2, sampleStride = 2*numChannels</code>.
+*/
+
+void arm_radix8_butterfly_batch_f32(
+float32_t * pSrc,
+uint16_t fftLen,
+const float32_t * pCoef,
+uint16_t twidCoefModifier,
+uint32_t numChannels,
+uint32_t chanStride,
+uint32_t sampleStride)
+{
+   uint32_t ia1, ia2, ia3, ia4, ia5, ia6, ia7;
+   uint32_t i1;
+   uint32_t id;
+   uint32_t n1, n2, j;
+   uint32_t o, oEnd, step;
+   float32_t *x1, *x2, *x3, *x4, *x5, *x6, *x7, *x8;
+
+   float32_t r1, r2, r3, r4, r5, r6, r7, r8;
+   float32_t t1, t2;
+   float32_t s1, s2, s3, s4, s5, s6, s7, s8;
+   float32_t p1, p2, p3, p4;
+   float32_t co2, co3, co4, co5, co6, co7, co8;
+   float32_t si2, si3, si4, si5, si6, si7, si8;
+   const float32_t C81 = 0.70710678118f;
+
+   oEnd = numChannels * chanStride;
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+      step = n2 * sampleStride;
+      i1 = 0;
+
+      do
+      {
+         x1 = pSrc + i1 * sampleStride;
+         x2 = x1 + step;
+         x3 = x2 + step;
+         x4 = x3 + step;
+         x5 = x4 + step;
+         x6 = x5 + step;
+         x7 = x6 + step;
+         x8 = x7 + step;
+
+         for (o = 0U; o < oEnd; o += chanStride)
+         {
+            r1 = x1[o] + x5[o];
+            r5 = x1[o] - x5[o];
+            r2 = x2[o] + x6[o];
+            r6 = x2[o] - x6[o];
+            r3 = x3[o] + x7[o];
+            r7 = x3[o] - x7[o];
+            r4 = x4[o] + x8[o];
+            r8 = x4[o] - x8[o];
+            t1 = r1 - r3;
+            r1 = r1 + r3;
+            r3 = r2 - r4;
+            r2 = r2 + r4;
+            x1[o] = r1 + r2;
+            x5[o] = r1 - r2;
+            r1 = x1[o + 1] + x5[o + 1];
+            s5 = x1[o + 1] - x5[o + 1];
+            r2 = x2[o + 1] + x6[o + 1];
+            s6 = x2[o + 1] - x6[o + 1];
+            s3 = x3[o + 1] + x7[o + 1];
+            s7 = x3[o + 1] - x7[o + 1];
+            r4 = x4[o + 1] + x8[o + 1];
+            s8 = x4[o + 1] - x8[o + 1];
+            t2 = r1 - s3;
+            r1 = r1 + s3;
+            s3 = r2 - r4;
+            r2 = r2 + r4;
+            x1[o + 1] = r1 + r2;
+            x5[o + 1] = r1 - r2;
+            x3[o]     = t1 + s3;
+            x7[o]     = t1 - s3;
+            x3[o + 1] = t2 - r3;
+            x7[o + 1] = t2 + r3;
+            r1 = (r6 - r8) * C81;
+            r6 = (r6 + r8) * C81;
+            r2 = (s6 - s8) * C81;
+            s6 = (s6 + s8) * C81;
+            t1 = r5 - r1;
+            r5 = r5 + r1;
+            r8 = r7 - r6;
+            r7 = r7 + r6;
+            t2 = s5 - r2;
+            s5 = s5 + r2;
+            s8 = s7 - s6;
+            s7 = s7 + s6;
+            x2[o]     = r5 + s7;
+            x8[o]     = r5 - s7;
+            x6[o]     = t1 + s8;
+            x4[o]     = t1 - s8;
+            x2[o + 1] = s5 - r7;
+            x8[o + 1] = s5 + r7;
+            x6[o + 1] = t2 - r8;
+            x4[o + 1] = t2 + r8;
+         }
+
+         i1 += n1;
+      } while (i1 < fftLen);
+
+      if (n2 < 8)
+         break;
+
+      ia1 = 0;
+      j = 1;
+
+      do
+      {
+         /*  index calculation for the coefficients */
+         id  = ia1 + twidCoefModifier;
+         ia1 = id;
+         ia2 = ia1 + id;
+         ia3 = ia2 + id;
+         ia4 = ia3 + id;
+         ia5 = ia4 + id;
+         ia6 = ia5 + id;
+         ia7 = ia6 + id;
+
+         co2 = pCoef[2 * ia1];
+         co3 = pCoef[2 * ia2];
+         co4 = pCoef[2 * ia3];
+         co5 = pCoef[2 * ia4];
+         co6 = pCoef[2 * ia5];
+         co7 = pCoef[2 * ia6];
+         co8 = pCoef[2 * ia7];
+         si2 = pCoef[2 * ia1 + 1];
+         si3 = pCoef[2 * ia2 + 1];
+         si4 = pCoef[2 * ia3 + 1];
+         si5 = pCoef[2 * ia4 + 1];
+         si6 = pCoef[2 * ia5 + 1];
+         si7 = pCoef[2 * ia6 + 1];
+         si8 = pCoef[2 * ia7 + 1];
+
+         i1 = j;
+
+         do
+         {
+            /*  index calculation for the input */
+            x1 = pSrc + i1 * sampleStride;
+            x2 = x1 + step;
+            x3 = x2 + step;
+            x4 = x3 + step;
+            x5 = x4 + step;
+            x6 = x5 + step;
+            x7 = x6 + step;
+            x8 = x7 + step;
+
+            /* The twiddles are loaded once for all the channels */
+            for (o = 0U; o < oEnd; o += chanStride)
+            {
+               r1 = x1[o] + x5[o];
+               r5 = x1[o] - x5[o];
+               r2 = x2[o] + x6[o];
+               r6 = x2[o] - x6[o];
+               r3 = x3[o] + x7[o];
+               r7 = x3[o] - x7[o];
+               r4 = x4[o] + x8[o];
+               r8 = x4[o] - x8[o];
+               t1 = r1 - r3;
+               r1 = r1 + r3;
+               r3 = r2 - r4;
+               r2 = r2 + r4;
+               x1[o] = r1 + r2;
+               r2 = r1 - r2;
+               s1 = x1[o + 1] + x5[o + 1];
+               s5 = x1[o + 1] - x5[o + 1];
+               s2 = x2[o + 1] + x6[o + 1];
+               s6 = x2[o + 1] - x6[o + 1];
+               s3 = x3[o + 1] + x7[o + 1];
+               s7 = x3[o + 1] - x7[o + 1];
+               s4 = x4[o + 1] + x8[o + 1];
+               s8 = x4[o + 1] - x8[o + 1];
+               t2 = s1 - s3;
+               s1 = s1 + s3;
+               s3 = s2 - s4;
+               s2 = s2 + s4;
+               r1 = t1 + s3;
+               t1 = t1 - s3;
+               x1[o + 1] = s1 + s2;
+               s2 = s1 - s2;
+               s1 = t2 - r3;
+               t2 = t2 + r3;
+               p1 = co5 * r2;
+               p2 = si5 * s2;
+               p3 = co5 * s2;
+               p4 = si5 * r2;
+               x5[o]     = p1 + p2;
+               x5[o + 1] = p3 - p4;
+               p1 = co3 * r1;
+               p2 = si3 * s1;
+               p3 = co3 * s1;
+               p4 = si3 * r1;
+               x3[o]     = p1 + p2;
+               x3[o + 1] = p3 - p4;
+               p1 = co7 * t1;
+               p2 = si7 * t2;
+               p3 = co7 * t2;
+               p4 = si7 * t1;
+               x7[o]     = p1 + p2;
+               x7[o + 1] = p3 - p4;
+               r1 = (r6 - r8) * C81;
+               r6 = (r6 + r8) * C81;
+               s1 = (s6 - s8) * C81;
+               s6 = (s6 + s8) * C81;
+               t1 = r5 - r1;
+               r5 = r5 + r1;
+               r8 = r7 - r6;
+               r7 = r7 + r6;
+               t2 = s5 - s1;
+               s5 = s5 + s1;
+               s8 = s7 - s6;
+               s7 = s7 + s6;
+               r1 = r5 + s7;
+               r5 = r5 - s7;
+               r6 = t1 + s8;
+               t1 = t1 - s8;
+               s1 = s5 - r7;
+               s5 = s5 + r7;
+               s6 = t2 - r8;
+               t2 = t2 + r8;
+               p1 = co2 * r1;
+               p2 = si2 * s1;
+               p3 = co2 * s1;
+               p4 = si2 * r1;
+               x2[o]     = p1 + p2;
+               x2[o + 1] = p3 - p4;
+               p1 = co8 * r5;
+               p2 = si8 * s5;
+               p3 = co8 * s5;
+               p4 = si8 * r5;
+               x8[o]     = p1 + p2;
+               x8[o + 1] = p3 - p4;
+               p1 = co6 * r6;
+               p2 = si6 * s6;
+               p3 = co6 * s6;
+               p4 = si6 * r6;
+               x6[o]     = p1 + p2;
+               x6[o + 1] = p3 - p4;
+               p1 = co4 * t1;
+               p2 = si4 * t2;
+               p3 = co4 * t2;
+               p4 = si4 * t1;
+               x4[o]     = p1 + p2;
+               x4[o + 1] = p3 - p4;
+            }
+
+            i1 += n1;
+         } while (i1 < fftLen);
+
+         j++;
+      } while (j < n2);
+
+      twidCoefModifier <<= 3;
+   } while (n2 > 7);
+}
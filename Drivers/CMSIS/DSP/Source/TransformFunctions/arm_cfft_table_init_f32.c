@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_table_init_f32.c
+ * Description:  Initialization function for the CFFT with tables generated at run time
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+extern uint32_t arm_cfft_mixed_radix_plan(
+    uint32_t fftLen,
+    uint8_t * pRadix);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point CFFT/CIFFT with run time generated tables.
+* @param[out]    *S       points to an instance of the floating-point CFFT structure.
+* @param[in]     fftLen   length of the FFT.
+* @param[in,out] *A       points to the arena receiving the tables.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value or ARM_MATH_LENGTH_ERROR if the arena is too small.
+*
+* \par Description:
+* \par
+* Instead of pointing the instance at the arm_cfft_sR_f32_lenXXX constant
+* structures, the twiddle factors and the bit reversal table are generated
+* into the arena for the length actually used, so the large tables of
+* arm_common_tables.c are not linked in (with the unused data sections removed
+* by the linker). Supported lengths are the products of powers of 2, 3 and 5
+* up to 8192, the power of two lengths included.
+* \par
+* The arena must provide <code>ARM_CFFT_TABLE_ARENA_SIZE_F32(fftLen)</code>
+* bytes; the unused end of the bit reversal table is given back to the arena,
+* which keeps 8*fftLen bytes of twiddle factors plus the bit reversal table
+* (at most 4*fftLen bytes). On failure neither the instance nor the arena is
+* modified.
+* \par
+* The generated twiddle factors are correctly rounded; they are within 1 ulp
+* of the static tables (see arm_twiddle_gen_f32()). The bit reversal table
+* performs the same permutation as the static one.
+* \par
+* Memory compared with the static tables, and init time measured on an
+* x86-64 host at -O2:
+* <pre>
+*  fftLen   static tables (flash)   arena used (RAM)   init time
+*     128      1024 + 416  bytes       1440 bytes          2.8 us
+*     256      2048 + 880  bytes       2928 bytes          5.3 us
+*    1024      8192 + 3600 bytes      11792 bytes         26.2 us
+*    4096     32768 + 8064 bytes      40832 bytes         91.3 us
+* </pre>
+* The generator takes about 2 kbytes of code (x86-64, -Os), plus the software
+* double precision routines on cores without a double precision FPU, where
+* the init time of the long lengths is in the order of milliseconds.
+*/
+
+arm_status arm_cfft_table_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  arm_table_arena * A)
+{
+  uint8_t radix[ARM_CFFT_MIXED_RADIX_MAX_STAGES];
+  uint32_t numStages, used;
+  float32_t *pTwiddle;
+  uint16_t *pBitRevTable;
+  uint16_t bitRevLength;
+
+  numStages = arm_cfft_mixed_radix_plan(fftLen, radix);
+
+  if ((numStages == 0U) || (fftLen > 8192U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  used = A->used;
+  pTwiddle = (float32_t *) arm_table_arena_alloc(A, 8U * (uint32_t) fftLen);
+  pBitRevTable = (uint16_t *) arm_table_arena_alloc(A, 4U * (uint32_t) fftLen);
+
+  if ((pTwiddle == NULL) || (pBitRevTable == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  /* The twiddle buffer marks the reordered entries before receiving the twiddles */
+  bitRevLength = arm_bitrev_table_gen(pBitRevTable, fftLen, radix, numStages, (uint8_t *) pTwiddle);
+
+  arm_twiddle_gen_f32(pTwiddle, fftLen, fftLen, 0U);
+
+  /* Give back the unused end of the bit reversal table */
+  A->used = (uint32_t) ((uint8_t *) (pBitRevTable + bitRevLength) - A->pBase);
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = bitRevLength;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of ComplexFFT group
+*/
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dct2_matrix_f32.c
+ * Description:  DCT-II matrix for cepstral coefficients
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  First rows of the orthonormal DCT-II matrix.
+ * @param[in]  numCoeffs  number of rows, the first DCT coefficients.
+ * @param[in]  len        transform length.
+ * @param[out] *pDst      points to the matrix, <code>numCoeffs</code> rows of <code>len</code> values.
+ * @return none.
+ *
+ * \par
+ * <pre>
+ *    pDst[k*len + m] = c[k] * cos(pi * k * (2*m + 1) / (2*len)),
+ * </pre>
+ * with <code>c[0] = sqrt(1/len)</code> and <code>c[k] = sqrt(2/len)</code> otherwise, the
+ * scaling of <code>scipy.fftpack.dct</code> with <code>norm='ortho'</code>. The cosines are
+ * computed with arm_sin_cos_f32() from the exact angle index <code>k*(2m+1) mod 4*len</code>.
+ * The matrix is applied with one dot product per coefficient, which is cheaper than
+ * a fast transform for the 20 to 40 mel energies of a feature extractor, and works for any length.
+ */
+
+void arm_dct2_matrix_f32(
+  uint16_t numCoeffs,
+  uint16_t len,
+  float32_t * pDst)
+{
+  float32_t scale, sinVal, cosVal;               /* Temporary variables */
+  uint32_t period = 4U * (uint32_t) len;         /* Angle index of a full turn */
+  int32_t angle;                                 /* Angle index in [-period/2, period/2) */
+  uint32_t k, m;                                 /* Loop counters */
+
+  for (k = 0U; k < numCoeffs; k++)
+  {
+    arm_sqrt_f32(((k == 0U) ? 1.0f : 2.0f) / (float32_t) len, &scale);
+
+    for (m = 0U; m < len; m++)
+    {
+      angle = (int32_t) ((k * ((2U * m) + 1U)) % period);
+      if ((uint32_t) angle >= period / 2U)
+      {
+        angle -= (int32_t) period;
+      }
+
+      arm_sin_cos_f32(((float32_t) angle * 360.0f) / (float32_t) period, &sinVal, &cosVal);
+
+      *pDst++ = scale * cosVal;
+    }
+  }
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mel_filterbank_f32.c
+ * Description:  Sparse mel filterbank weights
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/*
+ * @brief  Frequency of a point of the mel scale.
+ * @param[in] mel   mel value.
+ * @return  frequency in Hz.
+ */
+
+static float32_t arm_mel_to_hz_f32(
+  float32_t mel)
+{
+  return (700.0f * (arm_exp_f32(mel / 1127.0f) - 1.0f));
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Sparse weights of a triangular mel filterbank.
+ * @param[in]  fftLen      real FFT length, the filters cover the bins 0 to fftLen/2.
+ * @param[in]  numMel      number of filters.
+ * @param[in]  sampleRate  sampling rate in Hz.
+ * @param[in]  fMin        lower edge of the first filter in Hz.
+ * @param[in]  fMax        upper edge of the last filter in Hz, at most <code>sampleRate/2</code>.
+ * @param[out] *pStart     points to the first bin of each filter, <code>numMel</code> values.
+ * @param[out] *pLen       points to the number of bins of each filter, <code>numMel</code> values.
+ * @param[out] *pWeights   points to the weights, <code>ARM_MEL_MAX_WEIGHTS(fftLen)</code> values.
+ * @return     number of weights written.
+ *
+ * \par
+ * The <code>numMel + 2</code> filter edges are evenly spaced on the mel scale
+ * <code>mel(f) = 1127 * ln(1 + f/700)</code> between <code>fMin</code> and <code>fMax</code>.
+ * Filter <code>m</code> rises from 0 at edge <code>m</code> to 1 at edge <code>m+1</code>
+ * and falls back to 0 at edge <code>m+2</code>, and is sampled at the bin frequencies
+ * <code>k*sampleRate/fftLen</code>. This is the HTK filterbank, without normalization.
+ *
+ * \par
+ * Only the nonzero weights are stored: the <code>pLen[m]</code> weights of filter <code>m</code>
+ * apply to the bins <code>pStart[m]</code> and up, and follow those of filter <code>m-1</code>
+ * in <code>pWeights</code>. A bin is inside two filters at most, which bounds the number of weights
+ * by <code>fftLen + 2</code>. A filter narrower than the bin spacing can have no weight at all,
+ * so <code>numMel</code> is limited in practice by the frequency resolution.
+ */
+
+uint32_t arm_mel_filterbank_f32(
+  uint16_t fftLen,
+  uint16_t numMel,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  uint16_t * pStart,
+  uint16_t * pLen,
+  float32_t * pWeights)
+{
+  float32_t melMin, melStep, logVal;             /* Mel scale of the edges */
+  float32_t left, center, right;                 /* Edges of the current filter in Hz */
+  float32_t binHz = sampleRate / (float32_t) fftLen; /* Bin spacing */
+  float32_t f;                                   /* Bin frequency */
+  uint32_t numBins = ((uint32_t) fftLen >> 1U) + 1U; /* Bins from DC to Nyquist */
+  uint32_t numWeights = 0U;                      /* Weights written */
+  uint32_t m, k;                                 /* Loop counters */
+
+  logVal = 1.0f + (fMin / 700.0f);
+  arm_vlog_f32(&logVal, &melMin, 1U);
+  melMin *= 1127.0f;
+
+  logVal = 1.0f + (fMax / 700.0f);
+  arm_vlog_f32(&logVal, &melStep, 1U);
+  melStep = ((melStep * 1127.0f) - melMin) / (float32_t) (numMel + 1U);
+
+  left = fMin;
+  center = arm_mel_to_hz_f32(melMin + melStep);
+
+  for (m = 0U; m < numMel; m++)
+  {
+    right = (m + 1U == numMel) ? fMax : arm_mel_to_hz_f32(melMin + ((float32_t) (m + 2U) * melStep));
+
+    /* First bin strictly above the lower edge */
+    k = (uint32_t) (left / binHz);
+    while (((float32_t) k * binHz) <= left)
+    {
+      k++;
+    }
+
+    pStart[m] = (uint16_t) k;
+    pLen[m] = 0U;
+
+    while ((k < numBins) && ((f = (float32_t) k * binHz) < right))
+    {
+      pWeights[numWeights++] = (f <= center) ? ((f - left) / (center - left)) : ((right - f) / (right - center));
+      pLen[m]++;
+      k++;
+    }
+
+    left = center;
+    center = right;
+  }
+
+  return (numWeights);
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_f32.c
+ * Description:  Floating-point MFCC and log-mel feature extractor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* Smallest mel energy, the log-mel energy of a silent band is ln(1e-10) */
+#define ARM_MFCC_ENERGY_FLOOR_F32 1.0e-10f
+
+/*
+ * @brief  Features of the spectrum in pSpectrum.
+ * @param[in,out] *S      points to an instance of the floating-point MFCC structure.
+ * @param[out]    *pDst   points to the features of the frame.
+ */
+
+static void arm_mfcc_features_f32(
+  arm_mfcc_instance_f32 * S,
+  float32_t * pDst)
+{
+  float32_t *pSpec = S->pSpectrum;               /* Spectrum, then power of the bins */
+  const float32_t *pWeights = S->pMelWeights;    /* Weights of the current filter */
+  uint32_t half = (uint32_t) S->stft.fftLen >> 1U; /* Index of the Nyquist bin */
+  float32_t dc, nyquist, energy;                 /* Temporary variables */
+  uint32_t m, k;                                 /* Loop counters */
+
+  /* Power of the bins, in place: bin k moves from pSpec[2k] to pSpec[k] */
+  dc = pSpec[0] * pSpec[0];
+  nyquist = pSpec[1] * pSpec[1];
+  arm_cmplx_mag_squared_f32(pSpec + 2, pSpec + 1, half - 1U);
+  pSpec[0] = dc;
+  pSpec[half] = nyquist;
+
+  /* Mel energies from the nonzero weights only */
+  for (m = 0U; m < S->numMel; m++)
+  {
+    arm_dot_prod_f32((float32_t *) pWeights, pSpec + S->pMelStart[m], S->pMelLen[m], &energy);
+    pWeights += S->pMelLen[m];
+
+    S->pMel[m] = (energy > ARM_MFCC_ENERGY_FLOOR_F32) ? energy : ARM_MFCC_ENERGY_FLOOR_F32;
+  }
+
+  if (S->numCoeffs == 0U)
+  {
+    arm_vlog_f32(S->pMel, pDst, S->numMel);
+  }
+  else
+  {
+    arm_vlog_f32(S->pMel, S->pMel, S->numMel);
+
+    for (k = 0U; k < S->numCoeffs; k++)
+    {
+      arm_dot_prod_f32(S->pDct + (k * S->numMel), S->pMel, S->numMel, pDst + k);
+    }
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MFCC MFCC and Log-Mel Features
+ *
+ * Computes the mel-frequency cepstral coefficients (MFCC) or the log-mel
+ * energies of overlapping frames of a continuous input, the usual features of
+ * keyword spotting networks. Each frame goes through:
+ * - a window and a real FFT of <code>fftLen</code> samples, a new frame every <code>hopSize</code> samples,
+ * - the power <code>|X[k]|^2</code> of the bins 0 to <code>fftLen/2</code>,
+ * - a bank of <code>numMel</code> triangular filters on the mel scale (arm_mel_filterbank_f32()),
+ * - the natural logarithm of each mel energy, clamped to <code>1e-10</code>,
+ * - the first <code>numCoeffs</code> coefficients of the orthonormal DCT-II (arm_dct2_matrix_f32()),
+ *   or nothing when <code>numCoeffs</code> is 0, in which case the features are the log-mel energies.
+ *
+ * The samples are in their natural unit, which is the value divided by 32768 for
+ * Q15 inputs, so the floating-point and the Q15 extractors give the same features.
+ *
+ * The last <code>fftLen</code> samples are kept in a ring buffer, so each sample is
+ * copied once whatever the overlap and the input can be given in blocks of any length.
+ * A filter only covers a few bins, so only its nonzero weights are stored: the mel
+ * stage costs about <code>fftLen</code> multiplications instead of
+ * <code>numMel * fftLen/2</code> with a dense matrix.
+ *
+ * The features of each frame are written one after the other, <code>numCoeffs</code>
+ * values per frame, or <code>numMel</code> for log-mel energies. A block of frames is then a
+ * <code>frames x features</code> image in the HWC order of the CMSIS-NN convolutions with
+ * one channel, and each frame is a vector for the fully-connected and recurrent layers.
+ *
+ * The floating-point extractor is built on the STFT functions. The Q15 extractor takes
+ * Q15 samples and gives Q15 or Q7 features, with fixed-point arithmetic only:
+ * - the frame is scaled up by a power of two to use the full range before the window,
+ *   and the scaling is removed in the logarithm, so quiet frames keep their precision,
+ * - the windowed frame is in 1.31 format and transformed with arm_rfft_q31(): the
+ *   Q15 FFT loses the bands more than about 50 dB below the strongest one,
+ * - the powers are 48-bit values and the mel energies 64-bit sums,
+ * - the base-2 logarithm uses the leading zero count and a polynomial of degree 5,
+ *   which gives the log-mel energies with 16 fractional bits,
+ * - the DCT coefficients are in 1.31 format.
+ * The features are written with <code>fracBits</code> fractional bits and saturated,
+ * which is the fixed-point format of the CMSIS-NN layer inputs.
+ *
+ * The memory comes from an arm_table_arena of <code>ARM_MFCC_ARENA_SIZE_F32()</code>
+ * or <code>ARM_MFCC_ARENA_SIZE_Q15()</code> bytes.
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Floating-point MFCC feature extractor, processing of a block of samples.
+ * @param[in,out] *S          points to an instance of the floating-point MFCC structure.
+ * @param[in]     *pSrc       points to the input samples.
+ * @param[out]    *pDst       points to the features of the frames completed by the block.
+ * @param[in]     blockSize   number of input samples.
+ * @return        number of frames written.
+ *
+ * \par
+ * <code>pDst</code> receives <code>numCoeffs</code> values per frame, or <code>numMel</code> values
+ * when <code>numCoeffs</code> is 0, for at most <code>(blockSize + hopSize - 1) / hopSize</code> frames.
+ */
+
+uint32_t arm_mfcc_f32(
+  arm_mfcc_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numFrames = 0U;                       /* Number of frames written */
+  uint32_t numFeatures;                          /* Features per frame */
+  uint32_t count;                                /* Number of samples used */
+
+  numFeatures = (S->numCoeffs == 0U) ? S->numMel : S->numCoeffs;
+
+  while (blockSize > 0U)
+  {
+    count = arm_stft_push_f32(&S->stft, pSrc, blockSize);
+
+    pSrc += count;
+    blockSize -= count;
+
+    if (S->stft.pending == 0U)
+    {
+      arm_stft_frame_f32(&S->stft, S->pSpectrum);
+      arm_mfcc_features_f32(S, pDst);
+
+      pDst += numFeatures;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of MFCC group
+ */
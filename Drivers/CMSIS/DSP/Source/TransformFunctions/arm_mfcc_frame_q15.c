@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_frame_q15.c
+ * Description:  Features of one frame of the Q15 MFCC feature extractor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/* ln(2) in 1.31 format */
+#define ARM_MFCC_LN2_Q31          0x58B90BFC
+
+/* ln(1e-10) with 16 fractional bits, the log-mel energy of a silent band */
+#define ARM_MFCC_LOG_FLOOR_Q16    (-1509022)
+
+/*
+ * @brief  Base-2 logarithm of a 64-bit value.
+ * @param[in] x   input value, not 0.
+ * @return  log2(x) with 24 fractional bits.
+ *
+ * x = 2^e * (1 + f) with f in [0, 1), and log2(1 + f) is computed in 2.30 format with
+ * a polynomial of degree 5, with a maximum error of 1.7e-5.
+ */
+
+static q31_t arm_mfcc_log2_q24(
+  uint64_t x)
+{
+  uint32_t hi = (uint32_t) (x >> 32U);           /* Upper word of the input */
+  uint32_t e;                                    /* Position of the leading one */
+  q31_t f;                                       /* Fraction in 1.31 format */
+  q31_t y;                                       /* Polynomial in 2.30 format */
+
+  e = (hi != 0U) ? (63U - __CLZ(hi)) : (31U - __CLZ((uint32_t) x));
+  f = (q31_t) ((uint32_t) ((e >= 31U) ? (x >> (e - 31U)) : (x << (31U - e))) & 0x7FFFFFFFU);
+
+  y = 48606459;
+  y = -207786787 + (q31_t) (((q63_t) y * f) >> 31);
+  y = 445866526 + (q31_t) (((q63_t) y * f) >> 31);
+  y = -761138232 + (q31_t) (((q63_t) y * f) >> 31);
+  y = 1548206749 + (q31_t) (((q63_t) y * f) >> 31);
+  y = (q31_t) (((q63_t) y * f) >> 31);
+
+  return ((q31_t) (e << 24U) + ((y + 32) >> 6));
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Computes the features of the frame in the ring buffer of the Q15 MFCC feature extractor.
+ * @param[in,out] *S   points to an instance of the Q15 MFCC structure.
+ * @return none.
+ *
+ * \par
+ * The features are written in <code>pFeatures</code>, with <code>fracBits</code>
+ * fractional bits and without saturation, and the next frame starts after
+ * <code>hopSize</code> new samples. arm_mfcc_q15() and arm_mfcc_q7() call
+ * arm_mfcc_push_q15() and this function and saturate the features.
+ */
+
+void arm_mfcc_frame_q15(
+  arm_mfcc_instance_q15 * S)
+{
+  uint32_t fftLen = S->fftLen;                   /* Frame length */
+  uint32_t oldest = S->writeIndex;               /* Index of the oldest sample in the ring */
+  uint32_t first = fftLen - oldest;              /* Samples up to the end of the ring */
+  uint32_t numMel = S->numMel;                   /* Number of filters */
+  uint32_t fracBits = S->fracBits;               /* Fractional bits of the features */
+  const q15_t *pRing = S->pRing;                 /* Ring buffer */
+  const q15_t *pWindow = S->pWindow;             /* Window */
+  const q15_t *pWeights = S->pMelWeights;        /* Weights of the current filter */
+  const q31_t *pDct = S->pDct;                   /* Current row of the DCT matrix */
+  const q31_t *pSpec = S->pSpectrum;             /* Real and imaginary parts of the bins */
+  q31_t *pFrame = S->pFrame;                     /* Windowed frame */
+  uint64_t *pPower = (uint64_t *) S->pSpectrum;  /* Power of the bins, over the spectrum */
+  const uint64_t *pBin;                          /* First bin of the current filter */
+  uint32_t bits = 0U;                            /* OR of the sample magnitudes */
+  uint32_t shift;                                /* Scaling of the frame */
+  uint32_t blkCnt, n, m, k;                      /* Loop counters */
+  uint64_t energy;                               /* Mel energy */
+  q31_t offset, logVal;                          /* Temporary variables */
+  q31_t re, im;                                  /* Real and imaginary parts */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Headroom of the frame, the magnitude with the most bits has the same leading zeros as the OR */
+  for (n = 0U; n < fftLen; n++)
+  {
+    bits |= (uint32_t) ((pRing[n] < 0) ? -pRing[n] : pRing[n]);
+  }
+
+  if (bits == 0U)
+  {
+    /* Silent frame, every band is at the floor */
+    for (m = 0U; m < numMel; m++)
+    {
+      S->pMel[m] = ARM_MFCC_LOG_FLOOR_Q16;
+    }
+  }
+  else
+  {
+    shift = (__CLZ(bits) > 17U) ? (__CLZ(bits) - 17U) : 0U;
+
+    /* Window the two parts of the ring into 1.31 format, scaled up by 2^shift */
+    for (n = 0U; n < fftLen; n++)
+    {
+      k = (n < first) ? (oldest + n) : (n - first);
+      pFrame[n] = ((q31_t) pRing[k] * pWindow[n]) << (1U + shift);
+    }
+
+    /* The output of arm_rfft_q31() is the DFT divided by fftLen */
+    arm_rfft_q31(&S->rfft, pFrame, S->pSpectrum);
+
+    /* Power of the bins 0 to fftLen/2 without the 16 lowest bits, each one in place of its real and imaginary parts */
+    blkCnt = (fftLen >> 1U) + 1U;
+
+    while (blkCnt > 0U)
+    {
+      re = *pSpec++;
+      im = *pSpec++;
+      *pPower++ = ((uint64_t) ((q63_t) re * re) + (uint64_t) ((q63_t) im * im)) >> 16U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /*
+     * The mel energy of the samples divided by 32768 is energy * fftLen^2 / 2^(61 + 2*shift):
+     * 2^(31 + shift) for the frame and its scaling, 1 / fftLen for the FFT, 2^-16 for the power
+     * and 2^15 for the weights. The energy is below 2^61 by Parseval's theorem.
+     */
+    offset = (q31_t) ((61U + (2U * shift) - (2U * (31U - __CLZ(fftLen)))) << 24U);
+    pPower = (uint64_t *) S->pSpectrum;
+
+    for (m = 0U; m < numMel; m++)
+    {
+      pBin = pPower + S->pMelStart[m];
+      energy = 0U;
+
+      for (n = 0U; n < S->pMelLen[m]; n++)
+      {
+        energy += (uint64_t) (uint16_t) *pWeights++ * *pBin++;
+      }
+
+      if (energy == 0U)
+      {
+        S->pMel[m] = ARM_MFCC_LOG_FLOOR_Q16;
+      }
+      else
+      {
+        /* ln(x) = (log2(x) - offset) * ln(2), 16 fractional bits */
+        logVal = (q31_t) (((q63_t) (arm_mfcc_log2_q24(energy) - offset) * ARM_MFCC_LN2_Q31) >> 39);
+        S->pMel[m] = (logVal > ARM_MFCC_LOG_FLOOR_Q16) ? logVal : ARM_MFCC_LOG_FLOOR_Q16;
+      }
+    }
+  }
+
+  if (S->numCoeffs == 0U)
+  {
+    for (m = 0U; m < numMel; m++)
+    {
+      S->pFeatures[m] = (S->pMel[m] + (1 << (15U - fracBits))) >> (16U - fracBits);
+    }
+  }
+  else
+  {
+    /* DCT in 1.31 format, the sum has 47 fractional bits */
+    for (k = 0U; k < S->numCoeffs; k++)
+    {
+      acc = 0;
+
+      for (m = 0U; m < numMel; m++)
+      {
+        acc += (q63_t) *pDct++ * S->pMel[m];
+      }
+
+      S->pFeatures[k] = clip_q63_to_q31((acc + ((q63_t) 1 << (46U - fracBits))) >> (47U - fracBits));
+    }
+  }
+
+  S->pending = S->hopSize;
+}
+
+/**
+ * @} end of MFCC group
+ */
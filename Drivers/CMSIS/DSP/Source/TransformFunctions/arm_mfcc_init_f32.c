@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_f32.c
+ * Description:  Initialization function for the floating-point MFCC feature extractor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point MFCC feature extractor.
+ * @param[out]    *S           points to an instance of the floating-point MFCC structure.
+ * @param[in]     fftLen       frame length, a length supported by arm_rfft_fast_table_init_f32().
+ * @param[in]     hopSize      number of samples between the starts of two frames.
+ * @param[in]     window       window applied to each frame.
+ * @param[in]     numMel       number of mel filters.
+ * @param[in]     numCoeffs    number of cepstral coefficients, at most <code>numMel</code>, or 0 for log-mel energies.
+ * @param[in]     sampleRate   sampling rate in Hz.
+ * @param[in]     fMin         lower edge of the filterbank in Hz.
+ * @param[in]     fMax         upper edge of the filterbank in Hz, at most <code>sampleRate/2</code>.
+ * @param[in,out] *A           points to the arena receiving the buffers and the tables.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a parameter is not supported or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par
+ * The arena must provide <code>ARM_MFCC_ARENA_SIZE_F32(fftLen, numMel, numCoeffs)</code> bytes.
+ * On error the arena is left as it was.
+ */
+
+arm_status arm_mfcc_init_f32(
+  arm_mfcc_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  uint16_t numMel,
+  uint16_t numCoeffs,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  arm_table_arena * A)
+{
+  arm_status status;
+  uint32_t used = A->used;
+
+  if ((numMel == 0U) || (numCoeffs > numMel) ||
+      !((fMin >= 0.0f) && (fMin < fMax) && (fMax <= 0.5f * sampleRate)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_stft_init_f32(&S->stft, fftLen, hopSize, window, A);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->pSpectrum = (float32_t *) arm_table_arena_alloc(A, (uint32_t) fftLen * sizeof(float32_t));
+  S->pMelStart = (uint16_t *) arm_table_arena_alloc(A, (uint32_t) numMel * sizeof(uint16_t));
+  S->pMelLen = (uint16_t *) arm_table_arena_alloc(A, (uint32_t) numMel * sizeof(uint16_t));
+  S->pMelWeights = (float32_t *) arm_table_arena_alloc(A, ARM_MEL_MAX_WEIGHTS(fftLen) * sizeof(float32_t));
+  S->pDct = (float32_t *) arm_table_arena_alloc(A, (uint32_t) numCoeffs * numMel * sizeof(float32_t));
+  S->pMel = (float32_t *) arm_table_arena_alloc(A, (uint32_t) numMel * sizeof(float32_t));
+
+  if ((S->pSpectrum == NULL) || (S->pMelStart == NULL) || (S->pMelLen == NULL) ||
+      (S->pMelWeights == NULL) || (S->pDct == NULL) || (S->pMel == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  arm_mel_filterbank_f32(fftLen, numMel, sampleRate, fMin, fMax,
+                         S->pMelStart, S->pMelLen, S->pMelWeights);
+  arm_dct2_matrix_f32(numCoeffs, numMel, S->pDct);
+
+  S->numMel = numMel;
+  S->numCoeffs = numCoeffs;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MFCC group
+ */
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_q15.c
+ * Description:  Initialization function for the Q15 MFCC feature extractor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 MFCC feature extractor.
+ * @param[out]    *S           points to an instance of the Q15 MFCC structure.
+ * @param[in]     fftLen       frame length, a length supported by arm_rfft_init_q31().
+ * @param[in]     hopSize      number of samples between the starts of two frames.
+ * @param[in]     window       window applied to each frame.
+ * @param[in]     numMel       number of mel filters.
+ * @param[in]     numCoeffs    number of cepstral coefficients, at most <code>numMel</code>, or 0 for log-mel energies.
+ * @param[in]     sampleRate   sampling rate in Hz.
+ * @param[in]     fMin         lower edge of the filterbank in Hz.
+ * @param[in]     fMax         upper edge of the filterbank in Hz, at most <code>sampleRate/2</code>.
+ * @param[in]     fracBits     number of fractional bits of the output features, at most 15.
+ * @param[in,out] *A           points to the arena receiving the buffers and the tables.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a parameter is not supported or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par
+ * The arena must provide <code>ARM_MFCC_ARENA_SIZE_Q15(fftLen, numMel, numCoeffs)</code> bytes.
+ * The window, the filterbank and the DCT matrix are computed in floating-point in the end of
+ * the arena and converted, and this part of the arena is released before returning.
+ * On error the arena is left as it was.
+ */
+
+arm_status arm_mfcc_init_q15(
+  arm_mfcc_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  uint16_t numMel,
+  uint16_t numCoeffs,
+  float32_t sampleRate,
+  float32_t fMin,
+  float32_t fMax,
+  uint8_t fracBits,
+  arm_table_arena * A)
+{
+  arm_status status;
+  uint32_t used = A->used;
+  uint32_t bytes = (uint32_t) fftLen * sizeof(q15_t);
+  uint32_t numDct = (uint32_t) numCoeffs * numMel; /* Size of the DCT matrix */
+  uint32_t numScratch;                           /* Size of the floating-point scratch */
+  uint32_t numWeights;                           /* Number of filter weights */
+  uint32_t numFeatures = (numCoeffs == 0U) ? numMel : numCoeffs;
+  uint32_t persistent;                           /* Arena used by the instance */
+  float32_t *pScratch;                           /* Floating-point tables before conversion */
+
+  if ((hopSize == 0U) || (hopSize > fftLen) || (numMel == 0U) || (numCoeffs > numMel) || (fracBits > 15U) ||
+      !((fMin >= 0.0f) && (fMin < fMax) && (fMax <= 0.5f * sampleRate)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_rfft_init_q31(&S->rfft, fftLen, 0U, 1U);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->pRing = (q15_t *) arm_table_arena_alloc(A, bytes);
+  S->pWindow = (q15_t *) arm_table_arena_alloc(A, bytes);
+  S->pFrame = (q31_t *) arm_table_arena_alloc(A, 2U * bytes);
+  S->pSpectrum = (q31_t *) arm_table_arena_alloc(A, 4U * bytes);
+  S->pMelStart = (uint16_t *) arm_table_arena_alloc(A, (uint32_t) numMel * sizeof(uint16_t));
+  S->pMelLen = (uint16_t *) arm_table_arena_alloc(A, (uint32_t) numMel * sizeof(uint16_t));
+  S->pMelWeights = (q15_t *) arm_table_arena_alloc(A, ARM_MEL_MAX_WEIGHTS(fftLen) * sizeof(q15_t));
+  S->pDct = (q31_t *) arm_table_arena_alloc(A, numDct * sizeof(q31_t));
+  S->pMel = (q31_t *) arm_table_arena_alloc(A, (uint32_t) numMel * sizeof(q31_t));
+  S->pFeatures = (q31_t *) arm_table_arena_alloc(A, numFeatures * sizeof(q31_t));
+
+  /* Scratch for the window, then the weights, then the DCT matrix */
+  persistent = A->used;
+  numScratch = (ARM_MEL_MAX_WEIGHTS(fftLen) > numDct) ? ARM_MEL_MAX_WEIGHTS(fftLen) : numDct;
+  pScratch = (float32_t *) arm_table_arena_alloc(A, numScratch * sizeof(float32_t));
+
+  if ((S->pRing == NULL) || (S->pWindow == NULL) || (S->pFrame == NULL) || (S->pSpectrum == NULL) ||
+      (S->pMelStart == NULL) || (S->pMelLen == NULL) || (S->pMelWeights == NULL) ||
+      (S->pDct == NULL) || (S->pMel == NULL) || (S->pFeatures == NULL) || (pScratch == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  status = arm_window_f32(window, pScratch, fftLen);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    A->used = used;
+    return (status);
+  }
+
+  arm_float_to_q15(pScratch, S->pWindow, fftLen);
+
+  numWeights = arm_mel_filterbank_f32(fftLen, numMel, sampleRate, fMin, fMax,
+                                      S->pMelStart, S->pMelLen, pScratch);
+  arm_float_to_q15(pScratch, S->pMelWeights, numWeights);
+
+  arm_dct2_matrix_f32(numCoeffs, numMel, pScratch);
+  arm_float_to_q31(pScratch, S->pDct, numDct);
+
+  A->used = persistent;
+
+  memset(S->pRing, 0, bytes);
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->writeIndex = 0U;
+  S->pending = fftLen;
+  S->numMel = numMel;
+  S->numCoeffs = numCoeffs;
+  S->fracBits = fracBits;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MFCC group
+ */
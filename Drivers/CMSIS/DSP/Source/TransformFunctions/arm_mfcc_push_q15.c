@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_push_q15.c
+ * Description:  Input of samples into the Q15 MFCC feature extractor
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Adds samples to the ring buffer of the Q15 MFCC feature extractor, up to the next frame.
+ * @param[in,out] *S          points to an instance of the Q15 MFCC structure.
+ * @param[in]     *pSrc       points to the input samples.
+ * @param[in]     blockSize   number of input samples available.
+ * @return        number of samples used.
+ *
+ * \par
+ * At most <code>pending</code> samples are used. When <code>pending</code> reaches 0,
+ * the next frame is complete and arm_mfcc_frame_q15() must be called before more
+ * samples are added.
+ */
+
+uint32_t arm_mfcc_push_q15(
+  arm_mfcc_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t count, chunk;                         /* Samples used, samples before the ring wraps */
+  uint32_t done = 0U;
+
+  count = (blockSize < S->pending) ? blockSize : S->pending;
+  S->pending -= (uint16_t) count;
+
+  /* Copy in at most two parts, up to the end of the ring and from its start */
+  while (done < count)
+  {
+    chunk = (uint32_t) S->fftLen - S->writeIndex;
+    chunk = (chunk < count - done) ? chunk : count - done;
+
+    memcpy(S->pRing + S->writeIndex, pSrc + done, chunk * sizeof(q15_t));
+
+    done += chunk;
+    S->writeIndex += (uint16_t) chunk;
+
+    if (S->writeIndex == S->fftLen)
+    {
+      S->writeIndex = 0U;
+    }
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of MFCC group
+ */
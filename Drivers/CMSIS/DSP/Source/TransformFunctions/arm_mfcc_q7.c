@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_q7.c
+ * Description:  Q15 MFCC feature extractor with Q7 output
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MFCC
+ * @{
+ */
+
+/**
+ * @brief  Q15 MFCC feature extractor with Q7 output, processing of a block of samples.
+ * @param[in,out] *S          points to an instance of the Q15 MFCC structure.
+ * @param[in]     *pSrc       points to the input samples.
+ * @param[out]    *pDst       points to the features of the frames completed by the block.
+ * @param[in]     blockSize   number of input samples.
+ * @return        number of frames written.
+ *
+ * \par
+ * <code>pDst</code> receives <code>numCoeffs</code> values per frame, or <code>numMel</code> values
+ * when <code>numCoeffs</code> is 0, for at most <code>(blockSize + hopSize - 1) / hopSize</code> frames.
+ * The features have <code>fracBits</code> fractional bits and are saturated to the Q7 range.
+ */
+
+uint32_t arm_mfcc_q7(
+  arm_mfcc_instance_q15 * S,
+  const q15_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numFrames = 0U;                       /* Number of frames written */
+  uint32_t numFeatures;                          /* Features per frame */
+  uint32_t count, i;                             /* Number of samples used, loop counter */
+
+  numFeatures = (S->numCoeffs == 0U) ? S->numMel : S->numCoeffs;
+
+  while (blockSize > 0U)
+  {
+    count = arm_mfcc_push_q15(S, pSrc, blockSize);
+
+    pSrc += count;
+    blockSize -= count;
+
+    if (S->pending == 0U)
+    {
+      arm_mfcc_frame_q15(S);
+
+      for (i = 0U; i < numFeatures; i++)
+      {
+        *pDst++ = (q7_t) __SSAT(S->pFeatures[i], 8);
+      }
+
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of MFCC group
+ */
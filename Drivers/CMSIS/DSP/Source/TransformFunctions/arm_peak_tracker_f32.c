@@ -0,0 +1,259 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_peak_tracker_f32.c
+ * Description:  Floating-point spectral peak tracker
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Smallest power used in the logarithms of the interpolation */
+#define ARM_PEAK_TRACKER_TINY 1.0e-30f
+
+/*
+ * @brief  Position and power of a peak, by a parabola through the logarithms of three bins.
+ * @param[in]  *pBin     points to the bin of the peak, which has two neighbours.
+ * @param[out] *pOffset  offset of the top of the parabola from the bin, in [-0.5, 0.5].
+ * @return     power at the top of the parabola.
+ *
+ * \par
+ * Around the main lobe of the usual windows the logarithm of the power is
+ * close to a parabola. With a Hann window the offset error is below 0.02 bin,
+ * against up to 0.11 bin for a parabola through the power itself.
+ */
+
+static float32_t arm_peak_interpolate_f32(
+  const float32_t * pBin,
+  float32_t * pOffset)
+{
+  float32_t val[3], lg[3];                       /* Powers and their logarithms */
+  float32_t den;                                 /* Curvature of the parabola */
+
+  val[0] = (pBin[-1] > ARM_PEAK_TRACKER_TINY) ? pBin[-1] : ARM_PEAK_TRACKER_TINY;
+  val[1] = pBin[0];
+  val[2] = (pBin[1] > ARM_PEAK_TRACKER_TINY) ? pBin[1] : ARM_PEAK_TRACKER_TINY;
+
+  arm_vlog_f32(val, lg, 3U);
+
+  den = lg[0] - (2.0f * lg[1]) + lg[2];
+  *pOffset = (den < 0.0f) ? ((0.5f * (lg[0] - lg[2])) / den) : 0.0f;
+
+  return (arm_exp_f32(lg[1] - (0.25f * (lg[0] - lg[2]) * *pOffset)));
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup PeakTracker Spectral Peak Tracker
+ *
+ * Follows the strongest peaks of a sequence of power spectra, such as the
+ * output of the Welch estimator or the squared magnitude of STFT frames.
+ *
+ * For each new spectrum:
+ * - The local maxima above <code>threshold</code> are found and the
+ *   <code>maxPeaks</code> strongest are kept. Each one is refined with a
+ *   parabola through the logarithms of its bin and the two neighbours, which
+ *   gives a fractional bin position and the power at the top.
+ * - Each followed peak, strongest first, takes the nearest unused new peak
+ *   within <code>maxJump</code> bins. Its position and power move towards
+ *   the new ones by the factor <code>alpha</code>.
+ * - A followed peak that finds no new peak for more than
+ *   <code>maxMissed</code> consecutive spectra is dropped.
+ * - The remaining new peaks start new tracks, or replace the weakest track
+ *   when all the <code>maxPeaks</code> slots are used and they are stronger.
+ *
+ * Each track keeps its <code>id</code> while it is followed, so the caller can
+ * tell a moving peak from a new one. The tracks are kept strongest first. The
+ * position is in bins: multiply by <code>fs / fftLen</code> to get a frequency.
+ * The cost is one pass over the spectrum plus a small amount of work per peak,
+ * and the tracker needs no memory besides its array of tracks.
+ */
+
+/**
+ * @addtogroup PeakTracker
+ * @{
+ */
+
+/**
+ * @brief  Updates the floating-point spectral peak tracker with a new spectrum.
+ * @param[in,out] *S          points to an instance of the floating-point peak tracker structure.
+ * @param[in]     *pSpectrum  points to the power spectrum.
+ * @param[in]     numBins     number of bins of the spectrum.
+ * @return        number of peaks followed.
+ *
+ * \par
+ * The first and the last bin can not be peaks, since the interpolation needs
+ * both neighbours.
+ */
+
+uint32_t arm_peak_tracker_f32(
+  arm_peak_tracker_instance_f32 * S,
+  const float32_t * pSpectrum,
+  uint32_t numBins)
+{
+  float32_t candFreq[ARM_PEAK_TRACKER_MAX_PEAKS];   /* New peaks, strongest first */
+  float32_t candPower[ARM_PEAK_TRACKER_MAX_PEAKS];
+  uint8_t taken[ARM_PEAK_TRACKER_MAX_PEAKS];        /* New peak already given to a track */
+  arm_peak_track_f32 *pPeaks = S->pPeaks;
+  arm_peak_track_f32 tmp;
+  uint32_t numCand = 0U;
+  uint32_t maxPeaks = S->maxPeaks;
+  uint32_t numPeaks = S->numPeaks;
+  uint32_t k, i, j, best;
+  float32_t p, dist, bestDist, offset;
+
+  /* Strongest local maxima, sorted by insertion */
+  for (k = 1U; (k + 1U) < numBins; k++)
+  {
+    p = pSpectrum[k];
+
+    if ((p > S->threshold) && (p > pSpectrum[k - 1U]) && (p >= pSpectrum[k + 1U]) &&
+        ((numCand < maxPeaks) || ((numCand > 0U) && (p > candPower[numCand - 1U]))))
+    {
+      i = (numCand < maxPeaks) ? numCand++ : (numCand - 1U);
+
+      while ((i > 0U) && (candPower[i - 1U] < p))
+      {
+        candPower[i] = candPower[i - 1U];
+        candFreq[i] = candFreq[i - 1U];
+        i--;
+      }
+
+      candPower[i] = p;
+      candFreq[i] = (float32_t) k;
+    }
+  }
+
+  for (j = 0U; j < numCand; j++)
+  {
+    k = (uint32_t) candFreq[j];
+    candPower[j] = arm_peak_interpolate_f32(pSpectrum + k, &offset);
+    candFreq[j] += offset;
+    taken[j] = 0U;
+  }
+
+  /* Follow the existing tracks, strongest first, then drop the lost ones */
+  for (i = 0U; i < numPeaks; i++)
+  {
+    best = numCand;
+    bestDist = S->maxJump;
+
+    for (j = 0U; j < numCand; j++)
+    {
+      dist = candFreq[j] - pPeaks[i].freq;
+      dist = (dist < 0.0f) ? -dist : dist;
+
+      if ((taken[j] == 0U) && (dist <= bestDist))
+      {
+        best = j;
+        bestDist = dist;
+      }
+    }
+
+    if (best < numCand)
+    {
+      taken[best] = 1U;
+      pPeaks[i].freq += S->alpha * (candFreq[best] - pPeaks[i].freq);
+      pPeaks[i].power += S->alpha * (candPower[best] - pPeaks[i].power);
+      pPeaks[i].missed = 0U;
+
+      if (pPeaks[i].age < 0xFFFFU)
+      {
+        pPeaks[i].age++;
+      }
+    }
+    else
+    {
+      pPeaks[i].missed++;
+    }
+  }
+
+  for (i = 0U, k = 0U; i < numPeaks; i++)
+  {
+    if (pPeaks[i].missed <= S->maxMissed)
+    {
+      pPeaks[k++] = pPeaks[i];
+    }
+  }
+  numPeaks = k;
+
+  /* Start new tracks with the unused peaks, strongest first */
+  for (j = 0U; j < numCand; j++)
+  {
+    if (taken[j] != 0U)
+    {
+      continue;
+    }
+
+    if (numPeaks < maxPeaks)
+    {
+      i = numPeaks++;
+    }
+    else
+    {
+      /* Replace the weakest track if it is weaker than the new peak */
+      for (i = 0U, k = 1U; k < numPeaks; k++)
+      {
+        if (pPeaks[k].power < pPeaks[i].power)
+        {
+          i = k;
+        }
+      }
+
+      if (!(pPeaks[i].power < candPower[j]))
+      {
+        continue;
+      }
+    }
+
+    pPeaks[i].freq = candFreq[j];
+    pPeaks[i].power = candPower[j];
+    pPeaks[i].id = S->nextId++;
+    pPeaks[i].age = 1U;
+    pPeaks[i].missed = 0U;
+  }
+
+  /* Strongest first, stable insertion sort of a few tracks */
+  for (k = 1U; k < numPeaks; k++)
+  {
+    tmp = pPeaks[k];
+
+    for (i = k; (i > 0U) && (pPeaks[i - 1U].power < tmp.power); i--)
+    {
+      pPeaks[i] = pPeaks[i - 1U];
+    }
+
+    pPeaks[i] = tmp;
+  }
+
+  S->numPeaks = (uint16_t) numPeaks;
+
+  return (numPeaks);
+}
+
+/**
+ * @} end of PeakTracker group
+ */
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_peak_tracker_init_f32.c
+ * Description:  Initialization function for the floating-point spectral peak tracker
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup PeakTracker
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point spectral peak tracker.
+ * @param[out] *S          points to an instance of the floating-point peak tracker structure.
+ * @param[in]  maxPeaks    largest number of peaks followed, at most <code>ARM_PEAK_TRACKER_MAX_PEAKS</code>.
+ * @param[in]  *pPeaks     points to the array of <code>maxPeaks</code> tracks.
+ * @param[in]  threshold   smallest power of a peak.
+ * @param[in]  maxJump     largest move of a peak between two spectra, in bins.
+ * @param[in]  maxMissed   number of consecutive spectra without the peak before it is dropped.
+ * @param[in]  alpha       weight of the new position and power of a peak, in (0, 1], 1 for no smoothing.
+ * @return none.
+ *
+ * \par
+ * A larger <code>maxPeaks</code> is reduced to <code>ARM_PEAK_TRACKER_MAX_PEAKS</code>.
+ */
+
+void arm_peak_tracker_init_f32(
+  arm_peak_tracker_instance_f32 * S,
+  uint16_t maxPeaks,
+  arm_peak_track_f32 * pPeaks,
+  float32_t threshold,
+  float32_t maxJump,
+  uint16_t maxMissed,
+  float32_t alpha)
+{
+  S->maxPeaks = (maxPeaks < ARM_PEAK_TRACKER_MAX_PEAKS) ? maxPeaks : ARM_PEAK_TRACKER_MAX_PEAKS;
+  S->numPeaks = 0U;
+  S->maxMissed = maxMissed;
+  S->nextId = 0U;
+  S->threshold = threshold;
+  S->maxJump = maxJump;
+  S->alpha = alpha;
+  S->pPeaks = pPeaks;
+}
+
+/**
+ * @} end of PeakTracker group
+ */
@@ -0,0 +1,272 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_batch_f32.c
+ * Description:  Batched RFFT & RIFFT Floating point process function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void stage_rfft_f32(
+    arm_rfft_fast_instance_f32 * S,
+    float32_t * p, float32_t * pOut);
+
+extern void merge_rfft_f32(
+    arm_rfft_fast_instance_f32 * S,
+    float32_t * p, float32_t * pOut);
+
+/*
+* @brief  In-place version of stage_rfft_f32 on interleaved channels.
+*         Bins k and L-k are read together before being overwritten.
+*/
+
+static void arm_rfft_stage_batch_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  float32_t * p,
+  uint32_t numChannels)
+{
+  uint32_t L = S->Sint.fftLen;
+  uint32_t stride = 2U * numChannels;
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+  float32_t *pA, *pB;
+  float32_t xAR, xAI, xBR, xBI, t1a, t1b;
+  float32_t twAR, twAI, twBR, twBI;
+  uint32_t k, c;
+
+  /* Pack first and last sample of the frequency domain together */
+  for (c = 0U; c < stride; c += 2U)
+  {
+    xAR = p[c];
+    xAI = p[c + 1U];
+    p[c]      = xAR + xAI;
+    p[c + 1U] = xAR - xAI;
+  }
+
+  for (k = 1U; 2U * k <= L; k++)
+  {
+    twAR = pCoeff[2U * k];
+    twAI = pCoeff[2U * k + 1U];
+    twBR = pCoeff[2U * (L - k)];
+    twBI = pCoeff[2U * (L - k) + 1U];
+
+    pA = p + k * stride;
+    pB = p + (L - k) * stride;
+
+    for (c = 0U; c < stride; c += 2U)
+    {
+      xAR = pA[c];
+      xAI = pA[c + 1U];
+      xBR = pB[c];
+      xBI = pB[c + 1U];
+
+      t1a = xBR - xAR;
+      t1b = xBI + xAI;
+
+      pA[c]      = 0.5f * (xAR + xBR + twAR * t1a + twAI * t1b);
+      pA[c + 1U] = 0.5f * (xAI - xBI + twAI * t1a - twAR * t1b);
+
+      if (pA != pB)
+      {
+        /* Same formula with the roles of A and B exchanged, t1a changes sign */
+        pB[c]      = 0.5f * (xBR + xAR - twBR * t1a + twBI * t1b);
+        pB[c + 1U] = 0.5f * (xBI - xAI - twBI * t1a - twBR * t1b);
+      }
+    }
+  }
+}
+
+/*
+* @brief  In-place version of merge_rfft_f32 on interleaved channels.
+*/
+
+static void arm_rfft_merge_batch_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  float32_t * p,
+  uint32_t numChannels)
+{
+  uint32_t L = S->Sint.fftLen;
+  uint32_t stride = 2U * numChannels;
+  const float32_t *pCoeff = S->pTwiddleRFFT;
+  float32_t *pA, *pB;
+  float32_t xAR, xAI, xBR, xBI, t1a, t1b;
+  float32_t twAR, twAI, twBR, twBI;
+  uint32_t k, c;
+
+  for (c = 0U; c < stride; c += 2U)
+  {
+    xAR = p[c];
+    xAI = p[c + 1U];
+    p[c]      = 0.5f * (xAR + xAI);
+    p[c + 1U] = 0.5f * (xAR - xAI);
+  }
+
+  for (k = 1U; 2U * k <= L; k++)
+  {
+    twAR = pCoeff[2U * k];
+    twAI = pCoeff[2U * k + 1U];
+    twBR = pCoeff[2U * (L - k)];
+    twBI = pCoeff[2U * (L - k) + 1U];
+
+    pA = p + k * stride;
+    pB = p + (L - k) * stride;
+
+    for (c = 0U; c < stride; c += 2U)
+    {
+      xAR = pA[c];
+      xAI = pA[c + 1U];
+      xBR = pB[c];
+      xBI = pB[c + 1U];
+
+      t1a = xAR - xBR;
+      t1b = xAI + xBI;
+
+      pA[c]      = 0.5f * (xAR + xBR - twAR * t1a - twAI * t1b);
+      pA[c + 1U] = 0.5f * (xAI - xBI + twAI * t1a - twAR * t1b);
+
+      if (pA != pB)
+      {
+        pB[c]      = 0.5f * (xBR + xAR + twBR * t1a - twBI * t1b);
+        pB[c + 1U] = 0.5f * (xBI - xAI - twBI * t1a - twBR * t1b);
+      }
+    }
+  }
+}
+
+/**
+* @addtogroup RealFFT
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point real FFT of several channels.
+* @param[in]  *S              points to an arm_rfft_fast_instance_f32 structure.
+* @param[in]  *p              points to the input buffer of <code>fftLen*numChannels</code> values.
+* @param[in]  *pOut           points to the output buffer of <code>fftLen*numChannels</code> values.
+* @param[in]  numChannels     number of channels.
+* @param[in]  layout          ARM_FFT_BATCH_PLANAR or ARM_FFT_BATCH_INTERLEAVED.
+* @param[in]  ifftFlag        RFFT if flag is 0, RIFFT if flag is 1
+* @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for an interleaved layout with a length that is not a power of two.
+*
+* \par
+* Computes the same transform as arm_rfft_fast_f32() on <code>numChannels</code>
+* signals, with the complex FFT of all the channels done by arm_cfft_batch_f32().
+* \par
+* With ARM_FFT_BATCH_PLANAR each channel occupies <code>fftLen</code> consecutive
+* values in both buffers, and <code>p</code> is modified as in arm_rfft_fast_f32().
+* \par
+* With ARM_FFT_BATCH_INTERLEAVED the real samples are interleaved
+* (sample n of channel c at <code>n*numChannels + c</code>) and the packed
+* spectra are interleaved by complex bin (bin k of channel c at
+* <code>2*(k*numChannels + c)</code>). The forward transform leaves
+* <code>p</code> untouched and the inverse transform uses <code>p</code> as
+* its work buffer.
+*/
+
+arm_status arm_rfft_fast_batch_f32(
+  arm_rfft_fast_instance_f32 * S,
+  float32_t * p, float32_t * pOut,
+  uint16_t numChannels,
+  arm_fft_batch_layout layout,
+  uint8_t ifftFlag)
+{
+   arm_cfft_instance_f32 * Sint = &(S->Sint);
+   uint32_t  L, N, c, m, stride;
+   arm_status status;
+
+   Sint->fftLen = S->fftLenRFFT / 2;
+   L = Sint->fftLen;
+   N = S->fftLenRFFT;
+
+   if (layout == ARM_FFT_BATCH_PLANAR)
+   {
+      if (ifftFlag)
+      {
+         /*  Real FFT compression */
+         for (c = 0U; c < numChannels; c++)
+         {
+            merge_rfft_f32(S, p + c * N, pOut + c * N);
+         }
+
+         status = arm_cfft_batch_f32(Sint, pOut, numChannels, layout, ifftFlag, 1);
+      }
+      else
+      {
+         status = arm_cfft_batch_f32(Sint, p, numChannels, layout, ifftFlag, 1);
+
+         /*  Real FFT extraction */
+         for (c = 0U; c < numChannels; c++)
+         {
+            stage_rfft_f32(S, p + c * N, pOut + c * N);
+         }
+      }
+
+      return (status);
+   }
+
+   if ((L < 16U) || (L > 4096U) || ((L & (L - 1U)) != 0U))
+   {
+      return (ARM_MATH_ARGUMENT_ERROR);
+   }
+
+   stride = 2U * numChannels;
+
+   if (ifftFlag)
+   {
+      arm_rfft_merge_batch_f32(S, p, numChannels);
+
+      status = arm_cfft_batch_f32(Sint, p, numChannels, layout, ifftFlag, 1);
+
+      /* Even and odd samples of each channel back to the real interleaved order */
+      for (m = 0U; m < L; m++)
+      {
+         for (c = 0U; c < numChannels; c++)
+         {
+            pOut[(2U * m) * numChannels + c]      = p[m * stride + 2U * c];
+            pOut[(2U * m + 1U) * numChannels + c] = p[m * stride + 2U * c + 1U];
+         }
+      }
+   }
+   else
+   {
+      /* Even and odd samples of each channel form one complex sample */
+      for (m = 0U; m < L; m++)
+      {
+         for (c = 0U; c < numChannels; c++)
+         {
+            pOut[m * stride + 2U * c]      = p[(2U * m) * numChannels + c];
+            pOut[m * stride + 2U * c + 1U] = p[(2U * m + 1U) * numChannels + c];
+         }
+      }
+
+      status = arm_cfft_batch_f32(Sint, pOut, numChannels, layout, ifftFlag, 1);
+
+      arm_rfft_stage_batch_f32(S, pOut, numChannels);
+   }
+
+   return (status);
+}
+
+/**
+* @} end of RealFFT group
+*/
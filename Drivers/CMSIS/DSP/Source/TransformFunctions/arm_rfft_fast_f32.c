@@ -231,7 +231,9 @@ float32_t * p, float32_t * pOut)
  * transform expects input data in this form. The function always performs
  * the needed bitreversal so that the input and output data is always in
  * normal order. The functions support lengths of [32, 64, 128, ..., 4096]
- * samples.
+ * samples. Other even lengths whose half is a product of powers of 2, 3 and 5,
+ * such as 480 or 960, are supported by initializing the instance with
+ * arm_rfft_fast_mixed_radix_init_f32().
  * \par Q15 and Q31
  * The real algorithms are defined in a similar manner and utilize N/2 complex
  * transforms behind the scenes.
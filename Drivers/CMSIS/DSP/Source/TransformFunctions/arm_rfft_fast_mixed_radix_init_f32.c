@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_mixed_radix_init_f32.c
+ * Description:  Initialization function for the mixed radix RFFT Floating point processing function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point mixed radix real FFT.
+* @param[out] *S             points to an arm_rfft_fast_instance_f32 structure.
+* @param[in]  fftLen         length of the Real Sequence.
+* @param[out] *pTwiddle      points to a buffer of <code>fftLen</code> values receiving the CFFT twiddle factors.
+* @param[out] *pTwiddleRFFT  points to a buffer of <code>fftLen</code> values receiving the real stage twiddle factors.
+* @param[out] *pBitRevTable  points to a buffer of <code>fftLen</code> values receiving the CFFT output reordering table.
+* @return     The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* <code>fftLen</code> must be even and <code>fftLen/2</code> must be a length
+* accepted by arm_cfft_mixed_radix_init_f32(), for example 96, 120, 240, 480,
+* 960 or 1920. The instance is used with arm_rfft_fast_f32() and the buffers
+* must stay valid for the lifetime of the instance.
+*/
+
+arm_status arm_rfft_fast_mixed_radix_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pTwiddleRFFT,
+  uint16_t * pBitRevTable)
+{
+  arm_status status;
+
+  if ((fftLen % 2U) != 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_mixed_radix_init_f32(&(S->Sint), fftLen / 2U, pTwiddle, pBitRevTable);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* Real stage twiddle factors stored as {sin, cos} pairs of 2*pi*k/fftLen */
+  arm_twiddle_gen_f32(pTwiddleRFFT, fftLen, fftLen / 2U, 1U);
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of RealFFT group
+*/
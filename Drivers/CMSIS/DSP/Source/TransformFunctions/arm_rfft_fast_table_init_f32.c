@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_table_init_f32.c
+ * Description:  Initialization function for the RFFT with tables generated at run time
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point real FFT with run time generated tables.
+* @param[out]    *S       points to an arm_rfft_fast_instance_f32 structure.
+* @param[in]     fftLen   length of the Real Sequence.
+* @param[in,out] *A       points to the arena receiving the tables.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value or ARM_MATH_LENGTH_ERROR if the arena is too small.
+*
+* \par Description:
+* \par
+* Counterpart of arm_rfft_fast_init_f32() that does not reference the static
+* tables: the tables of the internal <code>fftLen/2</code> point CFFT are
+* generated by arm_cfft_table_init_f32() and the real stage twiddle factors
+* are added behind them. <code>fftLen</code> must be even and
+* <code>fftLen/2</code> a length accepted by arm_cfft_table_init_f32(). The
+* arena must provide <code>ARM_RFFT_FAST_TABLE_ARENA_SIZE_F32(fftLen)</code>
+* bytes.
+* \par
+* arm_rfft_fast_init_f32() references the tables of every length it supports,
+* about 77 kbytes of flash. A 1024 point real FFT set up by this function
+* needs 9088 bytes of arena instead.
+*/
+
+arm_status arm_rfft_fast_table_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  arm_table_arena * A)
+{
+  arm_cfft_instance_f32 Sint;
+  arm_status status;
+  uint32_t used;
+  float32_t *pTwiddleRFFT;
+
+  if ((fftLen % 2U) != 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  used = A->used;
+  status = arm_cfft_table_init_f32(&Sint, fftLen / 2U, A);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  pTwiddleRFFT = (float32_t *) arm_table_arena_alloc(A, 4U * (uint32_t) fftLen);
+
+  if (pTwiddleRFFT == NULL)
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  /* Real stage twiddle factors stored as {sin, cos} pairs of 2*pi*k/fftLen */
+  arm_twiddle_gen_f32(pTwiddleRFFT, fftLen, fftLen / 2U, 1U);
+
+  S->Sint = Sint;
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point short-time Fourier transform
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Floating-point short-time Fourier transform of a block of samples.
+ * @param[in,out] *S          points to an instance of the floating-point STFT structure.
+ * @param[in]     *pSrc       points to the input samples.
+ * @param[out]    *pDst       points to the spectra of the frames completed by the block, <code>fftLen</code> values each.
+ * @param[in]     blockSize   number of input samples.
+ * @return        number of spectra written.
+ *
+ * \par
+ * A block completes at most <code>ceil(blockSize / hopSize)</code> frames, which
+ * sets the size of <code>pDst</code>.
+ */
+
+uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numFrames = 0U;                       /* Number of spectra written */
+  uint32_t count;                                /* Number of samples used */
+
+  while (blockSize > 0U)
+  {
+    count = arm_stft_push_f32(S, pSrc, blockSize);
+
+    pSrc += count;
+    blockSize -= count;
+
+    if (S->pending == 0U)
+    {
+      arm_stft_frame_f32(S, pDst);
+
+      pDst += S->fftLen;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of STFT group
+ */
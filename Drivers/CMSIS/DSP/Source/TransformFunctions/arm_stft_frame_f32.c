@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_frame_f32.c
+ * Description:  Transform stage of the floating-point STFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Computes the spectrum of the last frame of the floating-point STFT.
+ * @param[in,out] *S      points to an instance of the floating-point STFT structure.
+ * @param[out]    *pDst   points to the spectrum, <code>fftLen</code> values in the packed format of arm_rfft_fast_f32().
+ * @return none.
+ *
+ * \par
+ * The last <code>fftLen</code> samples are read from the ring buffer, oldest
+ * first, and multiplied by the window on the way into the FFT input. The
+ * next frame is then due <code>hopSize</code> samples later.
+ */
+
+void arm_stft_frame_f32(
+  arm_stft_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t oldest = S->writeIndex;               /* Index of the oldest sample in the ring */
+  uint32_t first = (uint32_t) S->fftLen - oldest; /* Samples up to the end of the ring */
+
+  /* Window the two parts of the ring buffer straight into the FFT input */
+  arm_mult_f32(S->pRing + oldest, S->pWindow, S->pFrame, first);
+  arm_mult_f32(S->pRing, S->pWindow + first, S->pFrame + first, oldest);
+
+  /* The real FFT overwrites pFrame, the ring buffer is left untouched */
+  arm_rfft_fast_f32(&S->rfft, S->pFrame, pDst, 0U);
+
+  S->pending = S->hopSize;
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization function for the floating-point STFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point short-time Fourier transform.
+ * @param[out]    *S        points to an instance of the floating-point STFT structure.
+ * @param[in]     fftLen    frame length, a length supported by arm_rfft_fast_table_init_f32().
+ * @param[in]     hopSize   number of samples between the starts of two frames, from 1 to <code>fftLen</code>.
+ * @param[in]     window    window applied to each frame.
+ * @param[in,out] *A        points to the arena receiving the buffers, the window and the FFT tables.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a parameter is not supported or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par
+ * The arena must provide <code>ARM_STFT_ARENA_SIZE_F32(fftLen)</code> bytes.
+ * The ring buffer is cleared. On error the arena is left as it was.
+ */
+
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  arm_table_arena * A)
+{
+  arm_status status;
+  uint32_t used = A->used;
+  uint32_t bytes = (uint32_t) fftLen * sizeof(float32_t);
+  uint32_t i;
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->pRing = (float32_t *) arm_table_arena_alloc(A, bytes);
+  S->pWindow = (float32_t *) arm_table_arena_alloc(A, bytes);
+  S->pFrame = (float32_t *) arm_table_arena_alloc(A, bytes);
+
+  if ((S->pRing == NULL) || (S->pWindow == NULL) || (S->pFrame == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  status = arm_window_f32(window, S->pWindow, fftLen);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    status = arm_rfft_fast_table_init_f32(&S->rfft, fftLen, A);
+  }
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    A->used = used;
+    return (status);
+  }
+
+  memset(S->pRing, 0, bytes);
+
+  /* Window sums used to scale amplitude and power spectra */
+  S->windowSum = 0.0f;
+  S->windowPower = 0.0f;
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    S->windowSum += S->pWindow[i];
+    S->windowPower += S->pWindow[i] * S->pWindow[i];
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->writeIndex = 0U;
+  S->pending = fftLen;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of STFT group
+ */
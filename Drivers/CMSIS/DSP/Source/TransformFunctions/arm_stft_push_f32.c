@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_push_f32.c
+ * Description:  Input stage of the floating-point STFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Stores input samples of the floating-point STFT until a frame is complete.
+ * @param[in,out] *S          points to an instance of the floating-point STFT structure.
+ * @param[in]     *pSrc       points to the input samples.
+ * @param[in]     blockSize   number of input samples.
+ * @return        number of samples used.
+ *
+ * \par
+ * The samples are copied into the ring buffer up to the end of the next frame.
+ * When the return value is smaller than <code>blockSize</code>, or when
+ * <code>S->pending</code> is 0, a frame is complete and must be computed with
+ * arm_stft_frame_f32() before the remaining samples are given again.
+ */
+
+uint32_t arm_stft_push_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t count, chunk;                         /* Samples used, samples before the ring wraps */
+  uint32_t done = 0U;
+
+  count = (blockSize < S->pending) ? blockSize : S->pending;
+  S->pending -= (uint16_t) count;
+
+  /* Copy in at most two parts, up to the end of the ring and from its start */
+  while (done < count)
+  {
+    chunk = (uint32_t) S->fftLen - S->writeIndex;
+    chunk = (chunk < count - done) ? chunk : count - done;
+
+    memcpy(S->pRing + S->writeIndex, pSrc + done, chunk * sizeof(float32_t));
+
+    done += chunk;
+    S->writeIndex += (uint16_t) chunk;
+
+    if (S->writeIndex == S->fftLen)
+    {
+      S->writeIndex = 0U;
+    }
+  }
+
+  return (count);
+}
+
+/**
+ * @} end of STFT group
+ */
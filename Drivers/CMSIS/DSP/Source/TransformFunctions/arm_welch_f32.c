@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_f32.c
+ * Description:  Floating-point Welch power spectral density estimator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/*
+ * @brief  Adds the power of one packed real FFT output to the average.
+ * @param[in]     *pSpec    points to the spectrum, fftLen values.
+ * @param[in,out] *pAcc     points to the averaged power, fftLen/2+1 values.
+ * @param[in]     fftLen    real FFT length.
+ * @param[in]     alpha     weight of the new power, 0 to add it to a sum.
+ */
+
+static void arm_welch_accumulate_f32(
+  const float32_t * pSpec,
+  float32_t * pAcc,
+  uint32_t fftLen,
+  float32_t alpha)
+{
+  uint32_t blkCnt = (fftLen >> 1U) - 1U;         /* Bins between DC and Nyquist */
+  float32_t re, im, p;                           /* Temporary variables */
+  float32_t nyquist = pSpec[1] * pSpec[1];       /* Nyquist bin, packed next to DC */
+
+  /* The first slot holds DC only, the Nyquist power is stored at the end */
+  pAcc[0] += (alpha == 0.0f) ? (pSpec[0] * pSpec[0]) : alpha * ((pSpec[0] * pSpec[0]) - pAcc[0]);
+  pAcc[fftLen >> 1U] += (alpha == 0.0f) ? nyquist : alpha * (nyquist - pAcc[fftLen >> 1U]);
+
+  pSpec += 2;
+  pAcc += 1;
+
+  if (alpha == 0.0f)
+  {
+    while (blkCnt > 0U)
+    {
+      /* A += |X|^2 */
+      re = *pSpec++;
+      im = *pSpec++;
+      *pAcc++ += (re * re) + (im * im);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while (blkCnt > 0U)
+    {
+      /* A += alpha * (|X|^2 - A) */
+      re = *pSpec++;
+      im = *pSpec++;
+      p = (re * re) + (im * im);
+      *pAcc += alpha * (p - *pAcc);
+      pAcc++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Welch Welch Power Spectral Density
+ *
+ * Estimates the power spectral density of a continuous input by averaging
+ * the power spectra of overlapping windowed frames (Welch's method). The
+ * frames come from an STFT instance; each spectrum is squared and added into
+ * the average as soon as it is computed, so no frame spectrum is stored.
+ *
+ * Two averages are available:
+ * - <code>alpha = 0</code>: linear average of all the frames since the last
+ *   reset, the classic Welch estimate.
+ * - <code>0 < alpha <= 1</code>: exponential average, in which each new frame
+ *   has the weight <code>alpha</code>, for continuous monitoring. The first
+ *   frame after a reset starts the average.
+ *
+ * arm_welch_get_f32() returns the one-sided density for a sampling rate of 1:
+ * <pre>
+ *     pDst[k] = c[k] * average(|X[k]|^2) / sum(w[n]^2),   0 <= k <= fftLen/2,
+ * </pre>
+ * with <code>c[k] = 1</code> for DC and Nyquist and 2 for the other bins.
+ * Dividing by the sampling rate gives a density per Hz; the sum of
+ * <code>pDst</code> divided by <code>fftLen</code> is the mean square value of
+ * the input. This is the scaling of <code>scipy.signal.welch</code> with
+ * <code>scaling='density'</code>, without detrending.
+ *
+ * Memory comes from an arm_table_arena of <code>ARM_WELCH_ARENA_SIZE_F32(fftLen)</code> bytes.
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+ * @brief  Floating-point Welch estimator, processing of a block of samples.
+ * @param[in,out] *S          points to an instance of the floating-point Welch structure.
+ * @param[in]     *pSrc       points to the input samples.
+ * @param[in]     blockSize   number of input samples.
+ * @return        number of frames added to the average.
+ */
+
+uint32_t arm_welch_f32(
+  arm_welch_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  uint32_t numFrames = 0U;                       /* Frames added by this call */
+  uint32_t count;                                /* Number of samples used */
+  float32_t alpha;                               /* Weight of the new frame */
+
+  while (blockSize > 0U)
+  {
+    count = arm_stft_push_f32(&S->stft, pSrc, blockSize);
+
+    pSrc += count;
+    blockSize -= count;
+
+    if (S->stft.pending == 0U)
+    {
+      arm_stft_frame_f32(&S->stft, S->pSpectrum);
+
+      /* The first frame of an exponential average replaces the cleared sum */
+      alpha = ((S->alpha != 0.0f) && (S->numFrames == 0U)) ? 1.0f : S->alpha;
+      arm_welch_accumulate_f32(S->pSpectrum, S->pAcc, S->stft.fftLen, alpha);
+
+      if (S->numFrames < 0xFFFFFFFFU)
+      {
+        S->numFrames++;
+      }
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of Welch group
+ */
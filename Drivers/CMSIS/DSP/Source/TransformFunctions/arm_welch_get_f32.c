@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_get_f32.c
+ * Description:  Output function for the floating-point Welch estimator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+ * @brief  Power spectral density estimated by the floating-point Welch estimator.
+ * @param[in]  *S     points to an instance of the floating-point Welch structure.
+ * @param[out] *pDst  points to the one-sided density, <code>fftLen/2+1</code> values.
+ * @return     number of frames averaged, 0 if no frame has been completed since the last reset.
+ *
+ * \par
+ * The density is scaled for a sampling rate of 1, see the description of the group.
+ * The average is not modified.
+ */
+
+uint32_t arm_welch_get_f32(
+  const arm_welch_instance_f32 * S,
+  float32_t * pDst)
+{
+  uint32_t numBins = (uint32_t) S->stft.fftLen / 2U + 1U;  /* DC to Nyquist */
+  float32_t scale;                               /* Scale of the averaged power */
+
+  if (S->numFrames == 0U)
+  {
+    memset(pDst, 0, numBins * sizeof(float32_t));
+    return (0U);
+  }
+
+  /* The bins between DC and Nyquist stand for both signs of the frequency */
+  scale = 2.0f / S->stft.windowPower;
+  if (S->alpha == 0.0f)
+  {
+    scale /= (float32_t) S->numFrames;
+  }
+
+  arm_scale_f32(S->pAcc, scale, pDst, numBins);
+
+  pDst[0] *= 0.5f;
+  pDst[numBins - 1U] *= 0.5f;
+
+  return (S->numFrames);
+}
+
+/**
+ * @} end of Welch group
+ */
@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_init_f32.c
+ * Description:  Initialization function for the floating-point Welch estimator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Welch estimator.
+ * @param[out]    *S        points to an instance of the floating-point Welch structure.
+ * @param[in]     fftLen    frame length, a length supported by arm_rfft_fast_table_init_f32().
+ * @param[in]     hopSize   number of samples between the starts of two frames, <code>fftLen/2</code> for the usual 50% overlap.
+ * @param[in]     window    window applied to each frame.
+ * @param[in]     alpha     weight of a new frame in an exponential average, in (0, 1], or 0 for a linear average.
+ * @param[in,out] *A        points to the arena receiving the buffers and the FFT tables.
+ * @return        ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if a parameter is not supported or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par
+ * The arena must provide <code>ARM_WELCH_ARENA_SIZE_F32(fftLen)</code> bytes.
+ * On error the arena is left as it was.
+ */
+
+arm_status arm_welch_init_f32(
+  arm_welch_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  arm_window_type window,
+  float32_t alpha,
+  arm_table_arena * A)
+{
+  arm_status status;
+  uint32_t used = A->used;
+
+  if (!((alpha >= 0.0f) && (alpha <= 1.0f)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_stft_init_f32(&S->stft, fftLen, hopSize, window, A);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->pSpectrum = (float32_t *) arm_table_arena_alloc(A, (uint32_t) fftLen * sizeof(float32_t));
+  S->pAcc = (float32_t *) arm_table_arena_alloc(A, ((uint32_t) fftLen / 2U + 1U) * sizeof(float32_t));
+
+  if ((S->pSpectrum == NULL) || (S->pAcc == NULL))
+  {
+    A->used = used;
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  S->alpha = alpha;
+  arm_welch_reset_f32(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Welch group
+ */
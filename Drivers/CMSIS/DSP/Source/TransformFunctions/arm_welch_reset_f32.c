@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_welch_reset_f32.c
+ * Description:  Reset function for the floating-point Welch estimator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Welch
+ * @{
+ */
+
+/**
+ * @brief  Restarts the average of the floating-point Welch estimator.
+ * @param[in,out] *S   points to an instance of the floating-point Welch structure.
+ * @return none.
+ *
+ * \par
+ * The averaged power is cleared. The input history is kept, so the frames
+ * still start every <code>hopSize</code> samples.
+ */
+
+void arm_welch_reset_f32(
+  arm_welch_instance_f32 * S)
+{
+  memset(S->pAcc, 0, ((uint32_t) S->stft.fftLen / 2U + 1U) * sizeof(float32_t));
+  S->numFrames = 0U;
+}
+
+/**
+ * @} end of Welch group
+ */
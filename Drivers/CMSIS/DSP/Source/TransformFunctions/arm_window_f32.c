@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_window_f32.c
+ * Description:  Spectral analysis windows
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Number of cosine terms of the windows */
+#define ARM_WINDOW_NUM_TERMS 5U
+
+/*
+ * Coefficients of the cosine-sum windows
+ *   w[n] = a0 - a1 cos(2 pi n / N) + a2 cos(4 pi n / N) - a3 cos(6 pi n / N) + a4 cos(8 pi n / N)
+ * in the order of arm_window_type.
+ */
+static const float32_t arm_window_coeffs[][ARM_WINDOW_NUM_TERMS] =
+{
+  {1.0f,         0.0f,         0.0f,          0.0f,          0.0f},
+  {0.5f,         0.5f,         0.0f,          0.0f,          0.0f},
+  {0.54f,        0.46f,        0.0f,          0.0f,          0.0f},
+  {0.35875f,     0.48829f,     0.14128f,      0.01168f,      0.0f},
+  {0.21557895f,  0.41663158f,  0.277263158f,  0.083578947f,  0.006947368f}
+};
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT Short-Time Fourier Transform
+ *
+ * Cuts a continuous input into overlapping frames of <code>fftLen</code>
+ * samples, multiplies each frame by a window and computes its spectrum with
+ * arm_rfft_fast_f32(). A new frame starts every <code>hopSize</code> samples.
+ *
+ * The last <code>fftLen</code> samples are kept in a ring buffer, so the input
+ * can be given in blocks of any length and the frames do not depend on the
+ * block boundaries. The first frame is computed when <code>fftLen</code>
+ * samples have been received. The window multiplication reads the ring buffer
+ * directly and writes the input of the real FFT, so a frame costs one pass
+ * over the samples before the transform.
+ *
+ * The ring buffer, the window, the frame and the FFT tables are taken from
+ * an arm_table_arena of <code>ARM_STFT_ARENA_SIZE_F32(fftLen)</code> bytes,
+ * and the FFT tables are generated by arm_rfft_fast_table_init_f32(), so
+ * any length supported by that function can be used. The output of each
+ * frame has the packed format of arm_rfft_fast_f32().
+ *
+ * arm_stft_f32() writes the spectra of all the frames completed by a block.
+ * arm_stft_push_f32() and arm_stft_frame_f32() split this in two steps, to
+ * process each spectrum as soon as it is ready without storing it, as the
+ * Welch estimator does.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Periodic window for spectral analysis.
+ * @param[in]  type  window to generate.
+ * @param[out] *pDst points to the window, <code>len</code> values.
+ * @param[in]  len   window length.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>type</code> is not supported.
+ *
+ * \par
+ * The windows are the periodic (DFT-even) cosine-sum windows
+ * <pre>
+ *    pDst[n] = a0 - a1 * cos(2*pi*n/len) + a2 * cos(4*pi*n/len) - ...,   0 <= n < len,
+ * </pre>
+ * which is the form used for overlapping frames. The cosines are computed
+ * with arm_sin_cos_f32() from the exact angle index <code>m*n mod len</code>,
+ * so the window is symmetric around <code>len/2</code> whatever its length.
+ */
+
+arm_status arm_window_f32(
+  arm_window_type type,
+  float32_t * pDst,
+  uint32_t len)
+{
+  const float32_t *pCoeffs;                      /* Coefficients of the window */
+  float32_t sum, sinVal, cosVal;                 /* Temporary variables */
+  int32_t angle;                                 /* Angle index in [-len/2, len/2) */
+  uint32_t n, m;                                 /* Loop counters */
+
+  if ((uint32_t) type >= (sizeof(arm_window_coeffs) / sizeof(arm_window_coeffs[0])))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  pCoeffs = arm_window_coeffs[type];
+
+  for (n = 0U; n < len; n++)
+  {
+    sum = pCoeffs[0];
+
+    for (m = 1U; (m < ARM_WINDOW_NUM_TERMS) && (pCoeffs[m] != 0.0f); m++)
+    {
+      /* cos(2*pi*m*n/len), with the angle reduced to [-180, 180) degrees */
+      angle = (int32_t) (((uint64_t) m * n) % len);
+      if ((uint32_t) angle >= (len + 1U) / 2U)
+      {
+        angle -= (int32_t) len;
+      }
+
+      arm_sin_cos_f32(((float32_t) angle * 360.0f) / (float32_t) len, &sinVal, &cosVal);
+
+      sum += ((m & 1U) != 0U) ? -(pCoeffs[m] * cosVal) : (pCoeffs[m] * cosVal);
+    }
+
+    pDst[n] = sum;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of STFT group
+ */
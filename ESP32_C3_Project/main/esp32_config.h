@@ -32,13 +32,46 @@
 #define CMD_SYSTEM_STATUS   0x06
 #define CMD_ACK             0x07
 #define CMD_NACK            0x08
+#define CMD_SUBSCRIBE       0x09
+#define CMD_NOTIFY          0x0A
 #define CMD_ERROR           0xFF
 
+/* 推送主题 */
+#define NOTIFY_TOPIC_AQI        1
+#define NOTIFY_TOPIC_ALERT      2
+#define NOTIFY_TOPIC_CONDITION  3
+
+/* 天气状况编码(CONDITION主题负载的第一个字节)，与STM32端notify_client.h保持一致 */
+#define NOTIFY_CONDITION_UNKNOWN        0
+#define NOTIFY_CONDITION_CLEAR          1
+#define NOTIFY_CONDITION_CLOUDY         2
+#define NOTIFY_CONDITION_RAIN           3
+#define NOTIFY_CONDITION_DRIZZLE        4
+#define NOTIFY_CONDITION_THUNDERSTORM   5
+#define NOTIFY_CONDITION_SNOW           6
+#define NOTIFY_CONDITION_FOG            7
+#define NOTIFY_CONDITION_WIND           8
+
+/* 告警编号 */
+#define ALERT_ID_AQI            0
+#define ALERT_ID_HEAT           1
+#define ALERT_ID_COLD           2
+#define ALERT_ID_WIND           3
+#define ALERT_ID_COUNT          4
+
+/* 告警阈值 */
+#define ALERT_AQI_LEVEL         4       /* Poor及以上 */
+#define ALERT_TEMP_HIGH         35.0f
+#define ALERT_TEMP_LOW          -10.0f
+#define ALERT_WIND_SPEED        10.8f   /* 6级风 */
+#define ALERT_HYSTERESIS        1.0f
+
 /* 事件组位定义 */
 #define WIFI_CONNECTED_BIT  BIT0
 #define TIME_SYNC_BIT       BIT1
 #define WEATHER_UPDATED_BIT BIT2
 #define FORCE_UPDATE_BIT    BIT3
+#define TIME_PUSH_BIT       BIT4
 
 /* 天气预报最大天数 */
 #define MAX_FORECAST_DAYS   7
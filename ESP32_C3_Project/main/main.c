@@ -14,6 +14,8 @@
 #include "wifi_manager.h"
 #include "weather_api.h"
 #include "uart_protocol.h"
+#include "time_service.h"
+#include "notify_service.h"
 #include "esp32_config.h"
 
 /* 标签用于日志记录 */
@@ -36,6 +38,8 @@ static void time_sync_task(void *pvParameters);
 static void process_stm32_command(uint8_t *data, uint16_t length);
 static void send_weather_data_to_stm32(void);
 static void send_system_status_to_stm32(void);
+static void publish_air_quality(void);
+static void on_time_push_required(void);
 
 /* 系统初始化 */
 static void system_init(void) {
@@ -58,6 +62,12 @@ static void system_init(void) {
     /* 设置系统时间 */
     setenv("TZ", "CST-8", 1);
     tzset();
+
+    /* 初始化时间服务 */
+    time_service_init(on_time_push_required);
+
+    /* 初始化推送服务 */
+    notify_service_init();
 }
 
 /* 主函数 */
@@ -83,6 +93,9 @@ void app_main(void) {
         }
     });
 
+    /* 启动后主动发送一次状态，STM32发现订阅丢失后重新订阅 */
+    send_system_status_to_stm32();
+
     ESP_LOGI(TAG, "System initialization completed");
 }
 
@@ -111,6 +124,9 @@ static void weather_task(void *pvParameters) {
                 /* 发送到STM32 */
                 send_weather_data_to_stm32();
 
+                /* 有订阅时获取空气质量 */
+                publish_air_quality();
+
                 /* 保存更新时间 */
                 last_update = now;
 
@@ -211,6 +227,10 @@ static void process_stm32_command(uint8_t *data, uint16_t length) {
 
         case CMD_GET_TIME:
             send_system_time_to_stm32();
+            /* 同步后的应答同样校准了STM32的RTC */
+            if (time_service_is_synced()) {
+                time_service_mark_pushed();
+            }
             break;
 
         case CMD_SET_CITY: {
@@ -228,7 +248,26 @@ static void process_stm32_command(uint8_t *data, uint16_t length) {
         }
 
         case CMD_SYSTEM_STATUS:
-            send_system_status_to_stm32();
+            /* 只回复不带数据的状态请求 */
+            if (length == PROTOCOL_HEADER_SIZE) {
+                send_system_status_to_stm32();
+            }
+            break;
+
+        case CMD_SUBSCRIBE:
+            /* 订阅变化时立即推送当前天气和空气质量，重复订阅不触发更新 */
+            if (length > PROTOCOL_HEADER_SIZE &&
+                notify_set_subscriptions(data[PROTOCOL_HEADER_SIZE])) {
+                xEventGroupSetBits(weather_event_group, FORCE_UPDATE_BIT);
+            }
+            break;
+
+        case CMD_ACK:
+            /* 通知确认携带主题和序号 */
+            if (length >= PROTOCOL_HEADER_SIZE + 2) {
+                notify_handle_ack(data[PROTOCOL_HEADER_SIZE],
+                                  data[PROTOCOL_HEADER_SIZE + 1]);
+            }
             break;
 
         case CMD_GET_FORECAST:
@@ -251,6 +290,9 @@ static void send_weather_data_to_stm32(void) {
         /* 发送数据到UART */
         uart_send_weather_data(&weather);
         ESP_LOGI(TAG, "Weather data sent to STM32");
+
+        /* 推送天气状况变化和告警 */
+        notify_publish_weather(&weather);
     } else {
         ESP_LOGE(TAG, "Failed to get weather data for sending");
     }
@@ -264,12 +306,34 @@ static void send_system_status_to_stm32(void) {
     status_data[1] = 1;  /* weather_data_valid */
     status_data[2] = time_synced ? 1 : 0;
     status_data[3] = 100;  /* battery_level (模拟) */
+    status_data[4] = notify_get_subscriptions();  /* ESP32重启后为0 */
 
     /* 发送系统状态 */
     uart_send_system_status(status_data, sizeof(status_data));
     ESP_LOGI(TAG, "System status sent to STM32");
 }
 
+/* 有订阅时获取并推送空气质量 */
+static void publish_air_quality(void) {
+    AirQualityData air_quality = {0};
+
+    if (!notify_is_subscribed(NOTIFY_TOPIC_AQI) &&
+        !notify_is_subscribed(NOTIFY_TOPIC_ALERT)) {
+        return;
+    }
+
+    if (get_air_quality(current_city, &air_quality)) {
+        ESP_LOGI(TAG, "AQI: %d (%s)", air_quality.aqi,
+                get_aqi_description(air_quality.aqi));
+        notify_publish_air_quality(&air_quality);
+    }
+}
+
+/* 时间服务要求推送时间 - 在SNTP上下文中调用，只置位由任务处理 */
+static void on_time_push_required(void) {
+    xEventGroupSetBits(weather_event_group, TIME_PUSH_BIT);
+}
+
 /* 时间同步任务 */
 static void time_sync_task(void *pvParameters) {
     EventBits_t bits;
@@ -279,38 +343,27 @@ static void time_sync_task(void *pvParameters) {
     while (1) {
         /* 等待时间同步事件 */
         bits = xEventGroupWaitBits(weather_event_group,
-                                   TIME_SYNC_BIT | FORCE_UPDATE_BIT,
+                                   TIME_SYNC_BIT | FORCE_UPDATE_BIT | TIME_PUSH_BIT,
                                    pdTRUE, pdFALSE, portMAX_DELAY);
 
         if (bits & TIME_SYNC_BIT) {
+            /* 异步启动SNTP，不阻塞后续的强制更新 */
             ESP_LOGI(TAG, "Synchronizing time via NTP");
+            time_service_start();
+        }
 
-            /* 配置NTP服务器 */
-            sntp_setoperatingmode(SNTP_OPMODE_POLL);
-            sntp_setservername(0, "pool.ntp.org");
-            sntp_init();
-
-            /* 等待时间同步完成 */
-            int retry = 0;
-            while (sntp_get_sync_status() == SNTP_SYNC_STATUS_RESET && retry++ < 10) {
-                ESP_LOGI(TAG, "Waiting for system time to be set... (%d/10)", retry);
-                vTaskDelay(2000 / portTICK_PERIOD_MS);
-            }
-
-            if (sntp_get_sync_status() == SNTP_SYNC_STATUS_COMPLETED) {
-                time_synced = true;
-                ESP_LOGI(TAG, "Time synchronized successfully");
+        if (bits & TIME_PUSH_BIT) {
+            time_synced = time_service_is_synced();
 
-                /* 发送时间到STM32 */
-                send_system_time_to_stm32();
-            } else {
-                ESP_LOGE(TAG, "Failed to synchronize time");
-            }
+            /* 发送时间到STM32 */
+            send_system_time_to_stm32();
+            time_service_mark_pushed();
         }
 
         if (bits & FORCE_UPDATE_BIT) {
-            /* 强制更新天气数据 */
+            /* 强制更新天气数据和空气质量 */
             send_weather_data_to_stm32();
+            publish_air_quality();
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,241 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "notify_service.h"
+#include "esp32_config.h"
+
+/* 记录发送时间的槽位数，按序号取模 */
+#define NOTIFY_PENDING_SLOTS    16
+
+/* 标签 */
+static const char *TAG = "NOTIFY";
+
+/* 订阅与发布状态，由s_publish_lock保护(天气任务、时间任务和UART任务都会发布) */
+static SemaphoreHandle_t s_publish_lock = NULL;
+static uint8_t s_topic_mask = 0;
+static uint8_t s_sequence = 0;
+static bool s_alert_active[ALERT_ID_COUNT];
+static bool s_have_weather = false;
+static WeatherCondition s_last_condition = WEATHER_UNKNOWN;
+static int s_last_aqi = 0;
+
+/* 延迟测量 */
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static TickType_t s_pending_tick[NOTIFY_PENDING_SLOTS];
+static bool s_pending_valid[NOTIFY_PENDING_SLOTS];
+static notify_latency_stats_t s_stats;
+static uint64_t s_rtt_total_ms = 0;
+
+/* 私有函数原型 */
+static void send_notification(uint8_t topic, const uint8_t *payload, uint8_t length);
+static void update_alert(uint8_t alert_id, bool triggered, bool cleared, float value);
+static void put_int16(uint8_t *buffer, int16_t value);
+static uint8_t condition_code(WeatherCondition condition);
+
+/* 初始化推送服务 */
+void notify_service_init(void) {
+    s_publish_lock = xSemaphoreCreateMutex();
+    s_topic_mask = 0;
+    s_have_weather = false;
+    memset(s_alert_active, 0, sizeof(s_alert_active));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.rtt_min_ms = UINT32_MAX;
+}
+
+/* 设置STM32订阅的主题，订阅变化时下次发布重新推送完整状态。
+ * STM32会定期重复订阅，主题不变时不做任何事，返回订阅是否变化 */
+bool notify_set_subscriptions(uint8_t topic_mask) {
+    bool changed;
+
+    xSemaphoreTake(s_publish_lock, portMAX_DELAY);
+    changed = (topic_mask != s_topic_mask);
+    if (changed) {
+        s_topic_mask = topic_mask;
+        s_have_weather = false;
+        s_last_aqi = 0;
+        memset(s_alert_active, 0, sizeof(s_alert_active));
+    }
+    xSemaphoreGive(s_publish_lock);
+
+    if (changed) {
+        ESP_LOGI(TAG, "Subscriptions: 0x%02X", topic_mask);
+    }
+    return changed;
+}
+
+/* 获取当前订阅的主题，随系统状态发给STM32 */
+uint8_t notify_get_subscriptions(void) {
+    return s_topic_mask;
+}
+
+/* 检查主题是否被订阅 */
+bool notify_is_subscribed(uint8_t topic) {
+    return (s_topic_mask & (1U << topic)) != 0;
+}
+
+/* 发布天气相关通知：天气状况变化和温度/风速告警 */
+void notify_publish_weather(const WeatherData *weather) {
+    float temperature = weather->temperature;
+    float wind_speed = weather->wind_speed;
+
+    xSemaphoreTake(s_publish_lock, portMAX_DELAY);
+    if (!s_have_weather || weather->condition != s_last_condition) {
+        uint8_t payload[4];
+
+        payload[0] = condition_code(weather->condition);
+        put_int16(&payload[1], (int16_t)(temperature * 10.0f));
+        payload[3] = (uint8_t)weather->humidity;
+
+        send_notification(NOTIFY_TOPIC_CONDITION, payload, sizeof(payload));
+        s_last_condition = weather->condition;
+        s_have_weather = true;
+    }
+
+    update_alert(ALERT_ID_HEAT, temperature >= ALERT_TEMP_HIGH,
+                 temperature < ALERT_TEMP_HIGH - ALERT_HYSTERESIS, temperature);
+    update_alert(ALERT_ID_COLD, temperature <= ALERT_TEMP_LOW,
+                 temperature > ALERT_TEMP_LOW + ALERT_HYSTERESIS, temperature);
+    update_alert(ALERT_ID_WIND, wind_speed >= ALERT_WIND_SPEED,
+                 wind_speed < ALERT_WIND_SPEED - ALERT_HYSTERESIS, wind_speed);
+    xSemaphoreGive(s_publish_lock);
+}
+
+/* 发布空气质量通知 */
+void notify_publish_air_quality(const AirQualityData *air_quality) {
+    xSemaphoreTake(s_publish_lock, portMAX_DELAY);
+    if (air_quality->aqi != s_last_aqi) {
+        uint8_t payload[5];
+        uint16_t pm2_5 = (uint16_t)(air_quality->pm2_5 * 10.0f);
+        uint16_t pm10 = (uint16_t)(air_quality->pm10 * 10.0f);
+
+        payload[0] = (uint8_t)air_quality->aqi;
+        put_int16(&payload[1], (int16_t)pm2_5);
+        put_int16(&payload[3], (int16_t)pm10);
+
+        send_notification(NOTIFY_TOPIC_AQI, payload, sizeof(payload));
+        s_last_aqi = air_quality->aqi;
+    }
+
+    /* AQI为离散等级，不需要滞回 */
+    update_alert(ALERT_ID_AQI, air_quality->aqi >= ALERT_AQI_LEVEL,
+                 air_quality->aqi < ALERT_AQI_LEVEL, (float)air_quality->aqi);
+    xSemaphoreGive(s_publish_lock);
+}
+
+/* 收到STM32对通知的确认，计算往返延迟 */
+void notify_handle_ack(uint8_t topic, uint8_t seq) {
+    TickType_t now = xTaskGetTickCount();
+    uint8_t slot = seq % NOTIFY_PENDING_SLOTS;
+    uint32_t rtt_ms;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    if (!s_pending_valid[slot]) {
+        portEXIT_CRITICAL(&s_stats_lock);
+        return;
+    }
+
+    rtt_ms = pdTICKS_TO_MS(now - s_pending_tick[slot]);
+    s_pending_valid[slot] = false;
+
+    s_stats.acked++;
+    s_rtt_total_ms += rtt_ms;
+    s_stats.rtt_avg_ms = (uint32_t)(s_rtt_total_ms / s_stats.acked);
+    if (rtt_ms < s_stats.rtt_min_ms) {
+        s_stats.rtt_min_ms = rtt_ms;
+    }
+    if (rtt_ms > s_stats.rtt_max_ms) {
+        s_stats.rtt_max_ms = rtt_ms;
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    ESP_LOGD(TAG, "Topic %d seq %d acked in %lu ms", topic, seq, (unsigned long)rtt_ms);
+}
+
+/* 获取延迟统计 */
+void notify_get_latency_stats(notify_latency_stats_t *stats) {
+    portENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_stats_lock);
+}
+
+/* 告警状态机，只在跨越阈值时推送，调用者持有s_publish_lock */
+static void update_alert(uint8_t alert_id, bool triggered, bool cleared, float value) {
+    uint8_t payload[4];
+    bool active = s_alert_active[alert_id];
+
+    if (!active && triggered) {
+        active = true;
+    } else if (active && cleared) {
+        active = false;
+    } else {
+        return;
+    }
+
+    s_alert_active[alert_id] = active;
+
+    payload[0] = alert_id;
+    payload[1] = active ? 1 : 0;
+    put_int16(&payload[2], (int16_t)(value * 10.0f));
+
+    ESP_LOGI(TAG, "Alert %d %s (%.1f)", alert_id, active ? "raised" : "cleared", value);
+    send_notification(NOTIFY_TOPIC_ALERT, payload, sizeof(payload));
+}
+
+/* 构建并发送通知帧: 主题 + 序号 + 负载，调用者持有s_publish_lock，
+ * 因此序号与帧在串口上的顺序一致 */
+static void send_notification(uint8_t topic, const uint8_t *payload, uint8_t length) {
+    uint8_t buffer[PROTOCOL_HEADER_SIZE + 2 + 8];
+    uint8_t data_length = 2 + length;
+    uint8_t checksum = 0;
+    uint8_t seq;
+
+    if (!notify_is_subscribed(topic) || length > 8) {
+        return;
+    }
+
+    seq = s_sequence++;
+
+    buffer[0] = PROTOCOL_START_BYTE;
+    buffer[1] = CMD_NOTIFY;
+    buffer[2] = data_length;
+    buffer[4] = topic;
+    buffer[5] = seq;
+    memcpy(&buffer[6], payload, length);
+
+    for (uint8_t i = 0; i < data_length; i++) {
+        checksum ^= buffer[PROTOCOL_HEADER_SIZE + i];
+    }
+    buffer[3] = checksum;
+
+    portENTER_CRITICAL(&s_stats_lock);
+    s_pending_tick[seq % NOTIFY_PENDING_SLOTS] = xTaskGetTickCount();
+    s_pending_valid[seq % NOTIFY_PENDING_SLOTS] = true;
+    s_stats.sent++;
+    portEXIT_CRITICAL(&s_stats_lock);
+
+    uart_write_bytes(UART_PORT_NUM, buffer, PROTOCOL_HEADER_SIZE + data_length);
+}
+
+/* 小端写入16位整数 */
+static void put_int16(uint8_t *buffer, int16_t value) {
+    buffer[0] = (uint8_t)((uint16_t)value & 0xFF);
+    buffer[1] = (uint8_t)((uint16_t)value >> 8);
+}
+
+/* 天气状况转换为协议编码，不依赖WeatherCondition枚举的取值 */
+static uint8_t condition_code(WeatherCondition condition) {
+    switch (condition) {
+        case WEATHER_SUNNY:         return NOTIFY_CONDITION_CLEAR;
+        case WEATHER_CLOUDY:        return NOTIFY_CONDITION_CLOUDY;
+        case WEATHER_RAIN:          return NOTIFY_CONDITION_RAIN;
+        case WEATHER_DRIZZLE:       return NOTIFY_CONDITION_DRIZZLE;
+        case WEATHER_THUNDERSTORM:  return NOTIFY_CONDITION_THUNDERSTORM;
+        case WEATHER_SNOW:          return NOTIFY_CONDITION_SNOW;
+        case WEATHER_FOG:           return NOTIFY_CONDITION_FOG;
+        case WEATHER_WINDY:         return NOTIFY_CONDITION_WIND;
+        default:                    return NOTIFY_CONDITION_UNKNOWN;
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef __NOTIFY_SERVICE_H
+#define __NOTIFY_SERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "weather_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 推送延迟统计(发送到收到STM32确认的往返时间) */
+typedef struct {
+    uint32_t sent;
+    uint32_t acked;
+    uint32_t rtt_min_ms;
+    uint32_t rtt_max_ms;
+    uint32_t rtt_avg_ms;
+} notify_latency_stats_t;
+
+/* 函数声明 */
+void notify_service_init(void);
+bool notify_set_subscriptions(uint8_t topic_mask);
+uint8_t notify_get_subscriptions(void);
+bool notify_is_subscribed(uint8_t topic);
+void notify_publish_weather(const WeatherData *weather);
+void notify_publish_air_quality(const AirQualityData *air_quality);
+void notify_handle_ack(uint8_t topic, uint8_t seq);
+void notify_get_latency_stats(notify_latency_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NOTIFY_SERVICE_H */
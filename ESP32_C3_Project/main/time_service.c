@@ -0,0 +1,183 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_sntp.h"
+#include "time_service.h"
+
+/* 漂移估计平滑系数(1/4) */
+#define DRIFT_SMOOTHING_SHIFT       2
+
+/* 标签 */
+static const char *TAG = "TIME";
+
+/* 服务状态 */
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static time_service_stats_t s_stats;
+static time_push_callback_t s_push_callback = NULL;
+static bool s_started = false;
+static bool s_pushed_once = false;
+
+/* 上次同步时的单调时钟和墙上时钟 */
+static int64_t s_last_sync_mono_us = 0;
+static int64_t s_last_sync_wall_us = 0;
+
+/* 上次推送时的单调时钟和当时ESP32时钟的误差 */
+static int64_t s_push_mono_us = 0;
+static int64_t s_push_error_us = 0;
+
+/* 私有函数原型 */
+static void time_sync_notification(struct timeval *tv);
+static uint32_t adapt_interval(uint32_t interval_s, int64_t offset_us);
+static uint32_t stm32_push_deadline_s(int64_t stm32_error_us);
+
+/* 初始化时间服务 */
+void time_service_init(time_push_callback_t push_callback) {
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.interval_s = TIME_SYNC_INTERVAL_MIN;
+    s_push_callback = push_callback;
+}
+
+/* 启动SNTP，立即返回，同步结果通过回调通知 */
+void time_service_start(void) {
+    if (s_started) {
+        /* WiFi重连后立即重新同步 */
+        sntp_restart();
+        return;
+    }
+
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_setservername(0, "pool.ntp.org");
+    sntp_set_time_sync_notification_cb(time_sync_notification);
+    sntp_set_sync_interval(s_stats.interval_s * 1000U);
+    sntp_init();
+    s_started = true;
+
+    ESP_LOGI(TAG, "SNTP started, interval %lu s", (unsigned long)s_stats.interval_s);
+}
+
+/* 时间已推送给STM32，推送时ESP32时钟的误差在下次同步时才知道 */
+void time_service_mark_pushed(void) {
+    int64_t mono_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&s_lock);
+    s_push_mono_us = mono_us;
+    s_push_error_us = 0;
+    s_stats.stm32_error_us = 0;
+    s_pushed_once = true;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+/* 是否完成过同步 */
+bool time_service_is_synced(void) {
+    return s_stats.synced;
+}
+
+/* 获取统计信息 */
+void time_service_get_stats(time_service_stats_t *stats) {
+    portENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+/* SNTP同步完成回调 */
+static void time_sync_notification(struct timeval *tv) {
+    int64_t mono_us = esp_timer_get_time();
+    int64_t wall_us = (int64_t)tv->tv_sec * 1000000LL + tv->tv_usec;
+    int64_t offset_us = 0;
+    bool need_push;
+    uint32_t interval_s;
+    uint32_t deadline_s;
+
+    portENTER_CRITICAL(&s_lock);
+
+    if (s_stats.synced) {
+        /* 按单调时钟推算的本地时间与NTP时间之差即本地时钟偏差 */
+        int64_t elapsed_us = mono_us - s_last_sync_mono_us;
+        int64_t predicted_us = s_last_sync_wall_us + elapsed_us;
+        offset_us = predicted_us - wall_us;
+
+        if (elapsed_us > 0) {
+            float drift_ppm = (float)offset_us * 1e6f / (float)elapsed_us;
+            if (s_stats.sync_count == 1) {
+                s_stats.drift_ppm = drift_ppm;
+            } else {
+                s_stats.drift_ppm += (drift_ppm - s_stats.drift_ppm) /
+                                     (float)(1 << DRIFT_SMOOTHING_SHIFT);
+            }
+        }
+
+        /* 推送发生在上次同步之后：按本次偏差线性插值出推送时ESP32时钟的误差 */
+        if (s_pushed_once && s_push_mono_us > s_last_sync_mono_us && elapsed_us > 0) {
+            s_push_error_us = offset_us * (s_push_mono_us - s_last_sync_mono_us) / elapsed_us;
+        }
+
+        s_stats.interval_s = adapt_interval(s_stats.interval_s, offset_us);
+    }
+
+    s_last_sync_mono_us = mono_us;
+    s_last_sync_wall_us = wall_us;
+    s_stats.synced = true;
+    s_stats.sync_count++;
+    s_stats.last_offset_us = offset_us;
+
+    /* STM32的误差 = 推送时ESP32时钟的误差 + 之后STM32 RTC自身的漂移，
+       与ESP32时钟被校正了多少无关。到最早的下一次同步时会超过阈值就现在推送 */
+    if (s_pushed_once) {
+        s_stats.stm32_error_us = llabs(s_push_error_us) +
+                                 (mono_us - s_push_mono_us) * TIME_STM32_RTC_DRIFT_PPM / 1000000LL;
+    }
+    need_push = !s_pushed_once ||
+                s_stats.stm32_error_us + TIME_SYNC_INTERVAL_MIN * TIME_STM32_RTC_DRIFT_PPM >
+                TIME_PUSH_THRESHOLD_MS * 1000LL;
+
+    /* 在STM32的误差达到阈值前再同步一次，由那次同步触发推送 */
+    deadline_s = stm32_push_deadline_s(need_push ? 0 : s_stats.stm32_error_us);
+    interval_s = (s_stats.interval_s < deadline_s) ? s_stats.interval_s : deadline_s;
+
+    portEXIT_CRITICAL(&s_lock);
+
+    ESP_LOGI(TAG, "Time synchronized: offset %lld us, drift %.2f ppm, STM32 error %lld us, "
+            "next in %lu s", offset_us, s_stats.drift_ppm, s_stats.stm32_error_us,
+            (unsigned long)interval_s);
+
+    /* 回调返回后SNTP才安排下一次请求，新间隔即刻生效 */
+    sntp_set_sync_interval(interval_s * 1000U);
+
+    if (need_push && s_push_callback) {
+        s_push_callback();
+    }
+}
+
+/* 根据本次偏差调整同步间隔：偏差小则加倍，偏差大则减半 */
+static uint32_t adapt_interval(uint32_t interval_s, int64_t offset_us) {
+    int64_t limit_us = TIME_PUSH_THRESHOLD_MS * 1000LL;
+    int64_t magnitude_us = llabs(offset_us);
+
+    if (magnitude_us < limit_us / 4) {
+        interval_s *= 2;
+    } else if (magnitude_us > limit_us / 2) {
+        interval_s /= 2;
+    }
+
+    if (interval_s < TIME_SYNC_INTERVAL_MIN) {
+        interval_s = TIME_SYNC_INTERVAL_MIN;
+    } else if (interval_s > TIME_SYNC_INTERVAL_MAX) {
+        interval_s = TIME_SYNC_INTERVAL_MAX;
+    }
+
+    return interval_s;
+}
+
+/* STM32的误差从stm32_error_us按漂移上限增长到推送阈值所需的时间 */
+static uint32_t stm32_push_deadline_s(int64_t stm32_error_us) {
+    int64_t remaining_us = TIME_PUSH_THRESHOLD_MS * 1000LL - stm32_error_us;
+    int64_t deadline_s = remaining_us / TIME_STM32_RTC_DRIFT_PPM;
+
+    if (deadline_s < TIME_SYNC_INTERVAL_MIN) {
+        return TIME_SYNC_INTERVAL_MIN;
+    }
+    return (uint32_t)deadline_s;
+}
@@ -0,0 +1,45 @@
+#ifndef __TIME_SERVICE_H
+#define __TIME_SERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 同步间隔范围(秒) */
+#define TIME_SYNC_INTERVAL_MIN      (15 * 60)
+#define TIME_SYNC_INTERVAL_MAX      (24 * 60 * 60)
+
+/* STM32 RTC的估计误差超过该值(毫秒)才推送时间给STM32 */
+#define TIME_PUSH_THRESHOLD_MS      500
+
+/* STM32 RTC(LSE 32.768kHz晶振，未校准)的漂移上限 */
+#define TIME_STM32_RTC_DRIFT_PPM    20
+
+/* 时间服务统计 */
+typedef struct {
+    bool synced;
+    uint32_t sync_count;
+    int64_t last_offset_us;     /* 最近一次同步时本地时钟的偏差 */
+    float drift_ppm;            /* 平滑后的漂移估计 */
+    uint32_t interval_s;        /* 自适应的同步间隔，实际间隔不超过STM32的推送期限 */
+    int64_t stm32_error_us;     /* 最近一次同步时估计的STM32 RTC误差上限 */
+} time_service_stats_t;
+
+/* 需要推送时间时的回调，在SNTP上下文中调用，不应阻塞 */
+typedef void (*time_push_callback_t)(void);
+
+/* 函数声明 */
+void time_service_init(time_push_callback_t push_callback);
+void time_service_start(void);
+void time_service_mark_pushed(void);
+bool time_service_is_synced(void);
+void time_service_get_stats(time_service_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TIME_SERVICE_H */
@@ -1,12 +1,16 @@
 #include <string.h>
+#include <time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/event_groups.h"
+#include "freertos/timers.h"
 #include "esp_system.h"
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "esp_log.h"
 #include "nvs_flash.h"
+#include "nvs.h"
+#include "esp_netif.h"
 #include "lwip/err.h"
 #include "lwip/sys.h"
 #include "wifi_manager.h"
@@ -16,10 +20,54 @@
 #define WIFI_PASSWORD       CONFIG_WIFI_PASSWORD
 #define WIFI_MAX_RETRY      CONFIG_WIFI_MAXIMUM_RETRY
 
+/* 快速重连配置 */
+#define WIFI_NVS_NAMESPACE      "wifi_cache"
+#define WIFI_NVS_KEY_AP         "last_ap"
+#define WIFI_CACHE_MAGIC        0x57464332U  /* "WFC2" */
+#define WIFI_BACKOFF_BASE_MS    250
+#define WIFI_BACKOFF_MAX_MS     30000
+#define WIFI_SCAN_MAX_RECORDS   8
+
+/* esp_netif拿不到租期，按家用路由器常见的最短租期估计；
+   缓存的租约在到期前WIFI_LEASE_RENEW_MARGIN_S秒续租 */
+#define WIFI_LEASE_ASSUMED_S        3600
+#define WIFI_LEASE_RENEW_MARGIN_S   300
+
 /* 事件组位定义 */
 #define WIFI_CONNECTED_BIT  BIT0
 #define WIFI_FAIL_BIT       BIT1
 
+/* 内部事件：重连状态机只在默认事件循环任务中修改 */
+ESP_EVENT_DEFINE_BASE(WIFI_MANAGER_EVENT);
+
+enum {
+    WIFI_MANAGER_EVENT_BACKOFF_DONE = 0,    /* 退避定时器到期 */
+    WIFI_MANAGER_EVENT_RECONNECT,           /* 应用请求重连 */
+    WIFI_MANAGER_EVENT_LEASE_RENEW          /* 缓存的租约快到期 */
+};
+
+/* 重连状态机 */
+typedef enum {
+    WIFI_RECONNECT_IDLE = 0,
+    WIFI_RECONNECT_DIRECTED,    /* 使用缓存的BSSID/信道直连 */
+    WIFI_RECONNECT_SCANNING,    /* 全信道扫描中 */
+    WIFI_RECONNECT_CONNECTING,  /* 扫描后连接 */
+    WIFI_RECONNECT_BACKOFF,     /* 等待退避定时器 */
+    WIFI_RECONNECT_CONNECTED
+} wifi_reconnect_state_t;
+
+/* 保存在NVS中的上次连接信息 */
+typedef struct {
+    uint32_t magic;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t lease_valid;
+    uint32_t ip;
+    uint32_t netmask;
+    uint32_t gateway;
+    uint32_t lease_expire;      /* 租约到期的系统时间(秒) */
+} wifi_ap_cache_t;
+
 /* 标签 */
 static const char *TAG = "WiFi";
 
@@ -27,32 +75,84 @@ static const char *TAG = "WiFi";
 static EventGroupHandle_t s_wifi_event_group;
 static int s_retry_num = 0;
 
+/* 重连状态 */
+static esp_netif_t *s_sta_netif = NULL;
+static wifi_reconnect_state_t s_reconnect_state = WIFI_RECONNECT_IDLE;
+static wifi_ap_cache_t s_ap_cache;
+static bool s_ap_cache_valid = false;
+static bool s_static_ip_applied = false;
+static TimerHandle_t s_backoff_timer = NULL;
+static TimerHandle_t s_lease_timer = NULL;
+static TickType_t s_connect_start_tick = 0;
+static uint32_t s_last_connect_ms = 0;
+
 /* WiFi状态回调 */
 static wifi_connected_callback_t s_wifi_callback = NULL;
 
+/* 私有函数原型 */
+static void wifi_load_ap_cache(void);
+static void wifi_save_ap_cache(const ip_event_got_ip_t *event);
+static void wifi_connect_directed(void);
+static void wifi_start_fast_scan(void);
+static void wifi_handle_scan_done(void);
+static void wifi_schedule_backoff(void);
+static void wifi_backoff_timer_callback(TimerHandle_t timer);
+static void wifi_count_failure(void);
+static bool wifi_cached_lease_usable(void);
+static void wifi_apply_cached_lease(void);
+static void wifi_schedule_lease_renew(void);
+static void wifi_lease_timer_callback(TimerHandle_t timer);
+static void wifi_restore_dhcp(void);
+static void wifi_handle_reconnect_request(void);
+
 /* WiFi事件处理 */
 static void wifi_event_handler(void* arg, esp_event_base_t event_base,
                                int32_t event_id, void* event_data) {
     if (event_base == WIFI_EVENT) {
         switch (event_id) {
             case WIFI_EVENT_STA_START:
-                esp_wifi_connect();
+                s_connect_start_tick = xTaskGetTickCount();
+                if (s_ap_cache_valid) {
+                    wifi_connect_directed();
+                } else {
+                    wifi_start_fast_scan();
+                }
                 break;
 
             case WIFI_EVENT_STA_DISCONNECTED:
-                if (s_retry_num < WIFI_MAX_RETRY) {
-                    esp_wifi_connect();
-                    s_retry_num++;
-                    ESP_LOGI(TAG, "Retry to connect to AP (%d/%d)",
-                            s_retry_num, WIFI_MAX_RETRY);
-                } else {
-                    xEventGroupSetBits(s_wifi_event_group, WIFI_FAIL_BIT);
-                    ESP_LOGE(TAG, "Failed to connect after %d retries", WIFI_MAX_RETRY);
+                if (s_reconnect_state == WIFI_RECONNECT_IDLE) {
+                    /* 主动断开，不再重连 */
+                    break;
+                }
 
-                    /* 通知回调 */
+                if (s_reconnect_state == WIFI_RECONNECT_CONNECTED) {
+                    /* 连接丢失，重新从直连开始 */
+                    s_retry_num = 0;
+                    s_connect_start_tick = xTaskGetTickCount();
+                    xTimerStop(s_lease_timer, 0);
                     if (s_wifi_callback) {
                         s_wifi_callback(false);
                     }
+                    xEventGroupClearBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
+                    wifi_connect_directed();
+                    break;
+                }
+
+                if (s_reconnect_state == WIFI_RECONNECT_DIRECTED) {
+                    /* 缓存的AP不可用，改为全信道扫描 */
+                    ESP_LOGI(TAG, "Directed connect failed, falling back to scan");
+                    wifi_restore_dhcp();
+                    wifi_start_fast_scan();
+                    break;
+                }
+
+                wifi_count_failure();
+                wifi_schedule_backoff();
+                break;
+
+            case WIFI_EVENT_SCAN_DONE:
+                if (s_reconnect_state == WIFI_RECONNECT_SCANNING) {
+                    wifi_handle_scan_done();
                 }
                 break;
 
@@ -67,8 +167,29 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
         switch (event_id) {
             case IP_EVENT_STA_GOT_IP: {
                 ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
-                ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
+
+                if (s_reconnect_state == WIFI_RECONNECT_CONNECTED) {
+                    /* 后台续租拿到的新租约，只更新缓存 */
+                    ESP_LOGI(TAG, "DHCP lease: " IPSTR, IP2STR(&event->ip_info.ip));
+                    wifi_save_ap_cache(event);
+                    break;
+                }
+
+                s_last_connect_ms = pdTICKS_TO_MS(xTaskGetTickCount() - s_connect_start_tick);
+                ESP_LOGI(TAG, "Got IP: " IPSTR " in %lu ms%s",
+                        IP2STR(&event->ip_info.ip), (unsigned long)s_last_connect_ms,
+                        s_static_ip_applied ? " (cached lease)" : "");
                 s_retry_num = 0;
+                s_reconnect_state = WIFI_RECONNECT_CONNECTED;
+                wifi_save_ap_cache(event);
+
+                /* 沿用缓存的租约时不立即重启DHCP：esp_netif_dhcpc_start()会清除
+                   接口地址直到拿到新租约，改为在租约快到期前续租 */
+                if (s_static_ip_applied) {
+                    wifi_schedule_lease_renew();
+                }
+
+                xEventGroupClearBits(s_wifi_event_group, WIFI_FAIL_BIT);
                 xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
 
                 /* 通知回调 */
@@ -85,17 +206,305 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
             default:
                 break;
         }
+    } else if (event_base == WIFI_MANAGER_EVENT) {
+        switch (event_id) {
+            case WIFI_MANAGER_EVENT_BACKOFF_DONE:
+                /* 退避结束，重新扫描 */
+                if (s_reconnect_state == WIFI_RECONNECT_BACKOFF) {
+                    wifi_start_fast_scan();
+                }
+                break;
+
+            case WIFI_MANAGER_EVENT_RECONNECT:
+                wifi_handle_reconnect_request();
+                break;
+
+            case WIFI_MANAGER_EVENT_LEASE_RENEW:
+                /* 缓存的租约快到期，重启DHCP客户端续租 */
+                if (s_reconnect_state == WIFI_RECONNECT_CONNECTED) {
+                    ESP_LOGI(TAG, "Cached lease expiring, renewing via DHCP");
+                    wifi_restore_dhcp();
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/* 从NVS读取上次连接的AP信息 */
+static void wifi_load_ap_cache(void) {
+    nvs_handle_t handle;
+    size_t length = sizeof(s_ap_cache);
+
+    s_ap_cache_valid = false;
+    if (nvs_open(WIFI_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return;
+    }
+
+    if (nvs_get_blob(handle, WIFI_NVS_KEY_AP, &s_ap_cache, &length) == ESP_OK &&
+        length == sizeof(s_ap_cache) && s_ap_cache.magic == WIFI_CACHE_MAGIC) {
+        s_ap_cache_valid = true;
+        ESP_LOGI(TAG, "Cached AP " MACSTR " on channel %d",
+                MAC2STR(s_ap_cache.bssid), s_ap_cache.channel);
+    }
+
+    /* 只有软件复位、看门狗和深度睡眠唤醒时系统时间是连续的，
+       掉电后无法判断租约是否还有效，只保留BSSID和信道 */
+    switch (esp_reset_reason()) {
+        case ESP_RST_SW:
+        case ESP_RST_PANIC:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+        case ESP_RST_DEEPSLEEP:
+            break;
+
+        default:
+            s_ap_cache.lease_valid = 0;
+            break;
+    }
+
+    nvs_close(handle);
+}
+
+/* 保存当前AP和IP租约，内容未变化时不写Flash */
+static void wifi_save_ap_cache(const ip_event_got_ip_t *event) {
+    wifi_ap_record_t ap_info;
+    wifi_ap_cache_t cache = {0};
+    nvs_handle_t handle;
+
+    if (esp_wifi_sta_get_ap_info(&ap_info) != ESP_OK) {
+        return;
+    }
+
+    cache.magic = WIFI_CACHE_MAGIC;
+    memcpy(cache.bssid, ap_info.bssid, sizeof(cache.bssid));
+    cache.channel = ap_info.primary;
+    cache.lease_valid = 1;
+    cache.ip = event->ip_info.ip.addr;
+    cache.netmask = event->ip_info.netmask.addr;
+    cache.gateway = event->ip_info.gw.addr;
+
+    /* 沿用缓存的租约时租期没有更新 */
+    if (s_static_ip_applied) {
+        cache.lease_expire = s_ap_cache.lease_expire;
+    } else {
+        cache.lease_expire = (uint32_t)time(NULL) + WIFI_LEASE_ASSUMED_S;
+    }
+
+    if (s_ap_cache_valid && memcmp(&cache, &s_ap_cache, sizeof(cache)) == 0) {
+        return;
+    }
+
+    if (nvs_open(WIFI_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK) {
+        return;
+    }
+
+    if (nvs_set_blob(handle, WIFI_NVS_KEY_AP, &cache, sizeof(cache)) == ESP_OK &&
+        nvs_commit(handle) == ESP_OK) {
+        s_ap_cache = cache;
+        s_ap_cache_valid = true;
+    }
+
+    nvs_close(handle);
+}
+
+/* 使用缓存的BSSID和信道直接连接，跳过扫描 */
+static void wifi_connect_directed(void) {
+    wifi_config_t wifi_config;
+
+    if (!s_ap_cache_valid) {
+        wifi_start_fast_scan();
+        return;
+    }
+
+    esp_wifi_get_config(WIFI_IF_STA, &wifi_config);
+    memcpy(wifi_config.sta.bssid, s_ap_cache.bssid, sizeof(wifi_config.sta.bssid));
+    wifi_config.sta.bssid_set = true;
+    wifi_config.sta.channel = s_ap_cache.channel;
+    wifi_config.sta.scan_method = WIFI_FAST_SCAN;
+    esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+
+    wifi_apply_cached_lease();
+
+    s_reconnect_state = WIFI_RECONNECT_DIRECTED;
+    ESP_LOGI(TAG, "Directed connect to channel %d", s_ap_cache.channel);
+    esp_wifi_connect();
+}
+
+/* 启动非阻塞的全信道扫描 */
+static void wifi_start_fast_scan(void) {
+    wifi_scan_config_t scan_config = {
+        .ssid = (uint8_t *)WIFI_SSID,
+        .show_hidden = false,
+        .scan_type = WIFI_SCAN_TYPE_ACTIVE,
+        .scan_time.active = {
+            .min = 30,
+            .max = 80,
+        },
+    };
+
+    s_reconnect_state = WIFI_RECONNECT_SCANNING;
+    if (esp_wifi_scan_start(&scan_config, false) != ESP_OK) {
+        wifi_schedule_backoff();
+    }
+}
+
+/* 扫描完成，选择信号最强的同名AP连接 */
+static void wifi_handle_scan_done(void) {
+    wifi_ap_record_t ap_list[WIFI_SCAN_MAX_RECORDS];
+    uint16_t ap_count = WIFI_SCAN_MAX_RECORDS;
+    wifi_ap_record_t *best_ap = NULL;
+    wifi_config_t wifi_config;
+
+    if (esp_wifi_scan_get_ap_records(&ap_count, ap_list) != ESP_OK) {
+        ap_count = 0;
+    }
+
+    for (int i = 0; i < ap_count; i++) {
+        if (best_ap == NULL || ap_list[i].rssi > best_ap->rssi) {
+            best_ap = &ap_list[i];
+        }
+    }
+
+    if (best_ap == NULL) {
+        ESP_LOGW(TAG, "%s not found in scan", WIFI_SSID);
+        wifi_count_failure();
+        wifi_schedule_backoff();
+        return;
+    }
+
+    esp_wifi_get_config(WIFI_IF_STA, &wifi_config);
+    memcpy(wifi_config.sta.bssid, best_ap->bssid, sizeof(wifi_config.sta.bssid));
+    wifi_config.sta.bssid_set = true;
+    wifi_config.sta.channel = best_ap->primary;
+    esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+
+    s_reconnect_state = WIFI_RECONNECT_CONNECTING;
+    ESP_LOGI(TAG, "Connecting to " MACSTR " (RSSI: %d, Channel: %d)",
+            MAC2STR(best_ap->bssid), best_ap->rssi, best_ap->primary);
+    esp_wifi_connect();
+}
+
+/* 按指数退避安排下一次扫描，第一次失败后等待WIFI_BACKOFF_BASE_MS */
+static void wifi_schedule_backoff(void) {
+    uint32_t delay_ms = WIFI_BACKOFF_MAX_MS;
+
+    if (s_retry_num <= 8) {
+        delay_ms = WIFI_BACKOFF_BASE_MS << (s_retry_num > 0 ? s_retry_num - 1 : 0);
+        if (delay_ms > WIFI_BACKOFF_MAX_MS) {
+            delay_ms = WIFI_BACKOFF_MAX_MS;
+        }
+    }
+
+    s_reconnect_state = WIFI_RECONNECT_BACKOFF;
+    ESP_LOGI(TAG, "Retry to connect to AP in %lu ms (%d)",
+            (unsigned long)delay_ms, s_retry_num);
+    xTimerChangePeriod(s_backoff_timer, pdMS_TO_TICKS(delay_ms), 0);
+}
+
+/* 退避定时器到期，运行在定时器任务中，只向事件循环投递事件 */
+static void wifi_backoff_timer_callback(TimerHandle_t timer) {
+    if (esp_event_post(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_BACKOFF_DONE,
+                       NULL, 0, 0) != ESP_OK) {
+        /* 事件队列已满，稍后再试 */
+        xTimerChangePeriod(timer, pdMS_TO_TICKS(WIFI_BACKOFF_BASE_MS), 0);
+    }
+}
+
+/* 记录一次连接失败，达到最大重试次数时通知等待者和回调 */
+static void wifi_count_failure(void) {
+    s_retry_num++;
+    if (s_retry_num == WIFI_MAX_RETRY) {
+        xEventGroupSetBits(s_wifi_event_group, WIFI_FAIL_BIT);
+        ESP_LOGE(TAG, "Failed to connect after %d retries", WIFI_MAX_RETRY);
+
+        /* 通知回调，之后以最大退避间隔继续重试 */
+        if (s_wifi_callback) {
+            s_wifi_callback(false);
+        }
+    }
+}
+
+/* 缓存的租约离到期还有足够时间 */
+static bool wifi_cached_lease_usable(void) {
+    uint32_t now = (uint32_t)time(NULL);
+
+    return s_ap_cache.lease_valid &&
+           now + WIFI_LEASE_RENEW_MARGIN_S < s_ap_cache.lease_expire;
+}
+
+/* 直连时沿用上次的IP租约，省去DHCP握手 */
+static void wifi_apply_cached_lease(void) {
+    esp_netif_ip_info_t ip_info;
+
+    if (!s_sta_netif) {
+        return;
+    }
+
+    if (!wifi_cached_lease_usable()) {
+        /* 上次连接可能还在使用静态地址 */
+        wifi_restore_dhcp();
+        return;
+    }
+
+    ip_info.ip.addr = s_ap_cache.ip;
+    ip_info.netmask.addr = s_ap_cache.netmask;
+    ip_info.gw.addr = s_ap_cache.gateway;
+
+    esp_netif_dhcpc_stop(s_sta_netif);
+    if (esp_netif_set_ip_info(s_sta_netif, &ip_info) == ESP_OK) {
+        s_static_ip_applied = true;
+    } else {
+        esp_netif_dhcpc_start(s_sta_netif);
+    }
+}
+
+/* 在缓存的租约到期前WIFI_LEASE_RENEW_MARGIN_S秒安排续租 */
+static void wifi_schedule_lease_renew(void) {
+    uint32_t now = (uint32_t)time(NULL);
+    uint32_t hold_s = 1;
+
+    if (s_ap_cache.lease_expire > now + WIFI_LEASE_RENEW_MARGIN_S + 1) {
+        hold_s = s_ap_cache.lease_expire - WIFI_LEASE_RENEW_MARGIN_S - now;
+    }
+
+    ESP_LOGI(TAG, "Keeping cached lease, renewing in %lu s", (unsigned long)hold_s);
+    xTimerChangePeriod(s_lease_timer, pdMS_TO_TICKS(hold_s * 1000U), 0);
+}
+
+/* 续租定时器到期，运行在定时器任务中，只向事件循环投递事件 */
+static void wifi_lease_timer_callback(TimerHandle_t timer) {
+    if (esp_event_post(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_LEASE_RENEW,
+                       NULL, 0, 0) != ESP_OK) {
+        /* 事件队列已满，稍后再试 */
+        xTimerChangePeriod(timer, pdMS_TO_TICKS(WIFI_BACKOFF_BASE_MS), 0);
+    }
+}
+
+/* 直连失败、租约快到期或断开时恢复DHCP */
+static void wifi_restore_dhcp(void) {
+    if (s_sta_netif && s_static_ip_applied) {
+        esp_netif_dhcpc_start(s_sta_netif);
+        s_static_ip_applied = false;
     }
 }
 
 /* WiFi初始化 */
 void wifi_init(void) {
     s_wifi_event_group = xEventGroupCreate();
+    s_backoff_timer = xTimerCreate("wifi_backoff", pdMS_TO_TICKS(WIFI_BACKOFF_BASE_MS),
+                                   pdFALSE, NULL, wifi_backoff_timer_callback);
+    s_lease_timer = xTimerCreate("wifi_lease", pdMS_TO_TICKS(WIFI_LEASE_ASSUMED_S * 1000U),
+                                 pdFALSE, NULL, wifi_lease_timer_callback);
 
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK(esp_event_loop_create_default());
 
-    esp_netif_create_default_wifi_sta();
+    s_sta_netif = esp_netif_create_default_wifi_sta();
+    wifi_load_ap_cache();
 
     wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
     ESP_ERROR_CHECK(esp_wifi_init(&cfg));
@@ -105,6 +514,8 @@ void wifi_init(void) {
                                                &wifi_event_handler, NULL));
     ESP_ERROR_CHECK(esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
                                                &wifi_event_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(WIFI_MANAGER_EVENT, ESP_EVENT_ANY_ID,
+                                               &wifi_event_handler, NULL));
 
     /* WiFi配置 */
     wifi_config_t wifi_config = {
@@ -196,8 +607,12 @@ bool wifi_get_connection_info(wifi_connection_info_t *info) {
 
 /* 断开WiFi连接 */
 void wifi_disconnect(void) {
+    s_reconnect_state = WIFI_RECONNECT_IDLE;
+    xTimerStop(s_backoff_timer, 0);
+    xTimerStop(s_lease_timer, 0);
     ESP_ERROR_CHECK(esp_wifi_disconnect());
     ESP_ERROR_CHECK(esp_wifi_stop());
+    wifi_restore_dhcp();
 
     /* 通知回调 */
     if (s_wifi_callback) {
@@ -205,11 +620,29 @@ void wifi_disconnect(void) {
     }
 }
 
-/* 重新连接WiFi */
+/* 重新连接WiFi，由事件循环处理 */
 void wifi_reconnect(void) {
     ESP_LOGI(TAG, "Reconnecting to WiFi...");
-    ESP_ERROR_CHECK(esp_wifi_disconnect());
-    ESP_ERROR_CHECK(esp_wifi_connect());
+    esp_event_post(WIFI_MANAGER_EVENT, WIFI_MANAGER_EVENT_RECONNECT,
+                   NULL, 0, portMAX_DELAY);
+}
+
+/* 处理重连请求 */
+static void wifi_handle_reconnect_request(void) {
+    /* 已连接时由断开事件触发直连，否则立即直连 */
+    if (s_reconnect_state == WIFI_RECONNECT_CONNECTED) {
+        ESP_ERROR_CHECK(esp_wifi_disconnect());
+    } else {
+        xTimerStop(s_backoff_timer, 0);
+        s_retry_num = 0;
+        s_connect_start_tick = xTaskGetTickCount();
+        wifi_connect_directed();
+    }
+}
+
+/* 获取最近一次从开始连接到获得IP的耗时 */
+uint32_t wifi_get_last_connect_time_ms(void) {
+    return s_last_connect_ms;
 }
 
 /* 设置WiFi回调 */
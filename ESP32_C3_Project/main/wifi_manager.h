@@ -37,6 +37,7 @@ void wifi_disconnect(void);
 void wifi_reconnect(void);
 void set_wifi_connected_callback(wifi_connected_callback_t callback);
 void wifi_scan_networks(void);
+uint32_t wifi_get_last_connect_time_ms(void);
 
 #ifdef __cplusplus
 }
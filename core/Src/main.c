@@ -6,6 +6,8 @@
 #include "uart_comm_task.h"
 #include "rtc_task.h"
 #include "button_task.h"
+#include "fast_boot.h"
+#include "event_bus.h"
 
 /* 外设句柄 */
 SPI_HandleTypeDef hspi2;
@@ -25,7 +27,6 @@ osThreadId_t uiUpdateTaskHandle;
 osMessageQueueId_t weatherQueueHandle;
 osMessageQueueId_t timeQueueHandle;
 osMessageQueueId_t commandQueueHandle;
-osMessageQueueId_t eventQueueHandle;
 osSemaphoreId_t uartTxSemaphore;
 osSemaphoreId_t spiSemaphore;
 osMutexId_t displayMutex;
@@ -54,22 +55,22 @@ static void MX_RTC_Init(void);
 static void MX_TIM6_Init(void);
 static void CreateFreeRTOSObjects(void);
 static void CreateApplicationTasks(void);
+static void ShowFirstFrame(void);
 static void Error_Handler(void);
 
 int main(void) {
     /* 复位所有外设，初始化Flash接口和Systick */
     HAL_Init();
+    FastBoot_TraceInit();
 
     /* 配置系统时钟 */
     SystemClock_Config();
+    FastBoot_TraceMark("clock");
 
-    /* 初始化所有外设 */
+    /* 只初始化首帧显示所需的外设 */
     MX_GPIO_Init();
-    MX_USART2_UART_Init();
-    MX_USART3_UART_Init();
     MX_SPI2_Init();
-    MX_RTC_Init();
-    MX_TIM6_Init();
+    FastBoot_TraceMark("display_periph");
 
     /* 初始化系统状态 */
     system_status.wifi_connected = false;
@@ -79,11 +80,24 @@ int main(void) {
     system_status.error_code = 0;
     system_status.uptime_seconds = 0;
 
+    /* 从备份SRAM恢复上次的数据并立即显示 */
+    ShowFirstFrame();
+
+    /* 首帧之后再初始化其余外设 */
+    MX_USART2_UART_Init();
+    MX_USART3_UART_Init();
+    MX_RTC_Init();
+    MX_TIM6_Init();
+    FastBoot_TraceMark("deferred_periph");
+
     /* 创建FreeRTOS对象 */
     CreateFreeRTOSObjects();
 
     /* 创建应用任务 */
     CreateApplicationTasks();
+    FastBoot_TraceMark("tasks");
+
+    FastBoot_PrintTrace();
 
     /* 启动调度器 */
     osKernelStart();
@@ -94,12 +108,27 @@ int main(void) {
     }
 }
 
+/* 快速启动首帧 - 显示上次保存的天气和时间，并标记为过期 */
+static void ShowFirstFrame(void) {
+    WeatherData cached_weather = {0};
+    TimeData cached_time = {0};
+    bool restored;
+
+    FastBoot_BackupInit();
+    restored = FastBoot_Restore(&cached_weather, &cached_time);
+    FastBoot_TraceMark(restored ? "snapshot_restored" : "snapshot_missing");
+
+    /* 首帧总是标记为过期，没有快照时显示占位标记而不是全零的数据。
+       weather_data_valid会上报给ESP32，收到真实数据之前保持false */
+    DisplayShowSnapshot(&cached_weather, &cached_time, restored);
+    FastBoot_TraceMark("first_frame");
+}
+
 static void CreateFreeRTOSObjects(void) {
     /* 创建队列 */
     weatherQueueHandle = osMessageQueueNew(5, sizeof(WeatherData), NULL);
     timeQueueHandle = osMessageQueueNew(5, sizeof(TimeData), NULL);
     commandQueueHandle = osMessageQueueNew(10, sizeof(UARTFrame), NULL);
-    eventQueueHandle = osMessageQueueNew(20, sizeof(EventType), NULL);
 
     /* 创建信号量 */
     uartTxSemaphore = osSemaphoreNew(1, 1, NULL);
@@ -110,6 +139,9 @@ static void CreateFreeRTOSObjects(void) {
 
     /* 创建事件组 */
     systemEventGroup = xEventGroupCreate();
+
+    /* 初始化事件总线 */
+    EventBus_Init();
 }
 
 static void CreateApplicationTasks(void) {
@@ -149,6 +181,12 @@ static void CreateApplicationTasks(void) {
     buttonTaskHandle = osThreadNew(ButtonTask, NULL, &buttonTask_attributes);
     rtcTaskHandle = osThreadNew(RTCTask, NULL, &rtcTask_attributes);
     uiUpdateTaskHandle = osThreadNew(UIUpdateTask, NULL, &uiUpdateTask_attributes);
+
+    /* 在调度器启动前注册订阅者，避免丢失早期事件 */
+    EventBus_Subscribe(EVENT_SUBSCRIBER_DISPLAY, displayTaskHandle,
+                       EVENT_BIT(EVENT_WEATHER_UPDATE) |
+                       EVENT_BIT(EVENT_TIME_UPDATE) |
+                       EVENT_BIT(EVENT_MODE_CHANGE));
 }
 
 /* 系统时钟配置 */
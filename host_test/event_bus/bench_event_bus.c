@@ -0,0 +1,386 @@
+/*
+ * 事件总线的主机压力测试
+ *
+ * 多个生产者线程发布事件，一个消费者线程(对应显示任务)接收。生产者或者
+ * 以最快速度连续发布(测吞吐量)，或者成批发布后休眠(测延迟和丢失)。
+ * 对比两种实现：
+ *   queue  原来的eventQueueHandle：20深的消息队列，超时为0放入，满了丢弃
+ *   bus    event_bus.c：每个订阅者一个待处理位图，重复事件合并
+ * 输出每秒发布的事件数、送达/丢弃/合并的数量以及最坏和P99延迟。
+ * 延迟从发布开始计到消费者取到事件为止；总线的延迟取的是必然包含该事件的
+ * 那次取出的完成时间，是上界。
+ *
+ * 主机上的绝对数值和Cortex-M不同，只用于比较两种语义；连续发布时的延迟
+ * 主要取决于主机的线程调度。
+ * 同时检查总线的计数是否一致，检查失败时返回非0。
+ *
+ * 运行：make bench
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mock_rtos.h"
+#include "event_bus.h"
+
+#define BENCH_PRODUCERS         4
+#define BENCH_QUEUE_DEPTH       20U
+#define BENCH_STOP_EVENT        EVENT_TYPE_COUNT
+
+typedef enum {
+    BENCH_MODE_QUEUE = 0,
+    BENCH_MODE_BUS
+} BenchMode;
+
+/* 一组测试参数 */
+typedef struct {
+    const char *name;
+    uint32_t events_per_producer;
+    uint32_t burst;             /* 每发布burst个事件后休眠gap_us，0表示不休眠 */
+    uint32_t gap_us;
+    uint32_t consumer_cost_ns;  /* 消费者每次被唤醒后的处理时间 */
+} BenchWorkload;
+
+/* 一次测试的结果 */
+typedef struct {
+    uint64_t published;
+    uint64_t elapsed_ns;
+    uint64_t delivered;
+    uint64_t dropped;
+    uint64_t coalesced;
+    uint64_t wakeups;
+    uint64_t max_latency_ns;
+    uint64_t p99_latency_ns;
+} BenchResult;
+
+/* 总线模式下每次发布的记录：发布时间和必然包含该事件的取出序号 */
+typedef struct {
+    uint64_t publish_ns;
+    uint32_t fetch_index;
+} BusSample;
+
+typedef struct {
+    uint32_t id;
+    uint32_t count;
+    BusSample *samples;
+    uint64_t dropped;
+    uint64_t start_ns;
+    uint64_t end_ns;
+} ProducerContext;
+
+static const BenchWorkload k_workloads[] = {
+    { "saturation", 200000, 0, 0, 0 },
+    { "bursts of 16 every 500 us", 8000, 16, 500, 0 },
+    { "bursts of 16 every 500 us, 20 us per wake", 8000, 16, 500, 20000 },
+};
+
+static const EventType k_subscribed_events[] = {
+    EVENT_WEATHER_UPDATE, EVENT_TIME_UPDATE, EVENT_MODE_CHANGE
+};
+
+/* 当前测试的共享状态 */
+static BenchMode s_mode;
+static const BenchWorkload *s_workload;
+static pthread_barrier_t s_start_barrier;
+static osMessageQueueId_t s_event_queue;
+static osThreadId_t s_consumer_thread;
+static pthread_mutex_t s_ready_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_ready_cond = PTHREAD_COND_INITIALIZER;
+static volatile bool s_stop;
+
+/* 消费者记录 */
+static uint32_t s_fetch_count;
+static uint64_t *s_fetch_done_ns;
+static uint64_t *s_latencies;
+static uint64_t s_latency_count;
+static uint64_t s_delivered;
+static uint64_t s_wakeups;
+
+static int s_failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { \
+        printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } } while (0)
+
+/* 模拟消费者的处理时间 */
+static void BusyWait(uint32_t ns) {
+    uint64_t end;
+
+    if (ns == 0U) {
+        return;
+    }
+    end = mock_now_ns() + ns;
+    while (mock_now_ns() < end) {
+    }
+}
+
+static uint32_t NextRandom(uint32_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void *ProducerThread(void *arg) {
+    ProducerContext *ctx = arg;
+    uint32_t seed = 0x9E3779B9U * (ctx->id + 1U);
+
+    pthread_barrier_wait(&s_start_barrier);
+    ctx->start_ns = mock_now_ns();
+
+    for (uint32_t i = 0; i < ctx->count; i++) {
+        EventType event = k_subscribed_events[NextRandom(&seed) % 3U];
+
+        if (s_workload->burst != 0U && i != 0U && (i % s_workload->burst) == 0U) {
+            struct timespec gap = { 0, (long)s_workload->gap_us * 1000L };
+            nanosleep(&gap, NULL);
+        }
+
+        if (s_mode == BENCH_MODE_QUEUE) {
+            if (osMessageQueuePut(s_event_queue, &event, 0, 0) != osOK) {
+                ctx->dropped++;
+            }
+        } else {
+            ctx->samples[i].publish_ns = mock_now_ns();
+            EventBus_Publish(event);
+            ctx->samples[i].fetch_index =
+                __atomic_load_n(&s_fetch_count, __ATOMIC_ACQUIRE) + 1U;
+        }
+    }
+
+    ctx->end_ns = mock_now_ns();
+    return NULL;
+}
+
+static void *ConsumerThread(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&s_ready_lock);
+    s_consumer_thread = mock_thread_attach();
+    pthread_cond_signal(&s_ready_cond);
+    pthread_mutex_unlock(&s_ready_lock);
+
+    if (s_mode == BENCH_MODE_QUEUE) {
+        EventType event;
+
+        while (osMessageQueueGet(s_event_queue, &event, NULL, osWaitForever) == osOK) {
+            if (event == BENCH_STOP_EVENT) {
+                break;
+            }
+            s_latencies[s_latency_count++] = mock_now_ns() - mock_queue_put_ns;
+            s_delivered++;
+            s_wakeups++;
+            BusyWait(s_workload->consumer_cost_ns);
+        }
+    } else {
+        while (1) {
+            bool last;
+            uint32_t index;
+            uint32_t events;
+
+            osThreadFlagsWait(EVENT_BUS_THREAD_FLAG, osFlagsWaitAny, osWaitForever);
+            s_wakeups++;
+
+            /* 先读停止标志，设置标志后主线程还会再唤醒一次 */
+            last = __atomic_load_n(&s_stop, __ATOMIC_ACQUIRE);
+            index = __atomic_add_fetch(&s_fetch_count, 1U, __ATOMIC_ACQ_REL);
+            events = EventBus_Fetch(EVENT_SUBSCRIBER_DISPLAY);
+            s_fetch_done_ns[index] = mock_now_ns();
+            s_delivered += (uint64_t)__builtin_popcount(events);
+
+            BusyWait(s_workload->consumer_cost_ns);
+            if (last) {
+                break;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static int CompareU64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void RunBench(BenchMode mode, const BenchWorkload *workload, BenchResult *result) {
+    ProducerContext producers[BENCH_PRODUCERS];
+    pthread_t producer_threads[BENCH_PRODUCERS];
+    pthread_t consumer;
+    uint64_t total = (uint64_t)workload->events_per_producer * BENCH_PRODUCERS;
+    uint64_t start_ns = UINT64_MAX;
+    uint64_t end_ns = 0;
+
+    memset(result, 0, sizeof(*result));
+    s_mode = mode;
+    s_workload = workload;
+    s_stop = false;
+    s_fetch_count = 0;
+    s_fetch_done_ns = calloc(total + 2U, sizeof(uint64_t));
+    s_latencies = calloc(total, sizeof(uint64_t));
+    s_latency_count = 0;
+    s_delivered = 0;
+    s_wakeups = 0;
+    s_consumer_thread = NULL;
+
+    if (mode == BENCH_MODE_QUEUE) {
+        s_event_queue = osMessageQueueNew(BENCH_QUEUE_DEPTH, sizeof(EventType), NULL);
+    }
+
+    /* 订阅者在生产者开始前注册，和CreateApplicationTasks中的顺序一致 */
+    pthread_create(&consumer, NULL, ConsumerThread, NULL);
+    pthread_mutex_lock(&s_ready_lock);
+    while (s_consumer_thread == NULL) {
+        pthread_cond_wait(&s_ready_cond, &s_ready_lock);
+    }
+    pthread_mutex_unlock(&s_ready_lock);
+
+    EventBus_Init();
+    EventBus_Subscribe(EVENT_SUBSCRIBER_DISPLAY, s_consumer_thread,
+                       EVENT_BIT(EVENT_WEATHER_UPDATE) |
+                       EVENT_BIT(EVENT_TIME_UPDATE) |
+                       EVENT_BIT(EVENT_MODE_CHANGE));
+
+    pthread_barrier_init(&s_start_barrier, NULL, BENCH_PRODUCERS + 1);
+    for (uint32_t i = 0; i < BENCH_PRODUCERS; i++) {
+        producers[i].id = i;
+        producers[i].count = workload->events_per_producer;
+        producers[i].samples = calloc(workload->events_per_producer, sizeof(BusSample));
+        producers[i].dropped = 0;
+        pthread_create(&producer_threads[i], NULL, ProducerThread, &producers[i]);
+    }
+
+    /* 单核主机上主线程不一定先运行，时间由生产者自己记录 */
+    pthread_barrier_wait(&s_start_barrier);
+    for (uint32_t i = 0; i < BENCH_PRODUCERS; i++) {
+        pthread_join(producer_threads[i], NULL);
+        if (producers[i].start_ns < start_ns) {
+            start_ns = producers[i].start_ns;
+        }
+        if (producers[i].end_ns > end_ns) {
+            end_ns = producers[i].end_ns;
+        }
+    }
+    result->elapsed_ns = end_ns - start_ns;
+    pthread_barrier_destroy(&s_start_barrier);
+
+    /* 停止消费者，停止事件本身不能丢 */
+    if (mode == BENCH_MODE_QUEUE) {
+        EventType stop = BENCH_STOP_EVENT;
+        while (osMessageQueuePut(s_event_queue, &stop, 0, 0) != osOK) {
+            sched_yield();
+        }
+    } else {
+        __atomic_store_n(&s_stop, true, __ATOMIC_RELEASE);
+        osThreadFlagsSet(s_consumer_thread, EVENT_BUS_THREAD_FLAG);
+    }
+    pthread_join(consumer, NULL);
+
+    result->published = total;
+    result->delivered = s_delivered;
+    result->wakeups = s_wakeups;
+
+    if (mode == BENCH_MODE_QUEUE) {
+        for (uint32_t i = 0; i < BENCH_PRODUCERS; i++) {
+            result->dropped += producers[i].dropped;
+        }
+        osMessageQueueDelete(s_event_queue);
+    } else {
+        EventBusStats stats;
+
+        EventBus_GetStats(EVENT_SUBSCRIBER_DISPLAY, &stats);
+        result->coalesced = stats.coalesced;
+
+        for (uint32_t i = 0; i < BENCH_PRODUCERS; i++) {
+            for (uint32_t j = 0; j < producers[i].count; j++) {
+                BusSample *sample = &producers[i].samples[j];
+
+                CHECK(sample->fetch_index <= s_fetch_count);
+                if (sample->fetch_index <= s_fetch_count) {
+                    s_latencies[s_latency_count++] =
+                        s_fetch_done_ns[sample->fetch_index] - sample->publish_ns;
+                }
+            }
+        }
+
+        /* 每次发布要么置位一次并被取走，要么合并，不会丢失 */
+        CHECK(stats.published == total);
+        CHECK(s_delivered + stats.coalesced == total);
+        CHECK(EventBus_Fetch(EVENT_SUBSCRIBER_DISPLAY) == 0U);
+    }
+
+    if (s_latency_count > 0U) {
+        qsort(s_latencies, s_latency_count, sizeof(uint64_t), CompareU64);
+        result->max_latency_ns = s_latencies[s_latency_count - 1U];
+        result->p99_latency_ns = s_latencies[(s_latency_count * 99U) / 100U];
+    }
+
+    for (uint32_t i = 0; i < BENCH_PRODUCERS; i++) {
+        free(producers[i].samples);
+    }
+    free(s_fetch_done_ns);
+    free(s_latencies);
+}
+
+static void PrintResult(const char *name, const BenchResult *result) {
+    printf("  %-6s %10.2f %10llu %10llu %10llu %10llu %10.1f %10.1f\n",
+           name,
+           (double)result->published * 1000.0 / (double)result->elapsed_ns,
+           (unsigned long long)result->delivered,
+           (unsigned long long)result->dropped,
+           (unsigned long long)result->coalesced,
+           (unsigned long long)result->wakeups,
+           (double)result->max_latency_ns / 1000.0,
+           (double)result->p99_latency_ns / 1000.0);
+}
+
+/* 不在位图范围内的事件计入溢出，未订阅的事件不投递 */
+static void TestOverflowAndFilter(void) {
+    osThreadId_t self = mock_thread_attach();
+
+    printf("overflow and filter\n");
+    EventBus_Init();
+    EventBus_Subscribe(EVENT_SUBSCRIBER_DISPLAY, self, EVENT_BIT(EVENT_WEATHER_UPDATE));
+
+    CHECK(!EventBus_Publish((EventType)EVENT_BUS_MAX_EVENTS));
+    CHECK(EventBus_GetOverflowCount() == 1U);
+    CHECK(!EventBus_Publish(EVENT_UART_DATA_RECEIVED));
+    CHECK(EventBus_Fetch(EVENT_SUBSCRIBER_DISPLAY) == 0U);
+
+    CHECK(EventBus_Publish(EVENT_WEATHER_UPDATE));
+    CHECK(EventBus_Publish(EVENT_WEATHER_UPDATE));
+    CHECK(osThreadFlagsWait(EVENT_BUS_THREAD_FLAG, osFlagsWaitAny, 0) == EVENT_BUS_THREAD_FLAG);
+    CHECK(EventBus_Fetch(EVENT_SUBSCRIBER_DISPLAY) == EVENT_BIT(EVENT_WEATHER_UPDATE));
+}
+
+int main(void) {
+    TestOverflowAndFilter();
+
+    for (size_t i = 0; i < sizeof(k_workloads) / sizeof(k_workloads[0]); i++) {
+        const BenchWorkload *workload = &k_workloads[i];
+        BenchResult queue_result;
+        BenchResult bus_result;
+
+        printf("%s: %d producers x %lu events\n", workload->name, BENCH_PRODUCERS,
+               (unsigned long)workload->events_per_producer);
+        printf("  %-6s %10s %10s %10s %10s %10s %10s %10s\n", "mode", "Mev/s",
+               "delivered", "dropped", "coalesced", "wakeups", "max us", "p99 us");
+
+        RunBench(BENCH_MODE_QUEUE, workload, &queue_result);
+        PrintResult("queue", &queue_result);
+        CHECK(queue_result.delivered + queue_result.dropped == queue_result.published);
+
+        RunBench(BENCH_MODE_BUS, workload, &bus_result);
+        PrintResult("bus", &bus_result);
+        CHECK(bus_result.dropped == 0U);
+    }
+
+    if (s_failures != 0) {
+        printf("%d check(s) FAILED\n", s_failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
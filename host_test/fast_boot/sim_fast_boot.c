@@ -0,0 +1,205 @@
+/*
+ * 快速启动的主机仿真
+ *
+ * 直接包含fast_boot.c，按core/Src/main.c的顺序调用它的接口，打印各启动
+ * 阶段的时间。
+ * 硬件初始化的耗时是按数据手册估算的模型(见boot_cost_us)，DWT周期计数器
+ * 按这些耗时推进，主频在时钟配置后从16MHz HSI切换到168MHz，和目标板上
+ * FastBoot_TraceMark看到的情况一致。快照的恢复和保存运行的是真实代码。
+ *
+ * 检查以下情况，任何一项失败时返回非0：
+ *   冷启动      备份SRAM为空，首帧显示占位标记
+ *   热启动      恢复上次保存的天气和时间，首帧标记为缓存数据
+ *   写入中断    快照CRC不匹配时丢弃
+ *   没有VBAT    备份调节器打不开时不读快照
+ *   只有时间    没有保存过天气时按没有快照处理，时间照常恢复
+ *
+ * 运行：make test
+ */
+
+#include "mock_rtos.h"
+#include "fast_boot.c"
+
+/* 各阶段的估算耗时(us) */
+typedef enum {
+    COST_HAL_INIT = 0,      /* HAL_Init，16MHz HSI */
+    COST_CLOCK,             /* HSE起振约1.5ms加PLL锁定 */
+    COST_DISPLAY_PERIPH,    /* GPIO和SPI2 */
+    COST_LCD_INIT,          /* LCD复位5ms加退出睡眠120ms */
+    COST_FIRST_FRAME,       /* 240x320x16bit经21MHz SPI刷一整屏 */
+    COST_DEFERRED_PERIPH,   /* 两路UART、RTC(LSE已在备份域中运行)和TIM6 */
+    COST_TASKS,             /* 创建队列、信号量和任务 */
+    COST_COUNT
+} BootCost;
+
+static const uint32_t boot_cost_us[COST_COUNT] = {
+    [COST_HAL_INIT]        = 40,
+    [COST_CLOCK]           = 1700,
+    [COST_DISPLAY_PERIPH]  = 20,
+    [COST_LCD_INIT]        = 125000,
+    [COST_FIRST_FRAME]     = 58514,
+    [COST_DEFERRED_PERIPH] = 150,
+    [COST_TASKS]           = 300
+};
+
+/* DisplayShowSnapshot收到的参数 */
+static bool shown = false;
+static bool shown_restored = false;
+static WeatherData shown_weather;
+static TimeData shown_time;
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { \
+        printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/* display_task.c的首帧显示，这里只记录参数并计入LCD的耗时 */
+void DisplayShowSnapshot(const WeatherData *weather, const TimeData *time,
+                         bool restored) {
+    shown = true;
+    shown_restored = restored;
+    shown_weather = *weather;
+    shown_time = *time;
+
+    mock_cycles_advance(boot_cost_us[COST_LCD_INIT]);
+    mock_cycles_advance(boot_cost_us[COST_FIRST_FRAME]);
+}
+
+/* 与main.c中ShowFirstFrame相同 */
+static void ShowFirstFrame(void) {
+    WeatherData cached_weather = {0};
+    TimeData cached_time = {0};
+    bool restored;
+
+    FastBoot_BackupInit();
+    restored = FastBoot_Restore(&cached_weather, &cached_time);
+    FastBoot_TraceMark(restored ? "snapshot_restored" : "snapshot_missing");
+
+    DisplayShowSnapshot(&cached_weather, &cached_time, restored);
+    FastBoot_TraceMark("first_frame");
+}
+
+/* 与main.c中main()到osKernelStart()为止的顺序相同 */
+static void SimulateBoot(void) {
+    /* 复位：.bss清零，备份SRAM保留 */
+    backup_ready = false;
+    mock_core_debug.DEMCR = 0;
+    mock_dwt.CTRL = 0;
+    mock_dwt.CYCCNT = 0;
+    SystemCoreClock = 16000000U;
+    shown = false;
+
+    mock_cycles_advance(boot_cost_us[COST_HAL_INIT]);
+    FastBoot_TraceInit();
+
+    mock_cycles_advance(boot_cost_us[COST_CLOCK]);
+    SystemCoreClock = 168000000U;
+    FastBoot_TraceMark("clock");
+
+    mock_cycles_advance(boot_cost_us[COST_DISPLAY_PERIPH]);
+    FastBoot_TraceMark("display_periph");
+
+    ShowFirstFrame();
+
+    mock_cycles_advance(boot_cost_us[COST_DEFERRED_PERIPH]);
+    FastBoot_TraceMark("deferred_periph");
+
+    mock_cycles_advance(boot_cost_us[COST_TASKS]);
+    FastBoot_TraceMark("tasks");
+
+    FastBoot_PrintTrace();
+}
+
+/* 返回某个阶段的时间戳，没有记录时返回UINT32_MAX */
+static uint32_t PhaseTime(const char *phase) {
+    const BootTraceEntry *entries;
+    uint8_t count = FastBoot_GetTrace(&entries);
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(entries[i].phase, phase) == 0) {
+            return entries[i].timestamp_us;
+        }
+    }
+    return UINT32_MAX;
+}
+
+static void TestColdBoot(void) {
+    printf("cold boot\n");
+    memset(mock_bkpsram, 0, sizeof(mock_bkpsram));
+    mock_backup_regulator_ok = true;
+
+    SimulateBoot();
+    CHECK(shown && !shown_restored);
+    CHECK(PhaseTime("snapshot_missing") != UINT32_MAX);
+    CHECK(PhaseTime("first_frame") < PhaseTime("deferred_periph"));
+    CHECK(PhaseTime("tasks") != UINT32_MAX);
+}
+
+static void TestWarmBoot(void) {
+    WeatherData weather = {235, 61, 3, "Shenzhen"};
+    TimeData time = {7, 42, 5, 18, 10, 2026};
+
+    printf("warm boot\n");
+
+    /* 上一次运行中串口任务和显示任务保存的数据 */
+    FastBoot_SaveWeather(&weather);
+    FastBoot_SaveTime(&time);
+
+    SimulateBoot();
+    CHECK(shown && shown_restored);
+    CHECK(memcmp(&shown_weather, &weather, sizeof(weather)) == 0);
+    CHECK(memcmp(&shown_time, &time, sizeof(time)) == 0);
+    CHECK(PhaseTime("snapshot_restored") != UINT32_MAX);
+}
+
+static void TestTornWrite(void) {
+    printf("torn snapshot write\n");
+
+    /* 写到一半掉电：天气已改写，CRC还是旧的 */
+    ((volatile FastBootSnapshot *)BKPSRAM_BASE)->weather.temperature ^= 1;
+
+    SimulateBoot();
+    CHECK(shown && !shown_restored);
+}
+
+static void TestNoBackupRegulator(void) {
+    WeatherData weather = {180, 40, 1, "Beijing"};
+
+    printf("no backup regulator\n");
+    FastBoot_SaveWeather(&weather);
+
+    mock_backup_regulator_ok = false;
+    SimulateBoot();
+    CHECK(shown && !shown_restored);
+    mock_backup_regulator_ok = true;
+}
+
+static void TestTimeOnly(void) {
+    TimeData time = {23, 59, 58, 31, 12, 2026};
+
+    printf("time only\n");
+    memset(mock_bkpsram, 0, sizeof(mock_bkpsram));
+    SimulateBoot();
+
+    /* 只有显示任务保存过时间，还没收到过天气 */
+    FastBoot_SaveTime(&time);
+
+    SimulateBoot();
+    CHECK(shown && !shown_restored);
+    CHECK(memcmp(&shown_time, &time, sizeof(time)) == 0);
+}
+
+int main(void) {
+    TestColdBoot();
+    TestWarmBoot();
+    TestTornWrite();
+    TestNoBackupRegulator();
+    TestTimeOnly();
+
+    if (failures) {
+        printf("%d check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,7 @@
+#ifndef __MOCK_ESP_SYSTEM_H
+#define __MOCK_ESP_SYSTEM_H
+
+/* 主机测试替身，见mock_idf.h */
+#include "mock_idf.h"
+
+#endif /* __MOCK_ESP_SYSTEM_H */
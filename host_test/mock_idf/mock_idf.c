@@ -0,0 +1,804 @@
+#include <stdarg.h>
+#include "mock_idf.h"
+
+/* 模拟器上限 */
+#define MOCK_MAX_EVENTS     32
+#define MOCK_MAX_TIMERS     4
+#define MOCK_MAX_HANDLERS   8
+#define MOCK_MAX_NVS_KEYS   4
+#define MOCK_MAX_BLOB       64
+
+ESP_EVENT_DEFINE_BASE(WIFI_EVENT);
+ESP_EVENT_DEFINE_BASE(IP_EVENT);
+
+/* 事件队列中的条目：驱动内部动作或投递到事件循环的事件 */
+typedef enum {
+    MOCK_ACT_POST = 0,      /* 分发给事件处理器 */
+    MOCK_ACT_ASSOC_DONE,    /* 关联成功 */
+    MOCK_ACT_CONNECT_FAIL,  /* 连接失败 */
+    MOCK_ACT_SCAN_DONE,     /* 扫描结束 */
+    MOCK_ACT_DHCP_DONE,     /* DHCP拿到租约 */
+    MOCK_ACT_SNTP_SYNC      /* SNTP收到服务器应答 */
+} mock_action_t;
+
+typedef struct {
+    bool used;
+    mock_action_t action;
+    uint32_t gen;
+    uint32_t due;
+    uint32_t seq;
+    esp_event_base_t base;
+    int32_t id;
+    uint8_t data[sizeof(ip_event_got_ip_t)];
+    size_t size;
+} mock_event_t;
+
+struct mock_timer {
+    bool used;
+    bool active;
+    uint32_t due;
+    TimerCallbackFunction_t callback;
+};
+
+struct mock_event_group {
+    EventBits_t bits;
+};
+
+struct mock_netif {
+    bool dhcp_running;
+    esp_netif_ip_info_t ip_info;
+};
+
+typedef struct {
+    esp_event_base_t base;
+    int32_t id;
+    esp_event_handler_t handler;
+    void *arg;
+} mock_handler_t;
+
+typedef struct {
+    bool used;
+    char key[16];
+    uint8_t data[MOCK_MAX_BLOB];
+    size_t length;
+} mock_nvs_entry_t;
+
+/* 调用接口的上下文 */
+typedef enum {
+    MOCK_CTX_APP = 0,
+    MOCK_CTX_EVENT_LOOP,
+    MOCK_CTX_TIMER
+} mock_context_t;
+
+mock_wifi_env_t g_mock_env;
+mock_stats_t g_mock_stats;
+
+static uint32_t s_now;
+static uint32_t s_boot_time_s;      /* 本次启动时的系统时间 */
+static uint32_t s_seq;
+static mock_context_t s_context;
+static mock_event_t s_events[MOCK_MAX_EVENTS];
+static struct mock_timer s_timers[MOCK_MAX_TIMERS];
+static mock_handler_t s_handlers[MOCK_MAX_HANDLERS];
+static int s_handler_count;
+static struct mock_event_group s_event_group;
+static struct mock_netif s_netif;
+static mock_nvs_entry_t s_nvs[MOCK_MAX_NVS_KEYS];
+
+/* WiFi驱动状态 */
+static bool s_wifi_started;
+static bool s_link_up;
+static bool s_scanning;
+static uint32_t s_link_gen;
+static wifi_config_t s_wifi_config;
+static char s_scan_ssid[33];
+static wifi_ap_record_t s_scan_result;
+static uint16_t s_scan_count;
+
+/* SNTP客户端状态 */
+static bool s_sntp_running;
+static uint32_t s_sntp_gen;
+static uint32_t s_sntp_interval_ms;
+static sntp_sync_time_cb_t s_sntp_callback;
+static uint32_t s_ntp_noise_state;
+
+/* 定时器任务中不应调用WiFi/netif接口 */
+static void mock_check_context(void) {
+    if (s_context == MOCK_CTX_TIMER) {
+        g_mock_stats.timer_task_violations++;
+    }
+}
+
+static void mock_schedule(mock_action_t action, uint32_t delay_ms, esp_event_base_t base,
+                          int32_t id, const void *data, size_t size) {
+    for (int i = 0; i < MOCK_MAX_EVENTS; i++) {
+        if (!s_events[i].used) {
+            s_events[i].used = true;
+            s_events[i].action = action;
+            s_events[i].gen = s_link_gen;
+            s_events[i].due = s_now + delay_ms;
+            s_events[i].seq = s_seq++;
+            s_events[i].base = base;
+            s_events[i].id = id;
+            s_events[i].size = (size < sizeof(s_events[i].data)) ? size : sizeof(s_events[i].data);
+            if (data != NULL) {
+                memcpy(s_events[i].data, data, s_events[i].size);
+            }
+            return;
+        }
+    }
+    printf("mock: event queue overflow\n");
+    abort();
+}
+
+static void mock_post_got_ip(void) {
+    ip_event_got_ip_t event = {0};
+
+    event.esp_netif = &s_netif;
+    event.ip_info = s_netif.ip_info;
+    mock_schedule(MOCK_ACT_POST, 0, IP_EVENT, IP_EVENT_STA_GOT_IP, &event, sizeof(event));
+}
+
+/* 按模拟的本地时钟漂移和网络抖动计算NTP服务器给出的时间 */
+static void mock_ntp_time(struct timeval *tv) {
+    int64_t mono_us = (int64_t)s_now * 1000;
+    int64_t true_us = mono_us - (int64_t)((double)mono_us * g_mock_env.ntp_drift_ppm / 1e6);
+
+    if (g_mock_env.ntp_jitter_us > 0) {
+        s_ntp_noise_state = s_ntp_noise_state * 1103515245U + 12345U;
+        true_us += (int64_t)((s_ntp_noise_state >> 8) % (2 * g_mock_env.ntp_jitter_us + 1)) -
+                   g_mock_env.ntp_jitter_us;
+    }
+
+    true_us += MOCK_NTP_EPOCH_S * 1000000LL;
+    tv->tv_sec = (time_t)(true_us / 1000000);
+    tv->tv_usec = (suseconds_t)(true_us % 1000000);
+}
+
+static void mock_schedule_sntp(uint32_t delay_ms) {
+    s_sntp_gen++;
+    mock_schedule(MOCK_ACT_SNTP_SYNC, delay_ms, NULL, (int32_t)s_sntp_gen, NULL, 0);
+}
+
+static void mock_run_action(mock_event_t *event) {
+    /* 链路状态已变化的驱动动作作废 */
+    if (event->action != MOCK_ACT_POST && event->action != MOCK_ACT_SCAN_DONE &&
+        event->action != MOCK_ACT_SNTP_SYNC && event->gen != s_link_gen) {
+        return;
+    }
+
+    switch (event->action) {
+        case MOCK_ACT_ASSOC_DONE:
+            s_link_up = true;
+            mock_schedule(MOCK_ACT_POST, 0, WIFI_EVENT, WIFI_EVENT_STA_CONNECTED, NULL, 0);
+            if (s_netif.dhcp_running) {
+                mock_schedule(MOCK_ACT_DHCP_DONE, g_mock_env.dhcp_ms, NULL, 0, NULL, 0);
+            } else if (s_netif.ip_info.ip.addr != 0) {
+                mock_post_got_ip();
+            }
+            break;
+
+        case MOCK_ACT_CONNECT_FAIL:
+            mock_schedule(MOCK_ACT_POST, 0, WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, NULL, 0);
+            break;
+
+        case MOCK_ACT_SCAN_DONE:
+            s_scanning = false;
+            s_scan_count = 0;
+            if (g_mock_env.ap_present && strcmp(s_scan_ssid, CONFIG_WIFI_SSID) == 0) {
+                memset(&s_scan_result, 0, sizeof(s_scan_result));
+                memcpy(s_scan_result.bssid, g_mock_env.ap_bssid, sizeof(s_scan_result.bssid));
+                strcpy((char *)s_scan_result.ssid, CONFIG_WIFI_SSID);
+                s_scan_result.primary = g_mock_env.ap_channel;
+                s_scan_result.rssi = g_mock_env.ap_rssi;
+                s_scan_count = 1;
+            }
+            mock_schedule(MOCK_ACT_POST, 0, WIFI_EVENT, WIFI_EVENT_SCAN_DONE, NULL, 0);
+            break;
+
+        case MOCK_ACT_DHCP_DONE:
+            if (s_link_up && s_netif.dhcp_running) {
+                s_netif.ip_info.ip.addr = g_mock_env.dhcp_ip;
+                s_netif.ip_info.netmask.addr = 0x00FFFFFFU;
+                s_netif.ip_info.gw.addr = (g_mock_env.dhcp_ip & 0x00FFFFFFU) | 0x01000000U;
+                mock_post_got_ip();
+            }
+            break;
+
+        case MOCK_ACT_SNTP_SYNC:
+            /* 重启或停止后之前安排的请求作废 */
+            if (s_sntp_running && (uint32_t)event->id == s_sntp_gen) {
+                struct timeval tv;
+
+                mock_ntp_time(&tv);
+                g_mock_stats.sntp_syncs++;
+                if (s_sntp_callback != NULL) {
+                    s_sntp_callback(&tv);
+                }
+                /* 与lwIP一致：回调返回后按当前间隔安排下一次请求 */
+                mock_schedule_sntp(s_sntp_interval_ms);
+            }
+            break;
+
+        case MOCK_ACT_POST:
+        default:
+            s_context = MOCK_CTX_EVENT_LOOP;
+            for (int i = 0; i < s_handler_count; i++) {
+                if (s_handlers[i].base == event->base &&
+                    (s_handlers[i].id == ESP_EVENT_ANY_ID || s_handlers[i].id == event->id)) {
+                    s_handlers[i].handler(s_handlers[i].arg, event->base, event->id,
+                                          event->size ? event->data : NULL);
+                }
+            }
+            s_context = MOCK_CTX_APP;
+            break;
+    }
+}
+
+/* 执行到期的下一个事件或定时器，返回false表示until_ms之前没有可执行的 */
+static bool mock_step(uint32_t until_ms, bool *timer_fired) {
+    mock_event_t *next_event = NULL;
+    struct mock_timer *next_timer = NULL;
+
+    for (int i = 0; i < MOCK_MAX_EVENTS; i++) {
+        if (s_events[i].used &&
+            (next_event == NULL || s_events[i].due < next_event->due ||
+             (s_events[i].due == next_event->due && s_events[i].seq < next_event->seq))) {
+            next_event = &s_events[i];
+        }
+    }
+    for (int i = 0; i < MOCK_MAX_TIMERS; i++) {
+        if (s_timers[i].used && s_timers[i].active &&
+            (next_timer == NULL || s_timers[i].due < next_timer->due)) {
+            next_timer = &s_timers[i];
+        }
+    }
+
+    /* 同一时刻先处理事件 */
+    if (next_event != NULL && (next_timer == NULL || next_event->due <= next_timer->due)) {
+        mock_event_t event;
+
+        if (next_event->due > until_ms) {
+            return false;
+        }
+        event = *next_event;
+        next_event->used = false;
+        s_now = event.due;
+        mock_run_action(&event);
+        return true;
+    }
+
+    if (next_timer != NULL && next_timer->due <= until_ms) {
+        s_now = next_timer->due;
+        next_timer->active = false;
+        s_context = MOCK_CTX_TIMER;
+        next_timer->callback(next_timer);
+        s_context = MOCK_CTX_APP;
+        *timer_fired = true;
+        return true;
+    }
+
+    return false;
+}
+
+void mock_run_until(uint32_t until_ms) {
+    bool timer_fired = false;
+
+    while (mock_step(until_ms, &timer_fired)) {
+    }
+    if (s_now < until_ms) {
+        s_now = until_ms;
+    }
+}
+
+bool mock_run_next_timer(void) {
+    bool timer_fired = false;
+
+    while (!timer_fired) {
+        if (!mock_step(UINT32_MAX, &timer_fired)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void mock_reboot(void) {
+    switch (g_mock_env.reset_reason) {
+        case ESP_RST_SW:
+        case ESP_RST_PANIC:
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+        case ESP_RST_DEEPSLEEP:
+            /* RTC定时器没有复位 */
+            s_boot_time_s += s_now / 1000U;
+            break;
+
+        default:
+            s_boot_time_s = 0;
+            break;
+    }
+    s_now = 0;
+    s_seq = 0;
+    s_context = MOCK_CTX_APP;
+    memset(s_events, 0, sizeof(s_events));
+    memset(s_timers, 0, sizeof(s_timers));
+    memset(s_handlers, 0, sizeof(s_handlers));
+    s_handler_count = 0;
+    memset(&s_event_group, 0, sizeof(s_event_group));
+    memset(&s_netif, 0, sizeof(s_netif));
+    s_netif.dhcp_running = true;
+    s_wifi_started = false;
+    s_link_up = false;
+    s_scanning = false;
+    s_link_gen++;
+    memset(&s_wifi_config, 0, sizeof(s_wifi_config));
+    s_scan_count = 0;
+    s_sntp_running = false;
+    s_sntp_interval_ms = 3600000U;
+    s_sntp_callback = NULL;
+    s_ntp_noise_state = 1;
+    memset(&g_mock_stats, 0, sizeof(g_mock_stats));
+}
+
+void mock_nvs_erase(void) {
+    memset(s_nvs, 0, sizeof(s_nvs));
+}
+
+uint32_t mock_now_ms(void) {
+    return s_now;
+}
+
+int mock_pending_events(void) {
+    int count = 0;
+
+    for (int i = 0; i < MOCK_MAX_EVENTS; i++) {
+        if (s_events[i].used && s_events[i].action == MOCK_ACT_POST) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void mock_drop_link(void) {
+    if (s_link_up) {
+        s_link_up = false;
+        s_link_gen++;
+        mock_schedule(MOCK_ACT_POST, 0, WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, NULL, 0);
+    }
+}
+
+uint32_t mock_sntp_interval_ms(void) {
+    return s_sntp_interval_ms;
+}
+
+bool mock_dhcp_running(void) {
+    return s_netif.dhcp_running;
+}
+
+uint32_t mock_netif_ip(void) {
+    return s_netif.ip_info.ip.addr;
+}
+
+size_t mock_nvs_read(const char *key, void *value, size_t length) {
+    for (int i = 0; i < MOCK_MAX_NVS_KEYS; i++) {
+        if (s_nvs[i].used && strcmp(s_nvs[i].key, key) == 0) {
+            length = (length < s_nvs[i].length) ? length : s_nvs[i].length;
+            memcpy(value, s_nvs[i].data, length);
+            return s_nvs[i].length;
+        }
+    }
+    return 0;
+}
+
+void mock_log(const char *level, const char *tag, const char *fmt, ...) {
+    va_list args;
+
+    if (getenv("MOCK_VERBOSE") == NULL) {
+        return;
+    }
+    printf("[%6lu] %s (%s) ", (unsigned long)s_now, level, tag);
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    printf("\n");
+}
+
+/* ---------------- libc / esp_system ---------------- */
+
+/* 替换libc的time()，返回模拟的系统时间 */
+time_t time(time_t *t) {
+    time_t now = (time_t)(s_boot_time_s + s_now / 1000U);
+
+    if (t != NULL) {
+        *t = now;
+    }
+    return now;
+}
+
+esp_reset_reason_t esp_reset_reason(void) {
+    return g_mock_env.reset_reason;
+}
+
+/* ---------------- FreeRTOS ---------------- */
+void mock_critical_enter(int *owner) {
+    if (*owner != 0) {
+        g_mock_stats.critical_violations++;
+    }
+    *owner = 1;
+}
+
+void mock_critical_exit(int *owner) {
+    if (*owner == 0) {
+        g_mock_stats.critical_violations++;
+    }
+    *owner = 0;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return s_now;
+}
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    return &s_event_group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    group->bits |= bits;
+    return group->bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    EventBits_t old = group->bits;
+
+    group->bits &= ~bits;
+    return old;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits,
+                                BaseType_t clear, BaseType_t all, TickType_t wait) {
+    (void)all;
+
+    mock_run_until(s_now + wait);
+    if (clear) {
+        group->bits &= ~bits;
+    }
+    return group->bits;
+}
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, BaseType_t reload,
+                           void *id, TimerCallbackFunction_t callback) {
+    (void)name;
+    (void)period;
+    (void)reload;
+    (void)id;
+
+    for (int i = 0; i < MOCK_MAX_TIMERS; i++) {
+        if (!s_timers[i].used) {
+            s_timers[i].used = true;
+            s_timers[i].active = false;
+            s_timers[i].callback = callback;
+            return &s_timers[i];
+        }
+    }
+    return NULL;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait) {
+    (void)wait;
+
+    /* 与FreeRTOS一致：修改周期同时启动定时器 */
+    timer->active = true;
+    timer->due = s_now + period;
+    return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t wait) {
+    (void)wait;
+
+    timer->active = false;
+    return pdPASS;
+}
+
+/* ---------------- esp_timer / esp_sntp ---------------- */
+int64_t esp_timer_get_time(void) {
+    return (int64_t)s_now * 1000;
+}
+
+void sntp_setoperatingmode(uint8_t mode) {
+    (void)mode;
+}
+
+void sntp_setservername(uint8_t idx, const char *server) {
+    (void)idx;
+    (void)server;
+}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+    s_sntp_callback = callback;
+}
+
+void sntp_set_sync_interval(uint32_t interval_ms) {
+    s_sntp_interval_ms = interval_ms;
+}
+
+void sntp_init(void) {
+    s_sntp_running = true;
+    mock_schedule_sntp(g_mock_env.ntp_response_ms);
+}
+
+bool sntp_restart(void) {
+    if (!s_sntp_running) {
+        return false;
+    }
+    mock_schedule_sntp(g_mock_env.ntp_response_ms);
+    return true;
+}
+
+/* ---------------- esp_event ---------------- */
+esp_err_t esp_event_loop_create_default(void) {
+    return ESP_OK;
+}
+
+esp_err_t esp_event_handler_register(esp_event_base_t base, int32_t id,
+                                     esp_event_handler_t handler, void *arg) {
+    if (s_handler_count == MOCK_MAX_HANDLERS) {
+        return ESP_FAIL;
+    }
+    s_handlers[s_handler_count].base = base;
+    s_handlers[s_handler_count].id = id;
+    s_handlers[s_handler_count].handler = handler;
+    s_handlers[s_handler_count].arg = arg;
+    s_handler_count++;
+    return ESP_OK;
+}
+
+esp_err_t esp_event_post(esp_event_base_t base, int32_t id, const void *data,
+                         size_t size, TickType_t wait) {
+    (void)wait;
+
+    mock_schedule(MOCK_ACT_POST, 0, base, id, data, size);
+    return ESP_OK;
+}
+
+/* ---------------- esp_netif ---------------- */
+esp_err_t esp_netif_init(void) {
+    return ESP_OK;
+}
+
+esp_netif_t *esp_netif_create_default_wifi_sta(void) {
+    return &s_netif;
+}
+
+esp_netif_t *esp_netif_get_handle_from_ifkey(const char *key) {
+    (void)key;
+    return &s_netif;
+}
+
+esp_err_t esp_netif_dhcpc_start(esp_netif_t *netif) {
+    mock_check_context();
+    if (netif->dhcp_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    /* 与ESP-IDF一致：启动DHCP客户端时清除接口地址，直到拿到新租约 */
+    netif->dhcp_running = true;
+    memset(&netif->ip_info, 0, sizeof(netif->ip_info));
+    g_mock_stats.dhcp_starts++;
+    if (s_link_up) {
+        mock_schedule(MOCK_ACT_DHCP_DONE, g_mock_env.dhcp_ms, NULL, 0, NULL, 0);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_netif_dhcpc_stop(esp_netif_t *netif) {
+    mock_check_context();
+    if (!netif->dhcp_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    netif->dhcp_running = false;
+    memset(&netif->ip_info, 0, sizeof(netif->ip_info));
+    return ESP_OK;
+}
+
+esp_err_t esp_netif_set_ip_info(esp_netif_t *netif, const esp_netif_ip_info_t *info) {
+    mock_check_context();
+    /* 与ESP-IDF一致：DHCP客户端运行时不能设置静态地址 */
+    if (netif->dhcp_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    netif->ip_info = *info;
+    g_mock_stats.static_ip_sets++;
+    if (s_link_up) {
+        mock_post_got_ip();
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_netif_get_ip_info(esp_netif_t *netif, esp_netif_ip_info_t *info) {
+    *info = netif->ip_info;
+    return ESP_OK;
+}
+
+/* ---------------- esp_wifi ---------------- */
+esp_err_t esp_wifi_init(const wifi_init_config_t *config) {
+    (void)config;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode) {
+    (void)mode;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(wifi_interface_t iface, wifi_config_t *config) {
+    (void)iface;
+    mock_check_context();
+    s_wifi_config = *config;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_config(wifi_interface_t iface, wifi_config_t *config) {
+    (void)iface;
+    *config = s_wifi_config;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_start(void) {
+    s_wifi_started = true;
+    mock_schedule(MOCK_ACT_POST, 0, WIFI_EVENT, WIFI_EVENT_STA_START, NULL, 0);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_stop(void) {
+    mock_check_context();
+    s_wifi_started = false;
+    s_link_up = false;
+    s_link_gen++;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_connect(void) {
+    const wifi_sta_config_t *sta = &s_wifi_config.sta;
+    bool match;
+
+    mock_check_context();
+    if (!s_wifi_started) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    g_mock_stats.connects++;
+    if (sta->bssid_set && sta->channel != 0) {
+        g_mock_stats.directed_connects++;
+    }
+
+    match = g_mock_env.ap_present &&
+            (!sta->bssid_set || memcmp(sta->bssid, g_mock_env.ap_bssid, 6) == 0) &&
+            (sta->channel == 0 || sta->channel == g_mock_env.ap_channel);
+
+    s_link_gen++;
+    if (match) {
+        mock_schedule(MOCK_ACT_ASSOC_DONE, g_mock_env.assoc_ms, NULL, 0, NULL, 0);
+    } else {
+        mock_schedule(MOCK_ACT_CONNECT_FAIL, g_mock_env.connect_fail_ms, NULL, 0, NULL, 0);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_disconnect(void) {
+    mock_check_context();
+    /* 进行中的连接也被取消 */
+    s_link_gen++;
+    if (s_link_up) {
+        s_link_up = false;
+        mock_schedule(MOCK_ACT_POST, 0, WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, NULL, 0);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block) {
+    (void)block;
+    mock_check_context();
+    if (!s_wifi_started || s_scanning) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (g_mock_stats.scans < 16) {
+        g_mock_stats.scan_start_ms[g_mock_stats.scans] = s_now;
+    }
+    g_mock_stats.scans++;
+    s_scanning = true;
+    snprintf(s_scan_ssid, sizeof(s_scan_ssid), "%s",
+             (config != NULL && config->ssid != NULL) ? (const char *)config->ssid : "");
+    mock_schedule(MOCK_ACT_SCAN_DONE, g_mock_env.scan_ms, NULL, 0, NULL, 0);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_num(uint16_t *number) {
+    *number = s_scan_count;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *records) {
+    if (*number > s_scan_count) {
+        *number = s_scan_count;
+    }
+    if (*number > 0) {
+        records[0] = s_scan_result;
+    }
+    s_scan_count = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *info) {
+    if (!s_link_up) {
+        return ESP_FAIL;
+    }
+    memset(info, 0, sizeof(*info));
+    memcpy(info->bssid, g_mock_env.ap_bssid, sizeof(info->bssid));
+    strcpy((char *)info->ssid, CONFIG_WIFI_SSID);
+    info->primary = g_mock_env.ap_channel;
+    info->rssi = g_mock_env.ap_rssi;
+    return ESP_OK;
+}
+
+/* ---------------- nvs ---------------- */
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *handle) {
+    (void)name;
+    (void)mode;
+    *handle = 1;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *value, size_t *length) {
+    (void)handle;
+
+    for (int i = 0; i < MOCK_MAX_NVS_KEYS; i++) {
+        if (s_nvs[i].used && strcmp(s_nvs[i].key, key) == 0) {
+            if (*length < s_nvs[i].length) {
+                return ESP_FAIL;
+            }
+            memcpy(value, s_nvs[i].data, s_nvs[i].length);
+            *length = s_nvs[i].length;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) {
+    mock_nvs_entry_t *entry = NULL;
+
+    (void)handle;
+    if (length > MOCK_MAX_BLOB) {
+        return ESP_FAIL;
+    }
+
+    for (int i = 0; i < MOCK_MAX_NVS_KEYS; i++) {
+        if (s_nvs[i].used && strcmp(s_nvs[i].key, key) == 0) {
+            entry = &s_nvs[i];
+            break;
+        }
+        if (!s_nvs[i].used && entry == NULL) {
+            entry = &s_nvs[i];
+        }
+    }
+    if (entry == NULL) {
+        return ESP_FAIL;
+    }
+
+    entry->used = true;
+    snprintf(entry->key, sizeof(entry->key), "%s", key);
+    memcpy(entry->data, value, length);
+    entry->length = length;
+    g_mock_stats.nvs_writes++;
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    (void)handle;
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    (void)handle;
+}
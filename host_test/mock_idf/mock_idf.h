@@ -0,0 +1,317 @@
+#ifndef __MOCK_IDF_H
+#define __MOCK_IDF_H
+
+/*
+ * 主机测试用的ESP-IDF/FreeRTOS替身
+ *
+ * 只提供wifi_manager.c和time_service.c用到的接口。时间是模拟的(1 tick = 1 ms)，
+ * WiFi驱动、DHCP、SNTP、事件循环和定时器任务都由mock_idf.c中的模拟器驱动。
+ * mock_idf.c同时替换了libc的time()，返回模拟的系统时间。
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+
+/* 配置 */
+#define CONFIG_WIFI_SSID            "HostTestAP"
+#define CONFIG_WIFI_PASSWORD        "password"
+#define CONFIG_WIFI_MAXIMUM_RETRY   5
+
+/* ---------------- FreeRTOS ---------------- */
+typedef uint32_t TickType_t;
+typedef uint32_t EventBits_t;
+typedef int BaseType_t;
+typedef struct mock_event_group *EventGroupHandle_t;
+typedef struct mock_timer *TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t timer);
+typedef struct {
+    int owner;
+} portMUX_TYPE;
+
+#define pdFALSE                 0
+#define pdTRUE                  1
+#define pdPASS                  1
+#define portMAX_DELAY           0xFFFFFFFFU
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define pdTICKS_TO_MS(ticks)    ((uint32_t)(ticks))
+#define BIT0                    0x00000001U
+#define BIT1                    0x00000002U
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+
+/* 模拟器是单线程的，临界区只做检查 */
+#define portENTER_CRITICAL(mux)     mock_critical_enter(&(mux)->owner)
+#define portEXIT_CRITICAL(mux)      mock_critical_exit(&(mux)->owner)
+
+void mock_critical_enter(int *owner);
+void mock_critical_exit(int *owner);
+
+TickType_t xTaskGetTickCount(void);
+
+EventGroupHandle_t xEventGroupCreate(void);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits,
+                                BaseType_t clear, BaseType_t all, TickType_t wait);
+
+TimerHandle_t xTimerCreate(const char *name, TickType_t period, BaseType_t reload,
+                           void *id, TimerCallbackFunction_t callback);
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait);
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t wait);
+
+/* ---------------- esp_err / esp_log ---------------- */
+typedef int esp_err_t;
+
+#define ESP_OK                  0
+#define ESP_FAIL                -1
+#define ESP_ERR_NOT_FOUND       0x105
+#define ESP_ERR_INVALID_STATE   0x103
+
+#define ESP_ERROR_CHECK(x)      do { esp_err_t err_ = (x); if (err_ != ESP_OK) { \
+        printf("ESP_ERROR_CHECK failed: %s (%d)\n", #x, err_); abort(); } } while (0)
+
+void mock_log(const char *level, const char *tag, const char *fmt, ...);
+
+#define ESP_LOGE(tag, ...)      mock_log("E", tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...)      mock_log("W", tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...)      mock_log("I", tag, __VA_ARGS__)
+
+/* ---------------- esp_system ---------------- */
+typedef enum {
+    ESP_RST_UNKNOWN = 0,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO
+} esp_reset_reason_t;
+
+esp_reset_reason_t esp_reset_reason(void);
+
+/* ---------------- esp_timer / esp_sntp ---------------- */
+#define SNTP_OPMODE_POLL    0
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+int64_t esp_timer_get_time(void);
+
+void sntp_setoperatingmode(uint8_t mode);
+void sntp_setservername(uint8_t idx, const char *server);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+void sntp_set_sync_interval(uint32_t interval_ms);
+void sntp_init(void);
+bool sntp_restart(void);
+
+/* ---------------- esp_event ---------------- */
+typedef const char *esp_event_base_t;
+typedef void (*esp_event_handler_t)(void *arg, esp_event_base_t base,
+                                    int32_t id, void *data);
+
+#define ESP_EVENT_ANY_ID                -1
+#define ESP_EVENT_DECLARE_BASE(id)      extern esp_event_base_t const id
+#define ESP_EVENT_DEFINE_BASE(id)       esp_event_base_t const id = #id
+
+ESP_EVENT_DECLARE_BASE(WIFI_EVENT);
+ESP_EVENT_DECLARE_BASE(IP_EVENT);
+
+esp_err_t esp_event_loop_create_default(void);
+esp_err_t esp_event_handler_register(esp_event_base_t base, int32_t id,
+                                     esp_event_handler_t handler, void *arg);
+esp_err_t esp_event_post(esp_event_base_t base, int32_t id, const void *data,
+                         size_t size, TickType_t wait);
+
+/* ---------------- esp_netif ---------------- */
+typedef struct {
+    uint32_t addr;
+} esp_ip4_addr_t;
+
+typedef struct {
+    esp_ip4_addr_t ip;
+    esp_ip4_addr_t netmask;
+    esp_ip4_addr_t gw;
+} esp_netif_ip_info_t;
+
+typedef struct mock_netif esp_netif_t;
+
+#define IPSTR           "%d.%d.%d.%d"
+#define IP2STR(a)       (int)((a)->addr & 0xff), (int)(((a)->addr >> 8) & 0xff), \
+                        (int)(((a)->addr >> 16) & 0xff), (int)(((a)->addr >> 24) & 0xff)
+
+esp_err_t esp_netif_init(void);
+esp_netif_t *esp_netif_create_default_wifi_sta(void);
+esp_netif_t *esp_netif_get_handle_from_ifkey(const char *key);
+esp_err_t esp_netif_dhcpc_start(esp_netif_t *netif);
+esp_err_t esp_netif_dhcpc_stop(esp_netif_t *netif);
+esp_err_t esp_netif_set_ip_info(esp_netif_t *netif, const esp_netif_ip_info_t *info);
+esp_err_t esp_netif_get_ip_info(esp_netif_t *netif, esp_netif_ip_info_t *info);
+
+/* ---------------- esp_wifi ---------------- */
+typedef enum {
+    WIFI_EVENT_SCAN_DONE = 1,
+    WIFI_EVENT_STA_START = 2,
+    WIFI_EVENT_STA_CONNECTED = 4,
+    WIFI_EVENT_STA_DISCONNECTED = 5
+} wifi_event_t;
+
+typedef enum {
+    IP_EVENT_STA_GOT_IP = 0,
+    IP_EVENT_STA_LOST_IP = 1
+} ip_event_t;
+
+typedef struct {
+    esp_netif_t *esp_netif;
+    esp_netif_ip_info_t ip_info;
+    bool ip_changed;
+} ip_event_got_ip_t;
+
+typedef enum { WIFI_MODE_STA = 1 } wifi_mode_t;
+typedef enum { WIFI_IF_STA = 0 } wifi_interface_t;
+typedef enum { WIFI_AUTH_WPA2_PSK = 3 } wifi_auth_mode_t;
+typedef enum { WIFI_FAST_SCAN = 0, WIFI_ALL_CHANNEL_SCAN = 1 } wifi_scan_method_t;
+typedef enum { WIFI_SCAN_TYPE_ACTIVE = 0 } wifi_scan_type_t;
+
+typedef struct {
+    uint8_t ssid[32];
+    uint8_t password[64];
+    wifi_scan_method_t scan_method;
+    bool bssid_set;
+    uint8_t bssid[6];
+    uint8_t channel;
+    struct {
+        wifi_auth_mode_t authmode;
+    } threshold;
+    struct {
+        bool capable;
+        bool required;
+    } pmf_cfg;
+} wifi_sta_config_t;
+
+typedef union {
+    wifi_sta_config_t sta;
+} wifi_config_t;
+
+typedef struct {
+    uint8_t *ssid;
+    uint8_t *bssid;
+    uint8_t channel;
+    bool show_hidden;
+    wifi_scan_type_t scan_type;
+    struct {
+        struct {
+            uint32_t min;
+            uint32_t max;
+        } active;
+    } scan_time;
+} wifi_scan_config_t;
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    int8_t rssi;
+} wifi_ap_record_t;
+
+typedef struct {
+    int dummy;
+} wifi_init_config_t;
+
+#define WIFI_INIT_CONFIG_DEFAULT()  { 0 }
+#define MACSTR                      "%02x:%02x:%02x:%02x:%02x:%02x"
+#define MAC2STR(a)                  (a)[0], (a)[1], (a)[2], (a)[3], (a)[4], (a)[5]
+
+esp_err_t esp_wifi_init(const wifi_init_config_t *config);
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode);
+esp_err_t esp_wifi_set_config(wifi_interface_t iface, wifi_config_t *config);
+esp_err_t esp_wifi_get_config(wifi_interface_t iface, wifi_config_t *config);
+esp_err_t esp_wifi_start(void);
+esp_err_t esp_wifi_stop(void);
+esp_err_t esp_wifi_connect(void);
+esp_err_t esp_wifi_disconnect(void);
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block);
+esp_err_t esp_wifi_scan_get_ap_num(uint16_t *number);
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *records);
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *info);
+
+/* ---------------- nvs ---------------- */
+typedef uint32_t nvs_handle_t;
+typedef enum { NVS_READONLY = 0, NVS_READWRITE = 1 } nvs_open_mode_t;
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *handle);
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *value, size_t *length);
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length);
+esp_err_t nvs_commit(nvs_handle_t handle);
+void nvs_close(nvs_handle_t handle);
+
+/* ---------------- 模拟器控制 ---------------- */
+
+/* 模拟时间0点对应的NTP服务器时间(2026-01-01 00:00:00 UTC) */
+#define MOCK_NTP_EPOCH_S    1767225600LL
+
+/* 模拟的AP、链路时序和NTP服务器，时间单位ms */
+typedef struct {
+    bool ap_present;
+    uint8_t ap_bssid[6];
+    uint8_t ap_channel;
+    int8_t ap_rssi;
+    uint32_t dhcp_ip;           /* DHCP服务器分配的地址 */
+    uint32_t assoc_ms;          /* 认证+关联 */
+    uint32_t connect_fail_ms;   /* 连接失败上报DISCONNECTED的时间 */
+    uint32_t dhcp_ms;           /* DISCOVER到ACK */
+    uint32_t scan_ms;           /* 全信道扫描 */
+    esp_reset_reason_t reset_reason;    /* mock_reboot的复位原因，决定系统时间是否连续 */
+    double ntp_drift_ppm;       /* 本地时钟相对NTP服务器的漂移，正值表示本地时钟快 */
+    uint32_t ntp_jitter_us;     /* 每次同步测得时间的随机误差上限(网络延迟不对称) */
+    uint32_t ntp_response_ms;   /* 启动或重启SNTP到第一次同步 */
+} mock_wifi_env_t;
+
+/* 模拟过程中记录的调用 */
+typedef struct {
+    int scans;                  /* esp_wifi_scan_start次数 */
+    int connects;               /* esp_wifi_connect次数 */
+    int directed_connects;      /* 指定BSSID和信道的连接次数 */
+    int dhcp_starts;            /* DHCP客户端从停止到启动的次数 */
+    int static_ip_sets;         /* esp_netif_set_ip_info次数 */
+    int timer_task_violations;  /* 在定时器任务中调用WiFi/netif接口的次数 */
+    int nvs_writes;
+    int sntp_syncs;             /* SNTP同步通知次数 */
+    int critical_violations;    /* 临界区嵌套或不配对的次数 */
+    uint32_t scan_start_ms[16]; /* 前16次扫描的开始时间 */
+} mock_stats_t;
+
+extern mock_wifi_env_t g_mock_env;
+extern mock_stats_t g_mock_stats;
+
+/* 重启：清空事件、定时器和驱动状态，保留NVS。
+   复位原因为软件复位等时系统时间接着走，否则从0开始 */
+void mock_reboot(void);
+/* 擦除NVS */
+void mock_nvs_erase(void);
+/* 运行模拟器直到时间到达until_ms或没有待处理的事件和定时器 */
+void mock_run_until(uint32_t until_ms);
+/* 运行模拟器直到下一个定时器回调执行完(不处理之后的事件) */
+bool mock_run_next_timer(void);
+/* 当前模拟时间 */
+uint32_t mock_now_ms(void);
+/* 事件队列中待处理的事件数 */
+int mock_pending_events(void);
+/* 链路断开(AP掉电等) */
+void mock_drop_link(void);
+/* DHCP客户端是否运行，以及当前接口地址 */
+bool mock_dhcp_running(void);
+uint32_t mock_netif_ip(void);
+/* 当前SNTP的同步间隔 */
+uint32_t mock_sntp_interval_ms(void);
+/* 读取NVS中保存的blob，返回长度，0表示不存在 */
+size_t mock_nvs_read(const char *key, void *value, size_t length);
+
+#endif /* __MOCK_IDF_H */
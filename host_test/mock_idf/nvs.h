@@ -0,0 +1,7 @@
+#ifndef __MOCK_NVS_H
+#define __MOCK_NVS_H
+
+/* 主机测试替身，见mock_idf.h */
+#include "mock_idf.h"
+
+#endif /* __MOCK_NVS_H */
@@ -0,0 +1,7 @@
+#ifndef __MOCK_CMSIS_OS_H
+#define __MOCK_CMSIS_OS_H
+
+/* 主机测试替身，见mock_rtos.h */
+#include "mock_rtos.h"
+
+#endif /* __MOCK_CMSIS_OS_H */
@@ -0,0 +1,15 @@
+#ifndef __MOCK_DISPLAY_TASK_H
+#define __MOCK_DISPLAY_TASK_H
+
+/* 主机测试替身，显示设置的类型见mock_rtos.h */
+#include "mock_rtos.h"
+
+void DisplayTask(void *argument);
+void DisplayShowSnapshot(const WeatherData *weather, const TimeData *time,
+                         bool restored);
+void ChangeDisplayMode(DisplayMode new_mode);
+void AdjustBrightness(uint8_t brightness);
+void ToggleTemperatureUnit(void);
+void ToggleTimeFormat(void);
+
+#endif /* __MOCK_DISPLAY_TASK_H */
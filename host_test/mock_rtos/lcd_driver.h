@@ -0,0 +1,21 @@
+#ifndef __MOCK_LCD_DRIVER_H
+#define __MOCK_LCD_DRIVER_H
+
+/* 主机测试替身，由测试程序实现。240x320，8x16字体 */
+#include "mock_rtos.h"
+
+#define LCD_WIDTH       240
+#define LCD_HEIGHT      320
+
+#define COLOR_BLACK     0x0000
+#define COLOR_WHITE     0xFFFF
+#define COLOR_RED       0xF800
+#define COLOR_YELLOW    0xFFE0
+
+void LCD_Init(void);
+void LCD_Clear(uint16_t color);
+void LCD_SetBrightness(uint8_t brightness);
+void LCD_DrawString(uint16_t x, uint16_t y, const char *str,
+                    uint16_t color, uint16_t background);
+
+#endif /* __MOCK_LCD_DRIVER_H */
@@ -0,0 +1,231 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mock_rtos.h"
+
+struct mock_thread {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t flags;
+};
+
+struct mock_queue {
+    uint32_t count;
+    uint32_t size;
+    uint32_t head;
+    uint32_t used;
+    uint8_t *data;
+    uint64_t *put_ns;
+    pthread_cond_t not_empty;
+};
+
+/* 全局临界区，对应单核MCU上的关中断 */
+static pthread_mutex_t critical_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* 每个线程的独占监视器 */
+static __thread volatile uint32_t *exclusive_addr = NULL;
+static __thread uint32_t exclusive_value = 0;
+
+static __thread osThreadId_t current_thread = NULL;
+__thread uint64_t mock_queue_put_ns = 0;
+
+CoreDebug_Type mock_core_debug;
+DWT_Type mock_dwt;
+uint32_t SystemCoreClock = 16000000U;
+uint8_t mock_bkpsram[MOCK_BKPSRAM_SIZE] __attribute__((aligned(8)));
+bool mock_backup_regulator_ok = true;
+
+uint64_t mock_now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t osKernelGetTickCount(void) {
+    return (uint32_t)(mock_now_ns() / 1000000ULL);
+}
+
+uint32_t osKernelGetTickFreq(void) {
+    return 1000U;
+}
+
+void mock_cycles_advance(uint32_t us) {
+    if ((mock_core_debug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk) &&
+        (mock_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        mock_dwt.CYCCNT += us * (SystemCoreClock / 1000000U);
+    }
+}
+
+void HAL_PWR_EnableBkUpAccess(void) {
+}
+
+HAL_StatusTypeDef HAL_PWREx_EnableBkUpReg(void) {
+    return mock_backup_regulator_ok ? HAL_OK : HAL_ERROR;
+}
+
+/* 临界区不可嵌套，和关中断的用法一致 */
+void mock_critical_enter(void) {
+    pthread_mutex_lock(&critical_lock);
+}
+
+void mock_critical_exit(void) {
+    pthread_mutex_unlock(&critical_lock);
+}
+
+/* LDREX记录地址和读到的值 */
+uint32_t __LDREXW(volatile uint32_t *addr) {
+    exclusive_addr = addr;
+    exclusive_value = __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+    return exclusive_value;
+}
+
+/* STREX只在值未被其他线程修改时写入，成功返回0 */
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr) {
+    uint32_t expected = exclusive_value;
+    bool stored;
+
+    if (exclusive_addr != addr) {
+        return 1U;
+    }
+    exclusive_addr = NULL;
+    stored = __atomic_compare_exchange_n(addr, &expected, value, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return stored ? 0U : 1U;
+}
+
+osThreadId_t mock_thread_attach(void) {
+    osThreadId_t thread = calloc(1, sizeof(*thread));
+
+    pthread_mutex_init(&thread->lock, NULL);
+    pthread_cond_init(&thread->cond, NULL);
+    current_thread = thread;
+    return thread;
+}
+
+osThreadId_t osThreadGetId(void) {
+    return current_thread;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread, uint32_t flags) {
+    uint32_t result;
+
+    if (thread == NULL) {
+        return (uint32_t)osErrorParameter;
+    }
+
+    pthread_mutex_lock(&thread->lock);
+    thread->flags |= flags;
+    result = thread->flags;
+    pthread_cond_signal(&thread->cond);
+    pthread_mutex_unlock(&thread->lock);
+    return result;
+}
+
+/* 只支持等待任一标志并清除，超时单位ms */
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    osThreadId_t thread = current_thread;
+    struct timespec deadline;
+    uint32_t result;
+
+    (void)options;
+    if (thread == NULL) {
+        return (uint32_t)osErrorParameter;
+    }
+
+    if (timeout != osWaitForever) {
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += timeout / 1000U;
+        deadline.tv_nsec += (long)(timeout % 1000U) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    pthread_mutex_lock(&thread->lock);
+    while (!(thread->flags & flags)) {
+        if (timeout == 0U) {
+            pthread_mutex_unlock(&thread->lock);
+            return osFlagsErrorTimeout;
+        }
+        if (timeout == osWaitForever) {
+            pthread_cond_wait(&thread->cond, &thread->lock);
+        } else if (pthread_cond_timedwait(&thread->cond, &thread->lock, &deadline) != 0) {
+            pthread_mutex_unlock(&thread->lock);
+            return osFlagsErrorTimeout;
+        }
+    }
+    result = thread->flags & flags;
+    thread->flags &= ~result;
+    pthread_mutex_unlock(&thread->lock);
+    return result;
+}
+
+osMessageQueueId_t osMessageQueueNew(uint32_t count, uint32_t size, const void *attr) {
+    osMessageQueueId_t queue = calloc(1, sizeof(*queue));
+
+    (void)attr;
+    queue->count = count;
+    queue->size = size;
+    queue->data = calloc(count, size);
+    queue->put_ns = calloc(count, sizeof(uint64_t));
+    pthread_cond_init(&queue->not_empty, NULL);
+    return queue;
+}
+
+/* 只支持超时为0：队列满时立即返回osErrorResource，和原来的调用方式一致 */
+osStatus_t osMessageQueuePut(osMessageQueueId_t queue, const void *msg,
+                             uint8_t prio, uint32_t timeout) {
+    uint64_t put_ns = mock_now_ns();
+    uint32_t tail;
+
+    (void)prio;
+    (void)timeout;
+
+    /* 时间戳在进入临界区之前取，等待临界区的时间也计入延迟 */
+    pthread_mutex_lock(&critical_lock);
+    if (queue->used == queue->count) {
+        pthread_mutex_unlock(&critical_lock);
+        return osErrorResource;
+    }
+
+    tail = (queue->head + queue->used) % queue->count;
+    memcpy(queue->data + tail * queue->size, msg, queue->size);
+    queue->put_ns[tail] = put_ns;
+    queue->used++;
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&critical_lock);
+    return osOK;
+}
+
+/* 只支持超时为0或osWaitForever */
+osStatus_t osMessageQueueGet(osMessageQueueId_t queue, void *msg,
+                             uint8_t *prio, uint32_t timeout) {
+    pthread_mutex_lock(&critical_lock);
+    while (queue->used == 0U) {
+        if (timeout == 0U) {
+            pthread_mutex_unlock(&critical_lock);
+            return osErrorResource;
+        }
+        pthread_cond_wait(&queue->not_empty, &critical_lock);
+    }
+
+    memcpy(msg, queue->data + queue->head * queue->size, queue->size);
+    mock_queue_put_ns = queue->put_ns[queue->head];
+    queue->head = (queue->head + 1U) % queue->count;
+    queue->used--;
+    pthread_mutex_unlock(&critical_lock);
+
+    if (prio) {
+        *prio = 0;
+    }
+    return osOK;
+}
+
+void osMessageQueueDelete(osMessageQueueId_t queue) {
+    pthread_cond_destroy(&queue->not_empty);
+    free(queue->data);
+    free(queue->put_ns);
+    free(queue);
+}
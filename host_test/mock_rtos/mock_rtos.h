@@ -0,0 +1,185 @@
+#ifndef __MOCK_RTOS_H
+#define __MOCK_RTOS_H
+
+/*
+ * 主机测试用的CMSIS-RTOS2/Cortex-M替身
+ *
+ * 只提供App_下被测模块用到的接口。线程是pthread，线程标志用
+ * 互斥量加条件变量实现；消息队列按FreeRTOS的语义实现：放入和取出都在
+ * 全局"临界区"(一个互斥量，对应关中断)内完成，超时为0时队列满就丢弃。
+ * LDREX/STREX用线程局部的独占监视器加比较交换模拟。
+ * DWT周期计数器不会自己走，由测试用mock_cycles_advance()推进；
+ * 备份SRAM是一块静态数组，模拟复位时保留内容。
+ * 内核节拍为1kHz，由单调时钟换算。
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* ---------------- Cortex-M ---------------- */
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+extern CoreDebug_Type mock_core_debug;
+extern DWT_Type mock_dwt;
+extern uint32_t SystemCoreClock;
+
+#define CoreDebug                       (&mock_core_debug)
+#define DWT                             (&mock_dwt)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0)
+
+/* 按当前SystemCoreClock把周期计数器推进us微秒，计数器未使能时不动 */
+void mock_cycles_advance(uint32_t us);
+
+/* ---------------- STM32 HAL ---------------- */
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR = 1
+} HAL_StatusTypeDef;
+
+/* STM32F407的备份SRAM为4KB */
+#define MOCK_BKPSRAM_SIZE               4096U
+extern uint8_t mock_bkpsram[MOCK_BKPSRAM_SIZE];
+#define BKPSRAM_BASE                    ((uintptr_t)mock_bkpsram)
+
+#define __HAL_RCC_PWR_CLK_ENABLE()      do { } while (0)
+#define __HAL_RCC_BKPSRAM_CLK_ENABLE()  do { } while (0)
+void HAL_PWR_EnableBkUpAccess(void);
+HAL_StatusTypeDef HAL_PWREx_EnableBkUpReg(void);
+
+/* 备份调节器是否能打开，模拟没有VBAT的板子时设为false */
+extern bool mock_backup_regulator_ok;
+
+/* ---------------- CMSIS-RTOS2 ---------------- */
+typedef enum {
+    osOK = 0,
+    osError = -1,
+    osErrorTimeout = -2,
+    osErrorResource = -3,
+    osErrorParameter = -4
+} osStatus_t;
+
+typedef struct mock_thread *osThreadId_t;
+typedef struct mock_queue *osMessageQueueId_t;
+
+#define osWaitForever           0xFFFFFFFFU
+#define osFlagsWaitAny          0x00000000U
+#define osFlagsError            0x80000000U
+#define osFlagsErrorTimeout     0xFFFFFFFEU
+
+/* 为调用线程创建一个可接收线程标志的RTOS线程对象 */
+osThreadId_t mock_thread_attach(void);
+osThreadId_t osThreadGetId(void);
+uint32_t osThreadFlagsSet(osThreadId_t thread, uint32_t flags);
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+osMessageQueueId_t osMessageQueueNew(uint32_t count, uint32_t size, const void *attr);
+osStatus_t osMessageQueuePut(osMessageQueueId_t queue, const void *msg,
+                             uint8_t prio, uint32_t timeout);
+osStatus_t osMessageQueueGet(osMessageQueueId_t queue, void *msg,
+                             uint8_t *prio, uint32_t timeout);
+void osMessageQueueDelete(osMessageQueueId_t queue);
+
+/* 内核节拍，1kHz */
+uint32_t osKernelGetTickCount(void);
+uint32_t osKernelGetTickFreq(void);
+
+/* FreeRTOS节拍接口 */
+typedef uint32_t TickType_t;
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+#define xTaskGetTickCount()             ((TickType_t)osKernelGetTickCount())
+
+/* FreeRTOS临界区，用全局临界区互斥量实现 */
+void mock_critical_enter(void);
+void mock_critical_exit(void);
+#define taskENTER_CRITICAL()            mock_critical_enter()
+#define taskEXIT_CRITICAL()             mock_critical_exit()
+
+/* 取出的消息放入队列时的时间(ns)，仅用于测量队列延迟 */
+extern __thread uint64_t mock_queue_put_ns;
+
+/* 单调时钟，单位ns */
+uint64_t mock_now_ns(void);
+
+/* ---------------- project_defines.h ---------------- */
+
+#define DEBUG_PRINT(fmt, ...)           printf(fmt "\n", ##__VA_ARGS__)
+
+/* 天气和时间数据，工程中的完整定义不在这里，快照只按字节整体复制 */
+typedef struct {
+    int16_t temperature;
+    uint8_t humidity;
+    uint8_t weather_code;
+    char city[16];
+} WeatherData;
+
+typedef struct {
+    uint8_t hours;
+    uint8_t minutes;
+    uint8_t seconds;
+    uint8_t day;
+    uint8_t month;
+    uint16_t year;
+} TimeData;
+
+/* 显示设置和系统状态，只包含App_下用到的字段 */
+typedef enum {
+    DISPLAY_MODE_CLOCK = 0,
+    DISPLAY_MODE_WEATHER,
+    DISPLAY_MODE_COUNT
+} DisplayMode;
+
+typedef enum {
+    TEMP_UNIT_CELSIUS = 0,
+    TEMP_UNIT_FAHRENHEIT
+} TempUnit;
+
+typedef enum {
+    TIME_FORMAT_24H = 0,
+    TIME_FORMAT_12H
+} TimeFormat;
+
+typedef struct {
+    DisplayMode current_mode;
+    uint8_t brightness;
+    uint32_t refresh_interval;          /* ms */
+    TempUnit temp_unit;
+    TimeFormat time_format;
+} UIConfig;
+
+typedef struct {
+    bool wifi_connected;
+    bool weather_data_valid;
+    bool time_synced;
+    uint8_t battery_level;
+    uint32_t uptime_seconds;
+} SystemStatus;
+
+extern UIConfig ui_config;
+extern SystemStatus system_status;
+extern osMessageQueueId_t weatherQueueHandle;
+extern osMessageQueueId_t timeQueueHandle;
+
+/* 事件类型，与工程中的定义保持一致 */
+typedef enum {
+    EVENT_WEATHER_UPDATE = 0,
+    EVENT_TIME_UPDATE,
+    EVENT_MODE_CHANGE,
+    EVENT_UART_DATA_RECEIVED,
+    EVENT_TYPE_COUNT
+} EventType;
+
+#endif /* __MOCK_RTOS_H */
@@ -0,0 +1,7 @@
+#ifndef __MOCK_PROJECT_DEFINES_H
+#define __MOCK_PROJECT_DEFINES_H
+
+/* 主机测试替身，见mock_rtos.h */
+#include "mock_rtos.h"
+
+#endif /* __MOCK_PROJECT_DEFINES_H */
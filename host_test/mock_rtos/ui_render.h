@@ -0,0 +1,11 @@
+#ifndef __MOCK_UI_RENDER_H
+#define __MOCK_UI_RENDER_H
+
+/* 主机测试替身，由测试程序实现 */
+#include "mock_rtos.h"
+
+void RenderDisplay(const TimeData *time, const WeatherData *weather,
+                   const UIConfig *config, const SystemStatus *status);
+void RenderModeChange(DisplayMode mode);
+
+#endif /* __MOCK_UI_RENDER_H */
@@ -0,0 +1,360 @@
+/*
+ * 推送延迟的主机仿真
+ *
+ * 直接包含notify_client.c和display_task.c，显示任务跑在自己的线程里，主线程
+ * 扮演串口任务：按ESP32端notify_service.c的格式构造推送帧，等待它在115200
+ * 波特率下传完的时间，再交给NotifyClient_HandleFrame，然后等显示任务画完。
+ * LCD按8x16字体经21MHz SPI估算，每个字符约98us，画的内容写入一块字符屏，
+ * 用来检查屏幕上的结果。
+ *
+ * 每条推送测量：
+ *   传输    推送帧在串口上的传输时间(模型)
+ *   显示    从NotifyClient_HandleFrame到显示任务画完推送行(实测)
+ *   端到端  两者之和，即从ESP32发出到STM32屏幕上出现
+ * 推送到达的时刻在刷新周期中随机分布，以便和等待下一次刷新的方式比较。
+ *
+ * 检查以下情况，任何一项失败时返回非0：
+ *   天气状况、空气质量和告警显示在各自的行上，华氏度和零下温度格式正确
+ *   告警解除后告警行清空，较短的内容盖住较长的内容
+ *   显示延迟远小于刷新周期，NotifyState中的统计与实测一致
+ *
+ * 运行：make test
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include "mock_rtos.h"
+#include "notify_client.c"
+#include "display_task.c"
+
+/* 推送帧：帧头4字节(起始、命令、长度、校验) + 主题 + 序号 + 负载 */
+#define FRAME_HEADER_SIZE       4
+#define UART_BAUD               115200U
+/* 8x16像素、16位色，21MHz SPI */
+#define LCD_CHAR_NS             (8U * 16U * 16U * 1000U / 21U)
+/* 显示任务的刷新周期 */
+#define REFRESH_INTERVAL_MS     1000U
+#define NOTIFY_COUNT            24
+/* 显示延迟的上限，主机线程调度的抖动留足余量 */
+#define RENDER_LIMIT_MS         (REFRESH_INTERVAL_MS / 10U)
+
+/* 推送行的纵坐标，与display_task.c一致 */
+#define ROW_CONDITION           (LCD_HEIGHT - 54)
+#define ROW_AQI                 (LCD_HEIGHT - 36)
+#define ROW_ALERT               (LCD_HEIGHT - 18)
+
+#define SCREEN_COLUMNS          (LCD_WIDTH / 8)
+
+osThreadId_t displayTaskHandle;
+osMessageQueueId_t weatherQueueHandle;
+osMessageQueueId_t timeQueueHandle;
+UIConfig ui_config = {
+    .current_mode = DISPLAY_MODE_CLOCK,
+    .brightness = 80,
+    .refresh_interval = REFRESH_INTERVAL_MS,
+    .temp_unit = TEMP_UNIT_CELSIUS,
+    .time_format = TIME_FORMAT_24H
+};
+SystemStatus system_status;
+
+/* 字符屏，每个像素行一行，由screen_lock保护 */
+static pthread_mutex_t screen_lock = PTHREAD_MUTEX_INITIALIZER;
+static char screen[LCD_HEIGHT][SCREEN_COLUMNS + 1];
+/* 最近一次画告警行的时间，它是每次刷新画的最后一行 */
+static volatile uint64_t alert_row_ns = 0;
+
+static uint8_t sequence = 0;
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { \
+        printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static void SleepNs(uint64_t ns) {
+    struct timespec ts = {
+        .tv_sec = (time_t)(ns / 1000000000ULL),
+        .tv_nsec = (long)(ns % 1000000000ULL)
+    };
+
+    nanosleep(&ts, NULL);
+}
+
+/* ---------------- LCD和界面替身 ---------------- */
+
+void LCD_Init(void) {
+}
+
+void LCD_Clear(uint16_t color) {
+    (void)color;
+    pthread_mutex_lock(&screen_lock);
+    memset(screen, 0, sizeof(screen));
+    pthread_mutex_unlock(&screen_lock);
+}
+
+void LCD_SetBrightness(uint8_t brightness) {
+    (void)brightness;
+}
+
+void LCD_DrawString(uint16_t x, uint16_t y, const char *str,
+                    uint16_t color, uint16_t background) {
+    size_t length = strlen(str);
+    uint16_t column = x / 8U;
+
+    (void)color;
+    (void)background;
+    SleepNs((uint64_t)length * LCD_CHAR_NS);
+
+    pthread_mutex_lock(&screen_lock);
+    for (size_t i = 0; i < length && column + i < SCREEN_COLUMNS; i++) {
+        screen[y][column + i] = str[i];
+    }
+    pthread_mutex_unlock(&screen_lock);
+
+    if (y == ROW_ALERT) {
+        alert_row_ns = mock_now_ns();
+    }
+}
+
+/* ui_render.c的完整界面，这里只画时间和天气两行 */
+void RenderDisplay(const TimeData *time, const WeatherData *weather,
+                   const UIConfig *config, const SystemStatus *status) {
+    char text[32];
+
+    (void)config;
+    (void)status;
+    snprintf(text, sizeof(text), "%02d:%02d:%02d", time->hours, time->minutes,
+             time->seconds);
+    LCD_DrawString(88, 100, text, COLOR_WHITE, COLOR_BLACK);
+    snprintf(text, sizeof(text), "%s %d.%d", weather->city, weather->temperature / 10,
+             weather->temperature % 10);
+    LCD_DrawString(4, 140, text, COLOR_WHITE, COLOR_BLACK);
+}
+
+void RenderModeChange(DisplayMode mode) {
+    (void)mode;
+}
+
+void FastBoot_SaveTime(const TimeData *time) {
+    (void)time;
+}
+
+/* 取出一行，去掉行尾的空格 */
+static void ReadRow(uint16_t y, char *text) {
+    size_t length;
+
+    pthread_mutex_lock(&screen_lock);
+    memcpy(text, screen[y], SCREEN_COLUMNS + 1);
+    pthread_mutex_unlock(&screen_lock);
+
+    length = strlen(text);
+    while (length > 0 && text[length - 1] == ' ') {
+        text[--length] = '\0';
+    }
+}
+
+static bool RowIs(uint16_t y, const char *expected) {
+    char text[SCREEN_COLUMNS + 1];
+
+    ReadRow(y, text);
+    if (strcmp(text, expected) != 0) {
+        printf("  row %d: \"%s\", expected \"%s\"\n", y, text, expected);
+        return false;
+    }
+    return true;
+}
+
+/* ---------------- 推送 ---------------- */
+
+static void *DisplayThread(void *argument) {
+    (void)argument;
+    displayTaskHandle = mock_thread_attach();
+    DisplayTask(NULL);
+    return NULL;
+}
+
+static void PutInt16(uint8_t *buffer, int16_t value) {
+    buffer[0] = (uint8_t)((uint16_t)value & 0xFF);
+    buffer[1] = (uint8_t)((uint16_t)value >> 8);
+}
+
+/* 发送一条推送并等它显示完，返回显示延迟(ns)，transfer_ns返回传输时间 */
+static uint64_t Deliver(uint8_t topic, const uint8_t *payload, uint8_t length,
+                        uint64_t *transfer_ns) {
+    uint8_t data[2 + 8];
+    uint8_t frame_topic;
+    uint8_t frame_seq;
+    uint64_t handled_ns;
+    NotifyState state;
+
+    data[0] = topic;
+    data[1] = sequence++;
+    memcpy(&data[2], payload, length);
+
+    /* 每字节10位 */
+    *transfer_ns = (uint64_t)(FRAME_HEADER_SIZE + 2 + length) * 10U * 1000000000ULL / UART_BAUD;
+    SleepNs(*transfer_ns);
+
+    handled_ns = mock_now_ns();
+    CHECK(NotifyClient_HandleFrame(data, 2 + length, &frame_topic, &frame_seq));
+    CHECK(frame_topic == topic && frame_seq == data[1]);
+
+    while (NotifyClient_GetState(&state)) {
+        SleepNs(20000);
+    }
+    return alert_row_ns - handled_ns;
+}
+
+static uint64_t SendCondition(uint8_t condition, int16_t temperature_x10, uint8_t humidity,
+                              uint64_t *transfer_ns) {
+    uint8_t payload[4];
+
+    payload[0] = condition;
+    PutInt16(&payload[1], temperature_x10);
+    payload[3] = humidity;
+    return Deliver(NOTIFY_TOPIC_CONDITION, payload, sizeof(payload), transfer_ns);
+}
+
+static uint64_t SendAirQuality(uint8_t aqi, uint16_t pm2_5_x10, uint16_t pm10_x10,
+                               uint64_t *transfer_ns) {
+    uint8_t payload[5];
+
+    payload[0] = aqi;
+    PutInt16(&payload[1], (int16_t)pm2_5_x10);
+    PutInt16(&payload[3], (int16_t)pm10_x10);
+    return Deliver(NOTIFY_TOPIC_AQI, payload, sizeof(payload), transfer_ns);
+}
+
+static uint64_t SendAlert(uint8_t alert_id, bool active, int16_t value_x10,
+                          uint64_t *transfer_ns) {
+    uint8_t payload[4];
+
+    payload[0] = alert_id;
+    payload[1] = active ? 1 : 0;
+    PutInt16(&payload[2], value_x10);
+    return Deliver(NOTIFY_TOPIC_ALERT, payload, sizeof(payload), transfer_ns);
+}
+
+/* ---------------- 测试 ---------------- */
+
+static void TestRendering(void) {
+    uint64_t transfer_ns;
+
+    printf("rendering\n");
+
+    SendCondition(NOTIFY_CONDITION_RAIN, 235, 61, &transfer_ns);
+    CHECK(RowIs(ROW_CONDITION, "RAIN 23.5C 61%"));
+    CHECK(RowIs(ROW_ALERT, ""));
+
+    SendAirQuality(4, 853, 1204, &transfer_ns);
+    CHECK(RowIs(ROW_AQI, "AQI 4 PM2.5 85"));
+
+    SendAlert(ALERT_ID_WIND, true, 112, &transfer_ns);
+    CHECK(RowIs(ROW_ALERT, "WIND"));
+    SendAlert(ALERT_ID_AQI, true, 40, &transfer_ns);
+    CHECK(RowIs(ROW_ALERT, "AIR POOR"));
+
+    /* 解除编号小的告警后显示剩下的，全部解除后清空 */
+    SendAlert(ALERT_ID_AQI, false, 30, &transfer_ns);
+    CHECK(RowIs(ROW_ALERT, "WIND"));
+    SendAlert(ALERT_ID_WIND, false, 95, &transfer_ns);
+    CHECK(RowIs(ROW_ALERT, ""));
+
+    /* 较短的内容盖住较长的内容 */
+    SendCondition(NOTIFY_CONDITION_THUNDERSTORM, -125, 100, &transfer_ns);
+    CHECK(RowIs(ROW_CONDITION, "STORM -12.5C 100%"));
+    SendCondition(NOTIFY_CONDITION_FOG, -5, 9, &transfer_ns);
+    CHECK(RowIs(ROW_CONDITION, "FOG -0.5C 9%"));
+    SendAirQuality(12, 5, 10, &transfer_ns);
+    CHECK(RowIs(ROW_AQI, "AQI 12 PM2.5 0"));
+
+    /* 华氏度，未知编码 */
+    ui_config.temp_unit = TEMP_UNIT_FAHRENHEIT;
+    SendCondition(NOTIFY_CONDITION_CLEAR, 350, 40, &transfer_ns);
+    CHECK(RowIs(ROW_CONDITION, "CLEAR 95.0F 40%"));
+    SendCondition(200, -400, 50, &transfer_ns);
+    CHECK(RowIs(ROW_CONDITION, "UNKNOWN -40.0F 50%"));
+    ui_config.temp_unit = TEMP_UNIT_CELSIUS;
+}
+
+static void TestLatency(void) {
+    uint64_t transfer_ns;
+    uint64_t render_ns;
+    uint64_t render_max_ns = 0;
+    uint64_t render_total_ns = 0;
+    uint64_t end_to_end_max_ns = 0;
+    uint64_t end_to_end_total_ns = 0;
+    NotifyState state;
+
+    printf("latency, %d notifications, refresh every %u ms\n", NOTIFY_COUNT,
+           REFRESH_INTERVAL_MS);
+    srand(1);
+
+    for (int i = 0; i < NOTIFY_COUNT; i++) {
+        /* 到达时刻落在刷新周期中的任意位置 */
+        SleepNs((uint64_t)(rand() % (int)REFRESH_INTERVAL_MS) * 1000000ULL / 4U);
+
+        switch (i % 3) {
+            case 0:
+                render_ns = SendCondition((uint8_t)(i % NOTIFY_CONDITION_COUNT),
+                                          (int16_t)(i * 10), 50, &transfer_ns);
+                break;
+            case 1:
+                render_ns = SendAirQuality((uint8_t)(i % 6), 350, 700, &transfer_ns);
+                break;
+            default:
+                render_ns = SendAlert(ALERT_ID_HEAT, (i % 2) != 0, 360, &transfer_ns);
+                break;
+        }
+
+        render_total_ns += render_ns;
+        if (render_ns > render_max_ns) {
+            render_max_ns = render_ns;
+        }
+        end_to_end_total_ns += transfer_ns + render_ns;
+        if (transfer_ns + render_ns > end_to_end_max_ns) {
+            end_to_end_max_ns = transfer_ns + render_ns;
+        }
+    }
+
+    NotifyClient_GetState(&state);
+    printf("  render      avg %6.2f ms, max %6.2f ms\n",
+           render_total_ns / 1e6 / NOTIFY_COUNT, render_max_ns / 1e6);
+    printf("  end to end  avg %6.2f ms, max %6.2f ms\n",
+           end_to_end_total_ns / 1e6 / NOTIFY_COUNT, end_to_end_max_ns / 1e6);
+    printf("  NotifyState last %lu ms, max %lu ms\n",
+           (unsigned long)state.last_latency_ms, (unsigned long)state.max_latency_ms);
+    printf("  waiting for the next refresh: avg %u ms, max %u ms\n",
+           REFRESH_INTERVAL_MS / 2U, REFRESH_INTERVAL_MS);
+
+    CHECK(render_max_ns < RENDER_LIMIT_MS * 1000000ULL);
+    /* 节拍为1ms，统计值向下取整 */
+    CHECK(state.max_latency_ms <= render_max_ns / 1000000ULL + 1U);
+    CHECK(state.max_latency_ms < RENDER_LIMIT_MS);
+}
+
+int main(void) {
+    WeatherData weather = {235, 61, 3, "Shenzhen"};
+    TimeData time = {7, 42, 5, 18, 10, 2026};
+    pthread_t display_thread;
+
+    EventBus_Init();
+    weatherQueueHandle = osMessageQueueNew(4, sizeof(WeatherData), NULL);
+    timeQueueHandle = osMessageQueueNew(4, sizeof(TimeData), NULL);
+
+    /* 与main.c相同，调度器启动前先显示首帧 */
+    DisplayShowSnapshot(&weather, &time, false);
+    pthread_create(&display_thread, NULL, DisplayThread, NULL);
+    while (displayTaskHandle == NULL) {
+        SleepNs(1000000);
+    }
+
+    TestRendering();
+    TestLatency();
+
+    /* 显示任务不会退出，直接结束进程 */
+    if (failures) {
+        printf("%d check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
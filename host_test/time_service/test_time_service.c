@@ -0,0 +1,245 @@
+/*
+ * time_service的主机测试
+ *
+ * 直接包含time_service.c以检查其内部状态。mock_idf/中的模拟器扮演NTP服务器：
+ * 本地单调时钟按设定的漂移偏离服务器时间，每次应答再叠加随机抖动，SNTP按
+ * time_service设置的间隔轮询并调用同步通知回调。
+ *
+ * 测试里另外模拟STM32的RTC：推送时拿到ESP32当时的时间，之后按
+ * TIME_STM32_RTC_DRIFT_PPM的最坏情况漂移，用它检查STM32显示的时间误差。
+ *
+ * 运行：make test (MOCK_VERBOSE=1 打印time_service的日志)
+ */
+
+#include "mock_idf.h"
+#include "time_service.c"
+
+static int s_failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { \
+        printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } } while (0)
+
+/* 模拟的STM32 RTC */
+static int s_pushes = 0;
+static int64_t s_stm32_set_mono_us = 0;
+static int64_t s_stm32_set_error_us = 0;
+static int64_t s_stm32_max_error_us = 0;
+
+/* NTP服务器时间(不含抖动) */
+static int64_t true_time_us(void) {
+    int64_t mono_us = esp_timer_get_time();
+
+    return MOCK_NTP_EPOCH_S * 1000000LL + mono_us -
+           (int64_t)((double)mono_us * g_mock_env.ntp_drift_ppm / 1e6);
+}
+
+/* ESP32的系统时间：SNTP在每次同步时把它校准到服务器时间 */
+static int64_t esp32_time_us(void) {
+    return s_last_sync_wall_us + esp_timer_get_time() - s_last_sync_mono_us;
+}
+
+/* STM32 RTC当前的误差 */
+static int64_t stm32_error_us(void) {
+    int64_t elapsed_us = esp_timer_get_time() - s_stm32_set_mono_us;
+
+    return s_stm32_set_error_us + elapsed_us * TIME_STM32_RTC_DRIFT_PPM / 1000000LL;
+}
+
+/* 把ESP32的时间写入STM32，与time_sync_task发送后调用time_service_mark_pushed一致 */
+static void stm32_set_time(void) {
+    s_stm32_set_mono_us = esp_timer_get_time();
+    s_stm32_set_error_us = esp32_time_us() - true_time_us();
+    s_pushes++;
+    time_service_mark_pushed();
+}
+
+static void push_callback(void) {
+    stm32_set_time();
+}
+
+/* 包装同步通知，在time_service处理之前记录STM32的误差 */
+static void sync_notification(struct timeval *tv) {
+    int64_t error_us;
+
+    if (s_pushes > 0) {
+        error_us = llabs(stm32_error_us());
+        if (error_us > s_stm32_max_error_us) {
+            s_stm32_max_error_us = error_us;
+        }
+    }
+    time_sync_notification(tv);
+}
+
+/* 重启并启动时间服务，本地时钟漂移drift_ppm */
+static void start(double drift_ppm, uint32_t jitter_us) {
+    mock_reboot();
+    g_mock_env.ntp_drift_ppm = drift_ppm;
+    g_mock_env.ntp_jitter_us = jitter_us;
+    g_mock_env.ntp_response_ms = 200;
+
+    s_push_callback = NULL;
+    s_started = false;
+    s_pushed_once = false;
+    s_last_sync_mono_us = 0;
+    s_last_sync_wall_us = 0;
+    s_push_mono_us = 0;
+    s_push_error_us = 0;
+    s_pushes = 0;
+    s_stm32_set_mono_us = 0;
+    s_stm32_set_error_us = 0;
+    s_stm32_max_error_us = 0;
+
+    time_service_init(push_callback);
+    time_service_start();
+    sntp_set_time_sync_notification_cb(sync_notification);
+}
+
+static time_service_stats_t get_stats(void) {
+    time_service_stats_t stats;
+
+    time_service_get_stats(&stats);
+    return stats;
+}
+
+/* 运行模拟器hours小时 */
+static void run_hours(uint32_t hours) {
+    mock_run_until(mock_now_ms() + hours * 3600U * 1000U);
+}
+
+/* 第一次同步：立即推送，间隔从最小值开始 */
+static void test_first_sync(void) {
+    time_service_stats_t stats;
+
+    printf("first sync\n");
+    start(0.0, 0);
+    CHECK(!time_service_is_synced());
+
+    mock_run_until(g_mock_env.ntp_response_ms);
+    stats = get_stats();
+    CHECK(time_service_is_synced());
+    CHECK(stats.sync_count == 1);
+    CHECK(stats.last_offset_us == 0);
+    CHECK(s_pushes == 1);
+    CHECK(mock_sntp_interval_ms() == TIME_SYNC_INTERVAL_MIN * 1000U);
+
+    /* WiFi重连后立即重新同步 */
+    mock_run_until(mock_now_ms() + 60000);
+    time_service_start();
+    mock_run_until(mock_now_ms() + g_mock_env.ntp_response_ms);
+    CHECK(get_stats().sync_count == 2);
+    CHECK(g_mock_stats.sntp_syncs == 2);
+    CHECK(g_mock_stats.critical_violations == 0);
+}
+
+/* 本地时钟快40ppm：漂移估计收敛，间隔稳定在偏差落在(1/4,1/2]阈值之间的档位 */
+static void test_drift_convergence(void) {
+    time_service_stats_t stats;
+
+    printf("drift convergence, +40 ppm\n");
+    start(40.0, 2000);
+    run_hours(48);
+
+    stats = get_stats();
+    printf("  drift %.2f ppm, interval %lu s, offset %lld us, %d syncs, %d pushes\n",
+           stats.drift_ppm, (unsigned long)stats.interval_s, (long long)stats.last_offset_us,
+           g_mock_stats.sntp_syncs, s_pushes);
+    CHECK(stats.drift_ppm > 37.0f && stats.drift_ppm < 43.0f);
+    /* 3600s的偏差144ms，加倍后超过250ms会减半 */
+    CHECK(stats.interval_s == 3600);
+    CHECK(mock_sntp_interval_ms() <= 3600U * 1000U);
+    CHECK(llabs(stats.last_offset_us) < TIME_PUSH_THRESHOLD_MS * 1000LL / 2);
+    CHECK(s_stm32_max_error_us <= TIME_PUSH_THRESHOLD_MS * 1000LL + 5000);
+    CHECK(g_mock_stats.critical_violations == 0);
+}
+
+/* 本地时钟快300ppm：每15分钟校正270ms，但STM32的RTC没有变差，不应因此推送 */
+static void test_fast_esp32_clock(void) {
+    time_service_stats_t stats;
+    uint32_t deadline_s = TIME_PUSH_THRESHOLD_MS * 1000U / TIME_STM32_RTC_DRIFT_PPM;
+
+    printf("fast ESP32 clock, +300 ppm\n");
+    start(300.0, 2000);
+
+    /* STM32的误差到达阈值之前只有第一次推送 */
+    mock_run_until((deadline_s - TIME_SYNC_INTERVAL_MIN) * 1000U);
+    stats = get_stats();
+    CHECK(stats.interval_s == TIME_SYNC_INTERVAL_MIN);
+    CHECK(llabs(stats.last_offset_us - 270000) < 5000);
+    CHECK(s_pushes == 1);
+
+    run_hours(24);
+    stats = get_stats();
+    printf("  drift %.2f ppm, %d syncs, %d pushes in %lu h\n", stats.drift_ppm,
+           g_mock_stats.sntp_syncs, s_pushes, (unsigned long)(mock_now_ms() / 3600000U));
+    CHECK(stats.drift_ppm > 297.0f && stats.drift_ppm < 303.0f);
+    CHECK(s_pushes >= 4 && s_pushes <= 6);
+    CHECK(s_stm32_max_error_us <= TIME_PUSH_THRESHOLD_MS * 1000LL + 5000);
+}
+
+/* 本地时钟很准：间隔一直加倍，但在STM32的误差到达阈值前就要同步一次 */
+static void test_stable_clock(void) {
+    time_service_stats_t stats;
+    uint32_t max_interval_s = 0;
+    uint32_t deadline_s = TIME_PUSH_THRESHOLD_MS * 1000U / TIME_STM32_RTC_DRIFT_PPM;
+
+    printf("stable ESP32 clock, +2 ppm\n");
+    start(2.0, 2000);
+
+    for (int hour = 0; hour < 72; hour++) {
+        run_hours(1);
+        if (mock_sntp_interval_ms() / 1000U > max_interval_s) {
+            max_interval_s = mock_sntp_interval_ms() / 1000U;
+        }
+    }
+
+    stats = get_stats();
+    printf("  max interval %lu s, %d syncs, %d pushes, max STM32 error %lld us\n",
+           (unsigned long)max_interval_s, g_mock_stats.sntp_syncs, s_pushes,
+           (long long)s_stm32_max_error_us);
+    /* 自适应间隔加倍到上限，实际轮询间隔受STM32的推送期限约束 */
+    CHECK(stats.interval_s == TIME_SYNC_INTERVAL_MAX);
+    CHECK(max_interval_s > 4 * TIME_SYNC_INTERVAL_MIN);
+    CHECK(max_interval_s <= deadline_s);
+    CHECK(s_pushes >= 72 * 3600 / (int)deadline_s);
+    CHECK(s_stm32_max_error_us <= TIME_PUSH_THRESHOLD_MS * 1000LL + 5000);
+    CHECK(stats.stm32_error_us <= TIME_PUSH_THRESHOLD_MS * 1000LL);
+}
+
+/* 两次同步之间应答STM32的时间请求：推送时ESP32的误差也算进STM32的误差 */
+static void test_push_between_syncs(void) {
+    time_service_stats_t stats;
+    int64_t expected_us;
+
+    printf("push between syncs\n");
+    start(300.0, 0);
+    mock_run_until(g_mock_env.ntp_response_ms);
+    CHECK(s_pushes == 1);
+
+    /* 同步后450s，ESP32已快了135ms */
+    mock_run_until(mock_now_ms() + 450000);
+    stm32_set_time();
+    expected_us = s_stm32_set_error_us;
+    CHECK(llabs(expected_us - 135000) < 1000);
+
+    mock_run_until(g_mock_env.ntp_response_ms + TIME_SYNC_INTERVAL_MIN * 1000U);
+    stats = get_stats();
+    CHECK(stats.sync_count == 2);
+    CHECK(llabs(stats.stm32_error_us - llabs(stm32_error_us())) < 1000);
+    CHECK(llabs(stats.stm32_error_us - (expected_us + 450 * TIME_STM32_RTC_DRIFT_PPM)) < 1000);
+    CHECK(s_pushes == 2);
+}
+
+int main(void) {
+    test_first_sync();
+    test_drift_convergence();
+    test_fast_esp32_clock();
+    test_stable_clock();
+    test_push_between_syncs();
+
+    if (s_failures != 0) {
+        printf("%d check(s) FAILED\n", s_failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,389 @@
+/*
+ * wifi_manager重连状态机的主机测试
+ *
+ * 直接包含wifi_manager.c以检查其内部状态，ESP-IDF和FreeRTOS由mock_idf/中的
+ * 模拟器替代，时间是模拟的，测量的是模拟的从开始连接到获得IP的耗时。
+ *
+ * 运行：make test (MOCK_VERBOSE=1 打印wifi_manager的日志)
+ */
+
+#include "mock_idf.h"
+#include "wifi_manager.c"
+
+static int s_failures = 0;
+static int s_callback_true = 0;
+static int s_callback_false = 0;
+static uint32_t s_callback_ip = 0;
+
+#define CHECK(cond) do { if (!(cond)) { \
+        printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } } while (0)
+
+static const uint8_t k_bssid_a[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, 0x01};
+static const uint8_t k_bssid_b[6] = {0x24, 0x0a, 0xc4, 0x00, 0x00, 0x02};
+
+static void test_callback(bool connected) {
+    if (connected) {
+        /* 通知连接时接口必须已有地址 */
+        s_callback_ip = mock_netif_ip();
+        s_callback_true++;
+    } else {
+        s_callback_false++;
+    }
+}
+
+/* 设置模拟的AP */
+static void set_ap(bool present, const uint8_t *bssid, uint8_t channel) {
+    g_mock_env.ap_present = present;
+    memcpy(g_mock_env.ap_bssid, bssid, 6);
+    g_mock_env.ap_channel = channel;
+    g_mock_env.ap_rssi = -55;
+    g_mock_env.dhcp_ip = 0x6401A8C0U;       /* 192.168.1.100 */
+    g_mock_env.assoc_ms = 150;
+    g_mock_env.connect_fail_ms = 300;
+    g_mock_env.dhcp_ms = 600;
+    g_mock_env.scan_ms = 1100;
+    g_mock_env.reset_reason = ESP_RST_SW;
+}
+
+/* 模拟重启：清空模拟器和wifi_manager的静态状态(NVS保留)，然后初始化 */
+static void boot(void) {
+    mock_reboot();
+    s_retry_num = 0;
+    s_sta_netif = NULL;
+    s_reconnect_state = WIFI_RECONNECT_IDLE;
+    memset(&s_ap_cache, 0, sizeof(s_ap_cache));
+    s_ap_cache_valid = false;
+    s_static_ip_applied = false;
+    s_connect_start_tick = 0;
+    s_last_connect_ms = 0;
+    s_callback_true = 0;
+    s_callback_false = 0;
+    s_callback_ip = 0;
+
+    wifi_init();
+    set_wifi_connected_callback(test_callback);
+}
+
+/* 首次启动：没有缓存，扫描后连接，保存AP和租约 */
+static uint32_t test_cold_boot(void) {
+    wifi_ap_cache_t cache;
+
+    printf("cold boot\n");
+    mock_nvs_erase();
+    set_ap(true, k_bssid_a, 6);
+    boot();
+    mock_run_until(10000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.scans == 1);
+    CHECK(g_mock_stats.directed_connects == 1);     /* 扫描后也指定BSSID和信道 */
+    CHECK(g_mock_stats.static_ip_sets == 0);
+    CHECK(mock_dhcp_running());
+    CHECK(s_callback_true == 1);
+    CHECK(mock_nvs_read(WIFI_NVS_KEY_AP, &cache, sizeof(cache)) == sizeof(cache));
+    CHECK(cache.magic == WIFI_CACHE_MAGIC);
+    CHECK(memcmp(cache.bssid, k_bssid_a, 6) == 0);
+    CHECK(cache.channel == 6);
+    CHECK(cache.ip == g_mock_env.dhcp_ip);
+    CHECK(cache.lease_expire > (uint32_t)time(NULL) - 10 + WIFI_LEASE_ASSUMED_S);
+    CHECK(cache.lease_expire <= (uint32_t)time(NULL) + WIFI_LEASE_ASSUMED_S);
+    CHECK(s_callback_ip == g_mock_env.dhcp_ip);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    printf("  time to IP: %lu ms\n", (unsigned long)wifi_get_last_connect_time_ms());
+    return wifi_get_last_connect_time_ms();
+}
+
+/* 运行到缓存租约的续租定时器触发，检查续租期间地址被清除 */
+static void run_lease_renewal(void) {
+    uint32_t renew_ms;
+
+    CHECK(mock_run_next_timer());
+    renew_ms = mock_now_ms();
+    mock_run_until(renew_ms);
+    CHECK(mock_dhcp_running());
+    CHECK(mock_netif_ip() == 0);
+
+    mock_run_until(renew_ms + 10000);
+}
+
+/* 再次启动：直连缓存的AP，沿用租约，快到期时才在后台续租 */
+static uint32_t test_warm_boot(void) {
+    wifi_ap_cache_t cache;
+    uint32_t connect_ms;
+
+    printf("warm boot, cached AP\n");
+    set_ap(true, k_bssid_a, 6);
+    boot();
+    mock_run_until(10000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.scans == 0);
+    CHECK(g_mock_stats.connects == 1);
+    CHECK(g_mock_stats.static_ip_sets == 1);
+    /* 连接后继续使用缓存的地址，不重启DHCP */
+    CHECK(g_mock_stats.dhcp_starts == 0);
+    CHECK(!mock_dhcp_running());
+    CHECK(s_static_ip_applied);
+    CHECK(mock_netif_ip() == g_mock_env.dhcp_ip);
+    CHECK(s_callback_true == 1);
+    CHECK(s_callback_ip == g_mock_env.dhcp_ip);
+    CHECK(g_mock_stats.nvs_writes == 0);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+    connect_ms = wifi_get_last_connect_time_ms();
+
+    /* 租约到期前WIFI_LEASE_RENEW_MARGIN_S秒续租，不重复通知 */
+    CHECK(mock_nvs_read(WIFI_NVS_KEY_AP, &cache, sizeof(cache)) == sizeof(cache));
+    run_lease_renewal();
+    CHECK((uint32_t)time(NULL) - 10 + WIFI_LEASE_RENEW_MARGIN_S <= cache.lease_expire);
+    CHECK(g_mock_stats.dhcp_starts == 1);
+    CHECK(!s_static_ip_applied);
+    CHECK(mock_netif_ip() == g_mock_env.dhcp_ip);
+    CHECK(s_callback_true == 1);
+    CHECK(s_callback_false == 0);
+    CHECK(mock_nvs_read(WIFI_NVS_KEY_AP, &cache, sizeof(cache)) == sizeof(cache));
+    CHECK(cache.lease_expire > (uint32_t)time(NULL) + WIFI_LEASE_ASSUMED_S - 20);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    printf("  time to IP: %lu ms\n", (unsigned long)connect_ms);
+    return connect_ms;
+}
+
+/* DHCP服务器换了地址：后台续租后更新缓存 */
+static void test_lease_changed(void) {
+    wifi_ap_cache_t cache;
+
+    printf("warm boot, lease changed\n");
+    set_ap(true, k_bssid_a, 6);
+    g_mock_env.dhcp_ip = 0x6501A8C0U;   /* 192.168.1.101 */
+    boot();
+    mock_run_until(10000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(mock_netif_ip() == 0x6401A8C0U);
+    CHECK(s_callback_ip == 0x6401A8C0U);
+
+    run_lease_renewal();
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(mock_dhcp_running());
+    CHECK(mock_netif_ip() == 0x6501A8C0U);
+    CHECK(s_callback_true == 1);
+    CHECK(mock_nvs_read(WIFI_NVS_KEY_AP, &cache, sizeof(cache)) == sizeof(cache));
+    CHECK(cache.ip == 0x6501A8C0U);
+}
+
+/* 掉电后系统时间从0开始，不知道租约是否有效：直连但走DHCP */
+static void test_power_on(void) {
+    printf("power-on boot, cached AP\n");
+    set_ap(true, k_bssid_a, 6);
+    g_mock_env.reset_reason = ESP_RST_POWERON;
+    boot();
+    mock_run_until(10000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.scans == 0);
+    CHECK(g_mock_stats.directed_connects == 1);
+    CHECK(g_mock_stats.static_ip_sets == 0);
+    CHECK(mock_dhcp_running());
+    CHECK(s_callback_ip == g_mock_env.dhcp_ip);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    printf("  time to IP: %lu ms\n", (unsigned long)wifi_get_last_connect_time_ms());
+}
+
+/* 软件复位时缓存的租约已快到期：直连但走DHCP */
+static void test_lease_expired(void) {
+    printf("warm boot, cached lease expired\n");
+    set_ap(true, k_bssid_a, 6);
+    g_mock_env.reset_reason = ESP_RST_POWERON;
+    boot();
+    mock_run_until(10000);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(mock_dhcp_running());
+
+    /* 运行到离租约到期不足WIFI_LEASE_RENEW_MARGIN_S时软件复位 */
+    mock_run_until((WIFI_LEASE_ASSUMED_S - WIFI_LEASE_RENEW_MARGIN_S + 60) * 1000U);
+    g_mock_env.reset_reason = ESP_RST_SW;
+    boot();
+    mock_run_until(10000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.directed_connects == 1);
+    CHECK(g_mock_stats.static_ip_sets == 0);
+    CHECK(mock_dhcp_running());
+    CHECK(s_callback_ip == g_mock_env.dhcp_ip);
+    CHECK(g_mock_stats.nvs_writes == 1);
+}
+
+/* 缓存的AP不在了：直连失败，恢复DHCP，扫描到新的AP */
+static void test_cached_ap_gone(void) {
+    wifi_ap_cache_t cache;
+
+    printf("warm boot, cached AP gone\n");
+    set_ap(true, k_bssid_b, 11);
+    boot();
+    mock_run_until(10000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.scans == 1);
+    CHECK(g_mock_stats.connects == 2);
+    CHECK(mock_dhcp_running());
+    CHECK(s_callback_true == 1);
+    CHECK(mock_nvs_read(WIFI_NVS_KEY_AP, &cache, sizeof(cache)) == sizeof(cache));
+    CHECK(memcmp(cache.bssid, k_bssid_b, 6) == 0);
+    CHECK(cache.channel == 11);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    printf("  time to IP: %lu ms\n", (unsigned long)wifi_get_last_connect_time_ms());
+}
+
+/* 没有AP：指数退避，定时器任务只投递事件，由事件循环重新扫描 */
+static void test_backoff(void) {
+    static const uint32_t k_expected_delay[] = {250, 500, 1000, 2000};
+    uint32_t scan_done;
+
+    printf("no AP, exponential backoff\n");
+    mock_nvs_erase();
+    set_ap(false, k_bssid_a, 6);
+    boot();
+
+    /* 第一次扫描失败后进入退避 */
+    mock_run_until(g_mock_env.scan_ms);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_BACKOFF);
+    CHECK(g_mock_stats.scans == 1);
+
+    /* 定时器回调不修改状态，也不调用WiFi接口 */
+    CHECK(mock_run_next_timer());
+    CHECK(s_reconnect_state == WIFI_RECONNECT_BACKOFF);
+    CHECK(g_mock_stats.scans == 1);
+    CHECK(mock_pending_events() == 1);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    /* 事件循环处理后重新扫描 */
+    mock_run_until(mock_now_ms());
+    CHECK(s_reconnect_state == WIFI_RECONNECT_SCANNING);
+    CHECK(g_mock_stats.scans == 2);
+
+    mock_run_until(20000);
+    CHECK(g_mock_stats.scans >= 5);
+    for (int i = 0; i < 4; i++) {
+        scan_done = g_mock_stats.scan_start_ms[i] + g_mock_env.scan_ms;
+        CHECK(g_mock_stats.scan_start_ms[i + 1] - scan_done == k_expected_delay[i]);
+    }
+    CHECK(mock_dhcp_running());
+    CHECK(s_callback_true == 0);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    /* 扫描不到AP也计入重试次数，达到上限时通知等待者 */
+    CHECK(!wifi_wait_for_connection(0));
+    CHECK(xEventGroupWaitBits(s_wifi_event_group, WIFI_FAIL_BIT, pdFALSE, pdFALSE, 0) &
+          WIFI_FAIL_BIT);
+    CHECK(s_callback_false == 1);
+
+    /* AP出现后下一次扫描连上 */
+    set_ap(true, k_bssid_a, 6);
+    mock_run_until(60000);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(s_callback_true == 1);
+    CHECK(mock_dhcp_running());
+    CHECK(!(xEventGroupWaitBits(s_wifi_event_group, WIFI_FAIL_BIT, pdFALSE, pdFALSE, 0) &
+            WIFI_FAIL_BIT));
+    CHECK(g_mock_stats.timer_task_violations == 0);
+}
+
+/* 连接丢失：直连重连，继续沿用缓存的租约 */
+static void test_link_loss(void) {
+    int scans;
+
+    printf("link loss\n");
+    set_ap(true, k_bssid_a, 6);
+    boot();
+    mock_run_until(10000);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    scans = g_mock_stats.scans;
+
+    mock_drop_link();
+    mock_run_until(20000);
+
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.scans == scans);
+    CHECK(s_callback_false == 1);
+    CHECK(s_callback_true == 2);
+    CHECK(!mock_dhcp_running());
+    CHECK(s_static_ip_applied);
+    CHECK(s_callback_ip == g_mock_env.dhcp_ip);
+    CHECK(g_mock_stats.timer_task_violations == 0);
+
+    printf("  time to IP: %lu ms\n", (unsigned long)wifi_get_last_connect_time_ms());
+}
+
+/* 应用任务请求重连：只投递事件，由事件循环修改状态 */
+static void test_reconnect_request(void) {
+    printf("reconnect request during backoff\n");
+    mock_nvs_erase();
+    set_ap(false, k_bssid_a, 6);
+    boot();
+    mock_run_until(g_mock_env.scan_ms);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_BACKOFF);
+
+    /* 没有缓存时直连退回扫描 */
+    set_ap(true, k_bssid_a, 6);
+    wifi_reconnect();
+    CHECK(s_reconnect_state == WIFI_RECONNECT_BACKOFF);
+    CHECK(mock_pending_events() == 1);
+
+    mock_run_until(mock_now_ms());
+    CHECK(s_reconnect_state == WIFI_RECONNECT_SCANNING);
+    CHECK(g_mock_stats.scans == 2);
+
+    /* 已停止的退避定时器不会再触发扫描 */
+    mock_run_until(60000);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_CONNECTED);
+    CHECK(g_mock_stats.scans == 2);
+    CHECK(mock_dhcp_running());
+}
+
+/* 主动断开：不再重连，DHCP不会停留在停止状态 */
+static void test_disconnect_during_directed(void) {
+    printf("disconnect during directed connect\n");
+    set_ap(false, k_bssid_a, 6);
+    boot();
+    mock_run_until(10);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_DIRECTED);
+    CHECK(!mock_dhcp_running());
+
+    wifi_disconnect();
+    mock_run_until(10000);
+    CHECK(s_reconnect_state == WIFI_RECONNECT_IDLE);
+    CHECK(mock_dhcp_running());
+    CHECK(g_mock_stats.scans == 0);
+}
+
+int main(void) {
+    uint32_t cold_ms, warm_ms;
+
+    cold_ms = test_cold_boot();
+    warm_ms = test_warm_boot();
+    CHECK(warm_ms * 4 < cold_ms);
+
+    test_lease_changed();
+    test_power_on();
+    test_lease_expired();
+    test_cached_ap_gone();
+    test_link_loss();
+    test_backoff();
+    test_reconnect_request();
+
+    /* 先建立缓存 */
+    set_ap(true, k_bssid_a, 6);
+    boot();
+    mock_run_until(10000);
+    test_disconnect_during_directed();
+
+    if (s_failures != 0) {
+        printf("%d check(s) FAILED\n", s_failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}